@@ -42,6 +42,7 @@ clang++ \
   -I "${MSFS_SDK}/SimConnect SDK/include" \
   -I "${COMMON_DIR}/fadec_common/src" \
   -I "${COMMON_DIR}/fbw_common/src/inih" \
+  -I "${COMMON_DIR}/fbw_common/src/model" \
   -I "${DIR}/common" \
   "${DIR}/src/FadecGauge.cpp" \
   "${DIR}/src/Arinc429.cpp" \
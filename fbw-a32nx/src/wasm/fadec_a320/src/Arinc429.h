@@ -1 +1 @@
-#include "../../fbw_a320/src/Arinc429.h"
+#include "../../../../../fbw-common/src/wasm/fbw_common/src/Arinc429.h"
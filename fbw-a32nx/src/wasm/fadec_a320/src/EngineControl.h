@@ -2,6 +2,7 @@
 
 #include <string>
 #include "Arinc429Utils.h"
+#include "FuelSystem.h"
 #include "RegPolynomials.h"
 #include "SimVars.h"
 #include "Tables.h"
@@ -32,11 +33,11 @@ struct Configuration {
 class EngineControl {
  private:
   SimVars* simVars;
-  EngineRatios* ratios;
   Polynomial* poly;
-  Timer timerLeft;
-  Timer timerRight;
-  Timer timerFuel;
+  ThrustLimits thrustLimits;
+  FuelSystemState fuelState;
+  /// Sim time since the fuel quantities were last saved (in seconds)
+  double fuelSaveTimer = 0;
 
   std::string confFilename = FILENAME_FADEC_CONF_DIRECTORY;
 
@@ -65,14 +66,11 @@ class EngineControl {
   double simN1;
   double simN2;
   double thrust;
-  double simN2LeftPre;
-  double simN2RightPre;
+  double simN2Pre[2];
   double deltaN2;
-  double thermalEnergy1;
-  double thermalEnergy2;
+  double thermalEnergy[2];
   double oilTemperature;
-  double oilTemperatureLeftPre;
-  double oilTemperatureRightPre;
+  double oilTemperaturePre[2];
   double oilTemperatureMax;
   double idleN1;
   double idleN2;
@@ -87,12 +85,11 @@ class EngineControl {
   double imbalance;
   int engineImbalanced;
   double paramImbalance;
+  AmbientRatios ambientRatios;
   double prevEngineMasterPos[2] = {0, 0};
   bool prevEngineStarterState[2] = {false, false};
 
   const double LBS_TO_KGS = 0.4535934;
-  const double KGS_TO_LBS = 1 / 0.4535934;
-  const double FUEL_THRESHOLD = 661;  // lbs/sec
 
   bool isFlexActive = false;
   double prevThrustLimitType = 0;
@@ -113,11 +110,11 @@ class EngineControl {
     double idleCFF;
 
     idleCN1 = iCN1(pressAltitude, mach, ambientTemp);
-    idleN1 = idleCN1 * sqrt(ratios->theta2(0, ambientTemp));
-    idleN2 = iCN2(pressAltitude, mach) * sqrt(ratios->theta(ambientTemp));
-    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                                               // lbs/hr
-    idleFF = idleCFF * LBS_TO_KGS * ratios->delta2(0, ambientPressure) * sqrt(ratios->theta2(0, ambientTemp));  // Kg/hr
-    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ratios->theta2(0, ambientTemp);
+    idleN1 = idleCN1 * ambientRatios.sqrtTheta;
+    idleN2 = iCN2(pressAltitude, mach) * ambientRatios.sqrtTheta;
+    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                   // lbs/hr
+    idleFF = idleCFF * LBS_TO_KGS * ambientRatios.delta * ambientRatios.sqrtTheta;  // Kg/hr
+    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ambientRatios.theta;
 
     simVars->setEngineIdleN1(idleN1);
     simVars->setEngineIdleN2(idleN2);
@@ -197,18 +194,10 @@ class EngineControl {
                           double ambientTemp,
                           double deltaTimeDiff) {
     int resetTimer = 0;
-    double egtFbw = 0;
-
-    switch (engine) {
-      case 1:
-        engineState = simVars->getEngine1State();
-        egtFbw = simVars->getEngine1EGT();
-        break;
-      case 2:
-        engineState = simVars->getEngine2State();
-        egtFbw = simVars->getEngine2EGT();
-        break;
-    }
+    double egtFbw = simVars->getEngineEGT(engine);
+
+    engineState = simVars->getEngineState(engine);
+
     // Present State PAUSED
     if (deltaTimeDiff == 0 && engineState < 10) {
       engineState = engineState + 10;
@@ -277,19 +266,9 @@ class EngineControl {
       }
     }
 
-    switch (engine) {
-      case 1:
-        simVars->setEngine1State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine1Timer(0);
-        }
-        break;
-      case 2:
-        simVars->setEngine2State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine2Timer(0);
-        }
-        break;
+    simVars->setEngineState(engine, engineState);
+    if (resetTimer == 1) {
+      simVars->setEngineTimer(engine, 0);
     }
   }
 
@@ -304,8 +283,6 @@ class EngineControl {
                             double simN2,
                             double pressAltitude,
                             double ambientTemp) {
-    double startCN2Left;
-    double startCN2Right;
     double preN2Fbw;
     double newN2Fbw;
     double preEgtFbw;
@@ -330,74 +307,38 @@ class EngineControl {
       n2Imbalance = imbalanceExtractor(imbalance, 4) / 100;
     }
 
-    if (engine == 1) {
-      // Delay between Engine Master ON and Start Valve Open
-
-      if (simOnGround == 1) {
-        simVars->setFuelUsedLeft(0);
-      }
-
-      preN2Fbw = simVars->getEngine1N2();
-      preEgtFbw = simVars->getEngine1EGT();
-      newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2 - n2Imbalance);
-      startEgtFbw = poly->startEGT(newN2Fbw, idleN2 - n2Imbalance, ambientTemp, idleEGT - egtImbalance);
-      shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-      simVars->setEngine1N2(newN2Fbw);
-      simVars->setEngine1N1(poly->startN1(newN2Fbw, idleN2 - n2Imbalance, idleN1));
-      simVars->setEngine1FF(poly->startFF(newN2Fbw, idleN2 - n2Imbalance, idleFF - ffImbalance));
-
-      if (engineState == 3) {
-        if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-          simVars->setEngine1EGT(startEgtFbw);
-          simVars->setEngine1State(2);
-        } else if (startEgtFbw > preEgtFbw) {
-          simVars->setEngine1EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-        } else {
-          simVars->setEngine1EGT(shutdownEgtFbw);
-        }
-      } else {
-        simVars->setEngine1EGT(startEgtFbw);
-      }
+    // Delay between Engine Master ON and Start Valve Open
+    if (simOnGround == 1) {
+      simVars->setFuelUsed(engine, 0);
+    }
 
-      oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-      oilTemperatureLeftPre = oilTemperature;
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
+    preN2Fbw = simVars->getEngineN2(engine);
+    preEgtFbw = simVars->getEngineEGT(engine);
+    newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2 - n2Imbalance);
+    startEgtFbw = poly->startEGT(newN2Fbw, idleN2 - n2Imbalance, ambientTemp, idleEGT - egtImbalance);
+    shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
 
-    } else {
-      if (simOnGround == 1) {
-        simVars->setFuelUsedRight(0);
-      }
+    simVars->setEngineN2(engine, newN2Fbw);
+    simVars->setEngineN1(engine, poly->startN1(newN2Fbw, idleN2 - n2Imbalance, idleN1));
+    simVars->setEngineFF(engine, poly->startFF(newN2Fbw, idleN2 - n2Imbalance, idleFF - ffImbalance));
 
-      preN2Fbw = simVars->getEngine2N2();
-      preEgtFbw = simVars->getEngine2EGT();
-      newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2 - n2Imbalance);
-      startEgtFbw = poly->startEGT(newN2Fbw, idleN2 - n2Imbalance, ambientTemp, idleEGT - egtImbalance);
-      shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-      simVars->setEngine2N2(newN2Fbw);
-      simVars->setEngine2N1(poly->startN1(newN2Fbw, idleN2 - n2Imbalance, idleN1));
-      simVars->setEngine2FF(poly->startFF(newN2Fbw, idleN2 - n2Imbalance, idleFF - ffImbalance));
-
-      if (engineState == 3) {
-        if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-          simVars->setEngine2EGT(startEgtFbw);
-          simVars->setEngine2State(2);
-        } else if (startEgtFbw > preEgtFbw) {
-          simVars->setEngine2EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-        } else {
-          simVars->setEngine2EGT(shutdownEgtFbw);
-        }
+    if (engineState == 3) {
+      if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
+        simVars->setEngineEGT(engine, startEgtFbw);
+        simVars->setEngineState(engine, 2);
+      } else if (startEgtFbw > preEgtFbw) {
+        simVars->setEngineEGT(engine, preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
       } else {
-        simVars->setEngine2EGT(startEgtFbw);
+        simVars->setEngineEGT(engine, shutdownEgtFbw);
       }
-
-      oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-      oilTemperatureRightPre = oilTemperature;
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
+    } else {
+      simVars->setEngineEGT(engine, startEgtFbw);
     }
+
+    oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
+    oilTemperaturePre[engine - 1] = oilTemperature;
+    SimConnect_SetDataOnSimObject(hSimConnect, OilTempDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                  &oilTemperature);
   }
 
   /// <summary>
@@ -411,41 +352,21 @@ class EngineControl {
     double newN2Fbw;
     double newEgtFbw;
 
-    if (engine == 1) {
-      if (timer < 1.8) {
-        simVars->setEngine1Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine1N1();
-        preN2Fbw = simVars->getEngine1N2();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine1N1(newN1Fbw);
-        simVars->setEngine1N2(newN2Fbw);
-        simVars->setEngine1EGT(newEgtFbw);
-      }
-
+    if (timer < 1.8) {
+      simVars->setEngineTimer(engine, timer + deltaTime);
     } else {
-      if (timer < 1.8) {
-        simVars->setEngine2Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine2N1();
-        preN2Fbw = simVars->getEngine2N2();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine2N1(newN1Fbw);
-        simVars->setEngine2N2(newN2Fbw);
-        simVars->setEngine2EGT(newEgtFbw);
+      preN1Fbw = simVars->getEngineN1(engine);
+      preN2Fbw = simVars->getEngineN2(engine);
+      preEgtFbw = simVars->getEngineEGT(engine);
+      newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
+      if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
+        newN1Fbw = simN1;
       }
+      newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
+      newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
+      simVars->setEngineN1(engine, newN1Fbw);
+      simVars->setEngineN2(engine, newN2Fbw);
+      simVars->setEngineEGT(engine, newEgtFbw);
     }
   }
   /// <summary>
@@ -462,13 +383,8 @@ class EngineControl {
       paramImbalance = 0;
     }
 
-    if (engine == 1) {
-      simVars->setEngine1N1(simN1);
-      simVars->setEngine1N2(max(0, simN2 - paramImbalance));
-    } else {
-      simVars->setEngine2N1(simN1);
-      simVars->setEngine2N2(max(0, simN2 - paramImbalance));
-    }
+    simVars->setEngineN1(engine, simN1);
+    simVars->setEngineN2(engine, max(0, simN2 - paramImbalance));
   }
 
   /// <summary>
@@ -485,10 +401,8 @@ class EngineControl {
                  double mach,
                  double pressAltitude,
                  double ambientTemp) {
-    double egtFbwPreviousEng1;
-    double egtFbwActualEng1;
-    double egtFbwPreviousEng2;
-    double egtFbwActualEng2;
+    double egtFbwPrevious;
+    double egtFbwActual;
 
     // Engine imbalance timer
     engineImbalanced = imbalanceExtractor(imbalance, 1);
@@ -501,24 +415,13 @@ class EngineControl {
       paramImbalance = 0;
     }
 
-    if (engine == 1) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine1EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng1 = simVars->getEngine1EGT();
-        egtFbwActualEng1 = (correctedEGT * ratios->theta2(mach, ambientTemp)) - paramImbalance;
-        egtFbwActualEng1 = egtFbwActualEng1 + (egtFbwPreviousEng1 - egtFbwActualEng1) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine1EGT(egtFbwActualEng1);
-      }
+    if (simOnGround == 1 && engineState == 0) {
+      simVars->setEngineEGT(engine, ambientTemp);
     } else {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine2EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng2 = simVars->getEngine2EGT();
-        egtFbwActualEng2 = (correctedEGT * ratios->theta2(mach, ambientTemp)) - paramImbalance;
-        egtFbwActualEng2 = egtFbwActualEng2 + (egtFbwPreviousEng2 - egtFbwActualEng2) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine2EGT(egtFbwActualEng2);
-      }
+      egtFbwPrevious = simVars->getEngineEGT(engine);
+      egtFbwActual = (correctedEGT * ambientRatios.theta2) - paramImbalance;
+      egtFbwActual = egtFbwActual + (egtFbwPrevious - egtFbwActual) * expFBW(-0.1 * deltaTime);
+      simVars->setEngineEGT(engine, egtFbwActual);
     }
   }
 
@@ -526,8 +429,7 @@ class EngineControl {
   /// FBW Fuel FLow (in Kg/h)
   /// Updates Fuel Flow with realistic values
   /// </summary>
-  double
-  updateFF(int engine, double imbalance, double simCN1, double mach, double pressAltitude, double ambientTemp, double ambientPressure) {
+  double updateFF(int engine, double imbalance, double simCN1, double mach, double pressAltitude) {
     double outFlow = 0;
 
     // Engine imbalance
@@ -545,15 +447,10 @@ class EngineControl {
     if (correctedFuelFlow < 1) {
       outFlow = 0;
     } else {
-      outFlow = max(0, (correctedFuelFlow * LBS_TO_KGS * ratios->delta2(mach, ambientPressure) * sqrt(ratios->theta2(mach, ambientTemp))) -
-                           paramImbalance);
+      outFlow = max(0, (correctedFuelFlow * LBS_TO_KGS * ambientRatios.delta2 * ambientRatios.sqrtTheta2) - paramImbalance);
     }
 
-    if (engine == 1) {
-      simVars->setEngine1FF(outFlow);
-    } else {
-      simVars->setEngine2FF(outFlow);
-    }
+    simVars->setEngineFF(engine, outFlow);
 
     return correctedFuelFlow;
   }
@@ -564,8 +461,8 @@ class EngineControl {
   /// </summary>
   void updateOil(int engine, double imbalance, double thrust, double simN2, double deltaN2, double deltaTime, double ambientTemp) {
     double steadyTemperature;
-    double thermalEnergy;
-    double oilTemperaturePre;
+    double energy;
+    double oilTemperaturePrevious;
     double oilQtyActual;
     double oilTotalActual;
     double oilQtyObjective;
@@ -576,31 +473,23 @@ class EngineControl {
     //--------------------------------------------
     // Engine Reading
     //--------------------------------------------
-    if (engine == 1) {
-      steadyTemperature = simVars->getEngine1EGT();
-      thermalEnergy = thermalEnergy1;
-      oilTemperaturePre = oilTemperatureLeftPre;
-      oilQtyActual = simVars->getEngine1Oil();
-      oilTotalActual = simVars->getEngine1OilTotal();
-    } else {
-      steadyTemperature = simVars->getEngine2EGT();
-      thermalEnergy = thermalEnergy2;
-      oilTemperaturePre = oilTemperatureRightPre;
-      oilQtyActual = simVars->getEngine2Oil();
-      oilTotalActual = simVars->getEngine2OilTotal();
-    }
+    steadyTemperature = simVars->getEngineEGT(engine);
+    energy = thermalEnergy[engine - 1];
+    oilTemperaturePrevious = oilTemperaturePre[engine - 1];
+    oilQtyActual = simVars->getEngineOil(engine);
+    oilTotalActual = simVars->getEngineOilTotal(engine);
 
     //--------------------------------------------
     // Oil Temperature
     //--------------------------------------------
-    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperaturePre - 10) {
+    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperaturePrevious - 10) {
       oilTemperature = ambientTemp;
     } else {
       if (steadyTemperature > oilTemperatureMax) {
         steadyTemperature = oilTemperatureMax;
       }
-      thermalEnergy = (0.995 * thermalEnergy) + (deltaN2 / deltaTime);
-      oilTemperature = poly->oilTemperature(thermalEnergy, oilTemperaturePre, steadyTemperature, deltaTime);
+      energy = (0.995 * energy) + (deltaN2 / deltaTime);
+      oilTemperature = poly->oilTemperature(energy, oilTemperaturePrevious, steadyTemperature, deltaTime);
     }
 
     //--------------------------------------------
@@ -608,7 +497,7 @@ class EngineControl {
     //--------------------------------------------
     // Calculating Oil Qty as a function of thrust
     oilQtyObjective = oilTotalActual * (1 - poly->oilGulpPct(thrust));
-    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePre);
+    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePrevious);
 
     // Oil burnt taken into account for tank and total oil
     oilBurn = (0.00011111 * deltaTime);
@@ -633,327 +522,116 @@ class EngineControl {
     //--------------------------------------------
     // Engine Writing
     //--------------------------------------------
-    if (engine == 1) {
-      thermalEnergy1 = thermalEnergy;
-      oilTemperatureLeftPre = oilTemperature;
-      simVars->setEngine1Oil(oilQtyActual);
-      simVars->setEngine1OilTotal(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else {
-      thermalEnergy2 = thermalEnergy;
-      oilTemperatureRightPre = oilTemperature;
-      simVars->setEngine2Oil(oilQtyActual);
-      simVars->setEngine2OilTotal(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    }
+    thermalEnergy[engine - 1] = energy;
+    oilTemperaturePre[engine - 1] = oilTemperature;
+    simVars->setEngineOil(engine, oilQtyActual);
+    simVars->setEngineOilTotal(engine, oilTotalActual);
+    SimConnect_SetDataOnSimObject(hSimConnect, OilTempDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                  &oilTemperature);
+    SimConnect_SetDataOnSimObject(hSimConnect, OilPsiDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
   }
 
   /// @brief FBW Fuel Consumption and Tankering
   /// Updates Fuel Consumption with realistic values
   /// @param deltaTimeSeconds Frame delta time in seconds
   void updateFuel(double deltaTimeSeconds) {
-    double m = 0;
-    double b = 0;
-    double fuelBurn1 = 0;
-    double fuelBurn2 = 0;
-    double apuBurn1 = 0;
-    double apuBurn2 = 0;
-
-    double refuelRate = simVars->getRefuelRate();
-    double refuelStartedByUser = simVars->getRefuelStartedByUser();
-    bool uiFuelTamper = false;
-    double pumpStateLeft = simVars->getPumpStateLeft();
-    double pumpStateRight = simVars->getPumpStateRight();
+    FuelSystemInputs in;
+
+    // Check Ready & Development State for UI
+    isReady = simVars->getIsReady();
+    devState = simVars->getDeveloperState();
+
     bool xfrCenterLeftManual = simVars->getJunctionSetting(4) > 1.5;
     bool xfrCenterRightManual = simVars->getJunctionSetting(5) > 1.5;
     bool xfrCenterLeftAuto = simVars->getValve(11) > 0.0 && !xfrCenterLeftManual;
     bool xfrCenterRightAuto = simVars->getValve(12) > 0.0 && !xfrCenterRightManual;
-    bool xfrValveCenterLeftOpen = simVars->getValve(9) > 0.0 && (xfrCenterLeftAuto || xfrCenterLeftManual);
-    bool xfrValveCenterRightOpen = simVars->getValve(10) > 0.0 && (xfrCenterRightAuto || xfrCenterRightManual);
-    double xfrValveOuterLeft1 = simVars->getValve(6);
-    double xfrValveOuterLeft2 = simVars->getValve(4);
-    double xfrValveOuterRight1 = simVars->getValve(7);
-    double xfrValveOuterRight2 = simVars->getValve(5);
-    double lineLeftToCenterFlow = simVars->getLineFlow(27);
-    double lineRightToCenterFlow = simVars->getLineFlow(28);
-    double lineFlowRatio = 0;
-
-    double engine1PreFF = simVars->getEngine1PreFF();  // KG/H
-    double engine2PreFF = simVars->getEngine2PreFF();  // KG/H
-    double engine1FF = simVars->getEngine1FF();        // KG/H
-    double engine2FF = simVars->getEngine2FF();        // KG/H
 
     /// weight of one gallon of fuel in pounds
     double fuelWeightGallon = simVars->getFuelWeightGallon();
-    double fuelUsedLeft = simVars->getFuelUsedLeft();    // Kg
-    double fuelUsedRight = simVars->getFuelUsedRight();  // Kg
-
-    double fuelLeftPre = simVars->getFuelLeftPre();                                // LBS
-    double fuelRightPre = simVars->getFuelRightPre();                              // LBS
-    double fuelAuxLeftPre = simVars->getFuelAuxLeftPre();                          // LBS
-    double fuelAuxRightPre = simVars->getFuelAuxRightPre();                        // LBS
-    double fuelCenterPre = simVars->getFuelCenterPre();                            // LBS
-    double leftQuantity = simVars->getFuelTankQuantity(2) * fuelWeightGallon;      // LBS
-    double rightQuantity = simVars->getFuelTankQuantity(3) * fuelWeightGallon;     // LBS
-    double leftAuxQuantity = simVars->getFuelTankQuantity(4) * fuelWeightGallon;   // LBS
-    double rightAuxQuantity = simVars->getFuelTankQuantity(5) * fuelWeightGallon;  // LBS
-    double centerQuantity = simVars->getFuelTankQuantity(1) * fuelWeightGallon;    // LBS
-    /// Left inner tank fuel quantity in pounds
-    double fuelLeft = 0;
-    /// Right inner tank fuel quantity in pounds
-    double fuelRight = 0;
-    double fuelLeftAux = 0;
-    double fuelRightAux = 0;
-    double fuelCenter = 0;
-    double xfrCenterToLeft = 0;
-    double xfrCenterToRight = 0;
-    double xfrAuxLeft = 0;
-    double xfrAuxRight = 0;
-    double fuelTotalActual = leftQuantity + rightQuantity + leftAuxQuantity + rightAuxQuantity + centerQuantity;  // LBS
-    double fuelTotalPre = fuelLeftPre + fuelRightPre + fuelAuxLeftPre + fuelAuxRightPre + fuelCenterPre;          // LBS
-    double deltaFuelRate = abs(fuelTotalActual - fuelTotalPre) / (fuelWeightGallon * deltaTimeSeconds);           // LBS/ sec
-
-    double engine1State = simVars->getEngine1State();
-    double engine2State = simVars->getEngine2State();
 
-    int isTankClosed = 0;
-    double xFeedValve = simVars->getValve(3);
-    double leftPump1 = simVars->getPump(2);
-    double leftPump2 = simVars->getPump(5);
-    double rightPump1 = simVars->getPump(3);
-    double rightPump2 = simVars->getPump(6);
-
-    double apuNpercent = simVars->getAPUrpmPercent();
-
-    // Check Ready & Development State for UI
-    isReady = simVars->getIsReady();
-    devState = simVars->getDeveloperState();
-
-    /// Delta time for this update in hours
-    double deltaTime = deltaTimeSeconds / 3600;
-
-    // Pump State Logic for Left Wing
-    if (pumpStateLeft == 0 && (timerLeft.elapsed() == 0 || timerLeft.elapsed() >= 1000)) {
-      if (fuelLeftPre - leftQuantity > 0 && leftQuantity == 0) {
-        timerLeft.reset();
-        simVars->setPumpStateLeft(1);
-      } else if (fuelLeftPre == 0 && leftQuantity - fuelLeftPre > 0) {
-        timerLeft.reset();
-        simVars->setPumpStateLeft(2);
-      } else {
-        simVars->setPumpStateLeft(0);
-      }
-    } else if (pumpStateLeft == 1 && timerLeft.elapsed() >= 2100) {
-      simVars->setPumpStateLeft(0);
-      timerLeft.reset();
-    } else if (pumpStateLeft == 2 && timerLeft.elapsed() >= 2700) {
-      simVars->setPumpStateLeft(0);
-      timerLeft.reset();
-    }
+    in.actual.left = simVars->getFuelTankQuantity(2) * fuelWeightGallon;      // LBS
+    in.actual.right = simVars->getFuelTankQuantity(3) * fuelWeightGallon;     // LBS
+    in.actual.leftAux = simVars->getFuelTankQuantity(4) * fuelWeightGallon;   // LBS
+    in.actual.rightAux = simVars->getFuelTankQuantity(5) * fuelWeightGallon;  // LBS
+    in.actual.center = simVars->getFuelTankQuantity(1) * fuelWeightGallon;    // LBS
+    in.fuelWeightGallon = fuelWeightGallon;
+    in.refuelRate = simVars->getRefuelRate();
+    in.refuelStartedByUser = simVars->getRefuelStartedByUser();
+    in.isReady = isReady;
+    in.devState = devState;
+    in.simPaused = simPaused;
+    in.engine1FF = simVars->getEngine1FF();  // KG/H
+    in.engine2FF = simVars->getEngine2FF();  // KG/H
+    in.xfrValveCenterLeftOpen = simVars->getValve(9) > 0.0 && (xfrCenterLeftAuto || xfrCenterLeftManual);
+    in.xfrValveCenterRightOpen = simVars->getValve(10) > 0.0 && (xfrCenterRightAuto || xfrCenterRightManual);
+    in.xfrValveOuterLeft1 = simVars->getValve(6);
+    in.xfrValveOuterLeft2 = simVars->getValve(4);
+    in.xfrValveOuterRight1 = simVars->getValve(7);
+    in.xfrValveOuterRight2 = simVars->getValve(5);
+    in.lineLeftToCenterFlow = simVars->getLineFlow(27);
+    in.lineRightToCenterFlow = simVars->getLineFlow(28);
+    in.xFeedValve = simVars->getValve(3);
+    in.leftPump1 = simVars->getPump(2);
+    in.leftPump2 = simVars->getPump(5);
+    in.rightPump1 = simVars->getPump(3);
+    in.rightPump2 = simVars->getPump(6);
+    in.apuLineFlow = simVars->getLineFlow(18);
+    in.apuNpercent = simVars->getAPUrpmPercent();
+
+    // The pump timers live in fuelState, everything else is persisted in LVars
+    fuelState.pre.left = simVars->getFuelLeftPre();          // LBS
+    fuelState.pre.right = simVars->getFuelRightPre();        // LBS
+    fuelState.pre.leftAux = simVars->getFuelAuxLeftPre();    // LBS
+    fuelState.pre.rightAux = simVars->getFuelAuxRightPre();  // LBS
+    fuelState.pre.center = simVars->getFuelCenterPre();      // LBS
+    fuelState.engine1PreFF = simVars->getEngine1PreFF();     // KG/H
+    fuelState.engine2PreFF = simVars->getEngine2PreFF();     // KG/H
+    fuelState.fuelUsedLeft = simVars->getFuelUsedLeft();     // Kg
+    fuelState.fuelUsedRight = simVars->getFuelUsedRight();   // Kg
+    fuelState.pumpStateLeft = simVars->getPumpStateLeft();
+    fuelState.pumpStateRight = simVars->getPumpStateRight();
+
+    FuelTankWrite tankWrite = FuelSystem::step(fuelState, in, deltaTimeSeconds);
 
-    // Pump State Logic for Right Wing
-    if (pumpStateRight == 0 && (timerRight.elapsed() == 0 || timerRight.elapsed() >= 1000)) {
-      if (fuelRightPre - rightQuantity > 0 && rightQuantity == 0) {
-        timerRight.reset();
-        simVars->setPumpStateRight(1);
-      } else if (fuelRightPre == 0 && rightQuantity - fuelRightPre > 0) {
-        timerRight.reset();
-        simVars->setPumpStateRight(2);
-      } else {
-        simVars->setPumpStateRight(0);
-      }
-    } else if (pumpStateRight == 1 && timerRight.elapsed() >= 2100) {
-      simVars->setPumpStateRight(0);
-      timerRight.reset();
-    } else if (pumpStateRight == 2 && timerRight.elapsed() >= 2700) {
-      simVars->setPumpStateRight(0);
-      timerRight.reset();
-    }
+    //--------------------------------------------
+    // Setting new pre-cycle conditions
+    simVars->setPumpStateLeft(fuelState.pumpStateLeft);
+    simVars->setPumpStateRight(fuelState.pumpStateRight);
+    simVars->setEngine1PreFF(fuelState.engine1PreFF);
+    simVars->setEngine2PreFF(fuelState.engine2PreFF);
+    simVars->setFuelUsedLeft(fuelState.fuelUsedLeft);     // in KG
+    simVars->setFuelUsedRight(fuelState.fuelUsedRight);   // in KG
+    simVars->setFuelLeftPre(fuelState.pre.left);          // in LBS
+    simVars->setFuelRightPre(fuelState.pre.right);        // in LBS
+    simVars->setFuelAuxLeftPre(fuelState.pre.leftAux);    // in LBS
+    simVars->setFuelAuxRightPre(fuelState.pre.rightAux);  // in LBS
+    simVars->setFuelCenterPre(fuelState.pre.center);      // in LBS
+
+    if (tankWrite != FuelTankWrite::None) {
+      double fuelLeft = (fuelState.pre.left / fuelWeightGallon);    // USG
+      double fuelRight = (fuelState.pre.right / fuelWeightGallon);  // USG
 
-    // Checking for in-game UI Fuel tampering
-    if ((isReady == 1 && refuelStartedByUser == 0 && deltaFuelRate > FUEL_THRESHOLD) ||
-        (isReady == 1 && refuelStartedByUser == 1 && deltaFuelRate > FUEL_THRESHOLD && refuelRate < 2)) {
-      uiFuelTamper = true;
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
     }
-
-    if (simPaused || uiFuelTamper && devState == 0) {  // Detects whether the Sim is paused or the Fuel UI is being tampered with
-      simVars->setFuelLeftPre(fuelLeftPre);            // in LBS
-      simVars->setFuelRightPre(fuelRightPre);          // in LBS
-      simVars->setFuelAuxLeftPre(fuelAuxLeftPre);      // in LBS
-      simVars->setFuelAuxRightPre(fuelAuxRightPre);    // in LBS
-      simVars->setFuelCenterPre(fuelCenterPre);        // in LBS
-
-      fuelLeft = (fuelLeftPre / fuelWeightGallon);          // USG
-      fuelRight = (fuelRightPre / fuelWeightGallon);        // USG
-      fuelCenter = (fuelCenterPre / fuelWeightGallon);      // USG
-      fuelLeftAux = (fuelAuxLeftPre / fuelWeightGallon);    // USG
-      fuelRightAux = (fuelAuxRightPre / fuelWeightGallon);  // USG
+    if (tankWrite == FuelTankWrite::All) {
+      double fuelCenter = (fuelState.pre.center / fuelWeightGallon);      // USG
+      double fuelLeftAux = (fuelState.pre.leftAux / fuelWeightGallon);    // USG
+      double fuelRightAux = (fuelState.pre.rightAux / fuelWeightGallon);  // USG
 
       SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelCenterMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelCenter);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
       SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeftAux);
       SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRightAux);
-    } else if (!uiFuelTamper && refuelStartedByUser == 1) {  // Detects refueling from the EFB
-      simVars->setFuelLeftPre(leftQuantity);                 // in LBS
-      simVars->setFuelRightPre(rightQuantity);               // in LBS
-      simVars->setFuelAuxLeftPre(leftAuxQuantity);           // in LBS
-      simVars->setFuelAuxRightPre(rightAuxQuantity);         // in LBS
-      simVars->setFuelCenterPre(centerQuantity);             // in LBS
-    } else {
-      if (uiFuelTamper == 1) {
-        fuelLeftPre = leftQuantity;          // LBS
-        fuelRightPre = rightQuantity;        // LBS
-        fuelAuxLeftPre = leftAuxQuantity;    // LBS
-        fuelAuxRightPre = rightAuxQuantity;  // LBS
-        fuelCenterPre = centerQuantity;      // LBS
-      }
-      //-----------------------------------------------------------
-      // Cross-feed Logic
-      // isTankClosed = 0, x-feed valve closed
-      // isTankClosed = 1, left tank does not supply fuel
-      // isTankClosed = 2, right tank does not supply fuel
-      // isTankClosed = 3, left & right tanks do not supply fuel
-      // isTankClosed = 4, both tanks supply fuel
-      if (xFeedValve > 0.0) {
-        if (leftPump1 == 0 && leftPump2 == 0 && rightPump1 == 0 && rightPump2 == 0)
-          isTankClosed = 3;
-        else if (leftPump1 == 0 && leftPump2 == 0)
-          isTankClosed = 1;
-        else if (rightPump1 == 0 && rightPump2 == 0)
-          isTankClosed = 2;
-        else
-          isTankClosed = 4;
-      }
-
-      //--------------------------------------------
-      // Left Engine and Wing routine
-      if (fuelLeftPre > 0) {
-        // Cycle Fuel Burn for Engine 1
-        if (devState != 2) {
-          m = (engine1FF - engine1PreFF) / deltaTime;
-          b = engine1PreFF;
-          fuelBurn1 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
-        }
-
-        // Fuel transfer routine for Left Wing
-        if (xfrValveOuterLeft1 > 0.0 || xfrValveOuterLeft2 > 0.0)
-          xfrAuxLeft = fuelAuxLeftPre - leftAuxQuantity;
-      } else {
-        fuelBurn1 = 0;
-        fuelLeftPre = 0;
-      }
-
-      //--------------------------------------------
-      // Right Engine and Wing routine
-      if (fuelRightPre > 0) {
-        // Cycle Fuel Burn for Engine 2
-        if (devState != 2) {
-          m = (engine2FF - engine2PreFF) / deltaTime;
-          b = engine2PreFF;
-          fuelBurn2 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
-        }
-        // Fuel transfer routine for Right Wing
-        if (xfrValveOuterRight1 > 0.0 || xfrValveOuterRight2 > 0.0)
-          xfrAuxRight = fuelAuxRightPre - rightAuxQuantity;
-      } else {
-        fuelBurn2 = 0;
-        fuelRightPre = 0;
-      }
-
-      /// apu fuel consumption for this frame in pounds
-      double apuFuelConsumption = simVars->getLineFlow(18) * fuelWeightGallon * deltaTime;
-
-      // check if APU is actually running instead of just the ASU which doesnt consume fuel
-      if (apuNpercent <= 0.0) {
-        apuFuelConsumption = 0.0;
-      }
-
-      apuBurn1 = apuFuelConsumption;
-      apuBurn2 = 0;
-
-      //--------------------------------------------
-      // Fuel used accumulators
-      fuelUsedLeft += fuelBurn1;
-      fuelUsedRight += fuelBurn2;
-
-      //--------------------------------------------
-      // Cross-feed fuel burn routine
-      // If fuel pumps for a given tank are closed,
-      // all fuel will be burnt on the other tank
-      switch (isTankClosed) {
-        case 1:
-          fuelBurn2 = fuelBurn1 + fuelBurn2;
-          fuelBurn1 = 0;
-          apuBurn1 = 0;
-          apuBurn2 = apuFuelConsumption;
-          break;
-        case 2:
-          fuelBurn1 = fuelBurn1 + fuelBurn2;
-          fuelBurn2 = 0;
-          break;
-        case 3:
-          fuelBurn1 = 0;
-          fuelBurn2 = 0;
-          apuBurn1 = apuFuelConsumption * 0.5;
-          apuBurn2 = apuFuelConsumption * 0.5;
-          break;
-        case 4:
-          apuBurn1 = apuFuelConsumption * 0.5;
-          apuBurn2 = apuFuelConsumption * 0.5;
-          break;
-        default:
-          break;
-      }
-
-      //--------------------------------------------
-      // Center Tank transfer routine
-      if (xfrValveCenterLeftOpen && xfrValveCenterRightOpen) {
-        if (lineLeftToCenterFlow < 0.1 && lineRightToCenterFlow < 0.1)
-          lineFlowRatio = 0.5;
-        else
-          lineFlowRatio = lineLeftToCenterFlow / (lineLeftToCenterFlow + lineRightToCenterFlow);
-
-        xfrCenterToLeft = (fuelCenterPre - centerQuantity) * lineFlowRatio;
-        xfrCenterToRight = (fuelCenterPre - centerQuantity) * (1 - lineFlowRatio);
-      } else if (xfrValveCenterLeftOpen)
-        xfrCenterToLeft = fuelCenterPre - centerQuantity;
-      else if (xfrValveCenterRightOpen)
-        xfrCenterToRight = fuelCenterPre - centerQuantity;
-
-      //--------------------------------------------
-      // Final Fuel levels for left and right inner tanks
-      fuelLeft = (fuelLeftPre - (fuelBurn1 * KGS_TO_LBS)) + xfrAuxLeft + xfrCenterToLeft - apuBurn1;      // LBS
-      fuelRight = (fuelRightPre - (fuelBurn2 * KGS_TO_LBS)) + xfrAuxRight + xfrCenterToRight - apuBurn2;  // LBS
-
-      //--------------------------------------------
-      // Setting new pre-cycle conditions
-      simVars->setEngine1PreFF(engine1FF);
-      simVars->setEngine2PreFF(engine2FF);
-      simVars->setFuelUsedLeft(fuelUsedLeft);         // in KG
-      simVars->setFuelUsedRight(fuelUsedRight);       // in KG
-      simVars->setFuelAuxLeftPre(leftAuxQuantity);    // in LBS
-      simVars->setFuelAuxRightPre(rightAuxQuantity);  // in LBS
-      simVars->setFuelCenterPre(centerQuantity);      // in LBS
-
-      simVars->setFuelLeftPre(fuelLeft);    // in LBS
-      simVars->setFuelRightPre(fuelRight);  // in LBS
-
-      fuelLeft = (fuelLeft / fuelWeightGallon);    // USG
-      fuelRight = (fuelRight / fuelWeightGallon);  // USG
-
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
     }
 
+    double engine1State = simVars->getEngine1State();
+    double engine2State = simVars->getEngine2State();
+
     //--------------------------------------------
     // Will save the current fuel quantities if on
     // the ground AND engines being shutdown
-    if (timerFuel.elapsed() >= 1000 && simVars->getSimOnGround() &&
+    fuelSaveTimer += deltaTimeSeconds;
+    if (fuelSaveTimer >= 1.0 && simVars->getSimOnGround() &&
         (engine1State == 0 || engine1State == 10 || engine1State == 4 || engine1State == 14 || engine2State == 0 || engine2State == 10 ||
          engine2State == 4 || engine2State == 14)) {
       Configuration configuration;
@@ -965,7 +643,7 @@ class EngineControl {
       configuration.fuelRightAux = simVars->getFuelAuxRightPre() / simVars->getFuelWeightGallon();
 
       saveFuelInConfiguration(configuration);
-      timerFuel.reset();
+      fuelSaveTimer = 0;
     }
   }
 
@@ -991,14 +669,13 @@ class EngineControl {
     double flex = 0;
 
     // Write all N1 Limits
-    to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    if (flexTemp > 0) {
-      flex_to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-      flex_ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-    }
-    clb = limitN1(2, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
-    mct = limitN1(3, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+    const N1Limits& n1Limits = thrustLimits.compute(pressAltitude, ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+    to = n1Limits.to;
+    ga = n1Limits.ga;
+    flex_to = n1Limits.flexTo;
+    flex_ga = n1Limits.flexGa;
+    clb = n1Limits.clb;
+    mct = n1Limits.mct;
 
     // transition between TO and GA limit -----------------------------------------------------------------------------
     double machFactorLow = max(0.0, min(1.0, (mach - 0.04) / 0.04));
@@ -1086,8 +763,9 @@ class EngineControl {
     simVars = new SimVars();
     double engTime = 0;
     ambientTemp = simVars->getAmbientTemperature();
-    simN2LeftPre = simVars->getN2(1);
-    simN2RightPre = simVars->getN2(2);
+    for (engine = 1; engine <= 2; engine++) {
+      simN2Pre[engine - 1] = simVars->getN2(engine);
+    }
 
     confFilename += acftRegistration;
     confFilename += FILENAME_FADEC_CONF_FILE_EXTENSION;
@@ -1119,37 +797,29 @@ class EngineControl {
       idleOil = initOil(140, 200);
 
       // Setting initial Oil
-      if (engine == 1) {
-        simVars->setEngine1OilTotal(idleOil - paramImbalance);
-      } else {
-        simVars->setEngine2OilTotal(idleOil - paramImbalance);
-      }
+      simVars->setEngineOilTotal(engine, idleOil - paramImbalance);
     }
 
     // Setting initial Oil Temperature
-    thermalEnergy1 = 0;
-    thermalEnergy2 = 0;
+    thermalEnergy[0] = 0;
+    thermalEnergy[1] = 0;
     oilTemperatureMax = imbalanceExtractor(imbalance, 8);
     simOnGround = simVars->getSimOnGround();
     double engine1Combustion = simVars->getEngineCombustion(1);
     double engine2Combustion = simVars->getEngineCombustion(2);
 
+    double initialOilTemperature = ambientTemp;
     if (simOnGround == 1 && engine1Combustion == 1 && engine2Combustion == 1) {
-      oilTemperatureLeftPre = 75;
-      oilTemperatureRightPre = 75;
+      initialOilTemperature = 75;
     } else if (simOnGround == 0 && engine1Combustion == 1 && engine2Combustion == 1) {
-      oilTemperatureLeftPre = 85;
-      oilTemperatureRightPre = 85;
-
-    } else {
-      oilTemperatureLeftPre = ambientTemp;
-      oilTemperatureRightPre = ambientTemp;
+      initialOilTemperature = 85;
     }
 
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureLeftPre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureRightPre);
+    for (engine = 1; engine <= 2; engine++) {
+      oilTemperaturePre[engine - 1] = initialOilTemperature;
+      SimConnect_SetDataOnSimObject(hSimConnect, OilTempDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &oilTemperaturePre[engine - 1]);
+    }
 
     // Initialize Engine State
     simVars->setEngine1State(10);
@@ -1213,6 +883,9 @@ class EngineControl {
     }
     wai = simVars->getWAI();
 
+    // ambient terms are identical for all engines
+    ambientRatios.update(mach, ambientTemp, ambientPressure);
+
     generateIdleParameters(pressAltitude, mach, ambientTemp, ambientPressure);
 
     // Timer timer;
@@ -1230,17 +903,10 @@ class EngineControl {
       bool engineMasterTurnedOn = prevEngineMasterPos[engine - 1] < 1 && engineFuelValveOpen >= 1;
       bool engineMasterTurnedOff = prevEngineMasterPos[engine - 1] == 1 && engineFuelValveOpen < 1;
 
-      if (engine == 1) {
-        deltaN2 = simN2 - simN2LeftPre;
-        simN2LeftPre = simN2;
-        timer = simVars->getEngine1Timer();
-        fbwN2 = simVars->getEngine1N2();
-      } else {
-        deltaN2 = simN2 - simN2RightPre;
-        simN2RightPre = simN2;
-        timer = simVars->getEngine2Timer();
-        fbwN2 = simVars->getEngine2N2();
-      }
+      deltaN2 = simN2 - simN2Pre[engine - 1];
+      simN2Pre[engine - 1] = simN2;
+      timer = simVars->getEngineTimer(engine);
+      fbwN2 = simVars->getEngineN2(engine);
 
       // starts engines if Engine Master is turned on and Starter is pressurized or engine is still spinning fast enough
       if (!engineStarter && engineFuelValveOpen == 1 && (engineStarterPressurized || simN2 >= 20)) {
@@ -1272,11 +938,11 @@ class EngineControl {
           }
         case 4:
           engineShutdownProcedure(engine, ambientTemp, simN1, deltaTime, timer);
-          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
+          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude);
           break;
         default:
           updatePrimaryParameters(engine, imbalance, simN1, simN2);
-          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
+          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude);
           updateEGT(engine, imbalance, deltaTime, simOnGround, engineState, simCN1, cFbwFF, mach, pressAltitude, ambientTemp);
           // updateOil(engine, imbalance, thrust, simN2, deltaN2, deltaTime, ambientTemp);
       }
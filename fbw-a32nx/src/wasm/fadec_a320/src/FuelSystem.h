@@ -0,0 +1,286 @@
+#pragma once
+
+#include <cmath>
+
+/// <summary>
+/// Fuel tank quantities (in LBS)
+/// </summary>
+struct FuelTanks {
+  double left = 0;
+  double right = 0;
+  double leftAux = 0;
+  double rightAux = 0;
+  double center = 0;
+
+  double total() const { return left + right + leftAux + rightAux + center; }
+};
+
+/// <summary>
+/// Per-frame inputs of the fuel system, read from the simulation before each step
+/// </summary>
+struct FuelSystemInputs {
+  /// Tank quantities as currently reported by the simulation (in LBS)
+  FuelTanks actual;
+  /// Weight of one gallon of fuel (in LBS)
+  double fuelWeightGallon = 0;
+
+  double refuelRate = 0;
+  double refuelStartedByUser = 0;
+  double isReady = 0;
+  double devState = 0;
+  bool simPaused = false;
+
+  double engine1FF = 0;  // KG/H
+  double engine2FF = 0;  // KG/H
+
+  bool xfrValveCenterLeftOpen = false;
+  bool xfrValveCenterRightOpen = false;
+  double xfrValveOuterLeft1 = 0;
+  double xfrValveOuterLeft2 = 0;
+  double xfrValveOuterRight1 = 0;
+  double xfrValveOuterRight2 = 0;
+  double lineLeftToCenterFlow = 0;
+  double lineRightToCenterFlow = 0;
+  double xFeedValve = 0;
+  double leftPump1 = 0;
+  double leftPump2 = 0;
+  double rightPump1 = 0;
+  double rightPump2 = 0;
+
+  double apuLineFlow = 0;  // gallons/ hr
+  double apuNpercent = 0;
+};
+
+/// <summary>
+/// State carried by the fuel system from one step to the next
+/// </summary>
+struct FuelSystemState {
+  /// Tank quantities accounted for by the FADEC at the end of the previous step (in LBS)
+  FuelTanks pre;
+  double engine1PreFF = 0;   // KG/H
+  double engine2PreFF = 0;   // KG/H
+  double fuelUsedLeft = 0;   // KG
+  double fuelUsedRight = 0;  // KG
+  double pumpStateLeft = 0;
+  double pumpStateRight = 0;
+  /// Sim time since the last pump state change (in seconds), starts expired
+  double pumpTimerLeft = 1;
+  double pumpTimerRight = 1;
+};
+
+/// <summary>
+/// Tanks of which the simulation quantities have to be overwritten after a step
+/// </summary>
+enum class FuelTankWrite { None, Inner, All };
+
+/// <summary>
+/// A32NX fuel consumption and transfer solver.
+/// Pure function of its inputs and state, driven by sim time only, so it can be stepped offline at any rate.
+/// </summary>
+class FuelSystem {
+ private:
+  static constexpr double KGS_TO_LBS = 1 / 0.4535934;
+  static constexpr double FUEL_THRESHOLD = 661;  // lbs/sec
+
+  /// <summary>
+  /// Pump state logic for one wing, advanced by the elapsed sim time
+  /// </summary>
+  static void updatePumpState(double& pumpState, double& pumpTimer, double fuelPre, double quantity, double deltaTimeSeconds) {
+    pumpTimer += deltaTimeSeconds;
+
+    if (pumpState == 0 && pumpTimer >= 1.0) {
+      if (fuelPre - quantity > 0 && quantity == 0) {
+        pumpTimer = 0;
+        pumpState = 1;
+      } else if (fuelPre == 0 && quantity - fuelPre > 0) {
+        pumpTimer = 0;
+        pumpState = 2;
+      }
+    } else if (pumpState == 1 && pumpTimer >= 2.1) {
+      pumpState = 0;
+      pumpTimer = 0;
+    } else if (pumpState == 2 && pumpTimer >= 2.7) {
+      pumpState = 0;
+      pumpTimer = 0;
+    }
+  }
+
+ public:
+  /// <summary>
+  /// Advances the fuel system by one step
+  /// </summary>
+  /// <param name="state">State of the previous step, updated in place.</param>
+  /// <param name="in">Inputs of this step.</param>
+  /// <param name="deltaTimeSeconds">Sim time elapsed since the previous step.</param>
+  /// <returns>Which tanks of the simulation have to be set to the quantities in state.pre.</returns>
+  static FuelTankWrite step(FuelSystemState& state, const FuelSystemInputs& in, double deltaTimeSeconds) {
+    double m = 0;
+    double b = 0;
+    double fuelBurn1 = 0;
+    double fuelBurn2 = 0;
+    double apuBurn1 = 0;
+    double apuBurn2 = 0;
+    double xfrCenterToLeft = 0;
+    double xfrCenterToRight = 0;
+    double xfrAuxLeft = 0;
+    double xfrAuxRight = 0;
+    double lineFlowRatio = 0;
+    int isTankClosed = 0;
+    bool uiFuelTamper = false;
+
+    FuelTanks pre = state.pre;
+    const FuelTanks& actual = in.actual;
+    double deltaFuelRate = std::abs(actual.total() - pre.total()) / (in.fuelWeightGallon * deltaTimeSeconds);  // LBS/ sec
+
+    /// Delta time for this update in hours
+    double deltaTime = deltaTimeSeconds / 3600;
+
+    updatePumpState(state.pumpStateLeft, state.pumpTimerLeft, pre.left, actual.left, deltaTimeSeconds);
+    updatePumpState(state.pumpStateRight, state.pumpTimerRight, pre.right, actual.right, deltaTimeSeconds);
+
+    // Checking for in-game UI Fuel tampering
+    if ((in.isReady == 1 && in.refuelStartedByUser == 0 && deltaFuelRate > FUEL_THRESHOLD) ||
+        (in.isReady == 1 && in.refuelStartedByUser == 1 && deltaFuelRate > FUEL_THRESHOLD && in.refuelRate < 2)) {
+      uiFuelTamper = true;
+    }
+
+    // Detects whether the Sim is paused or the Fuel UI is being tampered with
+    if (in.simPaused || (uiFuelTamper && in.devState == 0)) {
+      return FuelTankWrite::All;
+    }
+
+    if (!uiFuelTamper && in.refuelStartedByUser == 1) {  // Detects refueling from the EFB
+      state.pre = actual;
+      return FuelTankWrite::None;
+    }
+
+    if (uiFuelTamper) {
+      pre = actual;
+    }
+
+    //-----------------------------------------------------------
+    // Cross-feed Logic
+    // isTankClosed = 0, x-feed valve closed
+    // isTankClosed = 1, left tank does not supply fuel
+    // isTankClosed = 2, right tank does not supply fuel
+    // isTankClosed = 3, left & right tanks do not supply fuel
+    // isTankClosed = 4, both tanks supply fuel
+    if (in.xFeedValve > 0.0) {
+      if (in.leftPump1 == 0 && in.leftPump2 == 0 && in.rightPump1 == 0 && in.rightPump2 == 0)
+        isTankClosed = 3;
+      else if (in.leftPump1 == 0 && in.leftPump2 == 0)
+        isTankClosed = 1;
+      else if (in.rightPump1 == 0 && in.rightPump2 == 0)
+        isTankClosed = 2;
+      else
+        isTankClosed = 4;
+    }
+
+    //--------------------------------------------
+    // Left Engine and Wing routine
+    if (pre.left > 0) {
+      // Cycle Fuel Burn for Engine 1
+      if (in.devState != 2) {
+        m = (in.engine1FF - state.engine1PreFF) / deltaTime;
+        b = state.engine1PreFF;
+        fuelBurn1 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+      }
+
+      // Fuel transfer routine for Left Wing
+      if (in.xfrValveOuterLeft1 > 0.0 || in.xfrValveOuterLeft2 > 0.0)
+        xfrAuxLeft = pre.leftAux - actual.leftAux;
+    } else {
+      fuelBurn1 = 0;
+      pre.left = 0;
+    }
+
+    //--------------------------------------------
+    // Right Engine and Wing routine
+    if (pre.right > 0) {
+      // Cycle Fuel Burn for Engine 2
+      if (in.devState != 2) {
+        m = (in.engine2FF - state.engine2PreFF) / deltaTime;
+        b = state.engine2PreFF;
+        fuelBurn2 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+      }
+      // Fuel transfer routine for Right Wing
+      if (in.xfrValveOuterRight1 > 0.0 || in.xfrValveOuterRight2 > 0.0)
+        xfrAuxRight = pre.rightAux - actual.rightAux;
+    } else {
+      fuelBurn2 = 0;
+      pre.right = 0;
+    }
+
+    /// apu fuel consumption for this frame in pounds
+    double apuFuelConsumption = in.apuLineFlow * in.fuelWeightGallon * deltaTime;
+
+    // check if APU is actually running instead of just the ASU which doesnt consume fuel
+    if (in.apuNpercent <= 0.0) {
+      apuFuelConsumption = 0.0;
+    }
+
+    apuBurn1 = apuFuelConsumption;
+    apuBurn2 = 0;
+
+    //--------------------------------------------
+    // Fuel used accumulators
+    state.fuelUsedLeft += fuelBurn1;
+    state.fuelUsedRight += fuelBurn2;
+
+    //--------------------------------------------
+    // Cross-feed fuel burn routine
+    // If fuel pumps for a given tank are closed,
+    // all fuel will be burnt on the other tank
+    switch (isTankClosed) {
+      case 1:
+        fuelBurn2 = fuelBurn1 + fuelBurn2;
+        fuelBurn1 = 0;
+        apuBurn1 = 0;
+        apuBurn2 = apuFuelConsumption;
+        break;
+      case 2:
+        fuelBurn1 = fuelBurn1 + fuelBurn2;
+        fuelBurn2 = 0;
+        break;
+      case 3:
+        fuelBurn1 = 0;
+        fuelBurn2 = 0;
+        apuBurn1 = apuFuelConsumption * 0.5;
+        apuBurn2 = apuFuelConsumption * 0.5;
+        break;
+      case 4:
+        apuBurn1 = apuFuelConsumption * 0.5;
+        apuBurn2 = apuFuelConsumption * 0.5;
+        break;
+      default:
+        break;
+    }
+
+    //--------------------------------------------
+    // Center Tank transfer routine
+    if (in.xfrValveCenterLeftOpen && in.xfrValveCenterRightOpen) {
+      if (in.lineLeftToCenterFlow < 0.1 && in.lineRightToCenterFlow < 0.1)
+        lineFlowRatio = 0.5;
+      else
+        lineFlowRatio = in.lineLeftToCenterFlow / (in.lineLeftToCenterFlow + in.lineRightToCenterFlow);
+
+      xfrCenterToLeft = (pre.center - actual.center) * lineFlowRatio;
+      xfrCenterToRight = (pre.center - actual.center) * (1 - lineFlowRatio);
+    } else if (in.xfrValveCenterLeftOpen)
+      xfrCenterToLeft = pre.center - actual.center;
+    else if (in.xfrValveCenterRightOpen)
+      xfrCenterToRight = pre.center - actual.center;
+
+    //--------------------------------------------
+    // Final Fuel levels for left and right inner tanks, the outer and center tanks are driven by the simulation
+    state.pre.left = (pre.left - (fuelBurn1 * KGS_TO_LBS)) + xfrAuxLeft + xfrCenterToLeft - apuBurn1;      // LBS
+    state.pre.right = (pre.right - (fuelBurn2 * KGS_TO_LBS)) + xfrAuxRight + xfrCenterToRight - apuBurn2;  // LBS
+    state.pre.leftAux = actual.leftAux;
+    state.pre.rightAux = actual.rightAux;
+    state.pre.center = actual.center;
+    state.engine1PreFF = in.engine1FF;
+    state.engine2PreFF = in.engine2FF;
+
+    return FuelTankWrite::Inner;
+  }
+};
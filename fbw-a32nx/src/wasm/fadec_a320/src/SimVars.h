@@ -19,6 +19,12 @@ enum DataTypesID {
   AcftInfo,
 };
 
+/// <summary>
+/// Per-engine SimConnect data types, indexed by engine number - 1
+/// </summary>
+const DataTypesID OilTempDataTypes[2] = {DataTypesID::OilTempLeft, DataTypesID::OilTempRight};
+const DataTypesID OilPsiDataTypes[2] = {DataTypesID::OilPsiLeft, DataTypesID::OilPsiRight};
+
 struct SimulationData {
   double simulationTime;
   double simulationRate;
@@ -163,6 +169,23 @@ class SimVars {
   ID Eng2StarterPressurized;
   ID APUrpmPercent;
 
+  /// <summary>
+  /// Per-engine LVars, indexed by engine number - 1
+  /// </summary>
+  struct EngineVars {
+    ID N1;
+    ID N2;
+    ID EGT;
+    ID FF;
+    ID PreFF;
+    ID Oil;
+    ID OilTotal;
+    ID State;
+    ID Timer;
+    ID FuelUsed;
+  };
+  EngineVars Engines[2];
+
   SimVars() { this->initializeVars(); }
 
   void initializeVars() {
@@ -222,6 +245,11 @@ class SimVars {
     PacksState1 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_1_IS_OPEN");
     PacksState2 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_2_IS_OPEN");
 
+    Engines[0] = {Engine1N1, Engine1N2, Engine1EGT, Engine1FF, Engine1PreFF, Engine1Oil, Engine1OilTotal, Engine1State, Engine1Timer,
+                  FuelUsedLeft};
+    Engines[1] = {Engine2N1, Engine2N2, Engine2EGT, Engine2FF, Engine2PreFF, Engine2Oil, Engine2OilTotal, Engine2State, Engine2Timer,
+                  FuelUsedRight};
+
     this->setDeveloperState(0);
     this->setEngine1N2(0);
     this->setEngine2N2(0);
@@ -312,6 +340,30 @@ class SimVars {
   void setThrustLimitClimb(FLOAT64 value) { set_named_variable_value(ThrustLimitClimb, value); }
   void setThrustLimitMct(FLOAT64 value) { set_named_variable_value(ThrustLimitMct, value); }
 
+  // Collection of per-engine LVar 'set' Functions (engine is 1-based)
+  void setEngineN1(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].N1, value); }
+  void setEngineN2(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].N2, value); }
+  void setEngineEGT(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].EGT, value); }
+  void setEngineFF(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].FF, value); }
+  void setEnginePreFF(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].PreFF, value); }
+  void setEngineOil(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].Oil, value); }
+  void setEngineOilTotal(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].OilTotal, value); }
+  void setEngineState(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].State, value); }
+  void setEngineTimer(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].Timer, value); }
+  void setFuelUsed(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].FuelUsed, value); }
+
+  // Collection of per-engine LVar 'get' Functions (engine is 1-based)
+  FLOAT64 getEngineN1(int engine) { return get_named_variable_value(Engines[engine - 1].N1); }
+  FLOAT64 getEngineN2(int engine) { return get_named_variable_value(Engines[engine - 1].N2); }
+  FLOAT64 getEngineEGT(int engine) { return get_named_variable_value(Engines[engine - 1].EGT); }
+  FLOAT64 getEngineFF(int engine) { return get_named_variable_value(Engines[engine - 1].FF); }
+  FLOAT64 getEnginePreFF(int engine) { return get_named_variable_value(Engines[engine - 1].PreFF); }
+  FLOAT64 getEngineOil(int engine) { return get_named_variable_value(Engines[engine - 1].Oil); }
+  FLOAT64 getEngineOilTotal(int engine) { return get_named_variable_value(Engines[engine - 1].OilTotal); }
+  FLOAT64 getEngineState(int engine) { return get_named_variable_value(Engines[engine - 1].State); }
+  FLOAT64 getEngineTimer(int engine) { return get_named_variable_value(Engines[engine - 1].Timer); }
+  FLOAT64 getFuelUsed(int engine) { return get_named_variable_value(Engines[engine - 1].FuelUsed); }
+
   // Collection of SimVar/LVar 'get' Functions
   FLOAT64 getDeveloperState() { return get_named_variable_value(DevVar); }
   FLOAT64 getIsReady() { return get_named_variable_value(IsReady); }
@@ -3,14 +3,6 @@
 #include "SimVars.h"
 #include "common.h"
 
-double cas2mach(double cas, double ambientPressure) {
-  double k = 2188648.141;
-  double delta = ambientPressure / 1013;
-  double mach = sqrt((5 * pow(((pow(((pow(cas, 2) / k) + 1), 3.5) * (1 / delta)) - (1 / delta) + 1), 0.285714286)) - 5);
-
-  return mach;
-}
-
 static constexpr double limits[72][6] = {
     {-2000, 48.000, 55.000, 81.351, 79.370, 61.535},  {-1000, 46.000, 55.000, 82.605, 80.120, 62.105},
     {0, 44.000, 55.000, 83.832, 80.776, 62.655},      {500, 42.000, 52.000, 84.210, 81.618, 62.655},
@@ -50,208 +42,268 @@ static constexpr double limits[72][6] = {
     {35000, -43.628, -14.384, 98.386, 85.747, 0.000}, {39000, -47.286, -18.508, 97.278, 85.545, 0.000}};
 
 /// <summary>
-/// Finds top-row boundary in an array
+/// N1 limits of all thrust rating modes for one flight condition
 /// </summary>
-int finder(double altitude, int index) {
-  if (altitude < limits[index][0]) {
-    return index;
-  } else {
-    return finder(altitude, index + 1);
-  }
-}
+struct N1Limits {
+  double to = 0;
+  double ga = 0;
+  double flexTo = 0;
+  double flexGa = 0;
+  double clb = 0;
+  double mct = 0;
+};
 
 /// <summary>
-/// Calculates Bleed Air situation for engine adaptation
+/// Table driven N1 limit computation.
+/// Bleed corrections are tabulated once at construction, the altitude segment of each rating mode is cached between frames and
+/// the limits are only recomputed when one of the inputs crosses its quantization step.
 /// </summary>
-double bleedTotal(int type, double altitude, double oat, double cp, double lp, double flexTemp, double ac, double nacelle, double wing) {
-  double n1Packs = 0;
-  double n1Nai = 0;
-  double n1Wai = 0;
-  double bleed = 0;
-
-  if (flexTemp > lp && type <= 1) {
-    n1Packs = -0.6;
-    n1Nai = -0.7;
-    n1Wai = -0.7;
-  } else {
-    switch (type) {
-      case 0:
-        if (altitude < 8000) {
-          if (oat < cp) {
-            n1Packs = -0.4;
-          } else {
-            n1Packs = -0.5;
-            n1Nai = -0.6;
-            n1Wai = -0.7;
-          }
-        } else {
-          if (oat < cp) {
-            n1Packs = -0.6;
-          } else {
-            n1Packs = -0.7;
-            n1Nai = -0.8;
-            n1Wai = -0.8;
+class ThrustLimits {
+ private:
+  enum Mode { TO = 0, GA = 1, CLB = 2, MCT = 3 };
+
+  // Altitude breakpoints of the 'limits' table per rating mode
+  static constexpr int rowMin[4] = {0, 21, 42, 59};
+  static constexpr int rowMax[4] = {20, 41, 58, 71};
+
+  // Bleed N1 deltas {packs, nacelle anti-ice, wing anti-ice} per mode, altitude band (below/above 8000ft) and OAT below/above
+  // the corner point
+  static constexpr double bleedDeltas[4][2][2][3] = {
+      {{{-0.4, 0, 0}, {-0.5, -0.6, -0.7}}, {{-0.6, 0, 0}, {-0.7, -0.8, -0.8}}},
+      {{{-0.4, 0, 0}, {-0.4, -0.6, -0.6}}, {{-0.6, 0, 0}, {-0.6, -0.7, -0.8}}},
+      {{{-0.2, 0, 0}, {-0.3, -0.8, -0.4}}, {{-0.2, 0, 0}, {-0.3, -0.8, -0.4}}},
+      {{{-0.6, 0, 0}, {-0.6, -0.9, -1.2}}, {{-0.6, 0, 0}, {-0.6, -0.9, -1.2}}}};
+  // Bleed N1 deltas for TO/GA when the flex temperature is above the limit point
+  static constexpr double flexBleedDeltas[3] = {-0.6, -0.7, -0.7};
+
+  // Total bleed correction per mode, altitude band, OAT band and bleed configuration (bit 0 packs, bit 1 NAI, bit 2 WAI)
+  double bleedTable[4][2][2][8];
+  double flexBleedTable[8];
+
+  // Impact pressure ratio (qc / p0) of the fixed CLB and MCT speed schedules
+  double qcRatio250;
+  double qcRatio300;
+  double qcRatio230;
+
+  int cachedRow[4];
+
+  N1Limits cachedLimits;
+  bool cacheValid = false;
+  long long altitudeKey = 0;
+  long long temperatureKey = 0;
+  long long pressureKey = 0;
+  double flexTempKey = 0;
+  int bleedKey = 0;
+
+  static double impactPressureRatio(double cas) {
+    double k = 2188648.141;
+    return pow(((cas * cas) / k) + 1, 3.5) - 1;
+  }
+
+  /// <summary>
+  /// cas2mach() for one of the precomputed speed schedules
+  /// </summary>
+  static double machFromImpactPressureRatio(double qcRatio, double ambientPressure) {
+    double delta = ambientPressure / 1013;
+    return sqrt((5 * pow((qcRatio / delta) + 1, 0.285714286)) - 5);
+  }
+
+  /// <summary>
+  /// Finds the upper altitude row for a mode, starting from the row found on the previous call
+  /// </summary>
+  int findRow(int mode, double altitude) {
+    int row = cachedRow[mode];
+
+    if (altitude < limits[row][0] && altitude >= limits[row - 1][0]) {
+      return row;
+    }
+
+    // binary search for the first row above the altitude
+    int lo = rowMin[mode] + 1;
+    int hi = rowMax[mode];
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (altitude < limits[mid][0]) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+
+    cachedRow[mode] = lo;
+    return lo;
+  }
+
+  int bleedIndex(double ac, double nacelle, double wing) { return (ac != 0) | ((nacelle != 0) << 1) | ((wing != 0) << 2); }
+
+ public:
+  // Quantization steps for the inputs, changes below these do not trigger a recompute
+  static constexpr double ALTITUDE_STEP = 10;     // ft
+  static constexpr double TEMPERATURE_STEP = 0.1;  // deg C
+  static constexpr double PRESSURE_STEP = 0.1;     // hPa
+
+  ThrustLimits() {
+    for (int config = 0; config < 8; config++) {
+      double packs = (config & 1) ? 1 : 0;
+      double nai = (config & 2) ? 1 : 0;
+      double wai = (config & 4) ? 1 : 0;
+
+      for (int mode = TO; mode <= MCT; mode++) {
+        for (int band = 0; band < 2; band++) {
+          for (int hot = 0; hot < 2; hot++) {
+            const double* deltas = bleedDeltas[mode][band][hot];
+            bleedTable[mode][band][hot][config] = (deltas[0] * packs) + (deltas[1] * nai) + (deltas[2] * wai);
           }
         }
+      }
+      flexBleedTable[config] = (flexBleedDeltas[0] * packs) + (flexBleedDeltas[1] * nai) + (flexBleedDeltas[2] * wai);
+    }
+
+    for (int mode = TO; mode <= MCT; mode++) {
+      cachedRow[mode] = rowMin[mode] + 1;
+    }
+
+    qcRatio250 = impactPressureRatio(250);
+    qcRatio300 = impactPressureRatio(300);
+    qcRatio230 = impactPressureRatio(230);
+  }
+
+  /// <summary>
+  /// Main N1 Limit Function
+  /// </summary>
+  /// <param name="type">0-TO, 1-GA, 2-CLB, 3-MCT</param>
+  /// <returns>N1 limit including bleed corrections.</returns>
+  double
+  limitN1(int type, double altitude, double ambientTemp, double ambientPressure, double flexTemp, double ac, double nacelle, double wing) {
+    int loAltRow = 0;
+    int hiAltRow = 0;
+    double mach = 0;
+    double cp = 0;
+    double lp = 0;
+    double cn1 = 0;
+    double cn1Flat = 0;
+    double cn1Last = 0;
+    double cn1Flex = 0;
+    double m = 0;
+    double b = 0;
+    double bleed = 0;
+
+    // Set mach per Limit Type
+    switch (type) {
+      case TO:
+        mach = 0;
         break;
-      case 1:
-        if (altitude < 8000) {
-          if (oat < cp) {
-            n1Packs = -0.4;
-          } else {
-            n1Packs = -0.4;
-            n1Nai = -0.6;
-            n1Wai = -0.6;
-          }
-        } else {
-          if (oat < cp) {
-            n1Packs = -0.6;
-          } else {
-            n1Packs = -0.6;
-            n1Nai = -0.7;
-            n1Wai = -0.8;
-          }
-        }
+      case GA:
+        mach = 0.225;
         break;
-      case 2:
-        if (oat < cp) {
-          n1Packs = -0.2;
+      case CLB:
+        if (altitude <= 10000) {
+          mach = machFromImpactPressureRatio(qcRatio250, ambientPressure);
         } else {
-          n1Packs = -0.3;
-          n1Nai = -0.8;
-          n1Wai = -0.4;
+          mach = machFromImpactPressureRatio(qcRatio300, ambientPressure);
+          if (mach > 0.78)
+            mach = 0.78;
         }
         break;
-      case 3:
-        if (oat < cp) {
-          n1Packs = -0.6;
-        } else {
-          n1Packs = -0.6;
-          n1Nai = -0.9;
-          n1Wai = -1.2;
-        }
+      case MCT:
+        mach = machFromImpactPressureRatio(qcRatio230, ambientPressure);
         break;
     }
-  }
-
-  if (ac == 0) {
-    n1Packs = 0;
-  }
-  if (nacelle == 0) {
-    n1Nai = 0;
-  }
-  if (wing == 0) {
-    n1Wai = 0;
-  }
 
-  bleed = n1Packs + n1Nai + n1Wai;
+    // Check for over/ underflows. Else, find top row value
+    if (altitude <= limits[rowMin[type]][0]) {
+      hiAltRow = rowMin[type];
+      loAltRow = rowMin[type];
+    } else if (altitude >= limits[rowMax[type]][0]) {
+      hiAltRow = rowMax[type];
+      loAltRow = rowMax[type];
+    } else {
+      hiAltRow = findRow(type, altitude);
+      loAltRow = hiAltRow - 1;
+    }
 
-  return bleed;
-}
+    // Define key table variables and interpolation
+    const double* lo = limits[loAltRow];
+    const double* hi = limits[hiAltRow];
+    cp = interpolate(altitude, lo[0], hi[0], lo[1], hi[1]);
+    lp = interpolate(altitude, lo[0], hi[0], lo[2], hi[2]);
+    cn1Flat = interpolate(altitude, lo[0], hi[0], lo[3], hi[3]);
+    cn1Last = interpolate(altitude, lo[0], hi[0], lo[4], hi[4]);
+    cn1Flex = interpolate(altitude, lo[0], hi[0], lo[5], hi[5]);
 
-/// <summary>
-/// Main N1 Limit Function
-/// </summary>
-/// <param name="type">0-TO, 1-GA, 2-CLB, 3-MCT</param>
-/// <returns></returns>
-double
-limitN1(int type, double altitude, double ambientTemp, double ambientPressure, double flexTemp, double ac, double nacelle, double wing) {
-  int rowMin = 0;
-  int rowMax = 0;
-  int loAltRow = 0;
-  int hiAltRow = 0;
-  double mach = 0;
-  double cp = 0;
-  double lp = 0;
-  double cn1 = 0;
-  double n1 = 0;
-  double cn1Flat = 0;
-  double cn1Last = 0;
-  double cn1Flex = 0;
-  double m = 0;
-  double b = 0;
-  double bleed = 0;
-
-  // Set main variables per Limit Type
-  switch (type) {
-    case 0:
-      rowMin = 0;
-      rowMax = 20;
-      mach = 0;
-      break;
-    case 1:
-      rowMin = 21;
-      rowMax = 41;
-      mach = 0.225;
-      break;
-    case 2:
-      rowMin = 42;
-      rowMax = 58;
-      if (altitude <= 10000) {
-        mach = cas2mach(250, ambientPressure);
+    if (flexTemp > 0 && type <= GA) {  // CN1 for Flex Case
+      if (flexTemp <= cp) {
+        cn1 = cn1Flat;
+      } else if (flexTemp > lp) {
+        m = (cn1Flex - cn1Last) / (100 - lp);
+        b = cn1Flex - m * 100;
+        cn1 = (m * flexTemp) + b;
       } else {
-        mach = cas2mach(300, ambientPressure);
-        if (mach > 0.78)
-          mach = 0.78;
+        m = (cn1Last - cn1Flat) / (lp - cp);
+        b = cn1Last - m * lp;
+        cn1 = (m * flexTemp) + b;
       }
-      break;
-    case 3:
-      rowMin = 59;
-      rowMax = 71;
-      mach = cas2mach(230, ambientPressure);
-      break;
-  }
-
-  // Check for over/ underflows. Else, find top row value
-  if (altitude <= limits[rowMin][0]) {
-    hiAltRow = rowMin;
-    loAltRow = rowMin;
-  } else if (altitude >= limits[rowMax][0]) {
-    hiAltRow = rowMax;
-    loAltRow = rowMax;
-  } else {
-    hiAltRow = finder(altitude, rowMin);
-    loAltRow = hiAltRow - 1;
-  }
+    } else {  // CN1 for All other cases
+      if (ambientTemp <= cp) {
+        cn1 = cn1Flat;
+      } else {
+        m = (cn1Last - cn1Flat) / (lp - cp);
+        b = cn1Last - m * lp;
+        cn1 = (m * ambientTemp) + b;
+      }
+    }
 
-  // Define key table variables and interpolation
-  cp = interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][1], limits[hiAltRow][1]);
-  lp = interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][2], limits[hiAltRow][2]);
-  cn1Flat = interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][3], limits[hiAltRow][3]);
-  cn1Last = interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][4], limits[hiAltRow][4]);
-  cn1Flex = interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][5], limits[hiAltRow][5]);
-
-  if (flexTemp > 0 && type <= 1) { // CN1 for Flex Case
-    if (flexTemp <= cp) {
-      cn1 = cn1Flat;
-    } else if (flexTemp > lp) {
-      m = (cn1Flex - cn1Last) / (100 - lp);
-      b = cn1Flex - m * 100;
-      cn1 = (m * flexTemp) + b;
+    // Define bleed rating/ derating
+    int config = bleedIndex(ac, nacelle, wing);
+    if (flexTemp > lp && type <= GA) {
+      bleed = flexBleedTable[config];
     } else {
-      m = (cn1Last - cn1Flat) / (lp - cp);
-      b = cn1Last - m * lp;
-      cn1 = (m * flexTemp) + b;
+      bleed = bleedTable[type][altitude < 8000 ? 0 : 1][ambientTemp < cp ? 0 : 1][config];
     }
+
+    // Setting N1
+    double theta2 = ((273.15 + ambientTemp) / 288.15) * (1 + 0.2 * (mach * mach));
+    return (cn1 * sqrt(theta2)) + bleed;
   }
-  else { // CN1 for All other cases
-    if (ambientTemp <= cp) {
-      cn1 = cn1Flat;
+
+  /// <summary>
+  /// Computes the TO, GA, FLEX (TO and GA), CLB and MCT N1 limits in one call.
+  /// TO and GA limits are evaluated at or below 16600ft, FLEX limits are only computed with a flex temperature set.
+  /// Returns the previous result while all inputs stay within their quantization step.
+  /// </summary>
+  const N1Limits&
+  compute(double pressAltitude, double ambientTemp, double ambientPressure, double flexTemp, double ac, double nacelle, double wing) {
+    long long altitude = llround(pressAltitude / ALTITUDE_STEP);
+    long long temperature = llround(ambientTemp / TEMPERATURE_STEP);
+    long long pressure = llround(ambientPressure / PRESSURE_STEP);
+    int bleed = bleedIndex(ac, nacelle, wing);
+
+    if (cacheValid && altitude == altitudeKey && temperature == temperatureKey && pressure == pressureKey && flexTemp == flexTempKey &&
+        bleed == bleedKey) {
+      return cachedLimits;
+    }
+
+    double takeoffAltitude = min(16600.0, pressAltitude);
+
+    cachedLimits.to = limitN1(TO, takeoffAltitude, ambientTemp, ambientPressure, 0, ac, nacelle, wing);
+    cachedLimits.ga = limitN1(GA, takeoffAltitude, ambientTemp, ambientPressure, 0, ac, nacelle, wing);
+    if (flexTemp > 0) {
+      cachedLimits.flexTo = limitN1(TO, takeoffAltitude, ambientTemp, ambientPressure, flexTemp, ac, nacelle, wing);
+      cachedLimits.flexGa = limitN1(GA, takeoffAltitude, ambientTemp, ambientPressure, flexTemp, ac, nacelle, wing);
     } else {
-      m = (cn1Last - cn1Flat) / (lp - cp);
-      b = cn1Last - m * lp;
-      cn1 = (m * ambientTemp) + b;
+      cachedLimits.flexTo = 0;
+      cachedLimits.flexGa = 0;
     }
-  }
+    cachedLimits.clb = limitN1(CLB, pressAltitude, ambientTemp, ambientPressure, 0, ac, nacelle, wing);
+    cachedLimits.mct = limitN1(MCT, pressAltitude, ambientTemp, ambientPressure, 0, ac, nacelle, wing);
 
-  // Define bleed rating/ derating
-  bleed = bleedTotal(type, altitude, ambientTemp, cp, lp, flexTemp, ac, nacelle, wing);
-
-  // Setting N1
-  n1 = (cn1 * sqrt(ratios->theta2(mach, ambientTemp))) + bleed;
-  /*if (type == 3) {
-    std::cout << "FADEC: bleed= " << bleed << " cn1= " << cn1 << " theta2= " << sqrt(ratios->theta2(mach, ambientTemp))
-              << " n1= " << n1 << std::endl;
-  }*/
-  return n1;
-}
\ No newline at end of file
+    cacheValid = true;
+    altitudeKey = altitude;
+    temperatureKey = temperature;
+    pressureKey = pressure;
+    flexTempKey = flexTemp;
+    bleedKey = bleed;
+
+    return cachedLimits;
+  }
+};
@@ -1,40 +1,58 @@
 #pragma once
 
-#include <fstream>
+#include <chrono>
+#include <string>
 
 #include "AdditionalData.h"
 #include "AutopilotLaws.h"
 #include "AutopilotStateMachine.h"
 #include "Autothrust.h"
 #include "EngineData.h"
-#include "zfstream.h"
+#include "FlightDataRecorderFile.h"
+#include "FlightDataRecorderSampler.h"
 
 class FlightDataRecorder {
  public:
-  // IMPORTANT: this constant needs to increased with every interface change
-  const uint64_t INTERFACE_VERSION = 25;
+  // IMPORTANT: this constant needs to increased with every interface change, tools/fdr2csv needs a schema for each version
+  const uint64_t INTERFACE_VERSION = 26;
 
   void initialize();
 
-  void update(AutopilotStateMachineModelClass* autopilotStateMachine,
+  // the law is only used to trigger full rate recording when it degrades
+  void update(double deltaTime,
+              AutopilotStateMachineModelClass* autopilotStateMachine,
               AutopilotLawsModelClass* autopilotLaws,
               AutothrustModelClass* autoThrust,
               const EngineData& engineData,
-              const AdditionalData& additionalData);
+              const AdditionalData& additionalData,
+              bool isNormalLawActive);
 
   void terminate();
 
  private:
   const std::string CONFIGURATION_FILEPATH = "\\work\\FlightDataRecorder.ini";
+  static constexpr const char* DEFAULT_TRIGGERS =
+      "ap_disconnect,law_degradation,master_warning,bank_angle,pitch_angle,overspeed,alpha_protection";
 
   bool isEnabled = false;
   int sampleCounter = false;
   int maximumSampleCounter = 0;
   int maximumFileCount = 0;
-  std::shared_ptr<gzofstream> fileStream;
+  double flushInterval = 0.0;
+  FlightDataRecorderCodec codec = FlightDataRecorderCodec::Fast;
+  int compressionLevel = 0;
+  FlightDataRecorderTransform transform = FlightDataRecorderTransform::Shuffle;
+  std::chrono::steady_clock::time_point lastFlushTime;
+  FlightDataRecorderFile file;
+  FlightDataRecorderSampler sampler;
+  uint32_t recordSize = 0;
+
+  void writeRecords();
 
   void manageFlightDataRecorderFiles();
 
+  void flushFlightDataRecorderFile();
+
   std::string getFlightDataRecorderFilename();
 
   void cleanUpFlightDataRecorderFiles();
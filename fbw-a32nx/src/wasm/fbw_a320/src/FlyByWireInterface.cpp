@@ -1,49 +1,72 @@
 #include <ini.h>
 #include <ini_type_conversion.h>
 #include <cmath>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 
 #include "Arinc429Utils.h"
 #include "FlyByWireInterface.h"
+#include "StartupTrace.h"
 #include "SimConnectData.h"
 
 using namespace mINI;
 
 bool FlyByWireInterface::connect() {
+  StartupTrace startupTrace("connect");
+
   // setup local variables
+  startupTrace.beginPhase("setupLocalVariables");
   setupLocalVariables();
 
   // load configuration
+  startupTrace.beginPhase("loadConfiguration");
   loadConfiguration();
 
   // setup handlers
   spoilersHandler = std::make_shared<SpoilersHandler>();
 
   // initialize failures handler
+  startupTrace.beginPhase("initializeFailures");
   failuresConsumer.initialize();
+  if (!failureScheduleFile.empty()) {
+    failuresConsumer.loadScheduleFromFile(FAILURE_SCHEDULE_DIRECTORY + failureScheduleFile);
+  }
 
   // initialize model
+  startupTrace.beginPhase("initializeModels");
   autopilotStateMachine.initialize();
   autopilotLaws.initialize();
   autoThrust.initialize();
 
   // initialize flight data recorder
+  startupTrace.beginPhase("initializeFlightDataRecorder");
   flightDataRecorder.initialize();
 
   // connect to sim connect
+  startupTrace.beginPhase("connectSimConnect");
   bool success = simConnectInterface.connect(
       clientDataEnabled, autopilotStateMachineEnabled, autopilotLawsEnabled, flyByWireEnabled, elacDisabled, secDisabled, facDisabled,
       throttleAxis, spoilersHandler, flightControlsKeyChangeAileron, flightControlsKeyChangeElevator, flightControlsKeyChangeRudder,
       disableXboxCompatibilityRudderAxisPlusMinus, enableRudder2AxisMode, idMinimumSimulationRate->get(), idMaximumSimulationRate->get(),
       limitSimulationRateByPerformance);
 
+  // use shared memory for externally executed computers if configured
+  if (success) {
+    simConnectInterface.setupComputerTransport(externalComputerSharedMemory, externalComputerTimeout);
+  }
+
   // request data
+  startupTrace.beginPhase("requestData");
   if (!simConnectInterface.requestData()) {
     std::cout << "WASM: Request data failed!" << std::endl;
     return false;
   }
 
+  startupTrace.finish();
+  std::cout << "WASM: STARTUP   : " << LocalVariable::getRegisteredCount() << " of " << LocalVariable::getCount();
+  std::cout << " local variables registered, the others are registered on use or over the next frames" << std::endl;
+
   return success;
 }
 
@@ -68,6 +91,9 @@ void FlyByWireInterface::disconnect() {
 bool FlyByWireInterface::update(double sampleTime) {
   bool result = true;
 
+  // register the local variables which have not been used yet a few at a time
+  LocalVariable::registerPending(LOCAL_VARIABLE_REGISTRATIONS_PER_UPDATE);
+
   // update failures handler
   failuresConsumer.update();
 
@@ -89,25 +115,41 @@ bool FlyByWireInterface::update(double sampleTime) {
   // do not process laws in pause or slew
   if (simConnectInterface.getSimData().slew_on) {
     wasInSlew = true;
+    simConnectInterface.resetSimInputAutopilot();
     return result;
   } else if (pauseDetected || simConnectInterface.getSimData().cameraState >= 10.0) {
+    simConnectInterface.resetSimInputAutopilot();
     return result;
   }
 
+  // apply scheduled failures, the schedule runs on the time of the laws and stands still in pause and slew
+  failuresConsumer.updateSchedule(calculatedSampleTime);
+
   // update altimeter setting
   result &= updateAltimeterSetting(calculatedSampleTime);
 
-  // update autopilot state machine
-  result &= updateAutopilotStateMachine(calculatedSampleTime);
+  // determine the steps of the models running at a fixed rate, in between the outputs of the last step are held
+  int autopilotSteps = autopilotScheduler->advance(calculatedSampleTime);
+  int computerSteps = computerScheduler->advance(calculatedSampleTime);
 
-  // update autopilot laws
-  result &= updateAutopilotLaws(calculatedSampleTime);
+  auto autopilotStartTime = std::chrono::steady_clock::now();
+  for (int step = 0; step < autopilotSteps; step++) {
+    // update autopilot state machine, the inputs latched since the last step are consumed by the first step
+    result &= updateAutopilotStateMachine(autopilotScheduler->getStepTime());
+    simConnectInterface.resetSimInputAutopilot();
+
+    // update autopilot laws
+    result &= updateAutopilotLaws(autopilotScheduler->getStepTime());
+  }
 
   // update fly-by-wire
   result &= updateFlyByWire(calculatedSampleTime);
 
   // get throttle data and process it
-  result &= updateAutothrust(calculatedSampleTime);
+  for (int step = 0; step < autopilotSteps; step++) {
+    result &= updateAutothrust(autopilotScheduler->getStepTime());
+  }
+  autopilotScheduler->recordExecutionTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - autopilotStartTime).count());
 
   for (int i = 0; i < 2; i++) {
     result &= updateRa(i);
@@ -125,21 +167,25 @@ bool FlyByWireInterface::update(double sampleTime) {
     result &= updateAdirs(i);
   }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateElac(calculatedSampleTime, i);
-  }
+  auto computerStartTime = std::chrono::steady_clock::now();
+  for (int step = 0; step < computerSteps; step++) {
+    for (int i = 0; i < 2; i++) {
+      result &= updateElac(computerScheduler->getStepTime(), i);
+    }
 
-  for (int i = 0; i < 3; i++) {
-    result &= updateSec(calculatedSampleTime, i);
-  }
+    for (int i = 0; i < 3; i++) {
+      result &= updateSec(computerScheduler->getStepTime(), i);
+    }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateFac(calculatedSampleTime, i);
-  }
+    for (int i = 0; i < 2; i++) {
+      result &= updateFac(computerScheduler->getStepTime(), i);
+    }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateFcdc(calculatedSampleTime, i);
+    for (int i = 0; i < 2; i++) {
+      result &= updateFcdc(computerScheduler->getStepTime(), i);
+    }
   }
+  computerScheduler->recordExecutionTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - computerStartTime).count());
 
   result &= updateServoSolenoidStatus();
 
@@ -155,8 +201,25 @@ bool FlyByWireInterface::update(double sampleTime) {
   // update FO side with FO Sync ON
   result &= updateFoSide(calculatedSampleTime);
 
-  // update flight data recorder
-  flightDataRecorder.update(&autopilotStateMachine, &autopilotLaws, &autoThrust, engineData, additionalData);
+  // report the steps executed by the schedulers
+  if (schedulerBudgetReportEnabled && monotonicTime - previousSchedulerBudgetReportTime >= SCHEDULER_BUDGET_REPORT_INTERVAL) {
+    autopilotScheduler->printBudgetReport();
+    computerScheduler->printBudgetReport();
+    previousSchedulerBudgetReportTime = monotonicTime;
+  }
+
+  // report the coalescing of the axis events
+  if (eventCounterReportEnabled && monotonicTime - previousEventCounterReportTime >= EVENT_COUNTER_REPORT_INTERVAL) {
+    simConnectInterface.printEventCounterReport();
+    previousEventCounterReportTime = monotonicTime;
+  }
+
+  // update flight data recorder, a degradation of the law reported by the first valid FCDC triggers full rate recording
+  int lawFcdcIndex = Arinc429Utils::isNo(fcdcsBusOutputs[0].efcs_status_word_1) ? 0 : 1;
+  const auto& efcsStatusWord = fcdcsBusOutputs[lawFcdcIndex].efcs_status_word_1;
+  bool isNormalLawActive = Arinc429Utils::bitFromValue(efcsStatusWord, 11) && Arinc429Utils::bitFromValue(efcsStatusWord, 16);
+  flightDataRecorder.update(calculatedSampleTime, &autopilotStateMachine, &autopilotLaws, &autoThrust, engineData, additionalData,
+                            isNormalLawActive);
 
   // if default AP is on -> disconnect it
   if (simConnectInterface.getSimData().autopilot_master_on) {
@@ -186,6 +249,15 @@ void FlyByWireInterface::loadConfiguration() {
   secDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "SEC_DISABLED", -1);
   facDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "FAC_DISABLED", -1);
   tailstrikeProtectionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "TAILSTRIKE_PROTECTION_ENABLED", false);
+  externalComputerSharedMemory = INITypeConversion::getBoolean(iniStructure, "MODEL", "EXTERNAL_COMPUTER_SHARED_MEMORY", false);
+  externalComputerTimeout = INITypeConversion::getDouble(iniStructure, "MODEL", "EXTERNAL_COMPUTER_TIMEOUT", 0.1);
+  autopilotRate = INITypeConversion::getDouble(iniStructure, "MODEL", "AUTOPILOT_RATE", 0);
+  computerRate = INITypeConversion::getDouble(iniStructure, "MODEL", "COMPUTER_RATE", 0);
+  maxStepsPerFrame = INITypeConversion::getInteger(iniStructure, "MODEL", "MAX_STEPS_PER_FRAME", 8);
+
+  // create schedulers, a rate of 0 steps the models once per frame
+  autopilotScheduler = std::make_unique<FixedRateScheduler>("AUTOPILOT", autopilotRate, maxStepsPerFrame);
+  computerScheduler = std::make_unique<FixedRateScheduler>("COMPUTERS", computerRate, maxStepsPerFrame);
 
   // if any model is deactivated we need to enable client data
   clientDataEnabled = (elacDisabled != -1 || secDisabled != -1 || facDisabled != -1 || !autopilotStateMachineEnabled ||
@@ -201,6 +273,11 @@ void FlyByWireInterface::loadConfiguration() {
   std::cout << "WASM: MODEL     : SEC_DISABLED                         = " << secDisabled << std::endl;
   std::cout << "WASM: MODEL     : FAC_DISABLED                         = " << facDisabled << std::endl;
   std::cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED        = " << tailstrikeProtectionEnabled << std::endl;
+  std::cout << "WASM: MODEL     : EXTERNAL_COMPUTER_SHARED_MEMORY      = " << externalComputerSharedMemory << std::endl;
+  std::cout << "WASM: MODEL     : EXTERNAL_COMPUTER_TIMEOUT            = " << externalComputerTimeout << std::endl;
+  std::cout << "WASM: MODEL     : AUTOPILOT_RATE                       = " << autopilotRate << std::endl;
+  std::cout << "WASM: MODEL     : COMPUTER_RATE                        = " << computerRate << std::endl;
+  std::cout << "WASM: MODEL     : MAX_STEPS_PER_FRAME                  = " << maxStepsPerFrame << std::endl;
 
   // --------------------------------------------------------------------------
   // load values - autopilot
@@ -208,12 +285,26 @@ void FlyByWireInterface::loadConfiguration() {
   idMaximumSimulationRate->set(INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "MAXIMUM_SIMULATION_RATE", 8));
   limitSimulationRateByPerformance = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "LIMIT_SIMULATION_RATE_BY_PERFORMANCE", true);
   simulationRateReductionEnabled = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "SIMULATION_RATE_REDUCTION_ENABLED", true);
+  subSteppingEnabled = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "SUB_STEPPING_ENABLED", false);
+  subSteppingMaxStepTime = INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "SUB_STEPPING_MAX_STEP_TIME", 0.1);
+  subSteppingFrameBudget = INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "SUB_STEPPING_FRAME_BUDGET", 0.005);
+
+  // split long frames at high simulation rates into several steps instead of reducing the simulation rate
+  if (subSteppingEnabled) {
+    autopilotScheduler->setMaxStepTime(subSteppingMaxStepTime);
+    autopilotScheduler->setFrameBudget(subSteppingFrameBudget);
+    computerScheduler->setMaxStepTime(subSteppingMaxStepTime);
+    computerScheduler->setFrameBudget(subSteppingFrameBudget);
+  }
 
   // print configuration into console
   std::cout << "WASM: AUTOPILOT : MINIMUM_SIMULATION_RATE                     = " << idMinimumSimulationRate->get() << std::endl;
   std::cout << "WASM: AUTOPILOT : MAXIMUM_SIMULATION_RATE                     = " << idMaximumSimulationRate->get() << std::endl;
   std::cout << "WASM: AUTOPILOT : LIMIT_SIMULATION_RATE_BY_PERFORMANCE        = " << limitSimulationRateByPerformance << std::endl;
   std::cout << "WASM: AUTOPILOT : SIMULATION_RATE_REDUCTION_ENABLED           = " << simulationRateReductionEnabled << std::endl;
+  std::cout << "WASM: AUTOPILOT : SUB_STEPPING_ENABLED                        = " << subSteppingEnabled << std::endl;
+  std::cout << "WASM: AUTOPILOT : SUB_STEPPING_MAX_STEP_TIME                  = " << subSteppingMaxStepTime << std::endl;
+  std::cout << "WASM: AUTOPILOT : SUB_STEPPING_FRAME_BUDGET                   = " << subSteppingFrameBudget << std::endl;
 
   // --------------------------------------------------------------------------
   // load values - autothrust
@@ -249,10 +340,21 @@ void FlyByWireInterface::loadConfiguration() {
   // load values - logging
   idLoggingFlightControlsEnabled->set(INITypeConversion::getBoolean(iniStructure, "LOGGING", "FLIGHT_CONTROLS_ENABLED", false));
   idLoggingThrottlesEnabled->set(INITypeConversion::getBoolean(iniStructure, "LOGGING", "THROTTLES_ENABLED", false));
+  schedulerBudgetReportEnabled = INITypeConversion::getBoolean(iniStructure, "LOGGING", "SCHEDULER_BUDGET_ENABLED", false);
+  eventCounterReportEnabled = INITypeConversion::getBoolean(iniStructure, "LOGGING", "EVENT_COUNTERS_ENABLED", false);
 
   // print configuration into console
   std::cout << "WASM: LOGGING : FLIGHT_CONTROLS_ENABLED = " << idLoggingFlightControlsEnabled->get() << std::endl;
   std::cout << "WASM: LOGGING : THROTTLES_ENABLED = " << idLoggingThrottlesEnabled->get() << std::endl;
+  std::cout << "WASM: LOGGING : SCHEDULER_BUDGET_ENABLED = " << schedulerBudgetReportEnabled << std::endl;
+  std::cout << "WASM: LOGGING : EVENT_COUNTERS_ENABLED = " << eventCounterReportEnabled << std::endl;
+
+  // --------------------------------------------------------------------------
+  // load values - failures
+  failureScheduleFile = iniStructure.get("FAILURES").get("SCHEDULE_FILE");
+
+  // print configuration into console
+  std::cout << "WASM: FAILURES : SCHEDULE_FILE = " << failureScheduleFile << std::endl;
 
   // --------------------------------------------------------------------------
   // create axis and load configuration
@@ -796,9 +898,7 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   // set sample time
   simConnectInterface.setSampleTime(sampleTime);
 
-  // reset input
-  simConnectInterface.resetSimInputAutopilot();
-
+  // reset input, the autopilot inputs are latched until a step of the autopilot consumes them
   simConnectInterface.resetSimInputRudderTrim();
 
   // set logging options
@@ -898,11 +998,17 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
 }
 
 bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
+  // with sub-stepping the laws are only affected if the last frame could not be split into short enough steps
+  double performanceSampleTime = calculatedSampleTime;
+  if (subSteppingEnabled) {
+    performanceSampleTime = max(autopilotScheduler->getEffectiveStepTime(), computerScheduler->getEffectiveStepTime());
+  }
+
   // check calculated delta time for performance issues (to also take sim rate into account)
-  if (calculatedSampleTime > MAX_ACCEPTABLE_SAMPLE_TIME && lowPerformanceTimer < LOW_PERFORMANCE_TIMER_THRESHOLD) {
+  if (performanceSampleTime > MAX_ACCEPTABLE_SAMPLE_TIME && lowPerformanceTimer < LOW_PERFORMANCE_TIMER_THRESHOLD) {
     // performance is low -> increase counter
     lowPerformanceTimer++;
-  } else if (calculatedSampleTime < MAX_ACCEPTABLE_SAMPLE_TIME) {
+  } else if (performanceSampleTime < MAX_ACCEPTABLE_SAMPLE_TIME) {
     // performance is ok -> reset counter
     lowPerformanceTimer = 0;
   }
@@ -1319,6 +1425,7 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
   if (elacIndex == elacDisabled) {
     simConnectInterface.setClientDataElacDiscretes(elacs[elacIndex].modelInputs.in.discrete_inputs);
     simConnectInterface.setClientDataElacAnalog(elacs[elacIndex].modelInputs.in.analog_inputs);
+    simConnectInterface.exchangeClientDataElac(elacIndex);
 
     elacsDiscreteOutputs[elacIndex] = simConnectInterface.getClientDataElacDiscretesOutput();
     elacsAnalogOutputs[elacIndex] = simConnectInterface.getClientDataElacAnalogsOutput();
@@ -1492,6 +1599,7 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
   if (secIndex == secDisabled) {
     simConnectInterface.setClientDataSecDiscretes(secs[secIndex].modelInputs.in.discrete_inputs);
     simConnectInterface.setClientDataSecAnalog(secs[secIndex].modelInputs.in.analog_inputs);
+    simConnectInterface.exchangeClientDataSec(secIndex);
 
     secsDiscreteOutputs[secIndex] = simConnectInterface.getClientDataSecDiscretesOutput();
     secsAnalogOutputs[secIndex] = simConnectInterface.getClientDataSecAnalogsOutput();
@@ -1652,6 +1760,7 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
   if (facIndex == facDisabled) {
     simConnectInterface.setClientDataFacDiscretes(facs[facIndex].modelInputs.in.discrete_inputs);
     simConnectInterface.setClientDataFacAnalog(facs[facIndex].modelInputs.in.analog_inputs);
+    simConnectInterface.exchangeClientDataFac(facIndex);
 
     facsDiscreteOutputs[facIndex] = simConnectInterface.getClientDataFacDiscretesOutput();
     facsAnalogOutputs[facIndex] = simConnectInterface.getClientDataFacAnalogsOutput();
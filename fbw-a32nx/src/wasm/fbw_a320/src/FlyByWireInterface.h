@@ -10,6 +10,7 @@
 #include "Autothrust.h"
 #include "CalculatedRadioReceiver.h"
 #include "EngineData.h"
+#include "FixedRateScheduler.h"
 #include "FlightDataRecorder.h"
 #include "InterpolatingLookupTable.h"
 #include "LocalVariable.h"
@@ -37,6 +38,7 @@ class FlyByWireInterface {
 
  private:
   const std::string CONFIGURATION_FILEPATH = "\\work\\ModelConfiguration.ini";
+  const std::string FAILURE_SCHEDULE_DIRECTORY = "\\work\\";
 
   static constexpr double MAX_ACCEPTABLE_SAMPLE_TIME = 0.22;
   static constexpr uint32_t LOW_PERFORMANCE_TIMER_THRESHOLD = 10;
@@ -47,12 +49,26 @@ class FlyByWireInterface {
 
   double monotonicTime = 0;
 
+  static constexpr double SCHEDULER_BUDGET_REPORT_INTERVAL = 10;
+  static constexpr size_t LOCAL_VARIABLE_REGISTRATIONS_PER_UPDATE = 32;
+  bool schedulerBudgetReportEnabled = false;
+  double previousSchedulerBudgetReportTime = 0;
+  static constexpr double EVENT_COUNTER_REPORT_INTERVAL = 10;
+  bool eventCounterReportEnabled = false;
+  double previousEventCounterReportTime = 0;
+
+  std::string failureScheduleFile;
+
   int currentApproachCapability = 0;
   double previousApproachCapabilityUpdateTime = 0;
 
   bool simulationRateReductionEnabled = true;
   bool limitSimulationRateByPerformance = true;
 
+  bool subSteppingEnabled = false;
+  double subSteppingMaxStepTime = 0.1;
+  double subSteppingFrameBudget = 0.005;
+
   double targetSimulationRate = 1;
   bool targetSimulationRateModified = false;
 
@@ -96,6 +112,14 @@ class FlyByWireInterface {
   bool enableRudder2AxisMode = false;
 
   bool clientDataEnabled = false;
+  bool externalComputerSharedMemory = false;
+  double externalComputerTimeout = 0.1;
+  double autopilotRate = 0;
+  double computerRate = 0;
+  int maxStepsPerFrame = 8;
+
+  std::unique_ptr<FixedRateScheduler> autopilotScheduler;
+  std::unique_ptr<FixedRateScheduler> computerScheduler;
 
   bool last_fd1_active = false;
   bool last_fd2_active = false;
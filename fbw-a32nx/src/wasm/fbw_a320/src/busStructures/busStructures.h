@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../Arinc429.h"
+#include "Arinc429.h"
 #include "../model/ElacComputer_types.h"
 #include "../model/SecComputer_types.h"
 
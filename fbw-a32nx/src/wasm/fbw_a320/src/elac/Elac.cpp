@@ -39,7 +39,10 @@ void Elac::update(double deltaTime, double simulationTime, bool faultActive, boo
   elacComputer.setExternalInputs(&modelInputs);
   modelInputs.in.sim_data.computer_running = monitoringHealthy;
   elacComputer.step();
-  modelOutputs = elacComputer.getExternalOutputs().out;
+  const elac_outputs& outputs = elacComputer.getExternalOutputs().out;
+  modelOutputs.discrete_outputs = outputs.discrete_outputs;
+  modelOutputs.analog_outputs = outputs.analog_outputs;
+  modelOutputs.bus_outputs = outputs.bus_outputs;
 }
 
 // Perform self monitoring
@@ -159,3 +162,27 @@ base_elac_analog_outputs Elac::getAnalogOutputs() {
 
   return output;
 }
+
+void Elac::saveSnapshot(Snapshot& snapshot) const {
+  elacComputer.saveSnapshot(&snapshot.model);
+  snapshot.modelInputs = modelInputs;
+  snapshot.modelOutputs = modelOutputs;
+  snapshot.monitoringHealthy = monitoringHealthy;
+  snapshot.prevEngageButtonWasPressed = prevEngageButtonWasPressed;
+  snapshot.powerSupplyOutageTime = powerSupplyOutageTime;
+  snapshot.powerSupplyFault = powerSupplyFault;
+  snapshot.selfTestTimer = selfTestTimer;
+  snapshot.selfTestComplete = selfTestComplete;
+}
+
+void Elac::restoreSnapshot(const Snapshot& snapshot) {
+  elacComputer.restoreSnapshot(&snapshot.model);
+  modelInputs = snapshot.modelInputs;
+  modelOutputs = snapshot.modelOutputs;
+  monitoringHealthy = snapshot.monitoringHealthy;
+  prevEngageButtonWasPressed = snapshot.prevEngageButtonWasPressed;
+  powerSupplyOutageTime = snapshot.powerSupplyOutageTime;
+  powerSupplyFault = snapshot.powerSupplyFault;
+  selfTestTimer = snapshot.selfTestTimer;
+  selfTestComplete = snapshot.selfTestComplete;
+}
@@ -1,13 +1,15 @@
 #pragma once
 
+#include <cstdint>
+
 #include "ElacIO.h"
 
-#include "../Arinc429.h"
+#include "Arinc429.h"
 #include "../model/ElacComputer.h"
-#include "../utils/ConfirmNode.h"
-#include "../utils/HysteresisNode.h"
-#include "../utils/PulseNode.h"
-#include "../utils/SRFlipFlop.h"
+#include "utils/ConfirmNode.h"
+#include "utils/HysteresisNode.h"
+#include "utils/PulseNode.h"
+#include "utils/SRFlipFlop.h"
 
 class Elac {
  public:
@@ -25,6 +27,34 @@ class Elac {
 
   ElacComputer::ExternalInputs_ElacComputer_T modelInputs = {};
 
+  // Outputs of the model used by the interface. The remaining outputs stay in the model, which keeps the copy after
+  // each step and the footprint of the computer small.
+  struct ModelOutputs {
+    base_elac_discrete_outputs discrete_outputs;
+    base_elac_analog_outputs analog_outputs;
+    base_elac_out_bus bus_outputs;
+  };
+
+  // State of the computer and its model, which can be restored to continue from a checkpoint.
+  // It is trivially copyable, see ModelSnapshot.h for storing it as a blob.
+  struct Snapshot {
+    static constexpr uint32_t ID = 0x43414c45;  // "ELAC"
+
+    ElacComputer::Snapshot_ElacComputer_T model;
+    ElacComputer::ExternalInputs_ElacComputer_T modelInputs;
+    ModelOutputs modelOutputs;
+    bool monitoringHealthy;
+    bool prevEngageButtonWasPressed;
+    double powerSupplyOutageTime;
+    bool powerSupplyFault;
+    double selfTestTimer;
+    bool selfTestComplete;
+  };
+
+  void saveSnapshot(Snapshot& snapshot) const;
+
+  void restoreSnapshot(const Snapshot& snapshot);
+
  private:
   void initSelfTests(bool viaPushButton);
 
@@ -40,7 +70,7 @@ class Elac {
 
   // Model
   ElacComputer elacComputer;
-  elac_outputs modelOutputs;
+  ModelOutputs modelOutputs;
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
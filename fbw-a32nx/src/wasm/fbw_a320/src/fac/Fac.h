@@ -1,9 +1,11 @@
 #pragma once
 
-#include "../Arinc429.h"
-#include "../model/FacComputer.h"
-#include "../utils/PulseNode.h"
-#include "../utils/SRFlipFlop.h"
+#include <cstdint>
+
+#include "Arinc429.h"
+#include "model/FacComputer.h"
+#include "utils/PulseNode.h"
+#include "utils/SRFlipFlop.h"
 #include "FacIO.h"
 
 class Fac {
@@ -22,6 +24,36 @@ class Fac {
 
   FacComputer::ExternalInputs_FacComputer_T modelInputs = {};
 
+  // Outputs of the model used by the interface. The remaining outputs stay in the model, which keeps the copy after
+  // each step and the footprint of the computer small.
+  struct ModelOutputs {
+    base_fac_discrete_outputs discrete_outputs;
+    base_fac_analog_outputs analog_outputs;
+    base_fac_bus bus_outputs;
+  };
+
+  // State of the computer and its model, which can be restored to continue from a checkpoint.
+  // It is trivially copyable, see ModelSnapshot.h for storing it as a blob.
+  struct Snapshot {
+    static constexpr uint32_t ID = 0x20434146;  // "FAC"
+
+    FacComputer::Snapshot_FacComputer_T model;
+    FacComputer::ExternalInputs_FacComputer_T modelInputs;
+    ModelOutputs modelOutputs;
+    bool facHealthy;
+    SRFlipFlop facHealthyFlipFlop = SRFlipFlop(false);
+    PulseNode pushbuttonPulse = PulseNode(true);
+    double powerSupplyOutageTime;
+    bool longPowerFailure;
+    bool shortPowerFailure;
+    double selfTestTimer;
+    bool selfTestComplete;
+  };
+
+  void saveSnapshot(Snapshot& snapshot) const;
+
+  void restoreSnapshot(const Snapshot& snapshot);
+
  private:
   void initSelfTests();
 
@@ -35,7 +67,7 @@ class Fac {
 
   // Model
   FacComputer facComputer;
-  fac_outputs modelOutputs;
+  ModelOutputs modelOutputs;
 
   // Computer Self-monitoring vars
   bool facHealthy;
@@ -1,18 +1,10 @@
 #include "FailuresConsumer.h"
-#include <utility>
 #include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
 
-FailuresConsumer::FailuresConsumer() {
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Elac1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Elac2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Sec1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Sec2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Sec3, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fac1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fac2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fcdc1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fcdc2, false));
-}
+FailuresConsumer::FailuresConsumer() {}
 
 void FailuresConsumer::initialize() {
   activateLvar = std::make_unique<LocalVariable>("A32NX_FAILURE_ACTIVATE");
@@ -24,8 +16,23 @@ void FailuresConsumer::update() {
   updateDeactivate();
 }
 
-bool FailuresConsumer::isActive(Failures failure) {
-  return (*activeFailures.find(failure)).second;
+void FailuresConsumer::updateSchedule(double deltaTime) {
+  if (nextScheduledFailure >= schedule.size()) {
+    return;
+  }
+
+  scheduleTime += deltaTime;
+  // small tolerance so that an entry at a multiple of the step time is not delayed by a step due to rounding
+  while (nextScheduledFailure < schedule.size() && schedule[nextScheduledFailure].time <= scheduleTime + 1e-6) {
+    const auto& entry = schedule[nextScheduledFailure];
+    activeFailures.set(getFailureIndex(entry.failure), entry.active);
+    nextScheduledFailure++;
+  }
+}
+
+bool FailuresConsumer::isActive(Failures failure) const {
+  int index = getFailureIndex(failure);
+  return index >= 0 && activeFailures.test(index);
 }
 
 void FailuresConsumer::updateActivate() {
@@ -43,20 +50,70 @@ void FailuresConsumer::updateDeactivate() {
 }
 
 bool FailuresConsumer::setIfFound(double identifier, bool value) {
-  auto pair = activeFailures.find(static_cast<Failures>(identifier));
-  if (pair == activeFailures.end()) {
+  int index = getFailureIndex(static_cast<Failures>(identifier));
+  if (index < 0) {
     return false;
   } else {
-    (*pair).second = value;
+    activeFailures.set(index, value);
     return true;
   }
 }
 
-bool FailuresConsumer::isAnyActive() {
-  if (std::any_of(activeFailures.begin(), activeFailures.end(), [](auto pair) {
-    return pair.second;
-  })) {
-      return true;
+bool FailuresConsumer::isAnyActive() const {
+  return activeFailures.any();
+}
+
+void FailuresConsumer::loadSchedule(const std::vector<ScheduledFailure>& schedule) {
+  this->schedule.clear();
+  for (const auto& entry : schedule) {
+    if (getFailureIndex(entry.failure) < 0) {
+      std::cout << "WASM: Ignoring unknown failure " << static_cast<int>(entry.failure) << " in failure schedule" << std::endl;
+      continue;
+    }
+    this->schedule.push_back(entry);
   }
-  return false;
+  std::stable_sort(this->schedule.begin(), this->schedule.end(),
+                   [](const ScheduledFailure& a, const ScheduledFailure& b) { return a.time < b.time; });
+
+  nextScheduledFailure = 0;
+  scheduleTime = 0;
+}
+
+bool FailuresConsumer::loadScheduleFromFile(const std::string& filePath) {
+  std::ifstream file(filePath);
+  if (!file.is_open()) {
+    std::cout << "WASM: Failed to open failure schedule " << filePath << std::endl;
+    return false;
+  }
+
+  std::vector<ScheduledFailure> entries;
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(file, line)) {
+    lineNumber++;
+    line = line.substr(0, line.find('#'));
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+      continue;
+    }
+
+    std::istringstream stream(line);
+    double time;
+    int identifier;
+    std::string action;
+    if (!(stream >> time >> identifier >> action) || (action != "activate" && action != "deactivate")) {
+      std::cout << "WASM: Invalid entry in line " << lineNumber << " of failure schedule " << filePath << std::endl;
+      return false;
+    }
+    entries.push_back({time, static_cast<Failures>(identifier), action == "activate"});
+  }
+
+  loadSchedule(entries);
+  std::cout << "WASM: Loaded " << schedule.size() << " scheduled failures from " << filePath << std::endl;
+  return true;
+}
+
+void FailuresConsumer::clearSchedule() {
+  schedule.clear();
+  nextScheduledFailure = 0;
+  scheduleTime = 0;
 }
@@ -1,24 +1,48 @@
 #pragma once
 
-#include <map>
+#include <bitset>
 #include <memory>
+#include <string>
+#include <vector>
 #include "../LocalVariable.h"
 #include "FailureList.h"
 
 class FailuresConsumer {
  public:
+  // failure to activate or clear at a time relative to loading the schedule
+  struct ScheduledFailure {
+    double time;
+    Failures failure;
+    bool active;
+  };
+
   FailuresConsumer();
 
   void update();
 
-  bool isActive(Failures failure);
+  // applies the scheduled failures which are due after the given time has passed
+  void updateSchedule(double deltaTime);
+
+  bool isActive(Failures failure) const;
 
-  bool isAnyActive();
+  bool isAnyActive() const;
 
   void initialize();
 
+  // replaces the schedule, entries with the same time are applied in the given order
+  void loadSchedule(const std::vector<ScheduledFailure>& schedule);
+
+  // reads a schedule with a line "<time in s> <failure identifier> <activate|deactivate>" per entry, # starts a comment
+  bool loadScheduleFromFile(const std::string& filePath);
+
+  void clearSchedule();
+
  private:
-  std::map<Failures, bool> activeFailures;
+  std::bitset<FAILURES_COUNT> activeFailures;
+
+  std::vector<ScheduledFailure> schedule;
+  size_t nextScheduledFailure = 0;
+  double scheduleTime = 0;
 
   void updateActivate();
 
@@ -795,3 +795,25 @@ FcdcDiscreteOutputs Fcdc::getDiscreteOutputs() {
 
   return output;
 }
+
+void Fcdc::saveSnapshot(Snapshot& snapshot) const {
+  snapshot.discreteInputs = discreteInputs;
+  snapshot.busInputs = busInputs;
+  snapshot.priorityLightFlashingClock = priorityLightFlashingClock;
+  snapshot.monitoringHealthy = monitoringHealthy;
+  snapshot.powerSupplyOutageTime = powerSupplyOutageTime;
+  snapshot.powerSupplyFault = powerSupplyFault;
+  snapshot.selfTestTimer = selfTestTimer;
+  snapshot.selfTestComplete = selfTestComplete;
+}
+
+void Fcdc::restoreSnapshot(const Snapshot& snapshot) {
+  discreteInputs = snapshot.discreteInputs;
+  busInputs = snapshot.busInputs;
+  priorityLightFlashingClock = snapshot.priorityLightFlashingClock;
+  monitoringHealthy = snapshot.monitoringHealthy;
+  powerSupplyOutageTime = snapshot.powerSupplyOutageTime;
+  powerSupplyFault = snapshot.powerSupplyFault;
+  selfTestTimer = snapshot.selfTestTimer;
+  selfTestComplete = snapshot.selfTestComplete;
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "FcdcIO.h"
 
 const double LIGHT_FLASHING_PERIOD = 0.25;
@@ -18,6 +20,27 @@ class Fcdc {
 
   FcdcBusInputs busInputs;
 
+  // State of the computer, which can be restored to continue from a checkpoint. The data computed from the inputs is
+  // written by every update of a healthy computer before it is output, so only the inputs and the monitoring, self-test
+  // and light flashing state carried between updates are part of it.
+  // It is trivially copyable, see ModelSnapshot.h for storing it as a blob.
+  struct Snapshot {
+    static constexpr uint32_t ID = 0x43444346;  // "FCDC"
+
+    FcdcDiscreteInputs discreteInputs;
+    FcdcBusInputs busInputs;
+    double priorityLightFlashingClock;
+    bool monitoringHealthy;
+    double powerSupplyOutageTime;
+    bool powerSupplyFault;
+    double selfTestTimer;
+    bool selfTestComplete;
+  };
+
+  void saveSnapshot(Snapshot& snapshot) const;
+
+  void restoreSnapshot(const Snapshot& snapshot);
+
  private:
   void startup();
 
@@ -1,5 +1,6 @@
 #include "SimConnectInterface.h"
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <vector>
@@ -42,6 +43,8 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     this->throttleAxis = throttleAxis;
     // store spoilers handler
     this->spoilersHandler = spoilersHandler;
+    // prepare axis event coalescing
+    prepareAxisEventSlots();
     // store maximum allowed simulation rate
     this->minSimulationRate = minSimulationRate;
     this->maxSimulationRate = maxSimulationRate;
@@ -68,6 +71,8 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     prepareResult &= prepareSimOutputSimConnectDataDefinitions();
     if (clientDataEnabled) {
       prepareResult &= prepareClientDataDefinitions();
+      // externally executed computers exchange their data through client data unless configured otherwise
+      computerTransport = std::make_unique<ClientDataComputerTransport>(hSimConnect);
     }
     // check result
     if (!prepareResult) {
@@ -96,10 +101,13 @@ void SimConnectInterface::disconnect() {
     unregister_key_event_handler_EX1(static_cast<GAUGE_KEY_EVENT_HANDLER_EX1>(processKeyEvent), NULL);
     // info message
     std::cout << "WASM: Disconnecting..." << std::endl;
+    // release computer transport
+    computerTransport.reset();
     // close connection
     SimConnect_Close(hSimConnect);
     // set flag
     isConnected = false;
+    slowSimDataRequested = false;
     // reset handle
     hSimConnect = 0;
     // info message
@@ -119,137 +127,217 @@ void SimConnectInterface::updateSimulationRateLimits(double minSimulationRate, d
 bool SimConnectInterface::prepareSimDataSimConnectDataDefinitions() {
   bool result = true;
 
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "G FORCE", "GFORCE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE PITCH DEGREES", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE BANK DEGREES", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_XYZ, "STRUCT BODY ROTATION VELOCITY", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_XYZ, "STRUCT BODY ROTATION ACCELERATION", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY Z", "METER PER SECOND SQUARED");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY X", "METER PER SECOND SQUARED");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY Y", "METER PER SECOND SQUARED");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE HEADING DEGREES MAGNETIC", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE HEADING DEGREES TRUE", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS GROUND MAGNETIC TRACK", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ELEVATOR POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ELEVATOR TRIM POSITION", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AILERON POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "RUDDER POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "RUDDER TRIM PCT", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INCIDENCE ALPHA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INCIDENCE BETA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "BETA DOT", "DEGREE PER SECOND");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED INDICATED", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED TRUE", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED MACH", "MACH");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GROUND VELOCITY", "KNOTS");
+  for (int tier = 0; tier < SIM_DATA_TIER_COUNT; tier++) {
+    simDataFields[tier].clear();
+    simDataTierSizes[tier] = 0;
+  }
+
+  // values which are continuous in flight are requested every frame, values which are only updated by the
+  // simulation from time to time every second and discrete values or settings each frame they have changed
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "G FORCE", "GFORCE", offsetof(SimData, nz_g));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE PITCH DEGREES", "DEGREE", offsetof(SimData, Theta_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE BANK DEGREES", "DEGREE", offsetof(SimData, Phi_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_XYZ, "STRUCT BODY ROTATION VELOCITY", "STRUCT",
+                       offsetof(SimData, bodyRotationVelocity));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_XYZ, "STRUCT BODY ROTATION ACCELERATION", "STRUCT",
+                       offsetof(SimData, bodyRotationAcceleration));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY Z", "METER PER SECOND SQUARED",
+                       offsetof(SimData, bx_m_s2));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY X", "METER PER SECOND SQUARED",
+                       offsetof(SimData, by_m_s2));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "ACCELERATION BODY Y", "METER PER SECOND SQUARED",
+                       offsetof(SimData, bz_m_s2));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE HEADING DEGREES MAGNETIC", "DEGREES",
+                       offsetof(SimData, Psi_magnetic_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE HEADING DEGREES TRUE", "DEGREES",
+                       offsetof(SimData, Psi_true_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GPS GROUND MAGNETIC TRACK", "DEGREES",
+                       offsetof(SimData, Psi_magnetic_track_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "ELEVATOR POSITION", "POSITION", offsetof(SimData, eta_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "ELEVATOR TRIM POSITION", "DEGREE", offsetof(SimData, eta_trim_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AILERON POSITION", "POSITION", offsetof(SimData, xi_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "RUDDER POSITION", "POSITION", offsetof(SimData, zeta_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "RUDDER TRIM PCT", "PERCENT OVER 100",
+                       offsetof(SimData, zeta_trim_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "INCIDENCE ALPHA", "DEGREE", offsetof(SimData, alpha_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "INCIDENCE BETA", "DEGREE", offsetof(SimData, beta_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "BETA DOT", "DEGREE PER SECOND", offsetof(SimData, beta_dot_deg_s));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED INDICATED", "KNOTS", offsetof(SimData, V_ias_kn));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED TRUE", "KNOTS", offsetof(SimData, V_tas_kn));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AIRSPEED MACH", "MACH", offsetof(SimData, V_mach));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GROUND VELOCITY", "KNOTS", offsetof(SimData, V_gnd_kn));
   // workaround for altitude issues due to MSFS bug, needs to be changed to PRESSURE ALTITUDE again when solved
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INDICATED ALTITUDE:3", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "INDICATED ALTITUDE", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE ALT ABOVE GROUND MINUS CG", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "VELOCITY WORLD Y", "FEET PER MINUTE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "CG PERCENT", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TOTAL WEIGHT", "KILOGRAMS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:0", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:1", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:2", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS HANDLE POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS LEFT POSITION", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS RIGHT POSITION", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "IS SLEW ACTIVE", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT MASTER", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:1", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:2", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AUTOPILOT AIRSPEED HOLD VAR", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AUTOPILOT ALTITUDE LOCK VAR:3", "FEET");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SIMULATION TIME", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "SIMULATION RATE", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "STRUCTURAL ICE PCT", "PERCENT OVER 100");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "LINEAR CL ALPHA", "PER DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "STALL ALPHA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "ZERO LIFT ALPHA", "DEGREE");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT DENSITY", "KILOGRAM PER CUBIC METER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT PRESSURE", "MILLIBARS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT TEMPERATURE", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND X", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND Y", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND Z", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND VELOCITY", "KNOTS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND DIRECTION", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TOTAL AIR TEMPERATURE", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE LATITUDE", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE LONGITUDE", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG THROTTLE LEVER POSITION:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG THROTTLE LEVER POSITION:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG JET THRUST:1", "POUNDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG JET THRUST:2", "POUNDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS NAV:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV LOCALIZER:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV RAW GLIDE SLOPE:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS DME:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV DME:3", "NAUTICAL MILES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS LOCALIZER:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV RADIAL ERROR:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "NAV HAS GLIDE SLOPE:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV GLIDE SLOPE ERROR:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOTHROTTLE ACTIVE", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "GPS IS ACTIVE FLIGHT PLAN", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS WP CROSS TRK", "NAUTICAL MILES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS WP TRACK ANGLE ERROR", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GPS COURSE TO STEER", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG COMMANDED N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG COMMANDED N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:1", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:2", "PERCENT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL TEMPERATURE:1", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL TEMPERATURE:2", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL PRESSURE:1", "PSI");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL PRESSURE:2", "PSI");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG COMBUSTION:1", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG COMBUSTION:2", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT MANAGED SPEED IN MACH", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT SPEED SLOT INDEX", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG ANTI ICE:1", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ENG ANTI ICE:2", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "SIM ON GROUND", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG ELAPSED TIME:1", "SECONDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG ELAPSED TIME:2", "SECONDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "STANDARD ATM TEMPERATURE", "CELSIUS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED FF:1", "POUNDS PER HOUR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED FF:2", "POUNDS PER HOUR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT AUX CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT AUX CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT MAIN CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT MAIN CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK CENTER CAPACITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT AUX QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT AUX QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT MAIN QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT MAIN QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK CENTER QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TOTAL QUANTITY", "GALLONS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FUEL WEIGHT PER GALLON", "POUNDS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "KOHLSMAN SETTING MB:0", "MBAR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "KOHLSMAN SETTING MB:1", "MBAR");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "KOHLSMAN SETTING STD:3", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "CAMERA STATE", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "PLANE ALTITUDE", "METERS");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "NAV MAGVAR:3", "DEGREES");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_LATLONALT, "NAV VOR LATLONALT:3", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_LATLONALT, "NAV GS LATLONALT:3", "STRUCT");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "BRAKE LEFT POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "BRAKE RIGHT POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "FLAPS HANDLE INDEX", "NUMBER");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "GEAR HANDLE POSITION", "POSITION");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ASSISTANCE TAKEOFF ENABLED", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "ASSISTANCE LANDING ENABLED", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AI AUTOTRIM ACTIVE", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_INT64, "AI CONTROLS", "BOOL");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "WHEEL RPM:1", "RPM");
-  result &= addDataDefinition(hSimConnect, 0, SIMCONNECT_DATATYPE_FLOAT64, "WHEEL RPM:2", "RPM");
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "INDICATED ALTITUDE:3", "FEET", offsetof(SimData, H_ft));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "INDICATED ALTITUDE", "FEET", offsetof(SimData, H_ind_ft));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE ALT ABOVE GROUND MINUS CG", "FEET",
+                       offsetof(SimData, H_radio_ft));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "VELOCITY WORLD Y", "FEET PER MINUTE", offsetof(SimData, H_dot_fpm));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "CG PERCENT", "PERCENT OVER 100", offsetof(SimData, CG_percent_MAC));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "TOTAL WEIGHT", "KILOGRAMS", offsetof(SimData, total_weight_kg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:0", "NUMBER",
+                       offsetof(SimData, gear_animation_pos_0));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:1", "NUMBER",
+                       offsetof(SimData, gear_animation_pos_1));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GEAR ANIMATION POSITION:2", "NUMBER",
+                       offsetof(SimData, gear_animation_pos_2));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS HANDLE POSITION", "POSITION",
+                       offsetof(SimData, spoilers_handle_position));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS LEFT POSITION", "PERCENT OVER 100",
+                       offsetof(SimData, spoilers_left_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "SPOILERS RIGHT POSITION", "PERCENT OVER 100",
+                       offsetof(SimData, spoilers_right_pos));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "IS SLEW ACTIVE", "BOOL", offsetof(SimData, slew_on));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT MASTER", "BOOL", offsetof(SimData, autopilot_master_on));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:1", "BOOL",
+                       offsetof(SimData, ap_fd_1_active));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT FLIGHT DIRECTOR ACTIVE:2", "BOOL",
+                       offsetof(SimData, ap_fd_2_active));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "AUTOPILOT AIRSPEED HOLD VAR", "KNOTS",
+                       offsetof(SimData, ap_V_c_kn));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "AUTOPILOT ALTITUDE LOCK VAR:3", "FEET",
+                       offsetof(SimData, ap_H_c_ft));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "SIMULATION TIME", "NUMBER", offsetof(SimData, simulationTime));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "SIMULATION RATE", "NUMBER", offsetof(SimData, simulation_rate));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "STRUCTURAL ICE PCT", "PERCENT OVER 100",
+                       offsetof(SimData, ice_structure_percent));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "LINEAR CL ALPHA", "PER DEGREE",
+                       offsetof(SimData, linear_cl_alpha_per_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "STALL ALPHA", "DEGREE", offsetof(SimData, alpha_stall_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "ZERO LIFT ALPHA", "DEGREE", offsetof(SimData, alpha_zero_lift_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT DENSITY", "KILOGRAM PER CUBIC METER",
+                       offsetof(SimData, ambient_density_kg_per_m3));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT PRESSURE", "MILLIBARS",
+                       offsetof(SimData, ambient_pressure_mbar));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT TEMPERATURE", "CELSIUS",
+                       offsetof(SimData, ambient_temperature_celsius));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND X", "KNOTS", offsetof(SimData, ambient_wind_x_kn));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND Y", "KNOTS", offsetof(SimData, ambient_wind_y_kn));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND Z", "KNOTS", offsetof(SimData, ambient_wind_z_kn));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND VELOCITY", "KNOTS",
+                       offsetof(SimData, ambient_wind_velocity_kn));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "AMBIENT WIND DIRECTION", "DEGREES",
+                       offsetof(SimData, ambient_wind_direction_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TOTAL AIR TEMPERATURE", "CELSIUS",
+                       offsetof(SimData, total_air_temperature_celsius));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE LATITUDE", "DEGREES", offsetof(SimData, latitude_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE LONGITUDE", "DEGREES", offsetof(SimData, longitude_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG THROTTLE LEVER POSITION:1", "PERCENT",
+                       offsetof(SimData, throttle_lever_1_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG THROTTLE LEVER POSITION:2", "PERCENT",
+                       offsetof(SimData, throttle_lever_2_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG JET THRUST:1", "POUNDS",
+                       offsetof(SimData, engine_1_thrust_lbf));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG JET THRUST:2", "POUNDS",
+                       offsetof(SimData, engine_2_thrust_lbf));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "NAV HAS NAV:3", "BOOL", offsetof(SimData, nav_valid));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "NAV LOCALIZER:3", "DEGREES", offsetof(SimData, nav_loc_deg));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "NAV RAW GLIDE SLOPE:3", "DEGREES", offsetof(SimData, nav_gs_deg));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "NAV HAS DME:3", "BOOL", offsetof(SimData, nav_dme_valid));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "NAV DME:3", "NAUTICAL MILES", offsetof(SimData, nav_dme_nmi));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "NAV HAS LOCALIZER:3", "BOOL", offsetof(SimData, nav_loc_valid));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "NAV RADIAL ERROR:3", "DEGREES", offsetof(SimData, nav_loc_error_deg));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "NAV HAS GLIDE SLOPE:3", "BOOL", offsetof(SimData, nav_gs_valid));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "NAV GLIDE SLOPE ERROR:3", "DEGREES",
+                       offsetof(SimData, nav_gs_error_deg));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AUTOTHROTTLE ACTIVE", "BOOL",
+                       offsetof(SimData, isAutoThrottleActive));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:1", "PERCENT", offsetof(SimData, engine_n1_1));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:2", "PERCENT", offsetof(SimData, engine_n1_2));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "GPS IS ACTIVE FLIGHT PLAN", "BOOL",
+                       offsetof(SimData, gpsIsFlightPlanActive));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GPS WP CROSS TRK", "NAUTICAL MILES",
+                       offsetof(SimData, gpsWpCrossTrack));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GPS WP TRACK ANGLE ERROR", "DEGREES",
+                       offsetof(SimData, gpsWpTrackAngleError));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "GPS COURSE TO STEER", "DEGREES", offsetof(SimData, gpsCourseToSteer));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG COMMANDED N1:1", "PERCENT",
+                       offsetof(SimData, commanded_engine_N1_1_percent));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG COMMANDED N1:2", "PERCENT",
+                       offsetof(SimData, commanded_engine_N1_2_percent));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG N1:1", "PERCENT", offsetof(SimData, engine_N1_1_percent));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG N1:2", "PERCENT", offsetof(SimData, engine_N1_2_percent));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:1", "PERCENT",
+                       offsetof(SimData, corrected_engine_N1_1_percent));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED N1:2", "PERCENT",
+                       offsetof(SimData, corrected_engine_N1_2_percent));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL TEMPERATURE:1", "CELSIUS",
+                       offsetof(SimData, engineEngineOilTemperature_1));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL TEMPERATURE:2", "CELSIUS",
+                       offsetof(SimData, engineEngineOilTemperature_2));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL PRESSURE:1", "PSI",
+                       offsetof(SimData, engineEngineOilPressure_1));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG OIL PRESSURE:2", "PSI",
+                       offsetof(SimData, engineEngineOilPressure_2));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "ENG COMBUSTION:1", "BOOL", offsetof(SimData, engine_combustion_1));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "ENG COMBUSTION:2", "BOOL", offsetof(SimData, engine_combustion_2));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT MANAGED SPEED IN MACH", "BOOL",
+                       offsetof(SimData, is_mach_mode_active));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AUTOPILOT SPEED SLOT INDEX", "NUMBER",
+                       offsetof(SimData, speed_slot_index));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "ENG ANTI ICE:1", "BOOL", offsetof(SimData, engineAntiIce_1));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "ENG ANTI ICE:2", "BOOL", offsetof(SimData, engineAntiIce_2));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "SIM ON GROUND", "BOOL", offsetof(SimData, simOnGround));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG ELAPSED TIME:1", "SECONDS",
+                       offsetof(SimData, generalEngineElapsedTime_1));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "GENERAL ENG ELAPSED TIME:2", "SECONDS",
+                       offsetof(SimData, generalEngineElapsedTime_2));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "STANDARD ATM TEMPERATURE", "CELSIUS",
+                       offsetof(SimData, standardAtmTemperature));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED FF:1", "POUNDS PER HOUR",
+                       offsetof(SimData, turbineEngineCorrectedFuelFlow_1));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "TURB ENG CORRECTED FF:2", "POUNDS PER HOUR",
+                       offsetof(SimData, turbineEngineCorrectedFuelFlow_2));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT AUX CAPACITY", "GALLONS",
+                       offsetof(SimData, fuelTankCapacityAuxLeft));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT AUX CAPACITY", "GALLONS",
+                       offsetof(SimData, fuelTankCapacityAuxRight));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT MAIN CAPACITY", "GALLONS",
+                       offsetof(SimData, fuelTankCapacityMainLeft));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT MAIN CAPACITY", "GALLONS",
+                       offsetof(SimData, fuelTankCapacityMainRight));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK CENTER CAPACITY", "GALLONS",
+                       offsetof(SimData, fuelTankCapacityCenter));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT AUX QUANTITY", "GALLONS",
+                       offsetof(SimData, fuelTankQuantityAuxLeft));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT AUX QUANTITY", "GALLONS",
+                       offsetof(SimData, fuelTankQuantityAuxRight));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK LEFT MAIN QUANTITY", "GALLONS",
+                       offsetof(SimData, fuelTankQuantityMainLeft));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK RIGHT MAIN QUANTITY", "GALLONS",
+                       offsetof(SimData, fuelTankQuantityMainRight));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TANK CENTER QUANTITY", "GALLONS",
+                       offsetof(SimData, fuelTankQuantityCenter));
+  result &= addSimData(SIM_DATA_SECOND, SIMCONNECT_DATATYPE_FLOAT64, "FUEL TOTAL QUANTITY", "GALLONS",
+                       offsetof(SimData, fuelTankQuantityTotal));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "FUEL WEIGHT PER GALLON", "POUNDS",
+                       offsetof(SimData, fuelWeightPerGallon));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "KOHLSMAN SETTING MB:0", "MBAR",
+                       offsetof(SimData, kohlsmanSetting_0));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "KOHLSMAN SETTING MB:1", "MBAR",
+                       offsetof(SimData, kohlsmanSetting_1));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "KOHLSMAN SETTING STD:3", "BOOL",
+                       offsetof(SimData, kohlsmanSettingStd_3));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "CAMERA STATE", "NUMBER", offsetof(SimData, cameraState));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "PLANE ALTITUDE", "METERS", offsetof(SimData, altitude_m));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "NAV MAGVAR:3", "DEGREES", offsetof(SimData, nav_loc_magvar_deg));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_LATLONALT, "NAV VOR LATLONALT:3", "STRUCT", offsetof(SimData, nav_loc_pos));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_LATLONALT, "NAV GS LATLONALT:3", "STRUCT", offsetof(SimData, nav_gs_pos));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "BRAKE LEFT POSITION", "POSITION",
+                       offsetof(SimData, brakeLeftPosition));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "BRAKE RIGHT POSITION", "POSITION",
+                       offsetof(SimData, brakeRightPosition));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "FLAPS HANDLE INDEX", "NUMBER",
+                       offsetof(SimData, flapsHandleIndex));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_FLOAT64, "GEAR HANDLE POSITION", "POSITION",
+                       offsetof(SimData, gearHandlePosition));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "ASSISTANCE TAKEOFF ENABLED", "BOOL",
+                       offsetof(SimData, assistanceTakeoffEnabled));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "ASSISTANCE LANDING ENABLED", "BOOL",
+                       offsetof(SimData, assistanceLandingEnabled));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AI AUTOTRIM ACTIVE", "BOOL", offsetof(SimData, aiAutoTrimActive));
+  result &= addSimData(SIM_DATA_ON_CHANGE, SIMCONNECT_DATATYPE_INT64, "AI CONTROLS", "BOOL", offsetof(SimData, aiControlsActive));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "WHEEL RPM:1", "RPM", offsetof(SimData, wheelRpmLeft));
+  result &= addSimData(SIM_DATA_FRAME, SIMCONNECT_DATATYPE_FLOAT64, "WHEEL RPM:2", "RPM", offsetof(SimData, wheelRpmRight));
 
   // FIXME use MMR2 (NAV4) as well
 
@@ -1096,8 +1184,9 @@ bool SimConnectInterface::requestData() {
     return false;
   }
 
-  // request data
-  HRESULT result = SimConnect_RequestDataOnSimObject(hSimConnect, 0, 0, SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_VISUAL_FRAME);
+  // request data, the request id of each tier equals its data definition id
+  HRESULT result = SimConnect_RequestDataOnSimObject(hSimConnect, simDataDefinitionIds[SIM_DATA_FRAME], simDataDefinitionIds[SIM_DATA_FRAME],
+                                                     SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_VISUAL_FRAME);
 
   // check result of data request
   if (result != S_OK) {
@@ -1105,6 +1194,31 @@ bool SimConnectInterface::requestData() {
     return false;
   }
 
+  // the periodic tiers are requested once per connection, requesting them again would restart their period
+  if (slowSimDataRequested) {
+    return true;
+  }
+
+  result = SimConnect_RequestDataOnSimObject(hSimConnect, simDataDefinitionIds[SIM_DATA_SECOND], simDataDefinitionIds[SIM_DATA_SECOND],
+                                             SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_SECOND);
+
+  // check result of data request
+  if (result != S_OK) {
+    // request failed
+    return false;
+  }
+
+  result = SimConnect_RequestDataOnSimObject(hSimConnect, simDataDefinitionIds[SIM_DATA_ON_CHANGE], simDataDefinitionIds[SIM_DATA_ON_CHANGE],
+                                             SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_VISUAL_FRAME, SIMCONNECT_DATA_REQUEST_FLAG_CHANGED);
+
+  // check result of data request
+  if (result != S_OK) {
+    // request failed
+    return false;
+  }
+
+  slowSimDataRequested = true;
+
   // success
   return true;
 }
@@ -1115,6 +1229,9 @@ bool SimConnectInterface::readData() {
     return false;
   }
 
+  // next frame for the computer transport
+  computerTransportFrame++;
+
   // get next dispatch message(s) and process them
   DWORD cbData;
   SIMCONNECT_RECV* pData;
@@ -1122,6 +1239,9 @@ bool SimConnectInterface::readData() {
     simConnectProcessDispatchMessage(pData, &cbData);
   }
 
+  // apply the last position received for each axis
+  flushAxisEvents();
+
   // success
   return true;
 }
@@ -1467,7 +1587,80 @@ void SimConnectInterface::simConnectProcessEvent_EX1(const SIMCONNECT_RECV_EVENT
   processEventWithOneParam(eventId, data0);
 }
 
+void SimConnectInterface::printEventCounterReport() {
+  std::cout << "WASM: EVENTS : " << eventCounters.received << " received, " << eventCounters.axisReceived << " axis events coalesced into ";
+  std::cout << eventCounters.axisApplied << " applied" << std::endl;
+
+  eventCounters = {};
+}
+
+void SimConnectInterface::prepareAxisEventSlots() {
+  for (auto& slot : axisEventSlots) {
+    slot = AXIS_SLOT_NONE;
+  }
+  for (auto& pendingAxisEvent : pendingAxisEvents) {
+    pendingAxisEvent = {};
+  }
+
+  axisEventSlots[Events::AXIS_ELEVATOR_SET] = AXIS_SLOT_ELEVATOR;
+  axisEventSlots[Events::ELEVATOR_SET] = AXIS_SLOT_ELEVATOR;
+  axisEventSlots[Events::AXIS_AILERONS_SET] = AXIS_SLOT_AILERONS;
+  axisEventSlots[Events::AILERON_SET] = AXIS_SLOT_AILERONS;
+  axisEventSlots[Events::AXIS_RUDDER_SET] = AXIS_SLOT_RUDDER;
+  axisEventSlots[Events::RUDDER_SET] = AXIS_SLOT_RUDDER;
+  axisEventSlots[Events::THROTTLE_SET] = AXIS_SLOT_THROTTLE_ALL;
+  axisEventSlots[Events::THROTTLE_AXIS_SET_EX1] = AXIS_SLOT_THROTTLE_ALL;
+  axisEventSlots[Events::THROTTLE1_SET] = AXIS_SLOT_THROTTLE_1;
+  axisEventSlots[Events::THROTTLE1_AXIS_SET_EX1] = AXIS_SLOT_THROTTLE_1;
+  axisEventSlots[Events::THROTTLE2_SET] = AXIS_SLOT_THROTTLE_2;
+  axisEventSlots[Events::THROTTLE2_AXIS_SET_EX1] = AXIS_SLOT_THROTTLE_2;
+  axisEventSlots[Events::SPOILERS_SET] = AXIS_SLOT_SPOILERS;
+  axisEventSlots[Events::AXIS_SPOILER_SET] = AXIS_SLOT_SPOILERS;
+}
+
 void SimConnectInterface::processEventWithOneParam(const DWORD eventId, const DWORD data0) {
+  eventCounters.received++;
+
+  const int slot = eventId < Events::EVENT_COUNT ? axisEventSlots[eventId] : AXIS_SLOT_NONE;
+
+  if (slot == AXIS_SLOT_NONE) {
+    // queued axis positions have to be applied before any other event to keep their order
+    flushAxisEvents();
+    dispatchEvent(eventId, data0);
+    return;
+  }
+
+  eventCounters.axisReceived++;
+
+  if (slot == AXIS_SLOT_THROTTLE_ALL) {
+    // setting all throttles supersedes any single throttle position received before
+    pendingAxisEvents[AXIS_SLOT_THROTTLE_1].pending = false;
+    pendingAxisEvents[AXIS_SLOT_THROTTLE_2].pending = false;
+  } else if (slot >= AXIS_SLOT_THROTTLE_1 && slot <= AXIS_SLOT_THROTTLE_2) {
+    // a single throttle position received after one for all throttles has to be applied on top of it
+    flushAxisEvent(AXIS_SLOT_THROTTLE_ALL);
+  }
+
+  pendingAxisEvents[slot] = {true, eventId, data0};
+}
+
+void SimConnectInterface::flushAxisEvent(AxisEventSlot slot) {
+  PendingAxisEvent& pendingAxisEvent = pendingAxisEvents[slot];
+  if (pendingAxisEvent.pending) {
+    pendingAxisEvent.pending = false;
+    eventCounters.axisApplied++;
+    dispatchEvent(pendingAxisEvent.eventId, pendingAxisEvent.data0);
+  }
+}
+
+void SimConnectInterface::flushAxisEvents() {
+  // the slot order matters: all throttles before the single throttles
+  for (int slot = 0; slot < AXIS_SLOT_COUNT; slot++) {
+    flushAxisEvent(static_cast<AxisEventSlot>(slot));
+  }
+}
+
+void SimConnectInterface::dispatchEvent(const DWORD eventId, const DWORD data0) {
   // process depending on event id
   switch (eventId) {
     case Events::AXIS_ELEVATOR_SET: {
@@ -2756,104 +2949,167 @@ void SimConnectInterface::processEventWithOneParam(const DWORD eventId, const DW
 
 void SimConnectInterface::simConnectProcessSimObjectData(const SIMCONNECT_RECV_SIMOBJECT_DATA* data) {
   // process depending on request id
-  switch (data->dwRequestID) {
-    case 0:
-      // store aircraft data
-      simData = *((SimData*)&data->dwData);
-      return;
+  for (int tier = 0; tier < SIM_DATA_TIER_COUNT; tier++) {
+    if (data->dwRequestID != simDataDefinitionIds[tier]) {
+      continue;
+    }
 
-    default:
-      // print unknown request id
-      std::cout << "WASM: Unknown request id in SimConnect connection: ";
-      std::cout << data->dwRequestID << std::endl;
+    auto source = reinterpret_cast<const char*>(&data->dwData);
+
+    // check that the message contains the complete tier
+    if (source + simDataTierSizes[tier] > reinterpret_cast<const char*>(data) + data->dwSize) {
+      std::cout << "WASM: Incomplete sim data for request id " << data->dwRequestID << std::endl;
       return;
+    }
+
+    // merge the packed tier data into the aircraft data
+    auto target = reinterpret_cast<char*>(&simData);
+    for (const auto& field : simDataFields[tier]) {
+      std::memcpy(target + field.offset, source, field.size);
+      source += field.size;
+    }
+    return;
   }
+
+  // print unknown request id
+  std::cout << "WASM: Unknown request id in SimConnect connection: ";
+  std::cout << data->dwRequestID << std::endl;
 }
 
 void SimConnectInterface::simConnectProcessClientData(const SIMCONNECT_RECV_CLIENT_DATA* data) {
+  // the data area starts at dwData and fills the rest of the message
+  auto headerSize = static_cast<DWORD>(reinterpret_cast<const char*>(&data->dwData) - reinterpret_cast<const char*>(data));
+  storeClientData(data->dwRequestID, &data->dwData, data->dwSize - headerSize);
+}
+
+void SimConnectInterface::storeClientData(DWORD id, const void* data, DWORD size) {
+  bool isStored = false;
+
   // process depending on request id
-  switch (data->dwRequestID) {
+  switch (id) {
     case ClientData::AUTOPILOT_STATE_MACHINE:
       // store aircraft data
-      clientDataAutopilotStateMachine = *((ClientDataAutopilotStateMachine*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataAutopilotStateMachine, data, size);
+      break;
 
     case ClientData::AUTOPILOT_LAWS:
       // store aircraft data
-      clientDataAutopilotLaws = *((ClientDataAutopilotLaws*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataAutopilotLaws, data, size);
+      break;
 
     case ClientData::AUTOTHRUST:
       // store aircraft data
-      clientDataAutothrust = *((ClientDataAutothrust*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataAutothrust, data, size);
+      break;
 
     case ClientData::ELAC_DISCRETE_OUTPUTS:
       // store aircraft data
-      clientDataElacDiscreteOutputs = *((base_elac_discrete_outputs*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataElacDiscreteOutputs, data, size);
+      break;
 
     case ClientData::ELAC_ANALOG_OUTPUTS:
       // store aircraft data
-      clientDataElacAnalogOutputs = *((base_elac_analog_outputs*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataElacAnalogOutputs, data, size);
+      break;
 
     case ClientData::ELAC_1_BUS_OUTPUT:
       // store aircraft data
-      clientDataElacBusOutputs = *((base_elac_out_bus*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataElacBusOutputs, data, size);
+      break;
 
     case ClientData::ELAC_2_BUS_OUTPUT:
       // store aircraft data
-      clientDataElacBusOutputs = *((base_elac_out_bus*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataElacBusOutputs, data, size);
+      break;
 
     case ClientData::SEC_DISCRETE_OUTPUTS:
       // store aircraft data
-      clientDataSecDiscreteOutputs = *((base_sec_discrete_outputs*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataSecDiscreteOutputs, data, size);
+      break;
 
     case ClientData::SEC_ANALOG_OUTPUTS:
       // store aircraft data
-      clientDataSecAnalogOutputs = *((base_sec_analog_outputs*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataSecAnalogOutputs, data, size);
+      break;
 
     case ClientData::SEC_1_BUS_OUTPUT:
       // store aircraft data
-      clientDataSecBusOutputs = *((base_sec_out_bus*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataSecBusOutputs, data, size);
+      break;
 
     case ClientData::SEC_2_BUS_OUTPUT:
       // store aircraft data
-      clientDataSecBusOutputs = *((base_sec_out_bus*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataSecBusOutputs, data, size);
+      break;
 
     case ClientData::FAC_DISCRETE_OUTPUTS:
       // store aircraft data
-      clientDataFacDiscreteOutputs = *((base_fac_discrete_outputs*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataFacDiscreteOutputs, data, size);
+      break;
 
     case ClientData::FAC_ANALOG_OUTPUTS:
       // store aircraft data
-      clientDataFacAnalogOutputs = *((base_fac_analog_outputs*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataFacAnalogOutputs, data, size);
+      break;
 
     case ClientData::FAC_1_BUS_OUTPUT:
       // store aircraft data
-      clientDataFacBusOutputs = *((base_fac_bus*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataFacBusOutputs, data, size);
+      break;
 
     case ClientData::FAC_2_BUS_OUTPUT:
       // store aircraft data
-      clientDataFacBusOutputs = *((base_fac_bus*)&data->dwData);
-      return;
+      isStored = readComputerData(clientDataFacBusOutputs, data, size);
+      break;
 
     default:
       // print unknown request id
       std::cout << "WASM: Unknown request id in SimConnect connection: ";
-      std::cout << data->dwRequestID << std::endl;
+      std::cout << id << std::endl;
       return;
   }
+
+  if (!isStored) {
+    std::cout << "WASM: Client data " << id << " of " << size << " bytes is shorter than its destination, ignored" << std::endl;
+  }
+}
+bool SimConnectInterface::setupComputerTransport(bool sharedMemory, double timeout) {
+  // client data is used unless shared memory is requested
+  if (!clientDataEnabled || !sharedMemory) {
+    return true;
+  }
+
+  auto sharedMemoryTransport = SharedMemoryComputerTransport::open("/fbw_a32nx_computers", timeout);
+  if (!sharedMemoryTransport) {
+    std::cout << "WASM: Shared memory computer transport not available, using client data" << std::endl;
+    return false;
+  }
+
+  computerTransport = std::move(sharedMemoryTransport);
+  std::cout << "WASM: Using shared memory computer transport /fbw_a32nx_computers" << std::endl;
+  return true;
+}
+
+bool SimConnectInterface::exchangeClientDataElac(int elacIndex) {
+  return exchangeClientData(static_cast<ExternalComputer>(ExternalComputer::ELAC_1 + elacIndex));
+}
+
+bool SimConnectInterface::exchangeClientDataSec(int secIndex) {
+  return exchangeClientData(static_cast<ExternalComputer>(ExternalComputer::SEC_1 + secIndex));
+}
+
+bool SimConnectInterface::exchangeClientDataFac(int facIndex) {
+  return exchangeClientData(static_cast<ExternalComputer>(ExternalComputer::FAC_1 + facIndex));
+}
+
+bool SimConnectInterface::exchangeClientData(ExternalComputer computer) {
+  // check if we are connected
+  if (!isConnected || !computerTransport) {
+    return false;
+  }
+
+  return computerTransport->exchange(computer, computerTransportFrame,
+                                     [this](uint32_t id, const void* data, uint32_t size) { storeClientData(id, data, size); });
 }
 
 bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, void* data) {
@@ -2868,6 +3124,11 @@ bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD
     return true;
   }
 
+  // data of externally executed computers is sent through the computer transport
+  if (computerTransport && id >= ClientData::ELAC_DISCRETE_INPUTS && id <= ClientData::FMGC_2_B_BUS) {
+    return computerTransport->send(id, data, size);
+  }
+
   // set output data
   HRESULT result = SimConnect_SetClientData(hSimConnect, id, id, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, size, data);
 
@@ -2912,6 +3173,23 @@ bool SimConnectInterface::addDataDefinition(const HANDLE connectionHandle,
   return (result == S_OK);
 }
 
+bool SimConnectInterface::addSimData(const SimDataTier tier,
+                                     const SIMCONNECT_DATATYPE dataType,
+                                     const std::string& dataName,
+                                     const std::string& dataUnit,
+                                     const size_t offset) {
+  if (!addDataDefinition(hSimConnect, simDataDefinitionIds[tier], dataType, dataName, dataUnit)) {
+    return false;
+  }
+
+  // the simulation packs the values of a definition in the order they were added
+  size_t size = getSimConnectDataTypeSize(dataType);
+  simDataFields[tier].push_back({offset, size});
+  simDataTierSizes[tier] += size;
+
+  return true;
+}
+
 bool SimConnectInterface::addInputDataDefinition(const HANDLE connectionHandle,
                                                  const SIMCONNECT_DATA_DEFINITION_ID groupId,
                                                  const SIMCONNECT_CLIENT_EVENT_ID eventId,
@@ -2956,6 +3234,27 @@ bool SimConnectInterface::isSimConnectDataTypeStruct(SIMCONNECT_DATATYPE type) {
   return false;
 }
 
+size_t SimConnectInterface::getSimConnectDataTypeSize(SIMCONNECT_DATATYPE dataType) {
+  switch (dataType) {
+    case SIMCONNECT_DATATYPE_INT32:
+    case SIMCONNECT_DATATYPE_FLOAT32:
+      return 4;
+
+    case SIMCONNECT_DATATYPE_INT64:
+    case SIMCONNECT_DATATYPE_FLOAT64:
+      return 8;
+
+    case SIMCONNECT_DATATYPE_XYZ:
+      return sizeof(SIMCONNECT_DATA_XYZ);
+
+    case SIMCONNECT_DATATYPE_LATLONALT:
+      return sizeof(SIMCONNECT_DATA_LATLONALT);
+
+    default:
+      return 0;
+  }
+}
+
 std::string SimConnectInterface::getSimConnectExceptionString(SIMCONNECT_EXCEPTION exception) {
   switch (exception) {
     case SIMCONNECT_EXCEPTION_NONE:
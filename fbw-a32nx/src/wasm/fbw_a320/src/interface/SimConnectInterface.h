@@ -2,16 +2,19 @@
 
 #include <MSFS/Legacy/gauges.h>
 #include <SimConnect.h>
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "../LocalVariable.h"
 #include "../SpoilersHandler.h"
 #include "../ThrottleAxisMapping.h"
+#include "ComputerTransport.h"
 #include "SimConnectData.h"
 
 #include "../model/ElacComputer_types.h"
-#include "../model/FacComputer_types.h"
+#include "model/FacComputer_types.h"
 #include "../model/SecComputer_types.h"
 
 class SimConnectInterface {
@@ -175,6 +178,25 @@ class SimConnectInterface {
     SIM_RATE_INCR,
     SIM_RATE_DECR,
     SIM_RATE_SET,
+    // number of events, keep last
+    EVENT_COUNT,
+  };
+
+  // computers which can be executed externally, the ids are used by the lockstep computer transport
+  enum ExternalComputer {
+    ELAC_1,
+    ELAC_2,
+    SEC_1,
+    SEC_2,
+    SEC_3,
+    FAC_1,
+    FAC_2,
+  };
+
+  struct EventCounters {
+    unsigned long long received;
+    unsigned long long axisReceived;
+    unsigned long long axisApplied;
   };
 
   SimConnectInterface() = default;
@@ -287,6 +309,12 @@ class SimConnectInterface {
   bool setClientDataSfcc(base_sfcc_bus output, int sfccIndex);
   bool setClientDataFmgcB(base_fmgc_b_bus output, int fmgcIndex);
 
+  bool setupComputerTransport(bool sharedMemory, double timeout);
+
+  bool exchangeClientDataElac(int elacIndex);
+  bool exchangeClientDataSec(int secIndex);
+  bool exchangeClientDataFac(int facIndex);
+
   void setLoggingFlightControlsEnabled(bool enabled);
   bool getLoggingFlightControlsEnabled();
 
@@ -298,6 +326,9 @@ class SimConnectInterface {
 
   void updateSimulationRateLimits(double minSimulationRate, double maxSimulationRate);
 
+  // prints the events received and the axis events applied since the last report
+  void printEventCounterReport();
+
  private:
   enum ClientData {
     AUTOPILOT_STATE_MACHINE,
@@ -349,6 +380,9 @@ class SimConnectInterface {
   bool limitSimulationRateByPerformance = true;
   bool clientDataEnabled = false;
 
+  std::unique_ptr<ComputerTransport> computerTransport;
+  uint64_t computerTransportFrame = 0;
+
   int elacDisabled = -1;
   int secDisabled = -1;
   int facDisabled = -1;
@@ -357,7 +391,27 @@ class SimConnectInterface {
   static bool loggingFlightControlsEnabled;
   bool loggingThrottlesEnabled = false;
 
+  // SimData is received in tiers with their own request period, so slowly changing values are not marshalled every frame.
+  // The packed data of a tier is merged into simData, which therefore always holds the latest value of every field.
+  enum SimDataTier {
+    SIM_DATA_FRAME,
+    SIM_DATA_SECOND,
+    SIM_DATA_ON_CHANGE,
+    SIM_DATA_TIER_COUNT,
+  };
+
+  struct SimDataField {
+    size_t offset;
+    size_t size;
+  };
+
+  // data definition and request id of each tier
+  static constexpr SIMCONNECT_DATA_DEFINITION_ID simDataDefinitionIds[SIM_DATA_TIER_COUNT] = {0, 10, 11};
+
   SimData simData = {};
+  std::vector<SimDataField> simDataFields[SIM_DATA_TIER_COUNT];
+  size_t simDataTierSizes[SIM_DATA_TIER_COUNT] = {};
+  bool slowSimDataRequested = false;
   // change to non-static when aileron events can be processed via SimConnect
   static SimInput simInput;
   SimInputRudderTrim simInputRudderTrim = {};
@@ -397,6 +451,30 @@ class SimConnectInterface {
   double rudderLeftAxis = -1;
   double rudderRightAxis = -1;
 
+  // Axis events only carry an absolute position. They are queued per control and only the last one received
+  // within a frame is dispatched, high resolution hardware can send many of them per frame.
+  enum AxisEventSlot {
+    AXIS_SLOT_NONE = -1,
+    AXIS_SLOT_ELEVATOR,
+    AXIS_SLOT_AILERONS,
+    AXIS_SLOT_RUDDER,
+    AXIS_SLOT_THROTTLE_ALL,
+    AXIS_SLOT_THROTTLE_1,
+    AXIS_SLOT_THROTTLE_2,
+    AXIS_SLOT_SPOILERS,
+    AXIS_SLOT_COUNT,
+  };
+
+  struct PendingAxisEvent {
+    bool pending;
+    DWORD eventId;
+    DWORD data0;
+  };
+
+  signed char axisEventSlots[Events::EVENT_COUNT] = {};
+  PendingAxisEvent pendingAxisEvents[AXIS_SLOT_COUNT] = {};
+  EventCounters eventCounters = {};
+
   std::unique_ptr<LocalVariable> idFcuEventSetSPEED;
   std::unique_ptr<LocalVariable> idFcuEventSetHDG;
   std::unique_ptr<LocalVariable> idFcuEventSetVS;
@@ -409,6 +487,8 @@ class SimConnectInterface {
 
   bool prepareClientDataDefinitions();
 
+  void prepareAxisEventSlots();
+
   void simConnectProcessDispatchMessage(SIMCONNECT_RECV* pData, DWORD* cbData);
 
   /**
@@ -444,6 +524,10 @@ class SimConnectInterface {
 
   void simConnectProcessClientData(const SIMCONNECT_RECV_CLIENT_DATA* data);
 
+  void storeClientData(DWORD id, const void* data, DWORD size);
+
+  bool exchangeClientData(ExternalComputer computer);
+
   bool sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, void* data);
   bool sendData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, void* data);
 
@@ -453,6 +537,12 @@ class SimConnectInterface {
                                 const std::string& dataName,
                                 const std::string& dataUnit);
 
+  bool addSimData(const SimDataTier tier,
+                  const SIMCONNECT_DATATYPE dataType,
+                  const std::string& dataName,
+                  const std::string& dataUnit,
+                  const size_t offset);
+
   static bool addInputDataDefinition(const HANDLE connectionHandle,
                                      const SIMCONNECT_DATA_DEFINITION_ID groupId,
                                      const SIMCONNECT_CLIENT_EVENT_ID eventId,
@@ -461,6 +551,8 @@ class SimConnectInterface {
 
   static bool isSimConnectDataTypeStruct(SIMCONNECT_DATATYPE dataType);
 
+  static size_t getSimConnectDataTypeSize(SIMCONNECT_DATATYPE dataType);
+
   static std::string getSimConnectExceptionString(SIMCONNECT_EXCEPTION exception);
 
  private:
@@ -471,4 +563,10 @@ class SimConnectInterface {
    * @param data0 Double word containing any additional number required by the event.
    */
   void processEventWithOneParam(const DWORD eventId, const DWORD data0);
+
+  void dispatchEvent(const DWORD eventId, const DWORD data0);
+
+  void flushAxisEvent(AxisEventSlot slot);
+
+  void flushAxisEvents();
 };
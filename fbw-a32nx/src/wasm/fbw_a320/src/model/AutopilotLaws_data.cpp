@@ -1,1671 +0,0 @@
-#include "AutopilotLaws.h"
-#include "AutopilotLaws_private.h"
-
-AutopilotLawsModelClass::Parameters_AutopilotLaws_T AutopilotLawsModelClass::AutopilotLaws_P{
-
-  {
-    {
-      0.0,
-      0.0
-    },
-
-    {
-      {
-        0.0,
-        0.0,
-        0.0
-      },
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      false,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      false,
-      0.0,
-      0.0,
-
-      {
-        0.0,
-        0.0,
-        0.0
-      },
-      false,
-      0.0,
-      false,
-      0.0,
-
-      {
-        0.0,
-        0.0,
-        0.0
-      },
-      false,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      false,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      false,
-      false,
-      false,
-      0.0
-    },
-
-    {
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      false,
-      false,
-      false,
-      false,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false
-    },
-
-    {
-      0.0,
-      0.0,
-      0.0,
-
-      {
-        0.0,
-        0.0,
-        0.0
-      },
-
-      {
-        0.0,
-        0.0,
-        0.0
-      },
-
-      {
-        false,
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0
-      }
-    }
-  },
-
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 400.0, 500.0 },
-
-
-  { 0.0, 50.0, 100.0, 1000.0, 2500.0, 3000.0 },
-
-
-  { 0.0, 150.0, 200.0 },
-
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 400.0, 500.0 },
-
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 400.0, 500.0 },
-
-
-  { 0.0, 50.0, 100.0, 200.0, 400.0, 1000.0, 2500.0, 3000.0 },
-
-
-  { 0.0, 100.0, 200.0, 400.0, 1000.0 },
-
-
-  { 0.0, 50.0, 100.0, 200.0, 400.0, 1000.0, 2500.0, 3000.0 },
-
-
-  { 0.0, 100.0, 150.0, 200.0, 250.0, 300.0, 400.0 },
-
-  1.0,
-
-  1.0,
-
-  4.0,
-
-  2.0,
-
-  0.7,
-
-  2.0,
-
-  1.0,
-
-  1.0,
-
-  1.0,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  10.0,
-
-  1.0,
-
-  4.0,
-
-  10.0,
-
-  10.0,
-
-  2.0,
-
-  1.0,
-
-  50.0,
-
-  0.033333333333333333,
-
-  15.0,
-
-  15.0,
-
-  2.0,
-
-  3.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  2.0,
-
-  6.0,
-
-  2.0,
-
-  4.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  3.0,
-
-  1.0,
-
-  3.0,
-
-  1.0,
-
-  3.0,
-
-  1.0,
-
-  3.0,
-
-  1.0,
-
-  3.0,
-
-  1.0,
-
-  3.0,
-
-  1.0,
-
-  3.0,
-
-  1.0,
-
-  1.0,
-
-  1.0,
-
-  3.0,
-
-  1.0,
-
-  1.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  0.33333333333333331,
-
-  15.0,
-
-  15.0,
-
-  1.0,
-
-  0.33333333333333331,
-
-  1.0,
-
-  1.0,
-
-  0.35,
-
-  0.35,
-
-  1.0,
-
-  1.0,
-
-  0.7,
-
-  1.0,
-
-  0.81,
-
-  1.0,
-
-  0.35,
-
-  0.7,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  -3.0,
-
-
-  { 1.6, 1.6, 2.0, 2.8, 3.2, 4.2, 4.5 },
-
-
-  { 3.7, 3.7, 4.3, 7.8, 15.0, 15.0 },
-
-
-  { 0.8, 0.2, 0.2 },
-
-
-  { 1.6, 1.6, 2.0, 2.8, 3.2, 4.2, 4.5 },
-
-
-  { 1.6, 1.6, 2.0, 2.8, 3.2, 4.2, 4.5 },
-
-
-  { 0.0, 0.0, -0.15, -0.4, -0.775, -1.6, -3.0, -3.0 },
-
-
-  { 14.0, 14.0, 14.0, 14.0, 14.0 },
-
-
-  { 0.0, 0.0, -0.1, -0.3, -0.6, -0.8, -2.0, -2.0 },
-
-
-  { 2.5, 2.5, 2.0, 1.0, 1.0, 1.0, 1.0 },
-
-  3.0,
-
-  1.0,
-
-  1.0,
-
-  4.0,
-
-  5.0,
-
-  30.0,
-
-  6.0,
-
-  1.0,
-
-  2.0,
-
-  1.0,
-
-  2.0,
-
-  0.0,
-
-  0.0,
-
-  0.5,
-
-  3.0,
-
-  0.0,
-
-  0.0,
-
-  31.0,
-
-  32.0,
-
-  60.0,
-
-  6.0,
-
-  7.0,
-
-  0.0,
-
-  0.0,
-
-  0.5,
-
-  8.0,
-
-  0.0,
-
-  0.0,
-
-  -1000.0,
-
-  -10.0,
-
-  -1000.0,
-
-  -10.0,
-
-  -1000.0,
-
-  -15.0,
-
-  -10.0,
-
-  0.5,
-
-  10.0,
-
-  0.2,
-
-  1.0,
-
-  1.0,
-
-  15.0,
-
-  1.0,
-
-  0.0,
-
-  0.0,
-
-  true,
-
-  true,
-
-  -1.0,
-
-  1.0,
-
-  -1.0,
-
-  1.0,
-
-  -1.0,
-
-  1.0,
-
-  1.0,
-
-  -1.0,
-
-  -1.0,
-
-  -1.0,
-
-  45.0,
-
-  -45.0,
-
-  0.4,
-
-  -1.0,
-
-  -1.0,
-
-  1.0,
-
-  1.0,
-
-  360.0,
-
-  360.0,
-
-  360.0,
-
-  0.017453292519943295,
-
-  0.2,
-
-  1.1,
-
-  15.0,
-
-  -15.0,
-
-  1.0,
-
-  0.0,
-
-  1.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  15.0,
-
-  -15.0,
-
-  1.4,
-
-  -1.0,
-
-  1.0,
-
-  -1.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  2.0,
-
-  0.0,
-
-  4.0,
-
-  -4.0,
-
-  0.6,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  -4.0,
-
-  0.6,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  0.0,
-
-  -100.0,
-
-  400.0,
-
-  -400.0,
-
-  0.0,
-
-  -4.0,
-
-  0.6,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  -4.0,
-
-  0.6,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  0.0,
-
-  2.85,
-
-  2.5,
-
-  -50.0,
-
-  2.5,
-
-  0.0,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  -4.0,
-
-  0.6,
-
-  -0.93,
-
-  0.0,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  -4.0,
-
-  0.6,
-
-  -0.93,
-
-  0.0,
-
-  0.0,
-
-  -1.0,
-
-  -1.0,
-
-  0.0,
-
-  -4.0,
-
-  0.6,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  -4.0,
-
-  0.6,
-
-  0.0,
-
-  4.0,
-
-  -0.93,
-
-  -1.0,
-
-  -1.0,
-
-  57.295779513082323,
-
-  -1.0,
-
-  57.295779513082323,
-
-  57.295779513082323,
-
-  -1.0,
-
-  -1.0,
-
-  2.0,
-
-  1.0,
-
-  1.0,
-
-  0.0,
-
-  2.0,
-
-  1.0,
-
-  0.0,
-
-  -25.0,
-
-  360.0,
-
-  360.0,
-
-  360.0,
-
-  360.0,
-
-  2.0,
-
-  0.8,
-
-  0.017453292519943295,
-
-  100.0,
-
-  2.0,
-
-  1.0,
-
-  360.0,
-
-  360.0,
-
-  1.0,
-
-  10.0,
-
-  360.0,
-
-  0.0,
-
-  360.0,
-
-  360.0,
-
-  0.017453292519943295,
-
-  100.0,
-
-  2.0,
-
-  1200.0,
-
-  70.0,
-
-  -70.0,
-
-  0.1,
-
-  360.0,
-
-  360.0,
-
-  360.0,
-
-  1.5,
-
-  -1.0,
-
-  1.0,
-
-  360.0,
-
-  -1.0,
-
-  1.0,
-
-  360.0,
-
-  -1.0,
-
-  1.16,
-
-  -2.0,
-
-  360.0,
-
-  -1.0,
-
-  1.16,
-
-  -2.0,
-
-  3.0,
-
-  0.8,
-
-  -1.0,
-
-  -1.2,
-
-  1.0,
-
-  1.0,
-
-  0.0,
-
-  1.0,
-
-  1.0,
-
-  0.0,
-
-  -0.04,
-
-  1.0,
-
-  -1.0,
-
-  -1.0,
-
-  1.0,
-
-  0.0,
-
-  1.0,
-
-  20.0,
-
-  0.0,
-
-  8.0,
-
-  1500.0,
-
-  -1500.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.0,
-
-  1.0,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.0,
-
-  0.33333333333333331,
-
-  0.36,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.0,
-
-  1.0,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.0,
-
-  0.33333333333333331,
-
-  0.36,
-
-  5.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.33333333333333331,
-
-  57.295779513082323,
-
-  120.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.0,
-
-  1.0,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.0,
-
-  0.33333333333333331,
-
-  0.36,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.0,
-
-  1.0,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.0,
-
-  0.33333333333333331,
-
-  0.36,
-
-  5.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.35,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.0,
-
-  1.0,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.0,
-
-  0.33333333333333331,
-
-  0.36,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.0,
-
-  1.0,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.0,
-
-  0.33333333333333331,
-
-  0.36,
-
-  5.0,
-
-  0.016666666666666666,
-
-  0.017453292519943295,
-
-  0.51444444444444448,
-
-  3.2808398950131235,
-
-  -0.25,
-
-  0.5,
-
-  -0.5,
-
-  0.5,
-
-  1.0,
-
-  1.0,
-
-  0.0,
-
-  1.0,
-
-  1.0,
-
-  -1.0,
-
-  -4.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.4,
-
-  2.0,
-
-  0.35,
-
-  -2.0,
-
-  0.35,
-
-  -2.0,
-
-  -1.2,
-
-  -0.3,
-
-  101.26859142607174,
-
-  0.02,
-
-  60.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.3,
-
-  0.00508,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  1.0,
-
-
-  { 1.0, 1.0, 1.15, 1.15 },
-
-
-  { 0.0, 45000.0, 65000.0, 70000.0 },
-
-  18.0,
-
-  50000.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  1000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  1.0,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  0.017453292519943295,
-
-  57.295779513082323,
-
-  0.017453292519943295,
-
-  9.81,
-
-  0.5144,
-
-  0.90350790290525129,
-
-  2.0,
-
-  0.5144,
-
-  0.1019367991845056,
-
-  0.7,
-
-  57.295779513082323,
-
-  0.33333333333333331,
-
-  57.295779513082323,
-
-  120.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  120.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  8.0,
-
-  1500.0,
-
-  -1500.0,
-
-  0.00508,
-
-  0.51444444444444448,
-
-  2000.0,
-
-  1.0,
-
-  57.295779513082323,
-
-  0.25,
-
-  -5.0,
-
-  2.0,
-
-  -2.0,
-
-  1.3,
-
-  0.0,
-
-  0.25,
-
-  -1.0,
-
-  1.0,
-
-  0.0,
-
-  1.0,
-
-  60.0,
-
-  false,
-
-  false,
-
-  0U,
-
-  0U
-};
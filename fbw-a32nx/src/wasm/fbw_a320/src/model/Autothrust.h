@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_Autothrust_h_
 #define RTW_HEADER_Autothrust_h_
 #include <cmath>
@@ -228,6 +230,12 @@ class AutothrustModelClass
     boolean_T Logic_table_m[16];
   };
 
+  struct Snapshot_Autothrust_T {
+    ExternalInputs_Autothrust_T U;
+    ExternalOutputs_Autothrust_T Y;
+    D_Work_Autothrust_T DWork;
+  };
+
   AutothrustModelClass(AutothrustModelClass const&) =delete;
   AutothrustModelClass& operator= (AutothrustModelClass const&) & = delete;
   void setExternalInputs(const ExternalInputs_Autothrust_T *pExternalInputs_Autothrust_T)
@@ -243,13 +251,27 @@ class AutothrustModelClass
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_Autothrust_T *pSnapshot) const
+  {
+    pSnapshot->U = Autothrust_U;
+    pSnapshot->Y = Autothrust_Y;
+    pSnapshot->DWork = Autothrust_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_Autothrust_T *pSnapshot)
+  {
+    Autothrust_U = pSnapshot->U;
+    Autothrust_Y = pSnapshot->Y;
+    Autothrust_DWork = pSnapshot->DWork;
+  }
+
   AutothrustModelClass();
   ~AutothrustModelClass();
  private:
   ExternalInputs_Autothrust_T Autothrust_U;
   ExternalOutputs_Autothrust_T Autothrust_Y;
   D_Work_Autothrust_T Autothrust_DWork;
-  static Parameters_Autothrust_T Autothrust_P;
+  static RT_PARAMETERS_CONST Parameters_Autothrust_T Autothrust_P;
   static void Autothrust_TimeSinceCondition(real_T rtu_time, boolean_T rtu_condition, real_T *rty_y,
     rtDW_TimeSinceCondition_Autothrust_T *localDW);
   static void Autothrust_LeadLagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_C2, real_T rtu_C3, real_T rtu_C4, real_T
@@ -1,7 +1,7 @@
 #include "Autothrust.h"
 #include "Autothrust_private.h"
 
-AutothrustModelClass::Parameters_Autothrust_T AutothrustModelClass::Autothrust_P{
+RT_PARAMETERS_CONST AutothrustModelClass::Parameters_Autothrust_T AutothrustModelClass::Autothrust_P{
 
   {
     {
@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_ElacComputer_h_
 #define RTW_HEADER_ElacComputer_h_
 #include "rtwtypes.h"
@@ -313,6 +315,18 @@ class ElacComputer final
     boolean_T Constant10_Value;
   };
 
+  struct Snapshot_ElacComputer_T {
+    ExternalInputs_ElacComputer_T U;
+    ExternalOutputs_ElacComputer_T Y;
+    BlockIO_ElacComputer_T B;
+    D_Work_ElacComputer_T DWork;
+    LateralDirectLaw::Snapshot_LateralDirectLaw_T LawMDLOBJ1;
+    LateralNormalLaw::Snapshot_LateralNormalLaw_T LawMDLOBJ2;
+    PitchAlternateLaw::Snapshot_PitchAlternateLaw_T LawMDLOBJ3;
+    PitchDirectLaw::Snapshot_PitchDirectLaw_T LawMDLOBJ4;
+    PitchNormalLaw::Snapshot_PitchNormalLaw_T LawMDLOBJ5;
+  };
+
   ElacComputer(ElacComputer const&) = delete;
   ElacComputer& operator= (ElacComputer const&) & = delete;
   ElacComputer(ElacComputer &&) = delete;
@@ -330,6 +344,32 @@ class ElacComputer final
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_ElacComputer_T *pSnapshot) const
+  {
+    pSnapshot->U = ElacComputer_U;
+    pSnapshot->Y = ElacComputer_Y;
+    pSnapshot->B = ElacComputer_B;
+    pSnapshot->DWork = ElacComputer_DWork;
+    LawMDLOBJ1.saveSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.saveSnapshot(&pSnapshot->LawMDLOBJ2);
+    LawMDLOBJ3.saveSnapshot(&pSnapshot->LawMDLOBJ3);
+    LawMDLOBJ4.saveSnapshot(&pSnapshot->LawMDLOBJ4);
+    LawMDLOBJ5.saveSnapshot(&pSnapshot->LawMDLOBJ5);
+  }
+
+  void restoreSnapshot(const Snapshot_ElacComputer_T *pSnapshot)
+  {
+    ElacComputer_U = pSnapshot->U;
+    ElacComputer_Y = pSnapshot->Y;
+    ElacComputer_B = pSnapshot->B;
+    ElacComputer_DWork = pSnapshot->DWork;
+    LawMDLOBJ1.restoreSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.restoreSnapshot(&pSnapshot->LawMDLOBJ2);
+    LawMDLOBJ3.restoreSnapshot(&pSnapshot->LawMDLOBJ3);
+    LawMDLOBJ4.restoreSnapshot(&pSnapshot->LawMDLOBJ4);
+    LawMDLOBJ5.restoreSnapshot(&pSnapshot->LawMDLOBJ5);
+  }
+
   ElacComputer();
   ~ElacComputer();
  private:
@@ -337,7 +377,7 @@ class ElacComputer final
   ExternalOutputs_ElacComputer_T ElacComputer_Y;
   BlockIO_ElacComputer_T ElacComputer_B;
   D_Work_ElacComputer_T ElacComputer_DWork;
-  static Parameters_ElacComputer_T ElacComputer_P;
+  static RT_PARAMETERS_CONST Parameters_ElacComputer_T ElacComputer_P;
   static void ElacComputer_MATLABFunction(const base_arinc_429 *rtu_u, boolean_T *rty_y);
   static void ElacComputer_MATLABFunction_j(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void ElacComputer_RateLimiter_Reset(rtDW_RateLimiter_ElacComputer_T *localDW);
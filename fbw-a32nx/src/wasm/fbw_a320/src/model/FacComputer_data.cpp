@@ -1,1969 +0,0 @@
-#include "FacComputer.h"
-
-FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
-  {
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-
-    {
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0
-    },
-
-    {
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0
-    },
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false
-  },
-
-  {
-    0.0,
-    0.0,
-    0.0
-  },
-
-  {
-    0.0,
-    0.0,
-    0.0
-  },
-
-  {
-    false,
-    false,
-    false,
-    false,
-    false,
-    false
-  },
-  0.2,
-  0.5,
-  0.5,
-  0.5,
-  0.5,
-  0.4,
-  1.6,
-  20.0,
-  0.5,
-  1.0,
-  1.0,
-  0.0,
-  0.0,
-  0.0,
-  30.0,
-  0.0,
-  -20.0,
-  20.0,
-  16.0,
-  18.0,
-  19.0,
-  20.0,
-  12.0,
-  13.0,
-  14.0,
-  11.0,
-  12.0,
-  23.0,
-  23.0,
-  17.0,
-  18.0,
-  19.0,
-  20.0,
-  21.0,
-  26.0,
-  26.0,
-  26.0,
-  17.0,
-  18.0,
-  19.0,
-  20.0,
-  21.0,
-  26.0,
-  17.0,
-  18.0,
-  19.0,
-  20.0,
-  21.0,
-  26.0,
-  17.0,
-  18.0,
-  19.0,
-  20.0,
-  21.0,
-  26.0,
-  17.0,
-  18.0,
-  19.0,
-  20.0,
-  21.0,
-  26.0,
-  26.0,
-  26.0,
-  20.0,
-  26.0,
-  20.0,
-  26.0,
-  20000.0,
-  3.0,
-  4.0,
-  1.0,
-  2.0,
-  0.0,
-  5.0,
-  15000.0,
-  -1.0,
-  -1.0,
-  -1.0,
-  -1.0,
-  -1.0,
-  -5.0,
-  -0.1,
-  -1.2,
-  -2.0,
-  -40.0,
-  -1.0,
-  1.0,
-  10.0,
-  1.0,
-  1.0,
-  1.0,
-  1.0,
-  1.0,
-  5.0,
-  0.1,
-  1.2,
-  2.0,
-  40.0,
-  1.0,
-  SignStatusMatrix::NormalOperation,
-  SignStatusMatrix::FailureWarning,
-  SignStatusMatrix::NoComputedData,
-  35.0F,
-  80.0F,
-  80.0F,
-  false,
-  false,
-  true,
-  true,
-
-  {
-    {
-      {
-        0.0,
-        0.0,
-        0.0
-      },
-
-      {
-        false,
-        false,
-        false,
-        false,
-        false
-      },
-
-      {
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false
-      },
-
-      {
-        0.0,
-        0.0,
-        0.0
-      },
-
-      {
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        },
-
-        {
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          },
-
-          {
-            0U,
-            0.0F
-          }
-        }
-      }
-    },
-
-    {
-      0.0,
-      0.0,
-      0.0
-    },
-
-    {
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-
-      {
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0
-      },
-
-      {
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0,
-        0.0
-      },
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false,
-      false
-    },
-
-    {
-      0.0,
-      0.0,
-      false,
-      false,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      false,
-      0.0,
-      false,
-      0.0,
-      false,
-      0.0,
-      0.0,
-      false,
-      0.0
-    },
-
-    {
-      false,
-      false,
-      false,
-      false,
-      false,
-      false
-    },
-
-    {
-      0.0,
-      0.0,
-      0.0
-    },
-
-    {
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      },
-
-      {
-        0U,
-        0.0F
-      }
-    }
-  },
-
-  {
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    }
-  },
-
-  {
-    0.0,
-    0.0,
-    false,
-    false,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    false,
-    0.0,
-    false,
-    0.0,
-    false,
-    0.0,
-    0.0,
-    false,
-    0.0
-  },
-  200.0,
-  0.0,
-  280.0,
-  350.0,
-  0.0,
-  0.0,
-  0.0,
-  0.066666666666666666,
-  0.0,
-  1.0,
-  5.0,
-  -5.0,
-  0.033333333333333333,
-  5.0,
-  -5.0,
-  0.0302,
-  1000.0,
-  1.0,
-  57.295779513082323,
-
-  { 7.6, 7.6, 6.03, 6.03, 12.5, 12.5, 12.5, 12.5, 12.7, 12.7, 12.7, 12.7, 13.1, 13.1, 13.1, 13.1, 12.1, 12.1, 12.1, 12.1,
-    11.8, 11.8, 11.8, 11.8 },
-
-  { 0.0, 0.5, 0.9, 1.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { -1.84, -1.84, -2.18, -4.72, -4.27, -6.94 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 8.7, 8.7, 6.4, 6.4, 13.6, 13.6, 13.6, 13.6, 13.6, 13.6, 13.6, 13.6, 14.2, 14.2, 14.2, 14.2, 13.1, 13.1, 13.1, 13.1,
-    13.0, 13.0, 13.0, 13.0 },
-
-  { 0.0, 0.5, 0.9, 1.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 6.5, 6.5, 4.6, 4.6, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.9, 11.9, 11.9, 11.9, 11.0, 11.0, 11.0, 11.0,
-    10.6, 10.6, 10.6, 10.6 },
-
-  { 0.0, 0.5, 0.9, 1.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 6.5, 6.5, 4.6, 4.6, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.9, 11.9, 11.9, 11.9, 11.0, 11.0, 11.0, 11.0,
-    10.6, 10.6, 10.6, 10.6 },
-
-  { 0.0, 0.5, 0.9, 1.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 125.64, 102.24, 93.76, 91.89, 91.89, 84.47 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 1.2, 0.99, 0.91, 0.88, 0.88, 0.81 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-  0.0,
-  -40.0,
-
-  { 18.0, 0.0 },
-
-  { -40.0, 0.0 },
-  0.01,
-  410.0,
-  200.0,
-
-  { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5118, 0.5209, 0.5289, 0.5364, 0.5435, 0.5505, 0.5574, 0.5642, 0.5711, 0.5779, 0.5848,
-    0.5917, 0.5987, 0.6057, 0.6126, 0.6195, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5044, 0.516, 0.5252, 0.5335, 0.5413, 0.5488, 0.5563, 0.5636,
-    0.571, 0.5785, 0.586, 0.5935, 0.6011, 0.6087, 0.6163, 0.6239, 0.6313, 0.6385, 0.6456, 0.6525, 0.0, 0.0, 0.0, 0.0,
-    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5047, 0.5175, 0.5275,
-    0.5365, 0.545, 0.5532, 0.5613, 0.5694, 0.5775, 0.5857, 0.5939, 0.6022, 0.6105, 0.6188, 0.6269, 0.6349, 0.6427,
-    0.6503, 0.6576, 0.6647, 0.6715, 0.6782, 0.6846, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-    0.0, 0.0, 0.0, 0.0, 0.0, 0.5022, 0.5168, 0.5277, 0.5374, 0.5466, 0.5555, 0.5644, 0.5733, 0.5822, 0.5913, 0.6004,
-    0.6095, 0.6187, 0.6277, 0.6365, 0.6451, 0.6533, 0.6613, 0.669, 0.6764, 0.6835, 0.6905, 0.6972, 0.7039, 0.7105, 0.717,
-    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5016, 0.5143, 0.5254, 0.5359,
-    0.5461, 0.5562, 0.5663, 0.5763, 0.5864, 0.5965, 0.6065, 0.6163, 0.6259, 0.6352, 0.6441, 0.6528, 0.6611, 0.6692,
-    0.6769, 0.6845, 0.6919, 0.6992, 0.7065, 0.7137, 0.7211, 0.7286, 0.7366, 0.7452, 0.7554, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5064, 0.5215, 0.5336, 0.5447, 0.5554, 0.566, 0.5766, 0.5873, 0.5981,
-    0.6089, 0.6197, 0.6303, 0.6406, 0.6505, 0.66, 0.6691, 0.6778, 0.6862, 0.6944, 0.7024, 0.7103, 0.7182, 0.7262, 0.7344,
-    0.7434, 0.7536, 0.7679, 0.7679, 0.7679, 0.7679, 0.7679, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-    0.513, 0.5269, 0.5394, 0.5513, 0.563, 0.5748, 0.5867, 0.5987, 0.6106, 0.6224, 0.6338, 0.6448, 0.6554, 0.6654, 0.6751,
-    0.6843, 0.6933, 0.702, 0.7107, 0.7194, 0.7282, 0.7376, 0.748, 0.761, 0.761, 0.761, 0.761, 0.761, 0.761, 0.761, 0.761,
-    0.761, 0.761, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5151, 0.5303, 0.544, 0.5571, 0.5701, 0.5832,
-    0.5963, 0.6095, 0.6224, 0.6349, 0.6469, 0.6584, 0.6693, 0.6796, 0.6896, 0.6993, 0.7089, 0.7184, 0.7282, 0.7386,
-    0.7503, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667, 0.7667,
-    0.7667, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5156, 0.5326, 0.5474, 0.5615, 0.5755, 0.5896, 0.6039, 0.6182,
-    0.6321, 0.6455, 0.6583, 0.6704, 0.6818, 0.6928, 0.7035, 0.714, 0.7246, 0.7356, 0.748, 0.7644, 0.7644, 0.7644, 0.7644,
-    0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.7644, 0.0,
-    0.0, 0.0, 0.0, 0.0, 0.0, 0.5106, 0.5311, 0.5475, 0.563, 0.5784, 0.594, 0.6098, 0.6255, 0.6408, 0.6552, 0.6688,
-    0.6816, 0.6937, 0.7053, 0.7168, 0.7285, 0.7409, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556,
-    0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.7556, 0.0,
-    0.0, 0.0, 0.0, 0.5004, 0.526, 0.5445, 0.5617, 0.5789, 0.5964, 0.6141, 0.6315, 0.6481, 0.6635, 0.6778, 0.6913, 0.7041,
-    0.7167, 0.7295, 0.7433, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607,
-    0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607, 0.7607 },
-
-  { 0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 4.5, 5.0, 5.5, 6.0, 6.5, 7.0, 7.5, 8.0, 8.5, 9.0, 9.5, 10.0, 10.5, 11.0,
-    11.5, 12.0, 12.5, 13.0, 13.5, 14.0, 14.5, 15.0, 15.5, 16.0, 16.5, 17.0, 17.5, 18.0, 18.5, 19.0, 19.5, 20.0, 20.5,
-    21.0, 21.5, 22.0 },
-
-  { 210.0, 230.0, 250.0, 270.0, 290.0, 310.0, 330.0, 350.0, 370.0, 390.0, 410.0 },
-  1.0,
-  0.0,
-  116.0,
-  116.0,
-  15.0,
-  2.0,
-
-  { 1.2, 0.99, 0.91, 0.88, 0.88, 0.81 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 125.64, 102.24, 93.76, 91.89, 91.89, 84.47 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-  1.26,
-  20.0,
-  0.0,
-
-  { 1.2, 0.99, 0.91, 0.88, 0.88, 0.81 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 125.64, 102.24, 93.76, 91.89, 91.89, 84.47 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-  1.23,
-
-  { 230.0, 200.0, 200.0, 185.0, 177.0, 177.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
-  { 350.0, 230.0, 215.0, 200.0, 185.0, 177.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-  0.82,
-  660.0,
-  30.0,
-  10.0,
-  20.0,
-  -20.0,
-
-  { 25.0, 25.0, 14.5, 8.8, 4.8, 3.4, 3.4 },
-
-  { 100.0, 160.0, 200.0, 240.0, 320.0, 380.0, 400.0 },
-  30.0,
-  0.0,
-  0.0,
-  0.0,
-  0.0,
-  0.1101F,
-  0.0F,
-  0.0F,
-  0.0F,
-  0.0F,
-  0.0F,
-  0.0F,
-  0.0F,
-
-  { 3U, 5U },
-
-  { 3U, 5U },
-
-  { 3U, 5U },
-
-  { 3U, 5U },
-
-  { 44U, 10U },
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-
-  { false, true, false, false, true, true, false, false, true, false, true, true, false, false, false, false },
-  true,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false
-};
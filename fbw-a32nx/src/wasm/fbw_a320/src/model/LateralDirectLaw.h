@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_LateralDirectLaw_h_
 #define RTW_HEADER_LateralDirectLaw_h_
 #include "rtwtypes.h"
@@ -20,6 +22,10 @@ class LateralDirectLaw final
     real_T Gain1_Gain;
   };
 
+  struct Snapshot_LateralDirectLaw_T {
+    D_Work_LateralDirectLaw_T DWork;
+  };
+
   LateralDirectLaw(LateralDirectLaw const&) = delete;
   LateralDirectLaw& operator= (LateralDirectLaw const&) & = delete;
   LateralDirectLaw(LateralDirectLaw &&) = delete;
@@ -27,11 +33,21 @@ class LateralDirectLaw final
   void step(const real_T *rtu_In_time_dt, const real_T *rtu_In_delta_xi_pos, real_T *rty_Out_xi_deg, real_T
             *rty_Out_zeta_deg);
   void reset();
+  void saveSnapshot(Snapshot_LateralDirectLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = LateralDirectLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_LateralDirectLaw_T *pSnapshot)
+  {
+    LateralDirectLaw_DWork = pSnapshot->DWork;
+  }
+
   LateralDirectLaw();
   ~LateralDirectLaw();
  private:
   D_Work_LateralDirectLaw_T LateralDirectLaw_DWork;
-  static Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
 };
 
 extern LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
@@ -9,7 +9,7 @@ const uint8_T LateralNormalLaw_IN_GroundMode{ 2U };
 
 const uint8_T LateralNormalLaw_IN_NO_ACTIVE_CHILD{ 0U };
 
-LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw::LateralNormalLaw_rtP{
+RT_PARAMETERS_CONST LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw::LateralNormalLaw_rtP{
 
   { 0.0, 120.0, 150.0, 380.0 },
 
@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_LateralNormalLaw_h_
 #define RTW_HEADER_LateralNormalLaw_h_
 #include "rtwtypes.h"
@@ -121,6 +123,10 @@ class LateralNormalLaw final
   };
 
   void init();
+  struct Snapshot_LateralNormalLaw_T {
+    D_Work_LateralNormalLaw_T DWork;
+  };
+
   LateralNormalLaw(LateralNormalLaw const&) = delete;
   LateralNormalLaw& operator= (LateralNormalLaw const&) & = delete;
   LateralNormalLaw(LateralNormalLaw &&) = delete;
@@ -133,11 +139,21 @@ class LateralNormalLaw final
             *rtu_In_ap_phi_c_deg, const real_T *rtu_In_ap_beta_c_deg, const boolean_T *rtu_In_any_ap_engaged, real_T
             *rty_Out_xi_deg, real_T *rty_Out_zeta_deg);
   void reset();
+  void saveSnapshot(Snapshot_LateralNormalLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = LateralNormalLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_LateralNormalLaw_T *pSnapshot)
+  {
+    LateralNormalLaw_DWork = pSnapshot->DWork;
+  }
+
   LateralNormalLaw();
   ~LateralNormalLaw();
  private:
   D_Work_LateralNormalLaw_T LateralNormalLaw_DWork;
-  static Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
   static void LateralNormalLaw_RateLimiter_Reset(rtDW_RateLimiter_LateralNormalLaw_T *localDW);
   static void LateralNormalLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_LateralNormalLaw_T *localDW);
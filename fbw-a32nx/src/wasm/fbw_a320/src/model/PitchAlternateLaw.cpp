@@ -23,7 +23,7 @@ const uint8_T PitchAlternateLaw_IN_flight_flaps{ 2U };
 
 const uint8_T PitchAlternateLaw_IN_ground{ 3U };
 
-PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw::PitchAlternateLaw_rtP{
+RT_PARAMETERS_CONST PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw::PitchAlternateLaw_rtP{
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
 
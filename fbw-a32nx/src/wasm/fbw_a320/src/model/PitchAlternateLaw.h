@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_PitchAlternateLaw_h_
 #define RTW_HEADER_PitchAlternateLaw_h_
 #include "rtwtypes.h"
@@ -197,6 +199,10 @@ class PitchAlternateLaw final
   };
 
   void init();
+  struct Snapshot_PitchAlternateLaw_T {
+    D_Work_PitchAlternateLaw_T DWork;
+  };
+
   PitchAlternateLaw(PitchAlternateLaw const&) = delete;
   PitchAlternateLaw& operator= (PitchAlternateLaw const&) & = delete;
   PitchAlternateLaw(PitchAlternateLaw &&) = delete;
@@ -209,11 +215,21 @@ class PitchAlternateLaw final
             boolean_T *rtu_In_tracking_mode_on, const boolean_T *rtu_In_stabilities_available, real_T *rty_Out_eta_deg,
             real_T *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void saveSnapshot(Snapshot_PitchAlternateLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = PitchAlternateLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_PitchAlternateLaw_T *pSnapshot)
+  {
+    PitchAlternateLaw_DWork = pSnapshot->DWork;
+  }
+
   PitchAlternateLaw();
   ~PitchAlternateLaw();
  private:
   D_Work_PitchAlternateLaw_T PitchAlternateLaw_DWork;
-  static Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
   static void PitchAlternateLaw_RateLimiter_Reset(rtDW_RateLimiter_PitchAlternateLaw_T *localDW);
   static void PitchAlternateLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_PitchAlternateLaw_T *localDW);
@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw::PitchDirectLaw_rtP{
+RT_PARAMETERS_CONST PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw::PitchDirectLaw_rtP{
 
   0.0,
 
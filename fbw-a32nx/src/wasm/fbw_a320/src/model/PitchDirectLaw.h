@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_PitchDirectLaw_h_
 #define RTW_HEADER_PitchDirectLaw_h_
 #include "rtwtypes.h"
@@ -24,6 +26,10 @@ class PitchDirectLaw final
     real_T Saturation_LowerSat;
   };
 
+  struct Snapshot_PitchDirectLaw_T {
+    D_Work_PitchDirectLaw_T DWork;
+  };
+
   PitchDirectLaw(PitchDirectLaw const&) = delete;
   PitchDirectLaw& operator= (PitchDirectLaw const&) & = delete;
   PitchDirectLaw(PitchDirectLaw &&) = delete;
@@ -31,11 +37,21 @@ class PitchDirectLaw final
   void step(const real_T *rtu_In_time_dt, const real_T *rtu_In_delta_eta_pos, real_T *rty_Out_eta_deg, real_T
             *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void saveSnapshot(Snapshot_PitchDirectLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = PitchDirectLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_PitchDirectLaw_T *pSnapshot)
+  {
+    PitchDirectLaw_DWork = pSnapshot->DWork;
+  }
+
   PitchDirectLaw();
   ~PitchDirectLaw();
  private:
   D_Work_PitchDirectLaw_T PitchDirectLaw_DWork;
-  static Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
 };
 
 extern PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
@@ -40,7 +40,7 @@ const uint8_T PitchNormalLaw_IN_OFF{ 1U };
 
 const uint8_T PitchNormalLaw_IN_ON{ 2U };
 
-PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
+RT_PARAMETERS_CONST PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 0.0, 50.0, 100.0, 200.0 },
 
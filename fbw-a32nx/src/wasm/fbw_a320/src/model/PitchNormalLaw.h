@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_PitchNormalLaw_h_
 #define RTW_HEADER_PitchNormalLaw_h_
 #include "rtwtypes.h"
@@ -473,6 +475,11 @@ class PitchNormalLaw final
   };
 
   void init();
+  struct Snapshot_PitchNormalLaw_T {
+    BlockIO_PitchNormalLaw_T B;
+    D_Work_PitchNormalLaw_T DWork;
+  };
+
   PitchNormalLaw(PitchNormalLaw const&) = delete;
   PitchNormalLaw& operator= (PitchNormalLaw const&) & = delete;
   PitchNormalLaw(PitchNormalLaw &&) = delete;
@@ -491,12 +498,24 @@ class PitchNormalLaw final
             *rtu_In_any_ap_engaged, real_T *rty_Out_eta_deg, real_T *rty_Out_eta_trim_dot_deg_s, real_T
             *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void saveSnapshot(Snapshot_PitchNormalLaw_T *pSnapshot) const
+  {
+    pSnapshot->B = PitchNormalLaw_B;
+    pSnapshot->DWork = PitchNormalLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_PitchNormalLaw_T *pSnapshot)
+  {
+    PitchNormalLaw_B = pSnapshot->B;
+    PitchNormalLaw_DWork = pSnapshot->DWork;
+  }
+
   PitchNormalLaw();
   ~PitchNormalLaw();
  private:
   BlockIO_PitchNormalLaw_T PitchNormalLaw_B;
   D_Work_PitchNormalLaw_T PitchNormalLaw_DWork;
-  static Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
   static void PitchNormalLaw_LagFilter_Reset(rtDW_LagFilter_PitchNormalLaw_T *localDW);
   static void PitchNormalLaw_LagFilter(const real_T *rtu_U, real_T rtu_C1, const real_T *rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_PitchNormalLaw_T *localDW);
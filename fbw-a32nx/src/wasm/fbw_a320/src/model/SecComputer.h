@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_SecComputer_h_
 #define RTW_HEADER_SecComputer_h_
 #include "rtwtypes.h"
@@ -281,6 +283,16 @@ class SecComputer final
     boolean_T Constant10_Value;
   };
 
+  struct Snapshot_SecComputer_T {
+    ExternalInputs_SecComputer_T U;
+    ExternalOutputs_SecComputer_T Y;
+    BlockIO_SecComputer_T B;
+    D_Work_SecComputer_T DWork;
+    LateralDirectLaw::Snapshot_LateralDirectLaw_T LawMDLOBJ1;
+    PitchAlternateLaw::Snapshot_PitchAlternateLaw_T LawMDLOBJ2;
+    PitchDirectLaw::Snapshot_PitchDirectLaw_T LawMDLOBJ3;
+  };
+
   SecComputer(SecComputer const&) = delete;
   SecComputer& operator= (SecComputer const&) & = delete;
   SecComputer(SecComputer &&) = delete;
@@ -298,6 +310,28 @@ class SecComputer final
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_SecComputer_T *pSnapshot) const
+  {
+    pSnapshot->U = SecComputer_U;
+    pSnapshot->Y = SecComputer_Y;
+    pSnapshot->B = SecComputer_B;
+    pSnapshot->DWork = SecComputer_DWork;
+    LawMDLOBJ1.saveSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.saveSnapshot(&pSnapshot->LawMDLOBJ2);
+    LawMDLOBJ3.saveSnapshot(&pSnapshot->LawMDLOBJ3);
+  }
+
+  void restoreSnapshot(const Snapshot_SecComputer_T *pSnapshot)
+  {
+    SecComputer_U = pSnapshot->U;
+    SecComputer_Y = pSnapshot->Y;
+    SecComputer_B = pSnapshot->B;
+    SecComputer_DWork = pSnapshot->DWork;
+    LawMDLOBJ1.restoreSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.restoreSnapshot(&pSnapshot->LawMDLOBJ2);
+    LawMDLOBJ3.restoreSnapshot(&pSnapshot->LawMDLOBJ3);
+  }
+
   SecComputer();
   ~SecComputer();
  private:
@@ -305,7 +339,7 @@ class SecComputer final
   ExternalOutputs_SecComputer_T SecComputer_Y;
   BlockIO_SecComputer_T SecComputer_B;
   D_Work_SecComputer_T SecComputer_DWork;
-  static Parameters_SecComputer_T SecComputer_P;
+  static RT_PARAMETERS_CONST Parameters_SecComputer_T SecComputer_P;
   static void SecComputer_MATLABFunction(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void SecComputer_RateLimiter_Reset(rtDW_RateLimiter_SecComputer_T *localDW);
   static void SecComputer_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T rtu_init, real_T
@@ -98,7 +98,7 @@ base_sec_discrete_outputs rtP_sec_discrete_output_MATLABStruct{
   false
 } ;
 
-SecComputer::Parameters_SecComputer_T SecComputer::SecComputer_P{
+RT_PARAMETERS_CONST SecComputer::Parameters_SecComputer_T SecComputer::SecComputer_P{
 
   1.0,
 
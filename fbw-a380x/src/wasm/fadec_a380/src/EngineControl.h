@@ -42,13 +42,10 @@ struct Configuration {
 class EngineControl {
  private:
   SimVars* simVars;
-  EngineRatios* ratios;
   Polynomial* poly;
-  Timer timerEngine1;
-  Timer timerEngine2;
-  Timer timerEngine3;
-  Timer timerEngine4;
-  Timer timerFuel;
+  ThrustLimits thrustLimits;
+  /// Sim time since the fuel quantities were last saved (in seconds)
+  double fuelSaveTimer = 0;
 
   std::string confFilename = FILENAME_FADEC_CONF_DIRECTORY;
 
@@ -74,20 +71,11 @@ class EngineControl {
   double simN1;
   double simN3;
   double thrust;
-  double simN3Engine1Pre;
-  double simN3Engine2Pre;
-  double simN3Engine3Pre;
-  double simN3Engine4Pre;
+  double simN3Pre[4];
   double deltaN3;
-  double thermalEnergy1;
-  double thermalEnergy2;
-  double thermalEnergy3;
-  double thermalEnergy4;
+  double thermalEnergy[4];
   double oilTemperature;
-  double oilTemperatureEngine1Pre;
-  double oilTemperatureEngine2Pre;
-  double oilTemperatureEngine3Pre;
-  double oilTemperatureEngine4Pre;
+  double oilTemperaturePre[4];
   double oilTemperatureMax;
   double idleN1;
   double idleN3;
@@ -99,6 +87,7 @@ class EngineControl {
   double correctedEGT;
   double correctedFuelFlow;
   double cFbwFF;
+  AmbientRatios ambientRatios;
 
   const double LBS_TO_KGS = 0.4535934;
   const double KGS_TO_LBS = 1 / 0.4535934;
@@ -123,11 +112,11 @@ class EngineControl {
     double idleCFF;
 
     idleCN1 = iCN1(pressAltitude, mach, ambientTemp);
-    idleN1 = idleCN1 * sqrt(ratios->theta2(0, ambientTemp));
-    idleN3 = iCN3(pressAltitude, mach) * sqrt(ratios->theta(ambientTemp));
-    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                                               // lbs/hr
-    idleFF = idleCFF * LBS_TO_KGS * ratios->delta2(0, ambientPressure) * sqrt(ratios->theta2(0, ambientTemp));  // Kg/hr
-    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ratios->theta2(0, ambientTemp);
+    idleN1 = idleCN1 * ambientRatios.sqrtTheta;
+    idleN3 = iCN3(pressAltitude, mach) * ambientRatios.sqrtTheta;
+    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                   // lbs/hr
+    idleFF = idleCFF * LBS_TO_KGS * ambientRatios.delta * ambientRatios.sqrtTheta;  // Kg/hr
+    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ambientRatios.theta;
 
     simVars->setEngineIdleN1(idleN1);
     simVars->setEngineIdleN3(idleN3);
@@ -153,26 +142,9 @@ class EngineControl {
                           double ambientTemp,
                           double deltaTimeDiff) {
     int resetTimer = 0;
-    double egtFbw = 0;
-
-    switch (engine) {
-      case 1:
-        engineState = simVars->getEngine1State();
-        egtFbw = simVars->getEngine1EGT();
-        break;
-      case 2:
-        engineState = simVars->getEngine2State();
-        egtFbw = simVars->getEngine2EGT();
-        break;
-      case 3:
-        engineState = simVars->getEngine3State();
-        egtFbw = simVars->getEngine3EGT();
-        break;
-      case 4:
-        engineState = simVars->getEngine4State();
-        egtFbw = simVars->getEngine4EGT();
-        break;
-    }
+    double egtFbw = simVars->getEngineEGT(engine);
+
+    engineState = simVars->getEngineState(engine);
 
     // Present State PAUSED
     if (deltaTimeDiff == 0 && engineState < 10) {
@@ -246,31 +218,9 @@ class EngineControl {
       }
     }
 
-    switch (engine) {
-      case 1:
-        simVars->setEngine1State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine1Timer(0);
-        }
-        break;
-      case 2:
-        simVars->setEngine2State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine2Timer(0);
-        }
-        break;
-      case 3:
-        simVars->setEngine3State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine3Timer(0);
-        }
-        break;
-      case 4:
-        simVars->setEngine4State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine4Timer(0);
-        }
-        break;
+    simVars->setEngineState(engine, engineState);
+    if (resetTimer == 1) {
+      simVars->setEngineTimer(engine, 0);
     }
   }
 
@@ -284,10 +234,7 @@ class EngineControl {
                             double simN3,
                             double pressAltitude,
                             double ambientTemp) {
-    double startCN3Engine1;
-    double startCN3Engine2;
-    double startCN3Engine3;
-    double startCN3Engine4;
+    double startCN3;
     double preN3Fbw;
     double newN3Fbw;
     double preEgtFbw;
@@ -299,163 +246,44 @@ class EngineControl {
     idleFF = simVars->getEngineIdleFF();
     idleEGT = simVars->getEngineIdleEGT();
 
-    if (engine == 1) {
-      // Delay between Engine Master ON and Start Valve Open
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine1(0);
-        }
-        simVars->setEngine1Timer(timer + deltaTime);
-        startCN3Engine1 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN3Engine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN3Engine1);
-      } else {
-        preN3Fbw = simVars->getEngine1N3();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN3Fbw = poly->startN3(simN3, preN3Fbw, idleN3);
-        startEgtFbw = poly->startEGT(newN3Fbw, idleN3, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine1N3(newN3Fbw);
-        simVars->setEngine1N2(newN3Fbw + 0.7);
-        simVars->setEngine1N1(poly->startN1(newN3Fbw, idleN3, idleN1));
-        simVars->setEngine1FF(poly->startFF(newN3Fbw, idleN3, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine1EGT(startEgtFbw);
-            simVars->setEngine1State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine1EGT(preEgtFbw + (0.75 * deltaTime * (idleN3 - newN3Fbw)));
-          } else {
-            simVars->setEngine1EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine1EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN3Fbw, idleN3, ambientTemp);
-        oilTemperatureEngine1Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
+    // Delay between Engine Master ON and Start Valve Open
+    if (timer < 1.7) {
+      if (simOnGround == 1) {
+        simVars->setFuelUsedEngine(engine, 0);
       }
-    } else if (engine == 2) {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine2(0);
-        }
-        simVars->setEngine2Timer(timer + deltaTime);
-        startCN3Engine2 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN3Engine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN3Engine2);
-      } else {
-        preN3Fbw = simVars->getEngine2N3();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN3Fbw = poly->startN3(simN3, preN3Fbw, idleN3);
-        startEgtFbw = poly->startEGT(newN3Fbw, idleN3, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine2N3(newN3Fbw);
-        simVars->setEngine2N2(newN3Fbw + 0.7);
-        simVars->setEngine2N1(poly->startN1(newN3Fbw, idleN3, idleN1));
-        simVars->setEngine2FF(poly->startFF(newN3Fbw, idleN3, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine2EGT(startEgtFbw);
-            simVars->setEngine2State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine2EGT(preEgtFbw + (0.75 * deltaTime * (idleN3 - newN3Fbw)));
-          } else {
-            simVars->setEngine2EGT(shutdownEgtFbw);
-          }
+      simVars->setEngineTimer(engine, timer + deltaTime);
+      startCN3 = 0;
+      SimConnect_SetDataOnSimObject(hSimConnect, StartCN3DataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &startCN3);
+    } else {
+      preN3Fbw = simVars->getEngineN3(engine);
+      preEgtFbw = simVars->getEngineEGT(engine);
+      newN3Fbw = poly->startN3(simN3, preN3Fbw, idleN3);
+      startEgtFbw = poly->startEGT(newN3Fbw, idleN3, ambientTemp, idleEGT);
+      shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
+
+      simVars->setEngineN3(engine, newN3Fbw);
+      simVars->setEngineN2(engine, newN3Fbw + 0.7);
+      simVars->setEngineN1(engine, poly->startN1(newN3Fbw, idleN3, idleN1));
+      simVars->setEngineFF(engine, poly->startFF(newN3Fbw, idleN3, idleFF));
+
+      if (engineState == 3) {
+        if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
+          simVars->setEngineEGT(engine, startEgtFbw);
+          simVars->setEngineState(engine, 2);
+        } else if (startEgtFbw > preEgtFbw) {
+          simVars->setEngineEGT(engine, preEgtFbw + (0.75 * deltaTime * (idleN3 - newN3Fbw)));
         } else {
-          simVars->setEngine2EGT(startEgtFbw);
+          simVars->setEngineEGT(engine, shutdownEgtFbw);
         }
-
-        oilTemperature = poly->startOilTemp(newN3Fbw, idleN3, ambientTemp);
-        oilTemperatureEngine2Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    } else if (engine == 3) {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine3(0);
-        }
-        simVars->setEngine3Timer(timer + deltaTime);
-        startCN3Engine3 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN3Engine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN3Engine3);
       } else {
-        preN3Fbw = simVars->getEngine3N3();
-        preEgtFbw = simVars->getEngine3EGT();
-        newN3Fbw = poly->startN3(simN3, preN3Fbw, idleN3);
-        startEgtFbw = poly->startEGT(newN3Fbw, idleN3, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine3N3(newN3Fbw);
-        simVars->setEngine3N2(newN3Fbw + 0.7);
-        simVars->setEngine3N1(poly->startN1(newN3Fbw, idleN3, idleN1));
-        simVars->setEngine3FF(poly->startFF(newN3Fbw, idleN3, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine3EGT(startEgtFbw);
-            simVars->setEngine3State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine3EGT(preEgtFbw + (0.75 * deltaTime * (idleN3 - newN3Fbw)));
-          } else {
-            simVars->setEngine3EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine3EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN3Fbw, idleN3, ambientTemp);
-        oilTemperatureEngine3Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
+        simVars->setEngineEGT(engine, startEgtFbw);
       }
-    } else {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine4(0);
-        }
-        simVars->setEngine4Timer(timer + deltaTime);
-        startCN3Engine4 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN3Engine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN3Engine4);
-      } else {
-        preN3Fbw = simVars->getEngine4N3();
-        preEgtFbw = simVars->getEngine4EGT();
-        newN3Fbw = poly->startN3(simN3, preN3Fbw, idleN3);
-        startEgtFbw = poly->startEGT(newN3Fbw, idleN3, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine4N3(newN3Fbw);
-        simVars->setEngine4N2(newN3Fbw + 0.7);
-        simVars->setEngine4N1(poly->startN1(newN3Fbw, idleN3, idleN1));
-        simVars->setEngine4FF(poly->startFF(newN3Fbw, idleN3, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine4EGT(startEgtFbw);
-            simVars->setEngine4State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine4EGT(preEgtFbw + (0.75 * deltaTime * (idleN3 - newN3Fbw)));
-          } else {
-            simVars->setEngine4EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine4EGT(startEgtFbw);
-        }
 
-        oilTemperature = poly->startOilTemp(newN3Fbw, idleN3, ambientTemp);
-        oilTemperatureEngine4Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
+      oilTemperature = poly->startOilTemp(newN3Fbw, idleN3, ambientTemp);
+      oilTemperaturePre[engine - 1] = oilTemperature;
+      SimConnect_SetDataOnSimObject(hSimConnect, OilTempDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &oilTemperature);
     }
   }
 
@@ -470,78 +298,22 @@ class EngineControl {
     double newN3Fbw;
     double newEgtFbw;
 
-    if (engine == 1) {
-      if (timer < 1.8) {
-        simVars->setEngine1Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine1N1();
-        preN3Fbw = simVars->getEngine1N3();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN3Fbw = poly->shutdownN3(preN3Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine1N1(newN1Fbw);
-        simVars->setEngine1N2(newN3Fbw + 0.7);
-        simVars->setEngine1N3(newN3Fbw);
-        simVars->setEngine1EGT(newEgtFbw);
-      }
-    } else if (engine == 2) {
-      if (timer < 1.8) {
-        simVars->setEngine2Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine2N1();
-        preN3Fbw = simVars->getEngine2N3();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN3Fbw = poly->shutdownN3(preN3Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine2N1(newN1Fbw);
-        simVars->setEngine2N2(newN3Fbw + 0.7);
-        simVars->setEngine2N3(newN3Fbw);
-        simVars->setEngine2EGT(newEgtFbw);
-      }
-    } else if (engine == 3) {
-      if (timer < 1.8) {
-        simVars->setEngine3Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine3N1();
-        preN3Fbw = simVars->getEngine3N3();
-        preEgtFbw = simVars->getEngine3EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN3Fbw = poly->shutdownN3(preN3Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine3N1(newN1Fbw);
-        simVars->setEngine3N2(newN3Fbw + 0.7);
-        simVars->setEngine3N3(newN3Fbw);
-        simVars->setEngine3EGT(newEgtFbw);
-      }
+    if (timer < 1.8) {
+      simVars->setEngineTimer(engine, timer + deltaTime);
     } else {
-      if (timer < 1.8) {
-        simVars->setEngine4Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine4N1();
-        preN3Fbw = simVars->getEngine4N3();
-        preEgtFbw = simVars->getEngine4EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN3Fbw = poly->shutdownN3(preN3Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine4N1(newN1Fbw);
-        simVars->setEngine4N2(newN3Fbw + 0.7);
-        simVars->setEngine4N3(newN3Fbw);
-        simVars->setEngine4EGT(newEgtFbw);
+      preN1Fbw = simVars->getEngineN1(engine);
+      preN3Fbw = simVars->getEngineN3(engine);
+      preEgtFbw = simVars->getEngineEGT(engine);
+      newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
+      if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
+        newN1Fbw = simN1;
       }
+      newN3Fbw = poly->shutdownN3(preN3Fbw, deltaTime);
+      newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
+      simVars->setEngineN1(engine, newN1Fbw);
+      simVars->setEngineN2(engine, newN3Fbw + 0.7);
+      simVars->setEngineN3(engine, newN3Fbw);
+      simVars->setEngineEGT(engine, newEgtFbw);
     }
   }
   /// <summary>
@@ -549,23 +321,9 @@ class EngineControl {
   /// Updates Engine N1, N2 and N3 with our own algorithm for start-up and shutdown
   /// </summary>
   void updatePrimaryParameters(int engine, double simN1, double simN3) {
-    if (engine == 1) {
-      simVars->setEngine1N1(simN1);
-      simVars->setEngine1N2(simN3 + 0.7);
-      simVars->setEngine1N3(simN3);
-    } else if (engine == 2) {
-      simVars->setEngine2N1(simN1);
-      simVars->setEngine2N2(simN3 + 0.7);
-      simVars->setEngine2N3(simN3);
-    } else if (engine == 3) {
-      simVars->setEngine3N1(simN1);
-      simVars->setEngine3N2(simN3 + 0.7);
-      simVars->setEngine3N3(simN3);
-    } else {
-      simVars->setEngine4N1(simN1);
-      simVars->setEngine4N2(simN3 + 0.7);
-      simVars->setEngine4N3(simN3);
-    }
+    simVars->setEngineN1(engine, simN1);
+    simVars->setEngineN2(engine, simN3 + 0.7);
+    simVars->setEngineN3(engine, simN3);
   }
 
   /// <summary>
@@ -581,53 +339,18 @@ class EngineControl {
                  double mach,
                  double pressAltitude,
                  double ambientTemp) {
-    double egtFbwPreviousEng1;
-    double egtFbwActualEng1;
-    double egtFbwPreviousEng2;
-    double egtFbwActualEng2;
-    double egtFbwPreviousEng3;
-    double egtFbwActualEng3;
-    double egtFbwPreviousEng4;
-    double egtFbwActualEng4;
+    double egtFbwPrevious;
+    double egtFbwActual;
 
     correctedEGT = poly->correctedEGT(simCN1, cFbwFF, mach, pressAltitude);
 
-    if (engine == 1) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine1EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng1 = simVars->getEngine1EGT();
-        egtFbwActualEng1 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng1 = egtFbwActualEng1 + (egtFbwPreviousEng1 - egtFbwActualEng1) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine1EGT(egtFbwActualEng1);
-      }
-    } else if (engine == 2) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine2EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng2 = simVars->getEngine2EGT();
-        egtFbwActualEng2 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng2 = egtFbwActualEng2 + (egtFbwPreviousEng2 - egtFbwActualEng2) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine2EGT(egtFbwActualEng2);
-      }
-    } else if (engine == 3) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine3EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng3 = simVars->getEngine3EGT();
-        egtFbwActualEng3 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng3 = egtFbwActualEng3 + (egtFbwPreviousEng3 - egtFbwActualEng3) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine3EGT(egtFbwActualEng3);
-      }
+    if (simOnGround == 1 && engineState == 0) {
+      simVars->setEngineEGT(engine, ambientTemp);
     } else {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine4EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng4 = simVars->getEngine3EGT();
-        egtFbwActualEng4 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng4 = egtFbwActualEng4 + (egtFbwPreviousEng4 - egtFbwActualEng4) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine4EGT(egtFbwActualEng4);
-      }
+      egtFbwPrevious = simVars->getEngineEGT(engine);
+      egtFbwActual = (correctedEGT * ambientRatios.theta2);
+      egtFbwActual = egtFbwActual + (egtFbwPrevious - egtFbwActual) * expFBW(-0.1 * deltaTime);
+      simVars->setEngineEGT(engine, egtFbwActual);
     }
   }
 
@@ -635,7 +358,7 @@ class EngineControl {
   /// FBW Fuel FLow (in Kg/h)
   /// Updates Fuel Flow with realistic values
   /// </summary>
-  double updateFF(int engine, double simCN1, double mach, double pressAltitude, double ambientTemp, double ambientPressure) {
+  double updateFF(int engine, double simCN1, double mach, double pressAltitude) {
     double outFlow = 0;
 
     correctedFuelFlow = poly->correctedFuelFlow(simCN1, mach, pressAltitude);  // in lbs/hr.
@@ -644,18 +367,10 @@ class EngineControl {
     if (correctedFuelFlow < 1) {
       outFlow = 0;
     } else {
-      outFlow = (correctedFuelFlow * LBS_TO_KGS * ratios->delta2(mach, ambientPressure) * sqrt(ratios->theta2(mach, ambientTemp)));
+      outFlow = (correctedFuelFlow * LBS_TO_KGS * ambientRatios.delta2 * ambientRatios.sqrtTheta2);
     }
 
-    if (engine == 1) {
-      simVars->setEngine1FF(outFlow);
-    } else if (engine == 2) {
-      simVars->setEngine2FF(outFlow);
-    } else if (engine == 3) {
-      simVars->setEngine3FF(outFlow);
-    } else {
-      simVars->setEngine4FF(outFlow);
-    }
+    simVars->setEngineFF(engine, outFlow);
 
     return correctedFuelFlow;
   }
@@ -666,8 +381,8 @@ class EngineControl {
   /// </summary>
   void updateOil(int engine, double thrust, double simN3, double deltaN3, double deltaTime, double ambientTemp) {
     double steadyTemperature;
-    double thermalEnergy;
-    double oilTemperaturePre;
+    double energy;
+    double oilTemperaturePrevious;
     double oilQtyActual;
     double oilTotalActual;
     double oilQtyObjective;
@@ -678,43 +393,23 @@ class EngineControl {
     //--------------------------------------------
     // Engine Reading
     //--------------------------------------------
-    if (engine == 1) {
-      steadyTemperature = simVars->getEngine1EGT();
-      thermalEnergy = thermalEnergy1;
-      oilTemperaturePre = oilTemperatureEngine1Pre;
-      oilQtyActual = simVars->getEngine1Oil();
-      oilTotalActual = simVars->getEngine1TotalOil();
-    } else if (engine == 2) {
-      steadyTemperature = simVars->getEngine2EGT();
-      thermalEnergy = thermalEnergy2;
-      oilTemperaturePre = oilTemperatureEngine2Pre;
-      oilQtyActual = simVars->getEngine2Oil();
-      oilTotalActual = simVars->getEngine2TotalOil();
-    } else if (engine == 3) {
-      steadyTemperature = simVars->getEngine3EGT();
-      thermalEnergy = thermalEnergy3;
-      oilTemperaturePre = oilTemperatureEngine3Pre;
-      oilQtyActual = simVars->getEngine3Oil();
-      oilTotalActual = simVars->getEngine3TotalOil();
-    } else {
-      steadyTemperature = simVars->getEngine4EGT();
-      thermalEnergy = thermalEnergy4;
-      oilTemperaturePre = oilTemperatureEngine4Pre;
-      oilQtyActual = simVars->getEngine4Oil();
-      oilTotalActual = simVars->getEngine4TotalOil();
-    }
+    steadyTemperature = simVars->getEngineEGT(engine);
+    energy = thermalEnergy[engine - 1];
+    oilTemperaturePrevious = oilTemperaturePre[engine - 1];
+    oilQtyActual = simVars->getEngineOil(engine);
+    oilTotalActual = simVars->getEngineTotalOil(engine);
 
     //--------------------------------------------
     // Oil Temperature
     //--------------------------------------------
-    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperaturePre - 10) {
+    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperaturePrevious - 10) {
       oilTemperature = ambientTemp;
     } else {
       if (steadyTemperature > oilTemperatureMax) {
         steadyTemperature = oilTemperatureMax;
       }
-      thermalEnergy = (0.995 * thermalEnergy) + (deltaN3 / deltaTime);
-      oilTemperature = poly->oilTemperature(thermalEnergy, oilTemperaturePre, steadyTemperature, deltaTime);
+      energy = (0.995 * energy) + (deltaN3 / deltaTime);
+      oilTemperature = poly->oilTemperature(energy, oilTemperaturePrevious, steadyTemperature, deltaTime);
     }
 
     //--------------------------------------------
@@ -722,7 +417,7 @@ class EngineControl {
     //--------------------------------------------
     // Calculating Oil Qty as a function of thrust
     oilQtyObjective = oilTotalActual * (1 - poly->oilGulpPct(thrust));
-    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePre);
+    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePrevious);
 
     // Oil burnt taken into account for tank and total oil
     oilBurn = (0.00011111 * deltaTime);
@@ -739,39 +434,13 @@ class EngineControl {
     //--------------------------------------------
     // Engine Writing
     //--------------------------------------------
-    if (engine == 1) {
-      thermalEnergy1 = thermalEnergy;
-      oilTemperatureEngine1Pre = oilTemperature;
-      simVars->setEngine1Oil(oilQtyActual);
-      simVars->setEngine1TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else if (engine == 2) {
-      thermalEnergy2 = thermalEnergy;
-      oilTemperatureEngine2Pre = oilTemperature;
-      simVars->setEngine2Oil(oilQtyActual);
-      simVars->setEngine2TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else if (engine == 3) {
-      thermalEnergy3 = thermalEnergy;
-      oilTemperatureEngine3Pre = oilTemperature;
-      simVars->setEngine3Oil(oilQtyActual);
-      simVars->setEngine3TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else {
-      thermalEnergy4 = thermalEnergy;
-      oilTemperatureEngine4Pre = oilTemperature;
-      simVars->setEngine4Oil(oilQtyActual);
-      simVars->setEngine4TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    }
+    thermalEnergy[engine - 1] = energy;
+    oilTemperaturePre[engine - 1] = oilTemperature;
+    simVars->setEngineOil(engine, oilQtyActual);
+    simVars->setEngineTotalOil(engine, oilTotalActual);
+    SimConnect_SetDataOnSimObject(hSimConnect, OilTempDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                  &oilTemperature);
+    SimConnect_SetDataOnSimObject(hSimConnect, OilPsiDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
   }
 
   /// <summary>
@@ -861,6 +530,7 @@ class EngineControl {
     isReady = simVars->getIsReady();
     devState = simVars->getDeveloperState();
 
+    fuelSaveTimer += deltaTime;
     deltaTime = deltaTime / 3600;
 
     /*--------------------------------------------
@@ -1125,7 +795,7 @@ class EngineControl {
     }
 
     // Will save the current fuel quantities if on the ground AND engines being shutdown
-    if (timerFuel.elapsed() >= 1000 && simVars->getSimOnGround() &&
+    if (fuelSaveTimer >= 1.0 && simVars->getSimOnGround() &&
         (engine1State == 0 || engine1State == 10 || engine1State == 4 || engine1State == 14 || engine2State == 0 || engine2State == 10 ||
          engine2State == 4 || engine2State == 14 || engine3State == 0 || engine3State == 10 || engine3State == 4 || engine3State == 14 ||
          engine4State == 0 || engine4State == 10 || engine4State == 4 || engine4State == 14)) {
@@ -1144,7 +814,7 @@ class EngineControl {
       configuration.fuelTrim = simVars->getFuelTrimPre() / simVars->getFuelWeightGallon();
 
       saveFuelInConfiguration(configuration);
-      timerFuel.reset();
+      fuelSaveTimer = 0;
     }
   }
 
@@ -1170,14 +840,13 @@ class EngineControl {
     double flex = 0;
 
     // Write all N1 Limits
-    to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    if (flexTemp > 0) {
-      flex_to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-      flex_ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-    }
-    clb = limitN1(2, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
-    mct = limitN1(3, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+    const N1Limits& n1Limits = thrustLimits.compute(pressAltitude, ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+    to = n1Limits.to;
+    ga = n1Limits.ga;
+    flex_to = n1Limits.flexTo;
+    flex_ga = n1Limits.flexGa;
+    clb = n1Limits.clb;
+    mct = n1Limits.mct;
 
     // transition between TO and GA limit -----------------------------------------------------------------------------
     double machFactorLow = max(0.0, min(1.0, (mach - 0.04) / 0.04));
@@ -1265,10 +934,9 @@ class EngineControl {
     simVars = new SimVars();
     double engTime = 0;
     ambientTemp = simVars->getAmbientTemperature();
-    simN3Engine1Pre = simVars->getN2(1);
-    simN3Engine2Pre = simVars->getN2(2);
-    simN3Engine3Pre = simVars->getN2(3);
-    simN3Engine4Pre = simVars->getN2(4);
+    for (engine = 1; engine <= 4; engine++) {
+      simN3Pre[engine - 1] = simVars->getN2(engine);
+    }
 
     confFilename += acftRegistration;
     confFilename += FILENAME_FADEC_CONF_FILE_EXTENSION;
@@ -1283,22 +951,12 @@ class EngineControl {
       idleOil = initOil(140, 200);
 
       // Setting initial Oil
-      if (engine == 1) {
-        simVars->setEngine1TotalOil(idleOil);
-      } else if (engine == 2) {
-        simVars->setEngine2TotalOil(idleOil);
-      } else if (engine == 3) {
-        simVars->setEngine3TotalOil(idleOil);
-      } else {
-        simVars->setEngine4TotalOil(idleOil);
-      }
+      simVars->setEngineTotalOil(engine, idleOil);
+
+      // Setting initial Oil Temperature
+      thermalEnergy[engine - 1] = 0;
     }
 
-    // Setting initial Oil Temperature
-    thermalEnergy1 = 0;
-    thermalEnergy2 = 0;
-    thermalEnergy3 = 0;
-    thermalEnergy4 = 0;
     oilTemperatureMax = 85;
     simOnGround = simVars->getSimOnGround();
     double engine1Combustion = simVars->getEngineCombustion(1);
@@ -1306,31 +964,18 @@ class EngineControl {
     double engine3Combustion = simVars->getEngineCombustion(3);
     double engine4Combustion = simVars->getEngineCombustion(4);
 
+    double initialOilTemperature = ambientTemp;
     if (simOnGround == 1 && engine1Combustion == 1 && engine2Combustion == 1 && engine3Combustion == 1 && engine4Combustion == 1) {
-      oilTemperatureEngine1Pre = 75;
-      oilTemperatureEngine2Pre = 75;
-      oilTemperatureEngine3Pre = 75;
-      oilTemperatureEngine4Pre = 75;
+      initialOilTemperature = 75;
     } else if (simOnGround == 0 && engine1Combustion == 1 && engine2Combustion == 1 && engine3Combustion == 1 && engine4Combustion == 1) {
-      oilTemperatureEngine1Pre = 85;
-      oilTemperatureEngine2Pre = 85;
-      oilTemperatureEngine3Pre = 85;
-      oilTemperatureEngine4Pre = 85;
-    } else {
-      oilTemperatureEngine1Pre = ambientTemp;
-      oilTemperatureEngine2Pre = ambientTemp;
-      oilTemperatureEngine3Pre = ambientTemp;
-      oilTemperatureEngine4Pre = ambientTemp;
+      initialOilTemperature = 85;
     }
 
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine1Pre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine2Pre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine3Pre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine4Pre);
+    for (engine = 1; engine <= 4; engine++) {
+      oilTemperaturePre[engine - 1] = initialOilTemperature;
+      SimConnect_SetDataOnSimObject(hSimConnect, OilTempDataTypes[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &oilTemperaturePre[engine - 1]);
+    }
 
     // Initialize Engine State
     simVars->setEngine1State(10);
@@ -1401,6 +1046,9 @@ class EngineControl {
     }
     wai = simVars->getWAI();
 
+    // ambient terms are identical for all engines
+    ambientRatios.update(mach, ambientTemp, ambientPressure);
+
     generateIdleParameters(pressAltitude, mach, ambientTemp, ambientPressure);
 
     // Timer timer;
@@ -1415,27 +1063,10 @@ class EngineControl {
       // Set & Check Engine Status for this Cycle
       engineStateMachine(engine, engineIgniter, engineStarter, simN3, idleN3, pressAltitude, ambientTemp,
                          animationDeltaTime - prevAnimationDeltaTime);
-      if (engine == 1) {
-        engineState = simVars->getEngine1State();
-        deltaN3 = simN3 - simN3Engine1Pre;
-        simN3Engine1Pre = simN3;
-        timer = simVars->getEngine1Timer();
-      } else if (engine == 2) {
-        engineState = simVars->getEngine2State();
-        deltaN3 = simN3 - simN3Engine2Pre;
-        simN3Engine2Pre = simN3;
-        timer = simVars->getEngine2Timer();
-      } else if (engine == 3) {
-        engineState = simVars->getEngine3State();
-        deltaN3 = simN3 - simN3Engine3Pre;
-        simN3Engine3Pre = simN3;
-        timer = simVars->getEngine3Timer();
-      } else {
-        engineState = simVars->getEngine4State();
-        deltaN3 = simN3 - simN3Engine4Pre;
-        simN3Engine4Pre = simN3;
-        timer = simVars->getEngine4Timer();
-      }
+      engineState = simVars->getEngineState(engine);
+      deltaN3 = simN3 - simN3Pre[engine - 1];
+      simN3Pre[engine - 1] = simN3;
+      timer = simVars->getEngineTimer(engine);
 
       switch (int(engineState)) {
         case 2:
@@ -1444,11 +1075,11 @@ class EngineControl {
           break;
         case 4:
           engineShutdownProcedure(engine, ambientTemp, simN1, deltaTime, timer);
-          cFbwFF = updateFF(engine, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
+          cFbwFF = updateFF(engine, simCN1, mach, pressAltitude);
           break;
         default:
           updatePrimaryParameters(engine, simN1, simN3);
-          cFbwFF = updateFF(engine, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
+          cFbwFF = updateFF(engine, simCN1, mach, pressAltitude);
           updateEGT(engine, deltaTime, simOnGround, engineState, simCN1, cFbwFF, mach, pressAltitude, ambientTemp);
           // updateOil(engine, imbalance, thrust, simN3, deltaN3, deltaTime, ambientTemp);
       }
@@ -39,6 +39,16 @@ enum DataTypesID {
   AcftInfo,
 };
 
+/// <summary>
+/// Per-engine SimConnect data types, indexed by engine number - 1
+/// </summary>
+const DataTypesID OilTempDataTypes[4] = {DataTypesID::OilTempEngine1, DataTypesID::OilTempEngine2, DataTypesID::OilTempEngine3,
+                                         DataTypesID::OilTempEngine4};
+const DataTypesID OilPsiDataTypes[4] = {DataTypesID::OilPsiEngine1, DataTypesID::OilPsiEngine2, DataTypesID::OilPsiEngine3,
+                                        DataTypesID::OilPsiEngine4};
+const DataTypesID StartCN3DataTypes[4] = {DataTypesID::StartCN3Engine1, DataTypesID::StartCN3Engine2, DataTypesID::StartCN3Engine3,
+                                          DataTypesID::StartCN3Engine4};
+
 struct SimulationData {
   double simulationTime;
   double simulationRate;
@@ -202,6 +212,24 @@ class SimVars {
   ID PacksState1;
   ID PacksState2;
 
+  /// <summary>
+  /// Per-engine LVars, indexed by engine number - 1
+  /// </summary>
+  struct EngineVars {
+    ID N1;
+    ID N2;
+    ID N3;
+    ID EGT;
+    ID FF;
+    ID PreFF;
+    ID Oil;
+    ID TotalOil;
+    ID State;
+    ID Timer;
+    ID FuelUsed;
+  };
+  EngineVars Engines[4];
+
   SimVars() { this->initializeVars(); }
 
   void initializeVars() {
@@ -288,6 +316,15 @@ class SimVars {
     PacksState1 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_1_IS_OPEN");
     PacksState2 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_2_IS_OPEN");
 
+    Engines[0] = {Engine1N1, Engine1N2, Engine1N3, Engine1EGT, Engine1FF, Engine1PreFF, Engine1Oil, Engine1TotalOil, Engine1State,
+                  Engine1Timer, FuelUsedEngine1};
+    Engines[1] = {Engine2N1, Engine2N2, Engine2N3, Engine2EGT, Engine2FF, Engine2PreFF, Engine2Oil, Engine2TotalOil, Engine2State,
+                  Engine2Timer, FuelUsedEngine2};
+    Engines[2] = {Engine3N1, Engine3N2, Engine3N3, Engine3EGT, Engine3FF, Engine3PreFF, Engine3Oil, Engine3TotalOil, Engine3State,
+                  Engine3Timer, FuelUsedEngine3};
+    Engines[3] = {Engine4N1, Engine4N2, Engine4N3, Engine4EGT, Engine4FF, Engine4PreFF, Engine4Oil, Engine4TotalOil, Engine4State,
+                  Engine4Timer, FuelUsedEngine4};
+
     this->setDeveloperState(0);
     this->setEngine1N3(0);
     this->setEngine2N3(0);
@@ -436,6 +473,32 @@ class SimVars {
   void setThrustLimitClimb(FLOAT64 value) { set_named_variable_value(ThrustLimitClimb, value); }
   void setThrustLimitMct(FLOAT64 value) { set_named_variable_value(ThrustLimitMct, value); }
 
+  // Collection of per-engine LVar 'set' Functions (engine is 1-based)
+  void setEngineN1(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].N1, value); }
+  void setEngineN2(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].N2, value); }
+  void setEngineN3(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].N3, value); }
+  void setEngineEGT(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].EGT, value); }
+  void setEngineFF(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].FF, value); }
+  void setEnginePreFF(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].PreFF, value); }
+  void setEngineOil(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].Oil, value); }
+  void setEngineTotalOil(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].TotalOil, value); }
+  void setEngineState(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].State, value); }
+  void setEngineTimer(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].Timer, value); }
+  void setFuelUsedEngine(int engine, FLOAT64 value) { set_named_variable_value(Engines[engine - 1].FuelUsed, value); }
+
+  // Collection of per-engine LVar 'get' Functions (engine is 1-based)
+  FLOAT64 getEngineN1(int engine) { return get_named_variable_value(Engines[engine - 1].N1); }
+  FLOAT64 getEngineN2(int engine) { return get_named_variable_value(Engines[engine - 1].N2); }
+  FLOAT64 getEngineN3(int engine) { return get_named_variable_value(Engines[engine - 1].N3); }
+  FLOAT64 getEngineEGT(int engine) { return get_named_variable_value(Engines[engine - 1].EGT); }
+  FLOAT64 getEngineFF(int engine) { return get_named_variable_value(Engines[engine - 1].FF); }
+  FLOAT64 getEnginePreFF(int engine) { return get_named_variable_value(Engines[engine - 1].PreFF); }
+  FLOAT64 getEngineOil(int engine) { return get_named_variable_value(Engines[engine - 1].Oil); }
+  FLOAT64 getEngineTotalOil(int engine) { return get_named_variable_value(Engines[engine - 1].TotalOil); }
+  FLOAT64 getEngineState(int engine) { return get_named_variable_value(Engines[engine - 1].State); }
+  FLOAT64 getEngineTimer(int engine) { return get_named_variable_value(Engines[engine - 1].Timer); }
+  FLOAT64 getFuelUsedEngine(int engine) { return get_named_variable_value(Engines[engine - 1].FuelUsed); }
+
   // Collection of SimVar/LVar 'get' Functions
   FLOAT64 getDeveloperState() { return get_named_variable_value(DevVar); }
   FLOAT64 getIsReady() { return get_named_variable_value(IsReady); }
@@ -3,8 +3,6 @@
 #include "SimVars.h"
 #include "common.h"
 
-EngineRatios* ratios;
-
 /// <summary>
 /// Table 1502 (CN3 vs correctedN1) representations with FSX nomenclature
 /// </summary>
@@ -13,49 +13,30 @@ else
   CLANG_ARGS="-flto -O2 -DNDEBUG"
 fi
 
+# keep the model parameters mutable to allow tuning them at runtime, by default they are constant
+if [[ " $* " == *" --tunable-parameters "* ]]; then
+  CLANG_ARGS="${CLANG_ARGS} -DFBW_TUNABLE_MODEL_PARAMETERS"
+fi
+
+# evaluate the navaid distance terms of the autopilot models with the polynomial kernels instead of the library
+if [[ " $* " == *" --fast-trig "* ]]; then
+  CLANG_ARGS="${CLANG_ARGS} -DFBW_FAST_TRIG"
+fi
+
 set -ex
 
+START_TIME=${SECONDS}
+
+# build the aircraft independent code, objects are reused across aircraft and runs
+"${COMMON_DIR}/fbw_common/build.sh" "${DIR}/obj/libfbw_common.a" "$@"
+COMMON_TIME=${SECONDS}
+
 # create temporary folder for o files
 mkdir -p "${DIR}/obj"
 # clean old object files out if they exist
-rm -f "${DIR}/obj/*.o"
+rm -f "${DIR}"/obj/*.o
 pushd "${DIR}/obj"
 
-# compile c code
-clang \
-  -c \
-  ${CLANG_ARGS} \
-  -Wno-unused-command-line-argument \
-  -Wno-implicit-function-declaration \
-  -Wno-deprecated-non-prototype \
-  --sysroot "${MSFS_SDK}/WASM/wasi-sysroot" \
-  -target wasm32-unknown-wasi \
-  -flto \
-  -D_MSFS_WASM=1 \
-  -D__wasi__ \
-  -D_LIBCPP_HAS_NO_THREADS \
-  -D_WINDLL \
-  -D_MBCS \
-  -mthread-model single \
-  -fno-exceptions \
-  -fms-extensions \
-  -fvisibility=hidden \
-  -I "${MSFS_SDK}/WASM/include" \
-  -I "${COMMON_DIR}/fbw_common/src/zlib" \
-  "${COMMON_DIR}/fbw_common/src/zlib/adler32.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/crc32.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/deflate.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/gzclose.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/gzlib.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/gzread.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/gzwrite.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/infback.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/inffast.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/inflate.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/inftrees.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/trees.c" \
-  "${COMMON_DIR}/fbw_common/src/zlib/zutil.c"
-
 # compile c++ code
 clang++ \
   -c \
@@ -79,6 +60,7 @@ clang++ \
   -I "${MSFS_SDK}/SimConnect SDK/include" \
   -I "${COMMON_DIR}/fbw_common/src" \
   -I "${COMMON_DIR}/fbw_common/src/inih" \
+  -I "${COMMON_DIR}/fbw_common/src/model" \
   -I "${DIR}/src/interface" \
   "${DIR}/src/interface/SimConnectInterface.cpp" \
   -I "${DIR}/src/prim" \
@@ -89,19 +71,9 @@ clang++ \
   "${DIR}/src/fac/Fac.cpp" \
   -I "${DIR}/src/failures" \
   "${DIR}/src/failures/FailuresConsumer.cpp" \
-  -I "${DIR}/src/utils" \
-  "${DIR}/src/utils/ConfirmNode.cpp" \
-  "${DIR}/src/utils/SRFlipFLop.cpp" \
-  "${DIR}/src/utils/PulseNode.cpp" \
-  "${DIR}/src/utils/HysteresisNode.cpp" \
   -I "${DIR}/src/model" \
-  "${DIR}/src/model/AutopilotLaws_data.cpp" \
-  "${DIR}/src/model/AutopilotLaws.cpp" \
-  "${DIR}/src/model/AutopilotStateMachine_data.cpp" \
-  "${DIR}/src/model/AutopilotStateMachine.cpp" \
   "${DIR}/src/model/Autothrust_data.cpp" \
   "${DIR}/src/model/Autothrust.cpp" \
-  "${DIR}/src/model/Double2MultiWord.cpp" \
   "${DIR}/src/model/A380PrimComputer_data.cpp" \
   "${DIR}/src/model/A380PrimComputer.cpp" \
   "${DIR}/src/model/A380SecComputer_data.cpp" \
@@ -111,33 +83,18 @@ clang++ \
   "${DIR}/src/model/A380PitchDirectLaw.cpp" \
   "${DIR}/src/model/A380LateralNormalLaw.cpp" \
   "${DIR}/src/model/A380LateralDirectLaw.cpp" \
-  "${DIR}/src/model/FacComputer_data.cpp" \
-  "${DIR}/src/model/FacComputer.cpp" \
-  "${DIR}/src/model/look1_binlxpw.cpp" \
-  "${DIR}/src/model/look2_binlcpw.cpp" \
-  "${DIR}/src/model/look2_binlxpw.cpp" \
-  "${DIR}/src/model/look2_pbinlxpw.cpp" \
-  "${DIR}/src/model/mod_mvZvttxs.cpp" \
-  "${DIR}/src/model/MultiWordIor.cpp" \
-  "${DIR}/src/model/rt_modd.cpp" \
-  "${DIR}/src/model/rt_remd.cpp" \
-  "${DIR}/src/model/uMultiWord2Double.cpp" \
   -I "${COMMON_DIR}/fbw_common/src/zlib" \
-  "${COMMON_DIR}/fbw_common/src/zlib/zfstream.cc" \
   "${DIR}/src/FlyByWireInterface.cpp" \
   "${DIR}/src/FlightDataRecorder.cpp" \
-  "${DIR}/src/Arinc429.cpp" \
   "${DIR}/src/Arinc429Utils.cpp" \
-  "${COMMON_DIR}/fbw_common/src/LocalVariable.cpp" \
-  "${COMMON_DIR}/fbw_common/src/InterpolatingLookupTable.cpp" \
   "${DIR}/src/SpoilersHandler.cpp" \
-  "${COMMON_DIR}/fbw_common/src/ThrottleAxisMapping.cpp" \
-  "${DIR}/src/CalculatedRadioReceiver.cpp" \
   "${DIR}/src/main.cpp" \
 
 # restore directory
 popd
 
+COMPILE_TIME=${SECONDS}
+
 # link modules
 wasm-ld \
   --no-entry \
@@ -154,4 +111,8 @@ wasm-ld \
   ${WASMLD_ARGS} \
   -lc++ -lc++abi \
   ${DIR}/obj/*.o \
+  ${DIR}/obj/libfbw_common.a \
   -o $OUTPUT
+
+set +x
+echo "BUILD: fbw common library $((COMMON_TIME - START_TIME)) s, compile $((COMPILE_TIME - COMMON_TIME)) s, link $((SECONDS - COMPILE_TIME)) s"
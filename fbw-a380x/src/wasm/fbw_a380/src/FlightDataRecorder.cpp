@@ -3,6 +3,7 @@
 #include <ini_type_conversion.h>
 #include <stdio.h>
 #include <chrono>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -22,6 +23,13 @@ void FlightDataRecorder::initialize() {
     iniStructure["FLIGHT_DATA_RECORDER"]["ENABLED"] = "true";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = "15";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] = "864000";
+    iniStructure["FLIGHT_DATA_RECORDER"]["FLUSH_INTERVAL_SECONDS"] = "1.0";
+    iniStructure["FLIGHT_DATA_RECORDER"]["CODEC"] = "fast";
+    iniStructure["FLIGHT_DATA_RECORDER"]["TRANSFORM"] = "shuffle";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BASE_SAMPLE_RATE_HZ"] = "0";
+    iniStructure["FLIGHT_DATA_RECORDER"]["PRE_TRIGGER_SECONDS"] = "10";
+    iniStructure["FLIGHT_DATA_RECORDER"]["POST_TRIGGER_SECONDS"] = "30";
+    iniStructure["FLIGHT_DATA_RECORDER"]["TRIGGERS"] = DEFAULT_TRIGGERS;
     iniFile.write(iniStructure, true);
   }
 
@@ -29,39 +37,126 @@ void FlightDataRecorder::initialize() {
   isEnabled = INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "ENABLED", true);
   maximumFileCount = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_FILES", 15);
   maximumSampleCounter = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE", 864000);
+  flushInterval = INITypeConversion::getDouble(iniStructure, "FLIGHT_DATA_RECORDER", "FLUSH_INTERVAL_SECONDS", 1.0);
+  std::string codecName = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "CODEC", "fast");
+  if (!FlightDataRecorderFile::parseCodec(codecName, codec)) {
+    std::cout << "WASM: Flight Data Recorder Configuration : unknown codec '" << codecName << "', using fast" << std::endl;
+    codecName = "fast";
+    codec = FlightDataRecorderCodec::Fast;
+  }
+  // the fast codec is zstd, its level 1 has the lowest peak cost per frame, deflate uses the zlib default level
+  int defaultCompressionLevel = codec == FlightDataRecorderCodec::Deflate ? 6 : 1;
+  compressionLevel = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "COMPRESSION_LEVEL", defaultCompressionLevel);
+  std::string transformName = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "TRANSFORM", "shuffle");
+  if (!parseFlightDataRecorderTransform(transformName, transform)) {
+    std::cout << "WASM: Flight Data Recorder Configuration : unknown transform '" << transformName << "', using shuffle" << std::endl;
+    transformName = "shuffle";
+    transform = FlightDataRecorderTransform::Shuffle;
+  }
+
+  // read sampling configuration, every frame is recorded unless a base rate is configured
+  FlightDataRecorderSamplerConfiguration samplerConfiguration;
+  samplerConfiguration.baseRateHz = INITypeConversion::getDouble(iniStructure, "FLIGHT_DATA_RECORDER", "BASE_SAMPLE_RATE_HZ", 0);
+  samplerConfiguration.preTriggerSeconds = INITypeConversion::getDouble(iniStructure, "FLIGHT_DATA_RECORDER", "PRE_TRIGGER_SECONDS", 10);
+  samplerConfiguration.postTriggerSeconds = INITypeConversion::getDouble(iniStructure, "FLIGHT_DATA_RECORDER", "POST_TRIGGER_SECONDS", 30);
+  std::string triggerNames = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "TRIGGERS", DEFAULT_TRIGGERS);
+  std::string unknownTrigger;
+  if (!FlightDataRecorderSampler::parseTriggers(triggerNames, samplerConfiguration.triggers, unknownTrigger)) {
+    std::cout << "WASM: Flight Data Recorder Configuration : unknown trigger '" << unknownTrigger << "', using all" << std::endl;
+    triggerNames = DEFAULT_TRIGGERS;
+    samplerConfiguration.triggers = FDR_TRIGGER_ALL;
+  }
+  samplerConfiguration.maximumBankAngleDeg = INITypeConversion::getDouble(
+      iniStructure, "FLIGHT_DATA_RECORDER", "TRIGGER_MAXIMUM_BANK_ANGLE_DEG", samplerConfiguration.maximumBankAngleDeg);
+  samplerConfiguration.minimumPitchAngleDeg = INITypeConversion::getDouble(
+      iniStructure, "FLIGHT_DATA_RECORDER", "TRIGGER_MINIMUM_PITCH_ANGLE_DEG", samplerConfiguration.minimumPitchAngleDeg);
+  samplerConfiguration.maximumPitchAngleDeg = INITypeConversion::getDouble(
+      iniStructure, "FLIGHT_DATA_RECORDER", "TRIGGER_MAXIMUM_PITCH_ANGLE_DEG", samplerConfiguration.maximumPitchAngleDeg);
+  samplerConfiguration.overspeedMarginKn = INITypeConversion::getDouble(
+      iniStructure, "FLIGHT_DATA_RECORDER", "TRIGGER_OVERSPEED_MARGIN_KN", samplerConfiguration.overspeedMarginKn);
+  sampler.initialize(samplerConfiguration);
 
   // print configuration
   std::cout << "WASM: Flight Data Recorder Configuration : Enabled                        = " << isEnabled << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfFiles           = " << maximumFileCount << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfEntriesPerFile  = " << maximumSampleCounter << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : FlushIntervalSeconds           = " << flushInterval << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Codec                          = " << codecName << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : CompressionLevel               = " << compressionLevel << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Transform                      = " << transformName << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : BaseSampleRateHz               = " << samplerConfiguration.baseRateHz
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : PreTriggerSeconds              = " << samplerConfiguration.preTriggerSeconds
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : PostTriggerSeconds             = " << samplerConfiguration.postTriggerSeconds
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Triggers                       = " << triggerNames << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : Interface Version              = " << INTERFACE_VERSION << std::endl;
 }
 
-void FlightDataRecorder::update(AutopilotStateMachineModelClass* autopilotStateMachine,
+void FlightDataRecorder::update(double deltaTime,
+                                AutopilotStateMachineModelClass* autopilotStateMachine,
                                 AutopilotLawsModelClass* autopilotLaws,
                                 Autothrust* autoThrust,
                                 const EngineData& engineData,
-                                const AdditionalData& additionalData) {
+                                const AdditionalData& additionalData,
+                                bool isNormalLawActive) {
   // check if enabled
   if (!isEnabled) {
     return;
   }
 
-  // do file management
-  manageFlightDataRecorderFiles();
-
-  // write data to file
-  fileStream->write((char*)(&autopilotStateMachine->getExternalOutputs().out), sizeof(autopilotStateMachine->getExternalOutputs().out));
-  fileStream->write((char*)(&autopilotLaws->getExternalOutputs().out.output), sizeof(autopilotLaws->getExternalOutputs().out.output));
-  fileStream->write((char*)(&autoThrust->getExternalOutputs().out), sizeof(autoThrust->getExternalOutputs().out));
-  fileStream->write((char*)(&engineData), sizeof(engineData));
-  fileStream->write((char*)(&additionalData), sizeof(additionalData));
+  const auto& autopilotStateMachineOutput = autopilotStateMachine->getExternalOutputs().out;
+  const auto& autopilotLawsOutput = autopilotLaws->getExternalOutputs().out.output;
+  const auto& autoThrustOutput = autoThrust->getExternalOutputs().out;
+
+  // the record is kept by the sampler until it decides whether it is written
+  recordSize = static_cast<uint32_t>(sizeof(autopilotStateMachineOutput) + sizeof(autopilotLawsOutput) + sizeof(autoThrustOutput) +
+                                     sizeof(engineData) + sizeof(additionalData) + sizeof(FlightDataRecorderSampling));
+  char* record = sampler.beginRecord(recordSize);
+  auto append = [&record](const auto& part) {
+    std::memcpy(record, &part, sizeof(part));
+    record += sizeof(part);
+  };
+  append(autopilotStateMachineOutput);
+  append(autopilotLawsOutput);
+  append(autoThrustOutput);
+  append(engineData);
+  append(additionalData);
+
+  // evaluate the triggers of the full rate bursts
+  FlightDataRecorderTriggerInputs triggerInputs = {};
+  triggerInputs.isAutopilotEngaged = autopilotStateMachineOutput.output.enabled_AP1 || autopilotStateMachineOutput.output.enabled_AP2;
+  triggerInputs.isNormalLawActive = isNormalLawActive;
+  triggerInputs.isMasterWarningActive = additionalData.master_warning_active != 0;
+  triggerInputs.isAlphaProtectionActive = additionalData.alpha_floor_condition != 0 || additionalData.high_aoa_protection != 0;
+  triggerInputs.bankAngleDeg = autopilotStateMachineOutput.data.Phi_deg;
+  triggerInputs.pitchAngleDeg = autopilotStateMachineOutput.data.Theta_deg;
+  triggerInputs.airspeedKn = autopilotStateMachineOutput.data.V_ias_kn;
+  triggerInputs.maximumAirspeedKn = autopilotStateMachineOutput.data.VMAX_kn;
+  sampler.endRecord(deltaTime, triggerInputs);
+
+  // write the records which are due
+  writeRecords();
+
+  // make the records written so far readable while the file is still open
+  flushFlightDataRecorderFile();
 }
 
 void FlightDataRecorder::terminate() {
-  if (fileStream) {
-    fileStream->close();
-    fileStream.reset();
+  // the records still in the delay line of the sampler are written as well
+  sampler.finish();
+  writeRecords();
+  file.close();
+}
+
+void FlightDataRecorder::writeRecords() {
+  while (const char* record = sampler.nextRecord()) {
+    // do file management
+    manageFlightDataRecorderFiles();
+
+    // write data to file
+    file.write(record, recordSize);
   }
 }
 
@@ -71,25 +166,40 @@ void FlightDataRecorder::manageFlightDataRecorderFiles() {
 
   // check if file is considered full
   if (sampleCounter >= maximumSampleCounter) {
-    // close file and delete
-    if (fileStream) {
-      fileStream->close();
-      fileStream.reset();
-    }
+    // close file
+    file.close();
     // reset counter
     sampleCounter = 0;
   }
 
-  if (!fileStream) {
+  if (!file.isOpen()) {
     // create new file
-    fileStream = std::make_shared<gzofstream>(getFlightDataRecorderFilename().c_str());
+    file.open(getFlightDataRecorderFilename(), FlightDataRecorderAircraft::A380X, codec, compressionLevel, transform,
+              {sizeof(INTERFACE_VERSION), recordSize});
+    lastFlushTime = std::chrono::steady_clock::now();
     // write version to file
-    fileStream->write((char*)&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
+    file.write(&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
     // clean up directory
     cleanUpFlightDataRecorderFiles();
   }
 }
 
+void FlightDataRecorder::flushFlightDataRecorderFile() {
+  if (flushInterval <= 0.0) {
+    return;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  if (std::chrono::duration<double>(now - lastFlushTime).count() < flushInterval) {
+    return;
+  }
+  lastFlushTime = now;
+
+  // the current block is written even when it is not full, so that a reader of the growing file can decompress every record
+  // written up to here
+  file.flush();
+}
+
 std::string FlightDataRecorder::getFlightDataRecorderFilename() {
   // get time
   auto in_time_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
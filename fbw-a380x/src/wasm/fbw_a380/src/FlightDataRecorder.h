@@ -1,40 +1,59 @@
 #pragma once
 
-#include <fstream>
+#include <chrono>
+#include <string>
 
 #include "AdditionalData.h"
 #include "EngineData.h"
+#include "FlightDataRecorderFile.h"
+#include "FlightDataRecorderSampler.h"
 #include "model/AutopilotLaws.h"
 #include "model/AutopilotStateMachine.h"
 #include "model/Autothrust.h"
-#include "zlib/zfstream.h"
 
 class FlightDataRecorder {
  public:
-  // IMPORTANT: this constant needs to increased with every interface change
-  const uint64_t INTERFACE_VERSION = 24;
+  // IMPORTANT: this constant needs to increased with every interface change, tools/fdr2csv needs a schema for each version
+  // the A32NX uses the versions 25 and 26, its files of version 25 do not record the aircraft
+  const uint64_t INTERFACE_VERSION = 27;
 
   void initialize();
 
-  void update(AutopilotStateMachineModelClass* autopilotStateMachine,
+  // the law is only used to trigger full rate recording when it degrades
+  void update(double deltaTime,
+              AutopilotStateMachineModelClass* autopilotStateMachine,
               AutopilotLawsModelClass* autopilotLaws,
               Autothrust* autoThrust,
               const EngineData& engineData,
-              const AdditionalData& additionalData);
+              const AdditionalData& additionalData,
+              bool isNormalLawActive);
 
   void terminate();
 
  private:
   const std::string CONFIGURATION_FILEPATH = "\\work\\FlightDataRecorder.ini";
+  static constexpr const char* DEFAULT_TRIGGERS =
+      "ap_disconnect,law_degradation,master_warning,bank_angle,pitch_angle,overspeed,alpha_protection";
 
   bool isEnabled = false;
   int sampleCounter = false;
   int maximumSampleCounter = 0;
   int maximumFileCount = 0;
-  std::shared_ptr<gzofstream> fileStream;
+  double flushInterval = 0.0;
+  FlightDataRecorderCodec codec = FlightDataRecorderCodec::Fast;
+  int compressionLevel = 0;
+  FlightDataRecorderTransform transform = FlightDataRecorderTransform::Shuffle;
+  std::chrono::steady_clock::time_point lastFlushTime;
+  FlightDataRecorderFile file;
+  FlightDataRecorderSampler sampler;
+  uint32_t recordSize = 0;
+
+  void writeRecords();
 
   void manageFlightDataRecorderFiles();
 
+  void flushFlightDataRecorderFile();
+
   std::string getFlightDataRecorderFilename();
 
   void cleanUpFlightDataRecorderFiles();
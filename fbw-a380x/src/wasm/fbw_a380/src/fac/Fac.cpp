@@ -1,6 +1,6 @@
 #include "Fac.h"
 
-#include "../Arinc429.h"
+#include "Arinc429.h"
 
 Fac::Fac(bool isUnit1) : isUnit1(isUnit1) {
   facComputer.initialize();
@@ -23,7 +23,10 @@ void Fac::update(double deltaTime, double simulationTime, bool faultActive, bool
   if (!shortPowerFailure) {
     facComputer.setExternalInputs(&modelInputs);
     facComputer.step();
-    modelOutputs = facComputer.getExternalOutputs().out;
+    const fac_outputs& outputs = facComputer.getExternalOutputs().out;
+    modelOutputs.discrete_outputs = outputs.discrete_outputs;
+    modelOutputs.analog_outputs = outputs.analog_outputs;
+    modelOutputs.bus_outputs = outputs.bus_outputs;
   }
 }
 
@@ -155,3 +158,31 @@ base_fac_analog_outputs Fac::getAnalogOutputs() {
 
   return output;
 }
+
+void Fac::saveSnapshot(Snapshot& snapshot) const {
+  facComputer.saveSnapshot(&snapshot.model);
+  snapshot.modelInputs = modelInputs;
+  snapshot.modelOutputs = modelOutputs;
+  snapshot.facHealthy = facHealthy;
+  snapshot.facHealthyFlipFlop = facHealthyFlipFlop;
+  snapshot.pushbuttonPulse = pushbuttonPulse;
+  snapshot.powerSupplyOutageTime = powerSupplyOutageTime;
+  snapshot.longPowerFailure = longPowerFailure;
+  snapshot.shortPowerFailure = shortPowerFailure;
+  snapshot.selfTestTimer = selfTestTimer;
+  snapshot.selfTestComplete = selfTestComplete;
+}
+
+void Fac::restoreSnapshot(const Snapshot& snapshot) {
+  facComputer.restoreSnapshot(&snapshot.model);
+  modelInputs = snapshot.modelInputs;
+  modelOutputs = snapshot.modelOutputs;
+  facHealthy = snapshot.facHealthy;
+  facHealthyFlipFlop = snapshot.facHealthyFlipFlop;
+  pushbuttonPulse = snapshot.pushbuttonPulse;
+  powerSupplyOutageTime = snapshot.powerSupplyOutageTime;
+  longPowerFailure = snapshot.longPowerFailure;
+  shortPowerFailure = snapshot.shortPowerFailure;
+  selfTestTimer = snapshot.selfTestTimer;
+  selfTestComplete = snapshot.selfTestComplete;
+}
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+// every failure is also listed in FAILURES, which gives its position in the set of active failures
 enum class Failures {
   Fac1 = 22000,
   Fac2 = 22001,
@@ -11,3 +16,42 @@ enum class Failures {
   Fcdc1 = 27005,
   Fcdc2 = 27006,
 };
+
+// the failures in the order of their position in the set of active failures, the count and the positions follow from it
+constexpr Failures FAILURES[] = {
+    Failures::Fac1,
+    Failures::Fac2,
+    Failures::Elac1,
+    Failures::Elac2,
+    Failures::Sec1,
+    Failures::Sec2,
+    Failures::Sec3,
+    Failures::Fcdc1,
+    Failures::Fcdc2,
+};
+
+constexpr size_t FAILURES_COUNT = std::size(FAILURES);
+
+// the comparisons are unrolled at compile time so that the lookup is as fast as a switch
+template <size_t... Indices>
+constexpr int findFailureIndex(Failures failure, std::index_sequence<Indices...>) {
+  int index = -1;
+  ((FAILURES[Indices] == failure && (index = static_cast<int>(Indices), true)) || ...);
+  return index;
+}
+
+// position of a failure in the set of active failures, -1 for unknown identifiers
+constexpr int getFailureIndex(Failures failure) {
+  return findFailureIndex(failure, std::make_index_sequence<FAILURES_COUNT>());
+}
+
+constexpr bool areFailuresUnique() {
+  for (size_t i = 0; i < FAILURES_COUNT; i++) {
+    if (getFailureIndex(FAILURES[i]) != static_cast<int>(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(areFailuresUnique(), "every failure must be listed once");
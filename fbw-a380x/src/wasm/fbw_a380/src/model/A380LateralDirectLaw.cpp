@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-A380LateralDirectLaw::Parameters_A380LateralDirectLaw_T A380LateralDirectLaw::A380LateralDirectLaw_rtP{
+RT_PARAMETERS_CONST A380LateralDirectLaw::Parameters_A380LateralDirectLaw_T A380LateralDirectLaw::A380LateralDirectLaw_rtP{
 
   0.0,
 
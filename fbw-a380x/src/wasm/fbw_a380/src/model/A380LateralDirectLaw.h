@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_A380LateralDirectLaw_h_
 #define RTW_HEADER_A380LateralDirectLaw_h_
 #include "rtwtypes.h"
@@ -29,6 +31,10 @@ class A380LateralDirectLaw final
     real_T Gain2_Gain;
   };
 
+  struct Snapshot_A380LateralDirectLaw_T {
+    D_Work_A380LateralDirectLaw_T DWork;
+  };
+
   A380LateralDirectLaw(A380LateralDirectLaw const&) = delete;
   A380LateralDirectLaw& operator= (A380LateralDirectLaw const&) & = delete;
   A380LateralDirectLaw(A380LateralDirectLaw &&) = delete;
@@ -37,11 +43,21 @@ class A380LateralDirectLaw final
             *rty_Out_xi_inboard_deg, real_T *rty_Out_xi_midboard_deg, real_T *rty_Out_xi_outboard_deg, real_T
             *rty_Out_xi_spoiler_deg, real_T *rty_Out_zeta_upper_deg, real_T *rty_Out_zeta_lower_deg);
   void reset();
+  void saveSnapshot(Snapshot_A380LateralDirectLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = A380LateralDirectLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_A380LateralDirectLaw_T *pSnapshot)
+  {
+    A380LateralDirectLaw_DWork = pSnapshot->DWork;
+  }
+
   A380LateralDirectLaw();
   ~A380LateralDirectLaw();
  private:
   D_Work_A380LateralDirectLaw_T A380LateralDirectLaw_DWork;
-  static Parameters_A380LateralDirectLaw_T A380LateralDirectLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_A380LateralDirectLaw_T A380LateralDirectLaw_rtP;
   static void A380LateralDirectLaw_RateLimiter_Reset(rtDW_RateLimiter_A380LateralDirectLaw_T *localDW);
   static void A380LateralDirectLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_A380LateralDirectLaw_T *localDW);
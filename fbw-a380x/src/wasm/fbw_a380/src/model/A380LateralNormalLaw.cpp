@@ -4,7 +4,7 @@
 #include <cstring>
 #include "look1_binlxpw.h"
 
-A380LateralNormalLaw::Parameters_A380LateralNormalLaw_T A380LateralNormalLaw::A380LateralNormalLaw_rtP{
+RT_PARAMETERS_CONST A380LateralNormalLaw::Parameters_A380LateralNormalLaw_T A380LateralNormalLaw::A380LateralNormalLaw_rtP{
 
   { 0.0, 120.0, 150.0, 380.0 },
 
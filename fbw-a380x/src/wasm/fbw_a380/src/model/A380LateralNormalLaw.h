@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_A380LateralNormalLaw_h_
 #define RTW_HEADER_A380LateralNormalLaw_h_
 #include "rtwtypes.h"
@@ -160,6 +162,10 @@ class A380LateralNormalLaw final
   };
 
   void init();
+  struct Snapshot_A380LateralNormalLaw_T {
+    D_Work_A380LateralNormalLaw_T DWork;
+  };
+
   A380LateralNormalLaw(A380LateralNormalLaw const&) = delete;
   A380LateralNormalLaw& operator= (A380LateralNormalLaw const&) & = delete;
   A380LateralNormalLaw(A380LateralNormalLaw &&) = delete;
@@ -173,11 +179,21 @@ class A380LateralNormalLaw final
             *rty_Out_xi_inboard_deg, real_T *rty_Out_xi_midboard_deg, real_T *rty_Out_xi_outboard_deg, real_T
             *rty_Out_xi_spoiler_deg, real_T *rty_Out_zeta_upper_deg, real_T *rty_Out_zeta_lower_deg);
   void reset();
+  void saveSnapshot(Snapshot_A380LateralNormalLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = A380LateralNormalLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_A380LateralNormalLaw_T *pSnapshot)
+  {
+    A380LateralNormalLaw_DWork = pSnapshot->DWork;
+  }
+
   A380LateralNormalLaw();
   ~A380LateralNormalLaw();
  private:
   D_Work_A380LateralNormalLaw_T A380LateralNormalLaw_DWork;
-  static Parameters_A380LateralNormalLaw_T A380LateralNormalLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_A380LateralNormalLaw_T A380LateralNormalLaw_rtP;
   static void A380LateralNormalLaw_RateLimiter_Reset(rtDW_RateLimiter_A380LateralNormalLaw_T *localDW);
   static void A380LateralNormalLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_A380LateralNormalLaw_T *localDW);
@@ -21,7 +21,7 @@ const uint8_T A380PitchAlternateLaw_IN_flight_flaps{ 2U };
 
 const uint8_T A380PitchAlternateLaw_IN_ground{ 3U };
 
-A380PitchAlternateLaw::Parameters_A380PitchAlternateLaw_T A380PitchAlternateLaw::A380PitchAlternateLaw_rtP{
+RT_PARAMETERS_CONST A380PitchAlternateLaw::Parameters_A380PitchAlternateLaw_T A380PitchAlternateLaw::A380PitchAlternateLaw_rtP{
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
 
@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_A380PitchAlternateLaw_h_
 #define RTW_HEADER_A380PitchAlternateLaw_h_
 #include "rtwtypes.h"
@@ -197,6 +199,10 @@ class A380PitchAlternateLaw final
   };
 
   void init();
+  struct Snapshot_A380PitchAlternateLaw_T {
+    D_Work_A380PitchAlternateLaw_T DWork;
+  };
+
   A380PitchAlternateLaw(A380PitchAlternateLaw const&) = delete;
   A380PitchAlternateLaw& operator= (A380PitchAlternateLaw const&) & = delete;
   A380PitchAlternateLaw(A380PitchAlternateLaw &&) = delete;
@@ -209,11 +215,21 @@ class A380PitchAlternateLaw final
             *rtu_In_tracking_mode_on, const boolean_T *rtu_In_stabilities_available, real_T *rty_Out_eta_deg, real_T
             *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void saveSnapshot(Snapshot_A380PitchAlternateLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = A380PitchAlternateLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_A380PitchAlternateLaw_T *pSnapshot)
+  {
+    A380PitchAlternateLaw_DWork = pSnapshot->DWork;
+  }
+
   A380PitchAlternateLaw();
   ~A380PitchAlternateLaw();
  private:
   D_Work_A380PitchAlternateLaw_T A380PitchAlternateLaw_DWork;
-  static Parameters_A380PitchAlternateLaw_T A380PitchAlternateLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_A380PitchAlternateLaw_T A380PitchAlternateLaw_rtP;
   static void A380PitchAlternateLaw_RateLimiter_Reset(rtDW_RateLimiter_A380PitchAlternateLaw_T *localDW);
   static void A380PitchAlternateLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_A380PitchAlternateLaw_T *localDW);
@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-A380PitchDirectLaw::Parameters_A380PitchDirectLaw_T A380PitchDirectLaw::A380PitchDirectLaw_rtP{
+RT_PARAMETERS_CONST A380PitchDirectLaw::Parameters_A380PitchDirectLaw_T A380PitchDirectLaw::A380PitchDirectLaw_rtP{
 
   0.0,
 
@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_A380PitchDirectLaw_h_
 #define RTW_HEADER_A380PitchDirectLaw_h_
 #include "rtwtypes.h"
@@ -24,6 +26,10 @@ class A380PitchDirectLaw final
     real_T Saturation_LowerSat;
   };
 
+  struct Snapshot_A380PitchDirectLaw_T {
+    D_Work_A380PitchDirectLaw_T DWork;
+  };
+
   A380PitchDirectLaw(A380PitchDirectLaw const&) = delete;
   A380PitchDirectLaw& operator= (A380PitchDirectLaw const&) & = delete;
   A380PitchDirectLaw(A380PitchDirectLaw &&) = delete;
@@ -31,11 +37,21 @@ class A380PitchDirectLaw final
   void step(const real_T *rtu_In_time_dt, const real_T *rtu_In_delta_eta_pos, real_T *rty_Out_eta_deg, real_T
             *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void saveSnapshot(Snapshot_A380PitchDirectLaw_T *pSnapshot) const
+  {
+    pSnapshot->DWork = A380PitchDirectLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_A380PitchDirectLaw_T *pSnapshot)
+  {
+    A380PitchDirectLaw_DWork = pSnapshot->DWork;
+  }
+
   A380PitchDirectLaw();
   ~A380PitchDirectLaw();
  private:
   D_Work_A380PitchDirectLaw_T A380PitchDirectLaw_DWork;
-  static Parameters_A380PitchDirectLaw_T A380PitchDirectLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_A380PitchDirectLaw_T A380PitchDirectLaw_rtP;
 };
 
 extern A380PitchDirectLaw::Parameters_A380PitchDirectLaw_T A380PitchDirectLaw_rtP;
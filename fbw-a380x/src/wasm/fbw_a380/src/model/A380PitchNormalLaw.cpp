@@ -48,7 +48,7 @@ const uint8_T A380PitchNormalLaw_IN_OFF{ 1U };
 
 const uint8_T A380PitchNormalLaw_IN_ON{ 2U };
 
-A380PitchNormalLaw::Parameters_A380PitchNormalLaw_T A380PitchNormalLaw::A380PitchNormalLaw_rtP{
+RT_PARAMETERS_CONST A380PitchNormalLaw::Parameters_A380PitchNormalLaw_T A380PitchNormalLaw::A380PitchNormalLaw_rtP{
 
   { 0.0, 50.0, 100.0, 200.0 },
 
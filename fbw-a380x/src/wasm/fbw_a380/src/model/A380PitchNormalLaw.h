@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_A380PitchNormalLaw_h_
 #define RTW_HEADER_A380PitchNormalLaw_h_
 #include "rtwtypes.h"
@@ -478,6 +480,11 @@ class A380PitchNormalLaw final
   };
 
   void init();
+  struct Snapshot_A380PitchNormalLaw_T {
+    BlockIO_A380PitchNormalLaw_T B;
+    D_Work_A380PitchNormalLaw_T DWork;
+  };
+
   A380PitchNormalLaw(A380PitchNormalLaw const&) = delete;
   A380PitchNormalLaw& operator= (A380PitchNormalLaw const&) & = delete;
   A380PitchNormalLaw(A380PitchNormalLaw &&) = delete;
@@ -496,12 +503,24 @@ class A380PitchNormalLaw final
             *rtu_In_ap_theta_c_deg, const boolean_T *rtu_In_any_ap_engaged, real_T *rty_Out_eta_deg, real_T
             *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void saveSnapshot(Snapshot_A380PitchNormalLaw_T *pSnapshot) const
+  {
+    pSnapshot->B = A380PitchNormalLaw_B;
+    pSnapshot->DWork = A380PitchNormalLaw_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_A380PitchNormalLaw_T *pSnapshot)
+  {
+    A380PitchNormalLaw_B = pSnapshot->B;
+    A380PitchNormalLaw_DWork = pSnapshot->DWork;
+  }
+
   A380PitchNormalLaw();
   ~A380PitchNormalLaw();
  private:
   BlockIO_A380PitchNormalLaw_T A380PitchNormalLaw_B;
   D_Work_A380PitchNormalLaw_T A380PitchNormalLaw_DWork;
-  static Parameters_A380PitchNormalLaw_T A380PitchNormalLaw_rtP;
+  static RT_PARAMETERS_CONST Parameters_A380PitchNormalLaw_T A380PitchNormalLaw_rtP;
   static void A380PitchNormalLaw_LagFilter_Reset(rtDW_LagFilter_A380PitchNormalLaw_T *localDW);
   static void A380PitchNormalLaw_LagFilter(const real_T *rtu_U, real_T rtu_C1, const real_T *rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_A380PitchNormalLaw_T *localDW);
@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_A380PrimComputer_h_
 #define RTW_HEADER_A380PrimComputer_h_
 #include "rtwtypes.h"
@@ -545,6 +547,17 @@ class A380PrimComputer final
     boolean_T Constant22_Value;
   };
 
+  struct Snapshot_A380PrimComputer_T {
+    ExternalInputs_A380PrimComputer_T U;
+    ExternalOutputs_A380PrimComputer_T Y;
+    D_Work_A380PrimComputer_T DWork;
+    A380LateralDirectLaw::Snapshot_A380LateralDirectLaw_T LawMDLOBJ1;
+    A380LateralNormalLaw::Snapshot_A380LateralNormalLaw_T LawMDLOBJ2;
+    A380PitchAlternateLaw::Snapshot_A380PitchAlternateLaw_T LawMDLOBJ3;
+    A380PitchDirectLaw::Snapshot_A380PitchDirectLaw_T LawMDLOBJ4;
+    A380PitchNormalLaw::Snapshot_A380PitchNormalLaw_T LawMDLOBJ5;
+  };
+
   A380PrimComputer(A380PrimComputer const&) = delete;
   A380PrimComputer& operator= (A380PrimComputer const&) & = delete;
   A380PrimComputer(A380PrimComputer &&) = delete;
@@ -562,13 +575,37 @@ class A380PrimComputer final
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_A380PrimComputer_T *pSnapshot) const
+  {
+    pSnapshot->U = A380PrimComputer_U;
+    pSnapshot->Y = A380PrimComputer_Y;
+    pSnapshot->DWork = A380PrimComputer_DWork;
+    LawMDLOBJ1.saveSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.saveSnapshot(&pSnapshot->LawMDLOBJ2);
+    LawMDLOBJ3.saveSnapshot(&pSnapshot->LawMDLOBJ3);
+    LawMDLOBJ4.saveSnapshot(&pSnapshot->LawMDLOBJ4);
+    LawMDLOBJ5.saveSnapshot(&pSnapshot->LawMDLOBJ5);
+  }
+
+  void restoreSnapshot(const Snapshot_A380PrimComputer_T *pSnapshot)
+  {
+    A380PrimComputer_U = pSnapshot->U;
+    A380PrimComputer_Y = pSnapshot->Y;
+    A380PrimComputer_DWork = pSnapshot->DWork;
+    LawMDLOBJ1.restoreSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.restoreSnapshot(&pSnapshot->LawMDLOBJ2);
+    LawMDLOBJ3.restoreSnapshot(&pSnapshot->LawMDLOBJ3);
+    LawMDLOBJ4.restoreSnapshot(&pSnapshot->LawMDLOBJ4);
+    LawMDLOBJ5.restoreSnapshot(&pSnapshot->LawMDLOBJ5);
+  }
+
   A380PrimComputer();
   ~A380PrimComputer();
  private:
   ExternalInputs_A380PrimComputer_T A380PrimComputer_U;
   ExternalOutputs_A380PrimComputer_T A380PrimComputer_Y;
   D_Work_A380PrimComputer_T A380PrimComputer_DWork;
-  static Parameters_A380PrimComputer_T A380PrimComputer_P;
+  static RT_PARAMETERS_CONST Parameters_A380PrimComputer_T A380PrimComputer_P;
   static void A380PrimComputer_RateLimiter_Reset(rtDW_RateLimiter_A380PrimComputer_T *localDW);
   static void A380PrimComputer_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T rtu_init,
     real_T *rty_Y, rtDW_RateLimiter_A380PrimComputer_T *localDW);
@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_A380SecComputer_h_
 #define RTW_HEADER_A380SecComputer_h_
 #include "rtwtypes.h"
@@ -890,6 +892,15 @@ class A380SecComputer final
     boolean_T Constant22_Value;
   };
 
+  struct Snapshot_A380SecComputer_T {
+    ExternalInputs_A380SecComputer_T U;
+    ExternalOutputs_A380SecComputer_T Y;
+    BlockIO_A380SecComputer_T B;
+    D_Work_A380SecComputer_T DWork;
+    A380LateralDirectLaw::Snapshot_A380LateralDirectLaw_T LawMDLOBJ1;
+    A380PitchDirectLaw::Snapshot_A380PitchDirectLaw_T LawMDLOBJ2;
+  };
+
   A380SecComputer(A380SecComputer const&) = delete;
   A380SecComputer& operator= (A380SecComputer const&) & = delete;
   A380SecComputer(A380SecComputer &&) = delete;
@@ -907,6 +918,26 @@ class A380SecComputer final
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_A380SecComputer_T *pSnapshot) const
+  {
+    pSnapshot->U = A380SecComputer_U;
+    pSnapshot->Y = A380SecComputer_Y;
+    pSnapshot->B = A380SecComputer_B;
+    pSnapshot->DWork = A380SecComputer_DWork;
+    LawMDLOBJ1.saveSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.saveSnapshot(&pSnapshot->LawMDLOBJ2);
+  }
+
+  void restoreSnapshot(const Snapshot_A380SecComputer_T *pSnapshot)
+  {
+    A380SecComputer_U = pSnapshot->U;
+    A380SecComputer_Y = pSnapshot->Y;
+    A380SecComputer_B = pSnapshot->B;
+    A380SecComputer_DWork = pSnapshot->DWork;
+    LawMDLOBJ1.restoreSnapshot(&pSnapshot->LawMDLOBJ1);
+    LawMDLOBJ2.restoreSnapshot(&pSnapshot->LawMDLOBJ2);
+  }
+
   A380SecComputer();
   ~A380SecComputer();
  private:
@@ -914,7 +945,7 @@ class A380SecComputer final
   ExternalOutputs_A380SecComputer_T A380SecComputer_Y;
   BlockIO_A380SecComputer_T A380SecComputer_B;
   D_Work_A380SecComputer_T A380SecComputer_DWork;
-  static Parameters_A380SecComputer_T A380SecComputer_P;
+  static RT_PARAMETERS_CONST Parameters_A380SecComputer_T A380SecComputer_P;
   static void A380SecComputer_RateLimiter_Reset(rtDW_RateLimiter_A380SecComputer_T *localDW);
   static void A380SecComputer_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T rtu_init,
     real_T *rty_Y, rtDW_RateLimiter_A380SecComputer_T *localDW);
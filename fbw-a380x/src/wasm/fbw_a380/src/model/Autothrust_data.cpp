@@ -1,6 +1,6 @@
 #include "Autothrust.h"
 
-Autothrust::Parameters_Autothrust_T Autothrust::Autothrust_P{
+RT_PARAMETERS_CONST Autothrust::Parameters_Autothrust_T Autothrust::Autothrust_P{
 
   {
     {
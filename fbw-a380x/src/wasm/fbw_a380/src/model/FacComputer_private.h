@@ -1,5 +0,0 @@
-#ifndef RTW_HEADER_FacComputer_private_h_
-#define RTW_HEADER_FacComputer_private_h_
-#include "rtwtypes.h"
-#endif
-
@@ -1,8 +0,0 @@
-#ifndef RTW_HEADER_MultiWordIor_h_
-#define RTW_HEADER_MultiWordIor_h_
-#include "rtwtypes.h"
-
-extern void MultiWordIor(const uint32_T u1[], const uint32_T u2[], uint32_T y[], int32_T n);
-
-#endif
-
@@ -1,8 +0,0 @@
-#ifndef RTW_HEADER_look1_binlxpw_h_
-#define RTW_HEADER_look1_binlxpw_h_
-#include "rtwtypes.h"
-
-extern real_T look1_binlxpw(real_T u0, const real_T bp0[], const real_T table[], uint32_T maxIndex);
-
-#endif
-
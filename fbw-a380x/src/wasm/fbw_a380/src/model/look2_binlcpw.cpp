@@ -1,69 +0,0 @@
-#include "rtwtypes.h"
-#include "look2_binlcpw.h"
-
-real_T look2_binlcpw(real_T u0, real_T u1, const real_T bp0[], const real_T bp1[], const real_T table[], const uint32_T
-                     maxIndex[], uint32_T stride)
-{
-  real_T fractions[2];
-  real_T frac;
-  real_T yL_0d0;
-  real_T yL_0d1;
-  uint32_T bpIndices[2];
-  uint32_T bpIdx;
-  uint32_T iLeft;
-  uint32_T iRght;
-  if (u0 <= bp0[0U]) {
-    iLeft = 0U;
-    frac = 0.0;
-  } else if (u0 < bp0[maxIndex[0U]]) {
-    bpIdx = maxIndex[0U] >> 1U;
-    iLeft = 0U;
-    iRght = maxIndex[0U];
-    while (iRght - iLeft > 1U) {
-      if (u0 < bp0[bpIdx]) {
-        iRght = bpIdx;
-      } else {
-        iLeft = bpIdx;
-      }
-
-      bpIdx = (iRght + iLeft) >> 1U;
-    }
-
-    frac = (u0 - bp0[iLeft]) / (bp0[iLeft + 1U] - bp0[iLeft]);
-  } else {
-    iLeft = maxIndex[0U] - 1U;
-    frac = 1.0;
-  }
-
-  fractions[0U] = frac;
-  bpIndices[0U] = iLeft;
-  if (u1 <= bp1[0U]) {
-    iLeft = 0U;
-    frac = 0.0;
-  } else if (u1 < bp1[maxIndex[1U]]) {
-    bpIdx = maxIndex[1U] >> 1U;
-    iLeft = 0U;
-    iRght = maxIndex[1U];
-    while (iRght - iLeft > 1U) {
-      if (u1 < bp1[bpIdx]) {
-        iRght = bpIdx;
-      } else {
-        iLeft = bpIdx;
-      }
-
-      bpIdx = (iRght + iLeft) >> 1U;
-    }
-
-    frac = (u1 - bp1[iLeft]) / (bp1[iLeft + 1U] - bp1[iLeft]);
-  } else {
-    iLeft = maxIndex[1U] - 1U;
-    frac = 1.0;
-  }
-
-  bpIdx = iLeft * stride + bpIndices[0U];
-  yL_0d0 = table[bpIdx];
-  yL_0d0 += (table[bpIdx + 1U] - yL_0d0) * fractions[0U];
-  bpIdx += stride;
-  yL_0d1 = table[bpIdx];
-  return (((table[bpIdx + 1U] - yL_0d1) * fractions[0U] + yL_0d1) - yL_0d0) * frac + yL_0d0;
-}
@@ -1,9 +0,0 @@
-#ifndef RTW_HEADER_look2_binlxpw_h_
-#define RTW_HEADER_look2_binlxpw_h_
-#include "rtwtypes.h"
-
-extern real_T look2_binlxpw(real_T u0, real_T u1, const real_T bp0[], const real_T bp1[], const real_T table[], const
-  uint32_T maxIndex[], uint32_T stride);
-
-#endif
-
@@ -1,8 +0,0 @@
-#ifndef RTW_HEADER_mod_mvZvttxs_h_
-#define RTW_HEADER_mod_mvZvttxs_h_
-#include "rtwtypes.h"
-
-extern real_T mod_mvZvttxs(real_T x);
-
-#endif
-
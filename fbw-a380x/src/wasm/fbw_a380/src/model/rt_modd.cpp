@@ -1,34 +0,0 @@
-#include "rtwtypes.h"
-#include <cfloat>
-#include <cmath>
-#include "rt_modd.h"
-
-real_T rt_modd(real_T u0, real_T u1)
-{
-  real_T y;
-  y = u0;
-  if (u1 == 0.0) {
-    if (u0 == 0.0) {
-      y = u1;
-    }
-  } else if (u0 == 0.0) {
-    y = 0.0 / u1;
-  } else {
-    boolean_T yEq;
-    y = std::fmod(u0, u1);
-    yEq = (y == 0.0);
-    if ((!yEq) && (u1 > std::floor(u1))) {
-      real_T q;
-      q = std::abs(u0 / u1);
-      yEq = (std::abs(q - std::floor(q + 0.5)) <= DBL_EPSILON * q);
-    }
-
-    if (yEq) {
-      y = 0.0;
-    } else if ((u0 < 0.0) != (u1 < 0.0)) {
-      y += u1;
-    }
-  }
-
-  return y;
-}
@@ -1,8 +0,0 @@
-#ifndef RTW_HEADER_rt_modd_h_
-#define RTW_HEADER_rt_modd_h_
-#include "rtwtypes.h"
-
-extern real_T rt_modd(real_T u0, real_T u1);
-
-#endif
-
@@ -1,8 +0,0 @@
-#ifndef RTW_HEADER_rt_remd_h_
-#define RTW_HEADER_rt_remd_h_
-#include "rtwtypes.h"
-
-extern real_T rt_remd(real_T u0, real_T u1);
-
-#endif
-
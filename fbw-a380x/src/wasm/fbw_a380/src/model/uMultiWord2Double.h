@@ -1,8 +0,0 @@
-#ifndef RTW_HEADER_uMultiWord2Double_h_
-#define RTW_HEADER_uMultiWord2Double_h_
-#include "rtwtypes.h"
-
-extern real_T uMultiWord2Double(const uint32_T u1[], int32_T n1, int32_T e1);
-
-#endif
-
@@ -1,6 +1,6 @@
 #include "Prim.h"
 #include <iostream>
-#include "../Arinc429.h"
+#include "Arinc429.h"
 #include "../Arinc429Utils.h"
 
 Prim::Prim(bool isUnit1, bool isUnit2, bool isUnit3) : isUnit1(isUnit1), isUnit2(isUnit2), isUnit3(isUnit3) {
@@ -41,7 +41,10 @@ void Prim::update(double deltaTime, double simulationTime, bool faultActive, boo
   primComputer.setExternalInputs(&modelInputs);
   modelInputs.in.sim_data.computer_running = monitoringHealthy;
   primComputer.step();
-  modelOutputs = primComputer.getExternalOutputs().out;
+  const prim_outputs& outputs = primComputer.getExternalOutputs().out;
+  modelOutputs.discrete_outputs = outputs.discrete_outputs;
+  modelOutputs.analog_outputs = outputs.analog_outputs;
+  modelOutputs.bus_outputs = outputs.bus_outputs;
 }
 
 // Perform self monitoring
@@ -208,3 +211,27 @@ base_prim_analog_outputs Prim::getAnalogOutputs() {
 
   return output;
 }
+
+void Prim::saveSnapshot(Snapshot& snapshot) const {
+  primComputer.saveSnapshot(&snapshot.model);
+  snapshot.modelInputs = modelInputs;
+  snapshot.modelOutputs = modelOutputs;
+  snapshot.monitoringHealthy = monitoringHealthy;
+  snapshot.prevEngageButtonWasPressed = prevEngageButtonWasPressed;
+  snapshot.powerSupplyOutageTime = powerSupplyOutageTime;
+  snapshot.powerSupplyFault = powerSupplyFault;
+  snapshot.selfTestTimer = selfTestTimer;
+  snapshot.selfTestComplete = selfTestComplete;
+}
+
+void Prim::restoreSnapshot(const Snapshot& snapshot) {
+  primComputer.restoreSnapshot(&snapshot.model);
+  modelInputs = snapshot.modelInputs;
+  modelOutputs = snapshot.modelOutputs;
+  monitoringHealthy = snapshot.monitoringHealthy;
+  prevEngageButtonWasPressed = snapshot.prevEngageButtonWasPressed;
+  powerSupplyOutageTime = snapshot.powerSupplyOutageTime;
+  powerSupplyFault = snapshot.powerSupplyFault;
+  selfTestTimer = snapshot.selfTestTimer;
+  selfTestComplete = snapshot.selfTestComplete;
+}
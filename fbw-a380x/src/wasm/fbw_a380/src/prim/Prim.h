@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstdint>
+
 #include "../model/A380PrimComputer.h"
-#include "../utils/ConfirmNode.h"
-#include "../utils/HysteresisNode.h"
-#include "../utils/PulseNode.h"
-#include "../utils/SRFlipFlop.h"
+#include "utils/ConfirmNode.h"
+#include "utils/HysteresisNode.h"
+#include "utils/PulseNode.h"
+#include "utils/SRFlipFlop.h"
 
 class Prim {
  public:
@@ -22,6 +24,34 @@ class Prim {
 
   A380PrimComputer::ExternalInputs_A380PrimComputer_T modelInputs = {};
 
+  // Outputs of the model used by the interface. The remaining outputs stay in the model, which keeps the copy after
+  // each step and the footprint of the computer small.
+  struct ModelOutputs {
+    base_prim_discrete_outputs discrete_outputs;
+    base_prim_analog_outputs analog_outputs;
+    base_prim_out_bus bus_outputs;
+  };
+
+  // State of the computer and its model, which can be restored to continue from a checkpoint.
+  // It is trivially copyable, see ModelSnapshot.h for storing it as a blob.
+  struct Snapshot {
+    static constexpr uint32_t ID = 0x4d495250;  // "PRIM"
+
+    A380PrimComputer::Snapshot_A380PrimComputer_T model;
+    A380PrimComputer::ExternalInputs_A380PrimComputer_T modelInputs;
+    ModelOutputs modelOutputs;
+    bool monitoringHealthy;
+    bool prevEngageButtonWasPressed;
+    double powerSupplyOutageTime;
+    bool powerSupplyFault;
+    double selfTestTimer;
+    bool selfTestComplete;
+  };
+
+  void saveSnapshot(Snapshot& snapshot) const;
+
+  void restoreSnapshot(const Snapshot& snapshot);
+
  private:
   void initSelfTests(bool viaPushButton);
 
@@ -37,7 +67,7 @@ class Prim {
 
   // Model
   A380PrimComputer primComputer;
-  prim_outputs modelOutputs;
+  ModelOutputs modelOutputs;
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
@@ -1,6 +1,6 @@
 #include "Sec.h"
 #include <iostream>
-#include "../Arinc429.h"
+#include "Arinc429.h"
 #include "../Arinc429Utils.h"
 
 Sec::Sec(bool isUnit1, bool isUnit2, bool isUnit3) : isUnit1(isUnit1), isUnit2(isUnit2), isUnit3(isUnit3) {
@@ -36,7 +36,10 @@ void Sec::update(double deltaTime, double simulationTime, bool faultActive, bool
 
   secComputer.setExternalInputs(&modelInputs);
   secComputer.step();
-  modelOutputs = secComputer.getExternalOutputs().out;
+  const sec_outputs& outputs = secComputer.getExternalOutputs().out;
+  modelOutputs.discrete_outputs = outputs.discrete_outputs;
+  modelOutputs.analog_outputs = outputs.analog_outputs;
+  modelOutputs.bus_outputs = outputs.bus_outputs;
 }
 
 // Perform self monitoring. If
@@ -180,3 +183,31 @@ base_sec_analog_outputs Sec::getAnalogOutputs() {
 
   return output;
 }
+
+void Sec::saveSnapshot(Snapshot& snapshot) const {
+  secComputer.saveSnapshot(&snapshot.model);
+  snapshot.modelInputs = modelInputs;
+  snapshot.modelOutputs = modelOutputs;
+  snapshot.monitoringHealthy = monitoringHealthy;
+  snapshot.cpuStopped = cpuStopped;
+  snapshot.cpuStoppedFlipFlop = cpuStoppedFlipFlop;
+  snapshot.resetPulseNode = resetPulseNode;
+  snapshot.powerSupplyOutageTime = powerSupplyOutageTime;
+  snapshot.powerSupplyFault = powerSupplyFault;
+  snapshot.selfTestTimer = selfTestTimer;
+  snapshot.selfTestComplete = selfTestComplete;
+}
+
+void Sec::restoreSnapshot(const Snapshot& snapshot) {
+  secComputer.restoreSnapshot(&snapshot.model);
+  modelInputs = snapshot.modelInputs;
+  modelOutputs = snapshot.modelOutputs;
+  monitoringHealthy = snapshot.monitoringHealthy;
+  cpuStopped = snapshot.cpuStopped;
+  cpuStoppedFlipFlop = snapshot.cpuStoppedFlipFlop;
+  resetPulseNode = snapshot.resetPulseNode;
+  powerSupplyOutageTime = snapshot.powerSupplyOutageTime;
+  powerSupplyFault = snapshot.powerSupplyFault;
+  selfTestTimer = snapshot.selfTestTimer;
+  selfTestComplete = snapshot.selfTestComplete;
+}
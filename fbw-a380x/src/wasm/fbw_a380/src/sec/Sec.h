@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstdint>
+
 #include "../model/A380SecComputer.h"
-#include "../utils/ConfirmNode.h"
-#include "../utils/PulseNode.h"
-#include "../utils/SRFlipFlop.h"
+#include "utils/ConfirmNode.h"
+#include "utils/PulseNode.h"
+#include "utils/SRFlipFlop.h"
 
 class Sec {
  public:
@@ -21,6 +23,36 @@ class Sec {
 
   A380SecComputer::ExternalInputs_A380SecComputer_T modelInputs = {};
 
+  // Outputs of the model used by the interface. The remaining outputs stay in the model, which keeps the copy after
+  // each step and the footprint of the computer small.
+  struct ModelOutputs {
+    base_sec_discrete_outputs discrete_outputs;
+    base_sec_analog_outputs analog_outputs;
+    base_sec_out_bus bus_outputs;
+  };
+
+  // State of the computer and its model, which can be restored to continue from a checkpoint.
+  // It is trivially copyable, see ModelSnapshot.h for storing it as a blob.
+  struct Snapshot {
+    static constexpr uint32_t ID = 0x20434553;  // "SEC"
+
+    A380SecComputer::Snapshot_A380SecComputer_T model;
+    A380SecComputer::ExternalInputs_A380SecComputer_T modelInputs;
+    ModelOutputs modelOutputs;
+    bool monitoringHealthy;
+    bool cpuStopped;
+    SRFlipFlop cpuStoppedFlipFlop = SRFlipFlop(true);
+    PulseNode resetPulseNode = PulseNode(false);
+    double powerSupplyOutageTime;
+    bool powerSupplyFault;
+    double selfTestTimer;
+    bool selfTestComplete;
+  };
+
+  void saveSnapshot(Snapshot& snapshot) const;
+
+  void restoreSnapshot(const Snapshot& snapshot);
+
  private:
   void initSelfTests();
 
@@ -34,7 +66,7 @@ class Sec {
 
   // Model
   A380SecComputer secComputer;
-  sec_outputs modelOutputs;
+  ModelOutputs modelOutputs;
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
@@ -49,28 +49,43 @@ double expFBW(double x) {
 }
 
 /// <summary>
-/// Environmental corrected ratios
+/// Evaluates the polynomial c[0] + c[1] * x + ... + c[N - 1] * x^(N - 1) in Horner form.
+/// Uses N - 1 multiplications and additions instead of the O(N^2) multiplications of the expanded power sum. Both forms
+/// agree within floating point rounding: the difference is bounded by a few ulp of the sum of the absolute terms, which for
+/// the FADEC regression polynomials stays below 1e-9 of the result over their operating range.
 /// </summary>
-class EngineRatios {
- public:
-  FLOAT64 theta(double ambientTemp) {
-    double t = (273.15 + ambientTemp) / 288.15;
-    return t;
-  }
+template <size_t N>
+constexpr double hornerFBW(const double (&c)[N], double x) {
+  double y = c[N - 1];
 
-  FLOAT64 delta(double ambientPressure) {
-    double d = ambientPressure / 1013;
-    return d;
+  for (size_t i = N - 1; i > 0; --i) {
+    y = (y * x) + c[i - 1];
   }
 
-  FLOAT64 theta2(double mach, double ambientTemp) {
-    double t2 = this->theta(ambientTemp) * (1 + 0.2 * powFBW(mach, 2));
-    return t2;
-  }
+  return y;
+}
 
-  FLOAT64 delta2(double mach, double ambientPressure) {
-    double d2 = this->delta(ambientPressure) * pow((1 + 0.2 * powFBW(mach, 2)), 3.5);
-    return d2;
+/// <summary>
+/// Ambient dependent correction terms shared by all engines.
+/// Computed once per update cycle instead of once per engine and parameter.
+/// </summary>
+struct AmbientRatios {
+  double theta = 1;
+  double sqrtTheta = 1;
+  double delta = 1;
+  double theta2 = 1;
+  double sqrtTheta2 = 1;
+  double delta2 = 1;
+
+  void update(double mach, double ambientTemp, double ambientPressure) {
+    double machTerm = 1 + 0.2 * powFBW(mach, 2);
+
+    theta = (273.15 + ambientTemp) / 288.15;
+    sqrtTheta = sqrt(theta);
+    delta = ambientPressure / 1013;
+    theta2 = theta * machTerm;
+    sqrtTheta2 = sqrt(theta2);
+    delta2 = delta * pow(machTerm, 3.5);
   }
 };
 
@@ -103,28 +118,3 @@ double imbalanceExtractor(double imbalanceCode, int parameter) {
 
   return int(reg);
 }
-
-/// <summary>
-/// Timer Class for Performance Profiling purposes. TO BE DELETED!
-/// </summary>
-class Timer {
- public:
-  Timer() : m_StartTimepoint{clock_type::now()} {}
-  ~Timer() {}
-
-  void reset() { m_StartTimepoint = clock_type::now(); }
-
-  double elapsed() {
-    auto start = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch().count();
-    auto end = std::chrono::time_point_cast<std::chrono::microseconds>(clock_type::now()).time_since_epoch().count();
-
-    auto duration = end - start;
-    double ms = duration * 0.001;
-    return ms;  // ms
-  }
-
- private:
-  using clock_type = std::chrono::steady_clock;
-
-  std::chrono::time_point<clock_type> m_StartTimepoint;
-};
@@ -0,0 +1,215 @@
+#!/bin/bash
+
+# Builds the aircraft independent sources into a static library which is linked by the fbw modules of all aircraft.
+# Objects are kept per configuration and only compiled again when the source or one of its headers changed,
+# so that the second aircraft and later runs reuse the objects of the first one.
+#
+# usage: build.sh <library> [--debug] [--tunable-parameters] [--fast-trig]
+
+# get directory of this script relative to root
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+LIBRARY="$1"
+AR="${AR:-llvm-ar}"
+JOBS="${FBW_BUILD_JOBS:-$(nproc)}"
+
+if [[ " $* " == *" --debug "* ]]; then
+  CONFIGURATION="debug"
+  CLANG_ARGS="-g"
+else
+  CONFIGURATION="release"
+  CLANG_ARGS="-flto -O2 -DNDEBUG"
+fi
+
+# keep the model parameters mutable to allow tuning them at runtime, by default they are constant
+if [[ " $* " == *" --tunable-parameters "* ]]; then
+  CONFIGURATION="${CONFIGURATION}-tunable-parameters"
+  CLANG_ARGS="${CLANG_ARGS} -DFBW_TUNABLE_MODEL_PARAMETERS"
+fi
+
+# evaluate the navaid distance terms of the autopilot models with the polynomial kernels instead of the library
+if [[ " $* " == *" --fast-trig "* ]]; then
+  CONFIGURATION="${CONFIGURATION}-fast-trig"
+  CLANG_ARGS="${CLANG_ARGS} -DFBW_FAST_TRIG"
+fi
+
+COMMON_ARGS=(
+  ${CLANG_ARGS}
+  -Wno-unused-command-line-argument
+  --sysroot "${MSFS_SDK}/WASM/wasi-sysroot"
+  -target wasm32-unknown-wasi
+  -D_MSFS_WASM=1
+  -D__wasi__
+  -D_LIBCPP_HAS_NO_THREADS
+  -D_WINDLL
+  -D_MBCS
+  -mthread-model single
+  -fno-exceptions
+  -fms-extensions
+  -fvisibility=hidden
+  -I "${MSFS_SDK}/WASM/include"
+)
+
+C_ARGS=(
+  -Wno-implicit-function-declaration
+  -Wno-deprecated-non-prototype
+  -DZSTD_DISABLE_ASM
+  -I "${DIR}/src/zlib"
+)
+
+CXX_ARGS=(
+  -std=c++20
+  -Wno-ignored-attributes
+  -Wno-macro-redefined
+  -I "${MSFS_SDK}/SimConnect SDK/include"
+  -I "${DIR}/src"
+  -I "${DIR}/src/inih"
+  -I "${DIR}/src/model"
+  -I "${DIR}/src/zlib"
+)
+
+SOURCES=(
+  src/zlib/adler32.c
+  src/zlib/crc32.c
+  src/zlib/deflate.c
+  src/zlib/gzclose.c
+  src/zlib/gzlib.c
+  src/zlib/gzread.c
+  src/zlib/gzwrite.c
+  src/zlib/infback.c
+  src/zlib/inffast.c
+  src/zlib/inflate.c
+  src/zlib/inftrees.c
+  src/zlib/trees.c
+  src/zlib/zutil.c
+  src/zlib/zfstream.cc
+  src/zstd/common/debug.c
+  src/zstd/common/entropy_common.c
+  src/zstd/common/error_private.c
+  src/zstd/common/fse_decompress.c
+  src/zstd/common/xxhash.c
+  src/zstd/common/zstd_common.c
+  src/zstd/compress/fse_compress.c
+  src/zstd/compress/hist.c
+  src/zstd/compress/huf_compress.c
+  src/zstd/compress/zstd_compress.c
+  src/zstd/compress/zstd_compress_literals.c
+  src/zstd/compress/zstd_compress_sequences.c
+  src/zstd/compress/zstd_compress_superblock.c
+  src/zstd/compress/zstd_double_fast.c
+  src/zstd/compress/zstd_fast.c
+  src/zstd/compress/zstd_lazy.c
+  src/zstd/compress/zstd_ldm.c
+  src/zstd/compress/zstd_opt.c
+  src/zstd/compress/zstd_preSplit.c
+  src/Arinc429.cpp
+  src/CalculatedRadioReceiver.cpp
+  src/ComputerTransport.cpp
+  src/FixedRateScheduler.cpp
+  src/FlightDataRecorderFile.cpp
+  src/FlightDataRecorderSampler.cpp
+  src/InterpolatingLookupTable.cpp
+  src/LocalVariable.cpp
+  src/StartupTrace.cpp
+  src/ThrottleAxisMapping.cpp
+  src/utils/ConfirmNode.cpp
+  src/utils/HysteresisNode.cpp
+  src/utils/PulseNode.cpp
+  src/utils/SRFlipFLop.cpp
+  src/model/AutopilotLaws_data.cpp
+  src/model/AutopilotLaws.cpp
+  src/model/AutopilotStateMachine_data.cpp
+  src/model/AutopilotStateMachine.cpp
+  src/model/Double2MultiWord.cpp
+  src/model/FacComputer_data.cpp
+  src/model/FacComputer.cpp
+  src/model/look1_binlxpw.cpp
+  src/model/look2_binlcpw.cpp
+  src/model/look2_binlxpw.cpp
+  src/model/look2_pbinlxpw.cpp
+  src/model/mod_mvZvttxs.cpp
+  src/model/MultiWordIor.cpp
+  src/model/rt_modd.cpp
+  src/model/rt_remd.cpp
+  src/model/uMultiWord2Double.cpp
+)
+
+if [ -z "${LIBRARY}" ] || [[ "${LIBRARY}" == --* ]]; then
+  echo "usage: build.sh <library> [--debug] [--tunable-parameters] [--fast-trig]" >&2
+  exit 1
+fi
+
+set -e
+
+START_TIME=${SECONDS}
+OBJ_DIR="${DIR}/obj/${CONFIGURATION}"
+mkdir -p "${OBJ_DIR}"
+
+# objects compiled with other flags, e.g. after an update of the SDK or this script, cannot be reused
+FLAGS="${COMMON_ARGS[*]} ${C_ARGS[*]} ${CXX_ARGS[*]}"
+if [ ! -f "${OBJ_DIR}/flags" ] || [ "$(cat "${OBJ_DIR}/flags")" != "${FLAGS}" ]; then
+  rm -f "${OBJ_DIR}"/*.o "${OBJ_DIR}"/*.d
+  echo "${FLAGS}" > "${OBJ_DIR}/flags"
+fi
+
+object_of() {
+  local name="${1#src/}"
+  echo "${OBJ_DIR}/${name//\//_}.o"
+}
+
+# an object is up to date when it is newer than every file listed in the dependency file written by the compiler
+is_up_to_date() {
+  local object="$1"
+  local dependencies="${object%.o}.d"
+  [ -f "${object}" ] && [ -f "${dependencies}" ] || return 1
+
+  local dependency
+  while read -r dependency; do
+    if [ -n "${dependency}" ] && [ "${dependency}" -nt "${object}" ]; then
+      return 1
+    fi
+  done < <(sed -e '1s/^[^:]*://' -e 's/\\$//' -e 's/\([^\\]\) /\1\n/g' -e 's/\\ / /g' "${dependencies}")
+}
+
+# the object is compiled to a temporary file first, another aircraft built at the same time must not link a partial object
+compile() {
+  local source="$1"
+  local object
+  object="$(object_of "${source}")"
+  local temporary="${object%.o}.${BASHPID}"
+  echo "compiling ${source}"
+
+  if [[ "${source}" == *.c ]]; then
+    clang -c "${COMMON_ARGS[@]}" "${C_ARGS[@]}" -MMD -MT "${object##*/}" -MF "${temporary}.d" "${DIR}/${source}" -o "${temporary}.o"
+  else
+    clang++ -c "${COMMON_ARGS[@]}" "${CXX_ARGS[@]}" -MMD -MT "${object##*/}" -MF "${temporary}.d" "${DIR}/${source}" -o "${temporary}.o"
+  fi
+  mv -f "${temporary}.o" "${object}"
+  mv -f "${temporary}.d" "${object%.o}.d"
+}
+
+OUTDATED=()
+OBJECTS=()
+for source in "${SOURCES[@]}"; do
+  object="$(object_of "${source}")"
+  OBJECTS+=("${object}")
+  if ! is_up_to_date "${object}"; then
+    OUTDATED+=("${source}")
+  fi
+done
+
+# compile the outdated sources in parallel, a failing source fails the build
+if [ ${#OUTDATED[@]} -gt 0 ]; then
+  export DIR OBJ_DIR
+  export -f object_of compile
+  # arrays cannot be exported, their declarations are passed to the jobs instead
+  export ARGS_DECLARATION
+  ARGS_DECLARATION="$(declare -p COMMON_ARGS C_ARGS CXX_ARGS)"
+  printf '%s\n' "${OUTDATED[@]}" | xargs -P "${JOBS}" -I {} bash -c 'set -e; eval "${ARGS_DECLARATION}"; compile "$1"' _ {}
+fi
+
+# the archive is cheap to create, it is always written so that it contains exactly the current objects
+mkdir -p "$(dirname "${LIBRARY}")"
+rm -f "${LIBRARY}"
+"${AR}" rcs "${LIBRARY}" "${OBJECTS[@]}"
+
+echo "BUILD: fbw_common ${CONFIGURATION}: ${#SOURCES[@]} sources, ${#OUTDATED[@]} compiled, $((${#SOURCES[@]} - ${#OUTDATED[@]})) reused in $((SECONDS - START_TIME)) s"
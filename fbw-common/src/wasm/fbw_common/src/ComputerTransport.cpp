@@ -0,0 +1,217 @@
+#include "ComputerTransport.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#if defined(__unix__) && !defined(__wasi__)
+#define COMPUTER_TRANSPORT_SHARED_MEMORY
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "the message rings require lock free atomics to be shared between processes");
+
+namespace {
+
+#ifdef COMPUTER_TRANSPORT_SHARED_MEMORY
+ComputerTransportSegment* mapSegment(const std::string& name, bool create) {
+  int fd = shm_open(name.c_str(), create ? O_RDWR | O_CREAT : O_RDWR, 0600);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  if (create && ftruncate(fd, sizeof(ComputerTransportSegment)) != 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  void* memory = mmap(nullptr, sizeof(ComputerTransportSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (memory == MAP_FAILED) {
+    return nullptr;
+  }
+  return static_cast<ComputerTransportSegment*>(memory);
+}
+
+void unmapSegment(ComputerTransportSegment* segment) {
+  munmap(segment, sizeof(ComputerTransportSegment));
+}
+
+void yieldToPeer() {
+  sched_yield();
+}
+#else
+void unmapSegment(ComputerTransportSegment*) {}
+
+void yieldToPeer() {}
+#endif
+
+}  // namespace
+
+ClientDataComputerTransport::ClientDataComputerTransport(HANDLE connectionHandle) : connectionHandle(connectionHandle) {}
+
+bool ClientDataComputerTransport::send(uint32_t id, const void* data, uint32_t size) {
+  HRESULT result =
+      SimConnect_SetClientData(connectionHandle, id, id, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, size, const_cast<void*>(data));
+  return result == S_OK;
+}
+
+bool ClientDataComputerTransport::exchange(uint32_t, uint64_t, const ComputerTransportReceiver&) {
+  // outputs are received through the SimConnect dispatch
+  return true;
+}
+
+void ComputerMessageRing::reset() {
+  head.store(0, std::memory_order_relaxed);
+  tail.store(0, std::memory_order_relaxed);
+}
+
+bool ComputerMessageRing::push(uint32_t id, uint64_t frame, const void* data, uint32_t size) {
+  if (size > PAYLOAD_SIZE) {
+    return false;
+  }
+
+  uint32_t currentHead = head.load(std::memory_order_relaxed);
+  if (currentHead - tail.load(std::memory_order_acquire) >= SLOT_COUNT) {
+    // ring is full
+    return false;
+  }
+
+  Slot& slot = slots[currentHead % SLOT_COUNT];
+  slot.id = id;
+  slot.size = size;
+  slot.frame = frame;
+  if (size > 0) {
+    std::memcpy(slot.data, data, size);
+  }
+
+  head.store(currentHead + 1, std::memory_order_release);
+  return true;
+}
+
+const ComputerMessageRing::Slot* ComputerMessageRing::front() {
+  uint32_t currentTail = tail.load(std::memory_order_relaxed);
+  if (currentTail == head.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  return &slots[currentTail % SLOT_COUNT];
+}
+
+void ComputerMessageRing::pop() {
+  tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+std::unique_ptr<SharedMemoryComputerTransport> SharedMemoryComputerTransport::open(const std::string& name, double timeout) {
+#ifdef COMPUTER_TRANSPORT_SHARED_MEMORY
+  ComputerTransportSegment* segment = mapSegment(name, true);
+  if (segment == nullptr) {
+    std::cout << "WASM: Failed to open shared memory segment " << name << std::endl;
+    return nullptr;
+  }
+  return std::make_unique<SharedMemoryComputerTransport>(segment, timeout);
+#else
+  std::cout << "WASM: Shared memory is not available, cannot open " << name << std::endl;
+  return nullptr;
+#endif
+}
+
+SharedMemoryComputerTransport::SharedMemoryComputerTransport(ComputerTransportSegment* segment, double timeout)
+    : segment(segment), timeout(timeout) {
+  // (re)initialize the segment, the endpoint attaches once the magic is set
+  segment->magic.store(0, std::memory_order_relaxed);
+  segment->version = ComputerTransportSegment::VERSION;
+  segment->toComputers.reset();
+  segment->toHost.reset();
+  segment->magic.store(ComputerTransportSegment::MAGIC, std::memory_order_release);
+}
+
+SharedMemoryComputerTransport::~SharedMemoryComputerTransport() {
+  unmapSegment(segment);
+}
+
+bool SharedMemoryComputerTransport::send(uint32_t id, const void* data, uint32_t size) {
+  return segment->toComputers.push(id, 0, data, size);
+}
+
+bool SharedMemoryComputerTransport::exchange(uint32_t computer, uint64_t frame, const ComputerTransportReceiver& receiver) {
+  if (!segment->toComputers.push(ComputerTransportSegment::SYNC_ID, frame, &computer, sizeof(computer))) {
+    return false;
+  }
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+  while (true) {
+    while (const ComputerMessageRing::Slot* slot = segment->toHost.front()) {
+      if (slot->id != ComputerTransportSegment::SYNC_ID) {
+        receiver(slot->id, slot->data, slot->size);
+        segment->toHost.pop();
+        continue;
+      }
+
+      uint32_t completedComputer;
+      std::memcpy(&completedComputer, slot->data, sizeof(completedComputer));
+      bool completed = completedComputer == computer && slot->frame == frame;
+      segment->toHost.pop();
+
+      if (completed) {
+        return true;
+      }
+      // stale completion of a step which timed out before, its outputs are still newer than the current ones
+    }
+
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    yieldToPeer();
+  }
+}
+
+std::unique_ptr<SharedMemoryComputerEndpoint> SharedMemoryComputerEndpoint::open(const std::string& name) {
+#ifdef COMPUTER_TRANSPORT_SHARED_MEMORY
+  ComputerTransportSegment* segment = mapSegment(name, false);
+  if (segment == nullptr) {
+    return nullptr;
+  }
+
+  if (segment->magic.load(std::memory_order_acquire) != ComputerTransportSegment::MAGIC ||
+      segment->version != ComputerTransportSegment::VERSION) {
+    unmapSegment(segment);
+    return nullptr;
+  }
+  return std::make_unique<SharedMemoryComputerEndpoint>(segment);
+#else
+  return nullptr;
+#endif
+}
+
+SharedMemoryComputerEndpoint::SharedMemoryComputerEndpoint(ComputerTransportSegment* segment) : segment(segment) {}
+
+SharedMemoryComputerEndpoint::~SharedMemoryComputerEndpoint() {
+  unmapSegment(segment);
+}
+
+bool SharedMemoryComputerEndpoint::receive(const ComputerTransportReceiver& receiver, uint32_t& computer, uint64_t& frame) {
+  while (const ComputerMessageRing::Slot* slot = segment->toComputers.front()) {
+    if (slot->id == ComputerTransportSegment::SYNC_ID) {
+      std::memcpy(&computer, slot->data, sizeof(computer));
+      frame = slot->frame;
+      segment->toComputers.pop();
+      return true;
+    }
+
+    receiver(slot->id, slot->data, slot->size);
+    segment->toComputers.pop();
+  }
+  return false;
+}
+
+bool SharedMemoryComputerEndpoint::send(uint32_t id, const void* data, uint32_t size) {
+  return segment->toHost.push(id, 0, data, size);
+}
+
+bool SharedMemoryComputerEndpoint::complete(uint32_t computer, uint64_t frame) {
+  return segment->toHost.push(ComputerTransportSegment::SYNC_ID, frame, &computer, sizeof(computer));
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <SimConnect.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+/// <summary>
+/// Handler for a data area received from an externally executed computer
+/// </summary>
+using ComputerTransportReceiver = std::function<void(uint32_t id, const void* data, uint32_t size)>;
+
+/// <summary>
+/// Copies a received data area into its destination.
+/// Data areas shorter than the destination are rejected, SimConnect may pad the client data it delivers.
+/// </summary>
+/// <returns>False if the data area is shorter than the destination, which is left unchanged then.</returns>
+template <typename T>
+bool readComputerData(T& destination, const void* data, uint32_t size) {
+  static_assert(std::is_trivially_copyable_v<T>, "data areas are copied bytewise");
+  if (size < sizeof(T)) {
+    return false;
+  }
+  std::memcpy(&destination, data, sizeof(T));
+  return true;
+}
+
+/// <summary>
+/// Transport of the data areas exchanged with flight computers which are executed outside of this module.
+/// The ids of the data areas are the client data ids of the aircraft.
+/// </summary>
+class ComputerTransport {
+ public:
+  virtual ~ComputerTransport() = default;
+
+  /// <summary>
+  /// Queues a data area for the external computers
+  /// </summary>
+  virtual bool send(uint32_t id, const void* data, uint32_t size) = 0;
+
+  /// <summary>
+  /// Completes the inputs of a computer for a frame and delivers the outputs received in return.
+  /// Lockstep transports block until the computer has been stepped for this frame.
+  /// </summary>
+  /// <param name="computer">Aircraft specific id of the computer.</param>
+  /// <param name="frame">Number of the current frame.</param>
+  /// <param name="receiver">Handler for the received data areas.</param>
+  /// <returns>False if the outputs of this frame have not been received.</returns>
+  virtual bool exchange(uint32_t computer, uint64_t frame, const ComputerTransportReceiver& receiver) = 0;
+};
+
+/// <summary>
+/// Transport through SimConnect client data areas.
+/// The outputs arrive asynchronously through the SimConnect dispatch, so they lag behind by one frame.
+/// </summary>
+class ClientDataComputerTransport : public ComputerTransport {
+ public:
+  explicit ClientDataComputerTransport(HANDLE connectionHandle);
+
+  bool send(uint32_t id, const void* data, uint32_t size) override;
+
+  bool exchange(uint32_t computer, uint64_t frame, const ComputerTransportReceiver& receiver) override;
+
+ private:
+  HANDLE connectionHandle;
+};
+
+/// <summary>
+/// Single producer single consumer ring of messages, placed in memory shared between two processes
+/// </summary>
+struct ComputerMessageRing {
+  static constexpr uint32_t SLOT_COUNT = 64;
+  static constexpr uint32_t PAYLOAD_SIZE = 4096;
+
+  struct Slot {
+    uint32_t id;
+    uint32_t size;
+    uint64_t frame;
+    unsigned char data[PAYLOAD_SIZE];
+  };
+
+  // next slot written by the producer
+  alignas(64) std::atomic<uint32_t> head;
+  // next slot read by the consumer
+  alignas(64) std::atomic<uint32_t> tail;
+  Slot slots[SLOT_COUNT];
+
+  void reset();
+
+  bool push(uint32_t id, uint64_t frame, const void* data, uint32_t size);
+
+  /// <summary>
+  /// Oldest message or nullptr if the ring is empty, it stays valid until pop is called
+  /// </summary>
+  const Slot* front();
+
+  void pop();
+};
+
+/// <summary>
+/// Layout of the shared memory segment.
+///
+/// Lockstep protocol, for each externally executed computer and frame:
+/// 1. the host pushes the input data areas of the computer to toComputers,
+/// 2. the host pushes a SYNC_ID message carrying the computer id and the frame number and waits,
+/// 3. the external process steps the computer and pushes its output data areas to toHost,
+/// 4. the external process pushes a SYNC_ID message with the same computer id and frame number,
+/// 5. the host applies the outputs and continues the frame.
+/// A host which runs into its timeout continues with the previous outputs and skips stale SYNC_ID messages later on.
+/// </summary>
+struct ComputerTransportSegment {
+  static constexpr uint32_t MAGIC = 0x43574246;  // "FBWC"
+  static constexpr uint32_t VERSION = 1;
+  static constexpr uint32_t SYNC_ID = 0xFFFFFFFF;
+
+  std::atomic<uint32_t> magic;
+  uint32_t version;
+  ComputerMessageRing toComputers;
+  ComputerMessageRing toHost;
+};
+
+/// <summary>
+/// Lockstep transport through a shared memory segment, for computers executed in a separate native process.
+/// Only available on POSIX hosts, the simulator WASM sandbox does not provide shared memory.
+/// </summary>
+class SharedMemoryComputerTransport : public ComputerTransport {
+ public:
+  /// <summary>
+  /// Creates or attaches to the named segment as host
+  /// </summary>
+  /// <param name="name">Name of the shared memory segment, e.g. "/fbw_a32nx_computers".</param>
+  /// <param name="timeout">Maximum time to wait for the outputs of a computer in seconds.</param>
+  /// <returns>The transport or nullptr if shared memory is not available.</returns>
+  static std::unique_ptr<SharedMemoryComputerTransport> open(const std::string& name, double timeout);
+
+  SharedMemoryComputerTransport(ComputerTransportSegment* segment, double timeout);
+  ~SharedMemoryComputerTransport() override;
+
+  SharedMemoryComputerTransport(const SharedMemoryComputerTransport&) = delete;
+  SharedMemoryComputerTransport& operator=(const SharedMemoryComputerTransport&) = delete;
+
+  bool send(uint32_t id, const void* data, uint32_t size) override;
+
+  bool exchange(uint32_t computer, uint64_t frame, const ComputerTransportReceiver& receiver) override;
+
+ private:
+  ComputerTransportSegment* segment;
+  double timeout;
+};
+
+/// <summary>
+/// Counterpart of the SharedMemoryComputerTransport, used by the process executing the computers
+/// </summary>
+class SharedMemoryComputerEndpoint {
+ public:
+  /// <summary>
+  /// Attaches to the named segment once the host has created it
+  /// </summary>
+  /// <returns>The endpoint or nullptr if the segment is not available (yet).</returns>
+  static std::unique_ptr<SharedMemoryComputerEndpoint> open(const std::string& name);
+
+  explicit SharedMemoryComputerEndpoint(ComputerTransportSegment* segment);
+  ~SharedMemoryComputerEndpoint();
+
+  SharedMemoryComputerEndpoint(const SharedMemoryComputerEndpoint&) = delete;
+  SharedMemoryComputerEndpoint& operator=(const SharedMemoryComputerEndpoint&) = delete;
+
+  /// <summary>
+  /// Delivers the queued inputs until the host requests a computer step
+  /// </summary>
+  /// <param name="receiver">Handler for the received data areas.</param>
+  /// <param name="computer">Computer to step, set if a step is requested.</param>
+  /// <param name="frame">Frame to step, set if a step is requested.</param>
+  /// <returns>True if a step is requested, false if all queued inputs have been delivered.</returns>
+  bool receive(const ComputerTransportReceiver& receiver, uint32_t& computer, uint64_t& frame);
+
+  bool send(uint32_t id, const void* data, uint32_t size);
+
+  /// <summary>
+  /// Signals the host that all outputs of the requested step have been sent
+  /// </summary>
+  bool complete(uint32_t computer, uint64_t frame);
+
+ private:
+  ComputerTransportSegment* segment;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cmath>
+
+/// <summary>
+/// Trigonometric kernels which trade the full accuracy of the library for speed.
+/// The angles are reduced to [-pi/4, pi/4] and evaluated with truncated series. The absolute error is below 2e-15 for
+/// arguments up to 1e5 rad, larger and non-finite arguments are passed to the library functions. Only the guidance
+/// terms of the autopilot models use them, see TrigCache.h. There is no tangent, close to its poles the error of the
+/// reduction is not bounded relative to the result.
+/// </summary>
+namespace FastTrig {
+
+// pi/2 split into a part with a 33 bit mantissa and the remainder (as in fdlibm), so that k * PI_2_HI is exact
+constexpr double PI_2_HI = 1.57079632673412561417;
+constexpr double PI_2_LO = 6.07710050650619224932e-11;
+
+// Taylor series of sin on [-pi/4, pi/4] up to x^15, evaluated with the Horner scheme
+inline double sinKernel(double x) {
+  double x2 = x * x;
+  double p = -1.0 / 1307674368000.0;
+  p = p * x2 + 1.0 / 6227020800.0;
+  p = p * x2 - 1.0 / 39916800.0;
+  p = p * x2 + 1.0 / 362880.0;
+  p = p * x2 - 1.0 / 5040.0;
+  p = p * x2 + 1.0 / 120.0;
+  p = p * x2 - 1.0 / 6.0;
+  return x + x * x2 * p;
+}
+
+// Taylor series of cos on [-pi/4, pi/4] up to x^14
+inline double cosKernel(double x) {
+  double x2 = x * x;
+  double p = -1.0 / 87178291200.0;
+  p = p * x2 + 1.0 / 479001600.0;
+  p = p * x2 - 1.0 / 3628800.0;
+  p = p * x2 + 1.0 / 40320.0;
+  p = p * x2 - 1.0 / 720.0;
+  p = p * x2 + 1.0 / 24.0;
+  p = p * x2 - 0.5;
+  return 1.0 + x2 * p;
+}
+
+// reduces the angle to [-pi/4, pi/4] and returns the quadrant
+inline int reduce(double x, double& reduced) {
+  double k = std::nearbyint(x * (1.0 / (PI_2_HI + PI_2_LO)));
+  reduced = (x - k * PI_2_HI) - k * PI_2_LO;
+  return static_cast<int>(static_cast<long long>(k) & 3);
+}
+
+inline double sin(double x) {
+  if (!std::isfinite(x) || std::abs(x) > 1e5) {
+    return std::sin(x);
+  }
+  double r;
+  switch (reduce(x, r)) {
+    case 0:
+      return sinKernel(r);
+    case 1:
+      return cosKernel(r);
+    case 2:
+      return -sinKernel(r);
+    default:
+      return -cosKernel(r);
+  }
+}
+
+inline double cos(double x) {
+  if (!std::isfinite(x) || std::abs(x) > 1e5) {
+    return std::cos(x);
+  }
+  double r;
+  switch (reduce(x, r)) {
+    case 0:
+      return cosKernel(r);
+    case 1:
+      return -sinKernel(r);
+    case 2:
+      return -cosKernel(r);
+    default:
+      return sinKernel(r);
+  }
+}
+}  // namespace FastTrig
@@ -0,0 +1,116 @@
+#include "FixedRateScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+FixedRateScheduler::FixedRateScheduler(const std::string& name, double rate, int maxStepsPerFrame)
+    : name(name), stepTime(rate > 0 ? 1.0 / rate : 0), maxStepsPerFrame(std::max(1, maxStepsPerFrame)) {}
+
+int FixedRateScheduler::advance(double frameTime) {
+  int stepLimit = getStepLimit();
+
+  if (!isFixedRate() && maxStepTime <= 0) {
+    frameSteps = 1;
+    frameStepTime = frameTime;
+  } else if (!isFixedRate()) {
+    // sub-stepping, the whole frame time is always simulated even if the steps get longer than intended
+    frameSteps = std::max(1, static_cast<int>(std::ceil(frameTime / maxStepTime - 1e-6)));
+    if (frameSteps > stepLimit) {
+      frameSteps = stepLimit;
+      budgetLimitedFrames++;
+    }
+    frameStepTime = frameTime / frameSteps;
+  } else {
+    accumulatedTime += frameTime;
+    // small tolerance so that a frame time which equals the step time is not held due to rounding
+    frameSteps = static_cast<int>(std::floor(accumulatedTime / stepTime + 1e-6));
+    accumulatedTime = std::max(0.0, accumulatedTime - frameSteps * stepTime);
+
+    if (frameSteps > stepLimit) {
+      // do not try to catch up, this would only increase the load of already slow frames
+      droppedSteps += frameSteps - stepLimit;
+      frameSteps = stepLimit;
+      if (stepLimit < maxStepsPerFrame) {
+        budgetLimitedFrames++;
+      }
+    }
+    frameStepTime = stepTime;
+  }
+
+  effectiveStepTime = frameSteps > 0 ? std::max(frameStepTime, frameTime / frameSteps) : frameStepTime;
+
+  frames++;
+  steps += frameSteps;
+  if (frameSteps == 0) {
+    heldFrames++;
+  }
+  maxStepsInFrame = std::max(maxStepsInFrame, frameSteps);
+
+  return frameSteps;
+}
+
+void FixedRateScheduler::setMaxStepTime(double maxStepTime) {
+  this->maxStepTime = std::max(0.0, maxStepTime);
+}
+
+void FixedRateScheduler::setFrameBudget(double frameBudget) {
+  this->frameBudget = std::max(0.0, frameBudget);
+}
+
+void FixedRateScheduler::recordExecutionTime(double executionTime) {
+  if (frameSteps == 0) {
+    return;
+  }
+
+  double executionTimePerStep = executionTime / frameSteps;
+  if (stepExecutionTime <= 0) {
+    stepExecutionTime = executionTimePerStep;
+  } else {
+    stepExecutionTime = 0.9 * stepExecutionTime + 0.1 * executionTimePerStep;
+  }
+}
+
+double FixedRateScheduler::getStepTime() const {
+  return frameStepTime;
+}
+
+double FixedRateScheduler::getEffectiveStepTime() const {
+  return effectiveStepTime;
+}
+
+bool FixedRateScheduler::isFixedRate() const {
+  return stepTime > 0;
+}
+
+int FixedRateScheduler::getStepLimit() const {
+  if (frameBudget <= 0 || stepExecutionTime <= 0) {
+    return maxStepsPerFrame;
+  }
+  return std::clamp(static_cast<int>(frameBudget / stepExecutionTime), 1, maxStepsPerFrame);
+}
+
+void FixedRateScheduler::printBudgetReport() {
+  if (frames == 0) {
+    return;
+  }
+
+  std::cout << "WASM: SCHEDULER : " << name << " ";
+  if (isFixedRate()) {
+    std::cout << std::round(1.0 / stepTime) << " Hz";
+  } else if (maxStepTime > 0) {
+    std::cout << "sub-stepped at max " << maxStepTime << " s";
+  } else {
+    std::cout << "every frame";
+  }
+  std::cout << ", " << frames << " frames, " << static_cast<double>(steps) / frames << " steps per frame (max " << maxStepsInFrame;
+  std::cout << "), " << heldFrames << " frames held, " << droppedSteps << " steps dropped, " << budgetLimitedFrames;
+  std::cout << " frames limited by budget, " << stepExecutionTime * 1e6 << " us per step" << std::endl;
+
+  frames = 0;
+  steps = 0;
+  heldFrames = 0;
+  droppedSteps = 0;
+  budgetLimitedFrames = 0;
+  maxStepsInFrame = 0;
+}
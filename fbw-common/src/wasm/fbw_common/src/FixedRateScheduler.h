@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// Schedules a model at a fixed rate independent of the frame rate.
+/// Depending on the frame time the model is sub-stepped several times per frame or skipped for some frames,
+/// in which case the outputs of the last step are held.
+/// With a rate of 0 the model is stepped exactly once per frame with the frame time as step time,
+/// unless sub-stepping is enabled which splits the frame into steps of bounded length (used at high simulation rates).
+/// </summary>
+class FixedRateScheduler {
+ public:
+  /// <param name="name">Name of the scheduled models used in the budget report.</param>
+  /// <param name="rate">Step rate in Hz, 0 to step once per frame.</param>
+  /// <param name="maxStepsPerFrame">Maximum number of steps in a frame, time exceeding it is dropped.</param>
+  FixedRateScheduler(const std::string& name, double rate, int maxStepsPerFrame);
+
+  /// <summary>
+  /// Advances the scheduler by the time of a frame
+  /// </summary>
+  /// <param name="frameTime">Time passed since the last frame in seconds.</param>
+  /// <returns>Number of steps to execute in this frame, 0 if the outputs are held.</returns>
+  int advance(double frameTime);
+
+  /// <summary>
+  /// Splits frames into equal steps no longer than the given step time, only used with a rate of 0
+  /// </summary>
+  void setMaxStepTime(double maxStepTime);
+
+  /// <summary>
+  /// Limits the steps per frame to those which fit into the given execution time, 0 to disable the limit
+  /// </summary>
+  void setFrameBudget(double frameBudget);
+
+  /// <summary>
+  /// Records the execution time of the steps returned by the last call to advance, used for the frame budget
+  /// </summary>
+  void recordExecutionTime(double executionTime);
+
+  /// <summary>
+  /// Time to use for each step returned by the last call to advance
+  /// </summary>
+  double getStepTime() const;
+
+  /// <summary>
+  /// Time the models advanced per step in the last frame.
+  /// Larger than the step time if steps had to be dropped or sub-steps limited.
+  /// </summary>
+  double getEffectiveStepTime() const;
+
+  bool isFixedRate() const;
+
+  /// <summary>
+  /// Prints the steps executed per frame since the last report and resets the statistics
+  /// </summary>
+  void printBudgetReport();
+
+ private:
+  const std::string name;
+  const double stepTime;
+  const int maxStepsPerFrame;
+
+  double maxStepTime = 0;
+  double frameBudget = 0;
+
+  double accumulatedTime = 0;
+  double frameStepTime = 0;
+  double effectiveStepTime = 0;
+  int frameSteps = 0;
+
+  // smoothed execution time of a single step
+  double stepExecutionTime = 0;
+
+  // statistics since the last report
+  uint64_t frames = 0;
+  uint64_t steps = 0;
+  uint64_t heldFrames = 0;
+  uint64_t droppedSteps = 0;
+  uint64_t budgetLimitedFrames = 0;
+  int maxStepsInFrame = 0;
+
+  int getStepLimit() const;
+};
@@ -0,0 +1,180 @@
+#include "FlightDataRecorderFile.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+FlightDataRecorderFile::~FlightDataRecorderFile() {
+  close();
+}
+
+bool FlightDataRecorderFile::parseCodec(const std::string& name, FlightDataRecorderCodec& codec) {
+  std::string lowerCaseName = name;
+  std::transform(lowerCaseName.begin(), lowerCaseName.end(), lowerCaseName.begin(), [](unsigned char c) { return std::tolower(c); });
+  if (lowerCaseName == "store") {
+    codec = FlightDataRecorderCodec::Store;
+  } else if (lowerCaseName == "fast") {
+    codec = FlightDataRecorderCodec::Fast;
+  } else if (lowerCaseName == "deflate") {
+    codec = FlightDataRecorderCodec::Deflate;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool FlightDataRecorderFile::open(const std::string& filePath,
+                                  FlightDataRecorderAircraft aircraft,
+                                  FlightDataRecorderCodec codec,
+                                  int level,
+                                  FlightDataRecorderTransform transform,
+                                  const FlightDataRecorderRecordLayout& layout) {
+  close();
+
+  if (transform != FlightDataRecorderTransform::None && layout.size == 0) {
+    return false;
+  }
+
+  this->codec = codec;
+  this->level = level;
+  this->transform = transform;
+  this->layout = layout;
+  position = 0;
+  switch (codec) {
+    case FlightDataRecorderCodec::Store:
+      break;
+    case FlightDataRecorderCodec::Fast:
+      zstdContext = ZSTD_createCCtx();
+      if (zstdContext == nullptr) {
+        return false;
+      }
+      break;
+    case FlightDataRecorderCodec::Deflate:
+      if (deflateInit(&deflateStream, level) != Z_OK) {
+        return false;
+      }
+      isDeflateStreamInitialized = true;
+      break;
+  }
+
+  file = fopen(filePath.c_str(), "wb");
+  if (file == nullptr) {
+    close();
+    return false;
+  }
+
+  FlightDataRecorderFileHeader header = {};
+  std::memcpy(header.magic, FlightDataRecorderFileHeader::MAGIC, sizeof(header.magic));
+  header.codec = codec;
+  header.level = static_cast<int8_t>(level);
+  header.transform = transform;
+  header.aircraft = aircraft;
+  fwrite(&header, sizeof(header), 1, file);
+  if (transform != FlightDataRecorderTransform::None) {
+    fwrite(&layout, sizeof(layout), 1, file);
+  }
+
+  block.reserve(BLOCK_SIZE + layout.size);
+  return true;
+}
+
+void FlightDataRecorderFile::write(const void* data, size_t size) {
+  if (file == nullptr) {
+    return;
+  }
+
+  // transformed records are kept together, the block is written at the end of the record which fills it
+  auto bytes = static_cast<const char*>(data);
+  if (transform != FlightDataRecorderTransform::None) {
+    block.insert(block.end(), bytes, bytes + size);
+    position += size;
+    if (block.size() >= BLOCK_SIZE && position >= layout.offset && (position - layout.offset) % layout.size == 0) {
+      writeBlock();
+    }
+    return;
+  }
+
+  // records are split across blocks, the reader joins the blocks to one stream
+  while (size > 0) {
+    size_t count = std::min(size, BLOCK_SIZE - block.size());
+    block.insert(block.end(), bytes, bytes + count);
+    bytes += count;
+    size -= count;
+    position += count;
+    if (block.size() == BLOCK_SIZE) {
+      writeBlock();
+    }
+  }
+}
+
+void FlightDataRecorderFile::flush() {
+  if (file == nullptr) {
+    return;
+  }
+  writeBlock();
+}
+
+void FlightDataRecorderFile::close() {
+  if (file != nullptr) {
+    writeBlock();
+    fclose(file);
+    file = nullptr;
+  }
+  if (zstdContext != nullptr) {
+    ZSTD_freeCCtx(zstdContext);
+    zstdContext = nullptr;
+  }
+  if (isDeflateStreamInitialized) {
+    deflateEnd(&deflateStream);
+    isDeflateStreamInitialized = false;
+  }
+  block.clear();
+}
+
+void FlightDataRecorderFile::writeBlock() {
+  if (block.empty()) {
+    return;
+  }
+
+  if (transform != FlightDataRecorderTransform::None) {
+    size_t firstRecord = getFlightDataRecorderFirstRecord(position - block.size(), layout);
+    if (firstRecord < block.size()) {
+      size_t count = (block.size() - firstRecord) / layout.size;
+      encodeFlightDataRecorderRecords(block.data() + firstRecord, count, layout.size, transform, transformBuffer);
+    }
+  }
+
+  const char* storedData = block.data();
+  size_t storedSize = block.size();
+  if (codec == FlightDataRecorderCodec::Fast) {
+    compressedBlock.resize(std::max(compressedBlock.size(), ZSTD_compressBound(block.size())));
+    size_t result = ZSTD_compressCCtx(zstdContext, compressedBlock.data(), compressedBlock.size(), block.data(), block.size(), level);
+    if (!ZSTD_isError(result)) {
+      storedData = compressedBlock.data();
+      storedSize = result;
+    }
+  } else if (codec == FlightDataRecorderCodec::Deflate) {
+    deflateReset(&deflateStream);
+    compressedBlock.resize(std::max<size_t>(compressedBlock.size(), deflateBound(&deflateStream, static_cast<uLong>(block.size()))));
+    deflateStream.next_in = reinterpret_cast<Bytef*>(block.data());
+    deflateStream.avail_in = static_cast<uInt>(block.size());
+    deflateStream.next_out = reinterpret_cast<Bytef*>(compressedBlock.data());
+    deflateStream.avail_out = static_cast<uInt>(compressedBlock.size());
+    if (deflate(&deflateStream, Z_FINISH) == Z_STREAM_END) {
+      storedData = compressedBlock.data();
+      storedSize = deflateStream.total_out;
+    }
+  }
+
+  // a block which does not get smaller is stored, the reader recognizes it by the equal sizes
+  if (storedSize >= block.size()) {
+    storedData = block.data();
+    storedSize = block.size();
+  }
+
+  FlightDataRecorderBlockHeader header = {static_cast<uint32_t>(block.size()), static_cast<uint32_t>(storedSize)};
+  fwrite(&header, sizeof(header), 1, file);
+  fwrite(storedData, 1, storedSize, file);
+  fflush(file);
+  block.clear();
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderTransform.h"
+#include "zlib.h"
+#include "zstd/zstd.h"
+
+/// <summary>
+/// Compression of the blocks of a flight data recorder file
+/// </summary>
+enum class FlightDataRecorderCodec : uint8_t {
+  Store = 0,
+  Fast = 1,
+  Deflate = 2,
+};
+
+/// <summary>
+/// Aircraft which has written a flight data recorder file, the interface versions of the aircraft overlap
+/// </summary>
+enum class FlightDataRecorderAircraft : uint8_t {
+  Unknown = 0,
+  A32NX = 1,
+  A380X = 2,
+};
+
+/// <summary>
+/// Header at the start of a flight data recorder file, older recordings are gzip files without this header. When the records are
+/// transformed, the header is followed by a FlightDataRecorderRecordLayout.
+/// </summary>
+struct FlightDataRecorderFileHeader {
+  static constexpr char MAGIC[4] = {'F', 'D', 'R', 1};
+
+  char magic[4];
+  FlightDataRecorderCodec codec;
+  int8_t level;
+  FlightDataRecorderTransform transform;
+  // the byte was reserved in the first files with this header and is unknown there
+  FlightDataRecorderAircraft aircraft;
+};
+
+/// <summary>
+/// Header of each block following the file header, every block is compressed on its own so that a reader can decode all blocks
+/// of a file which is still being written
+/// </summary>
+struct FlightDataRecorderBlockHeader {
+  uint32_t size;
+  uint32_t storedSize;
+};
+
+/// <summary>
+/// Writes the records of the flight data recorder into blocks which are compressed with the selected codec
+/// </summary>
+class FlightDataRecorderFile {
+ public:
+  /// <summary>
+  /// Uncompressed size after which a block is written, blocks of transformed records end with a complete record
+  /// </summary>
+  static constexpr size_t BLOCK_SIZE = 128 * 1024;
+
+  FlightDataRecorderFile() = default;
+  FlightDataRecorderFile(const FlightDataRecorderFile&) = delete;
+  FlightDataRecorderFile& operator=(const FlightDataRecorderFile&) = delete;
+  ~FlightDataRecorderFile();
+
+  /// <summary>
+  /// Parses the name of a codec as used in the configuration, returns false when the name is unknown
+  /// </summary>
+  static bool parseCodec(const std::string& name, FlightDataRecorderCodec& codec);
+
+  /// <summary>
+  /// Creates the file and writes the file header
+  /// </summary>
+  /// <param name="aircraft">Aircraft writing the file, needed to find the schema of the interface version.</param>
+  /// <param name="level">Compression level of the codec, the level of zstd for the fast codec and of zlib for deflate.</param>
+  /// <param name="transform">Transform of the records before compression.</param>
+  /// <param name="layout">Position and size of the records, only needed when the records are transformed.</param>
+  /// <returns>False when the file or the compression context could not be created.</returns>
+  bool open(const std::string& filePath,
+            FlightDataRecorderAircraft aircraft,
+            FlightDataRecorderCodec codec,
+            int level,
+            FlightDataRecorderTransform transform = FlightDataRecorderTransform::None,
+            const FlightDataRecorderRecordLayout& layout = {});
+
+  bool isOpen() const { return file != nullptr; }
+
+  /// <summary>
+  /// Appends data to the current block, the block is compressed and written when it is full
+  /// </summary>
+  void write(const void* data, size_t size);
+
+  /// <summary>
+  /// Compresses and writes the current block even when it is not full, so that all data written so far can be read
+  /// </summary>
+  void flush();
+
+  void close();
+
+ private:
+  FILE* file = nullptr;
+  FlightDataRecorderCodec codec = FlightDataRecorderCodec::Store;
+  int level = 0;
+  FlightDataRecorderTransform transform = FlightDataRecorderTransform::None;
+  FlightDataRecorderRecordLayout layout = {};
+  uint64_t position = 0;
+  ZSTD_CCtx* zstdContext = nullptr;
+  z_stream deflateStream = {};
+  bool isDeflateStreamInitialized = false;
+  std::vector<char> block;
+  std::vector<char> compressedBlock;
+  std::vector<char> transformBuffer;
+
+  void writeBlock();
+};
@@ -0,0 +1,198 @@
+#include "FlightDataRecorderSampler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+
+static const struct {
+  const char* name;
+  uint64_t trigger;
+} TRIGGER_NAMES[] = {
+    {"ap_disconnect", FDR_TRIGGER_AUTOPILOT_DISCONNECT},
+    {"law_degradation", FDR_TRIGGER_LAW_DEGRADATION},
+    {"master_warning", FDR_TRIGGER_MASTER_WARNING},
+    {"bank_angle", FDR_TRIGGER_BANK_ANGLE},
+    {"pitch_angle", FDR_TRIGGER_PITCH_ANGLE},
+    {"overspeed", FDR_TRIGGER_OVERSPEED},
+    {"alpha_protection", FDR_TRIGGER_ALPHA_PROTECTION},
+    {"all", FDR_TRIGGER_ALL},
+    {"none", 0},
+};
+
+void FlightDataRecorderSampler::initialize(const FlightDataRecorderSamplerConfiguration& configuration) {
+  this->configuration = configuration;
+
+  // without decimation every frame is written right away
+  if (configuration.baseRateHz <= 0) {
+    this->configuration.preTriggerSeconds = 0;
+  }
+  capacity = static_cast<size_t>(std::ceil(this->configuration.preTriggerSeconds * MAXIMUM_FRAME_RATE)) + 1;
+
+  recordSize = 0;
+  records.clear();
+  slots.assign(capacity, Slot{});
+  first = 0;
+  count = 0;
+  isFinishing = false;
+  time = 0;
+  nextBaseSampleTime = 0;
+  burstEndTime = -1;
+  burstTriggers = 0;
+  hasPreviousInputs = false;
+}
+
+bool FlightDataRecorderSampler::parseTriggers(const std::string& names, uint64_t& triggers, std::string& unknownName) {
+  triggers = 0;
+  size_t start = 0;
+  while (start <= names.size()) {
+    size_t end = std::min(names.find(',', start), names.size());
+    std::string name;
+    for (size_t i = start; i < end; i++) {
+      if (!std::isspace(static_cast<unsigned char>(names[i]))) {
+        name += static_cast<char>(std::tolower(static_cast<unsigned char>(names[i])));
+      }
+    }
+    start = end + 1;
+    if (name.empty()) {
+      continue;
+    }
+
+    auto entry = std::find_if(std::begin(TRIGGER_NAMES), std::end(TRIGGER_NAMES), [&](const auto& entry) { return name == entry.name; });
+    if (entry == std::end(TRIGGER_NAMES)) {
+      unknownName = name;
+      return false;
+    }
+    triggers |= entry->trigger;
+  }
+  return true;
+}
+
+char* FlightDataRecorderSampler::beginRecord(size_t recordSize) {
+  if (recordSize != this->recordSize) {
+    this->recordSize = recordSize;
+    records.assign(capacity * recordSize, 0);
+    first = 0;
+    count = 0;
+  }
+
+  // the records due were not taken, the oldest one is dropped
+  if (count == capacity) {
+    first = (first + 1) % capacity;
+    count--;
+  }
+  return records.data() + ((first + count) % capacity) * recordSize;
+}
+
+void FlightDataRecorderSampler::endRecord(double deltaTime, const FlightDataRecorderTriggerInputs& inputs) {
+  time += deltaTime;
+  uint64_t triggers = evaluateTriggers(inputs);
+  previousInputs = inputs;
+  hasPreviousInputs = true;
+
+  if (time > burstEndTime) {
+    burstTriggers = 0;
+  }
+  if (triggers != 0) {
+    burstTriggers |= triggers;
+    burstEndTime = time + configuration.postTriggerSeconds;
+
+    // the records of the pre-trigger time join the burst, the records before one which already has these triggers were
+    // marked by an earlier trigger
+    for (size_t i = count; i > 0; i--) {
+      Slot& slot = slots[(first + i - 1) % capacity];
+      if (time - slot.time > configuration.preTriggerSeconds || (slot.triggers & triggers) == triggers) {
+        break;
+      }
+      slot.triggers |= triggers;
+    }
+  }
+
+  slots[(first + count) % capacity] = {time, deltaTime, burstTriggers};
+  count++;
+}
+
+const char* FlightDataRecorderSampler::nextRecord() {
+  while (count > 0) {
+    const Slot& slot = slots[first];
+
+    // records leave the delay line after the pre-trigger time, earlier when it is full
+    if (!isFinishing && count < capacity && time - slot.time < configuration.preTriggerSeconds) {
+      return nullptr;
+    }
+
+    char* record = records.data() + first * recordSize;
+    first = (first + 1) % capacity;
+    count--;
+
+    FlightDataRecorderSampling sampling;
+    if (isDue(slot, sampling)) {
+      std::memcpy(record + recordSize - sizeof(sampling), &sampling, sizeof(sampling));
+      return record;
+    }
+  }
+
+  isFinishing = false;
+  return nullptr;
+}
+
+void FlightDataRecorderSampler::finish() {
+  isFinishing = true;
+}
+
+uint64_t FlightDataRecorderSampler::evaluateTriggers(const FlightDataRecorderTriggerInputs& inputs) const {
+  uint64_t triggers = 0;
+
+  // events are detected on the transition
+  if (hasPreviousInputs) {
+    if (previousInputs.isAutopilotEngaged && !inputs.isAutopilotEngaged) {
+      triggers |= FDR_TRIGGER_AUTOPILOT_DISCONNECT;
+    }
+    if (previousInputs.isNormalLawActive && !inputs.isNormalLawActive) {
+      triggers |= FDR_TRIGGER_LAW_DEGRADATION;
+    }
+    if (!previousInputs.isMasterWarningActive && inputs.isMasterWarningActive) {
+      triggers |= FDR_TRIGGER_MASTER_WARNING;
+    }
+  }
+
+  // exceedances trigger in every frame they last
+  if (std::abs(inputs.bankAngleDeg) > configuration.maximumBankAngleDeg) {
+    triggers |= FDR_TRIGGER_BANK_ANGLE;
+  }
+  if (inputs.pitchAngleDeg < configuration.minimumPitchAngleDeg || inputs.pitchAngleDeg > configuration.maximumPitchAngleDeg) {
+    triggers |= FDR_TRIGGER_PITCH_ANGLE;
+  }
+  if (inputs.maximumAirspeedKn > 0 && inputs.airspeedKn > inputs.maximumAirspeedKn + configuration.overspeedMarginKn) {
+    triggers |= FDR_TRIGGER_OVERSPEED;
+  }
+  if (inputs.isAlphaProtectionActive) {
+    triggers |= FDR_TRIGGER_ALPHA_PROTECTION;
+  }
+
+  return triggers & configuration.triggers;
+}
+
+bool FlightDataRecorderSampler::isDue(const Slot& slot, FlightDataRecorderSampling& sampling) {
+  double frameRate = slot.deltaTime > 0 ? 1.0 / slot.deltaTime : 0;
+
+  // a base sample is due in the frame closest to the sample time
+  bool isBaseSampleDue = slot.time + 0.5 * slot.deltaTime >= nextBaseSampleTime;
+  if (configuration.baseRateHz > 0 && isBaseSampleDue) {
+    double period = 1.0 / configuration.baseRateHz;
+    nextBaseSampleTime += period;
+    if (nextBaseSampleTime <= slot.time) {
+      nextBaseSampleTime = slot.time + period;
+    }
+  }
+
+  if (slot.triggers != 0 || configuration.baseRateHz <= 0) {
+    sampling = {frameRate, slot.triggers};
+    return true;
+  }
+  if (isBaseSampleDue) {
+    sampling = {std::min(configuration.baseRateHz, frameRate), 0};
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Appended to every record by the sampler, so that a reader knows at which rate the record was written and why
+/// </summary>
+struct FlightDataRecorderSampling {
+  // rate of the records around this one, the frame rate in a burst and the base rate otherwise
+  double rate_hz;
+  // triggers of the burst the record belongs to as FlightDataRecorderTrigger bits, 0 for records at the base rate
+  uint64_t triggers;
+};
+
+/// <summary>
+/// Conditions which start a burst of records at the full frame rate
+/// </summary>
+enum FlightDataRecorderTrigger : uint64_t {
+  FDR_TRIGGER_AUTOPILOT_DISCONNECT = 1 << 0,
+  FDR_TRIGGER_LAW_DEGRADATION = 1 << 1,
+  FDR_TRIGGER_MASTER_WARNING = 1 << 2,
+  FDR_TRIGGER_BANK_ANGLE = 1 << 3,
+  FDR_TRIGGER_PITCH_ANGLE = 1 << 4,
+  FDR_TRIGGER_OVERSPEED = 1 << 5,
+  FDR_TRIGGER_ALPHA_PROTECTION = 1 << 6,
+  FDR_TRIGGER_ALL = (1 << 7) - 1,
+};
+
+/// <summary>
+/// State of the aircraft the triggers are evaluated on, filled by the recorder of each aircraft
+/// </summary>
+struct FlightDataRecorderTriggerInputs {
+  bool isAutopilotEngaged;
+  bool isNormalLawActive;
+  bool isMasterWarningActive;
+  bool isAlphaProtectionActive;
+  double bankAngleDeg;
+  double pitchAngleDeg;
+  double airspeedKn;
+  double maximumAirspeedKn;
+};
+
+struct FlightDataRecorderSamplerConfiguration {
+  // rate of the records outside of bursts, 0 records every frame
+  double baseRateHz = 0;
+  double preTriggerSeconds = 0;
+  double postTriggerSeconds = 0;
+  uint64_t triggers = FDR_TRIGGER_ALL;
+  // exceedances keep the burst going for as long as they last
+  double maximumBankAngleDeg = 45;
+  double minimumPitchAngleDeg = -15;
+  double maximumPitchAngleDeg = 30;
+  double overspeedMarginKn = 4;
+};
+
+/// <summary>
+/// Decides which frames the flight data recorder writes. In steady state the records are decimated to the base rate,
+/// a trigger writes every frame from the pre-trigger time before it until the post-trigger time after it.
+/// All records pass a delay line of the pre-trigger time, so that the frames before a trigger are still available when
+/// it fires and the records leave in the order of the frames.
+/// </summary>
+class FlightDataRecorderSampler {
+ public:
+  /// <summary>
+  /// Frame rate up to which the delay line holds the whole pre-trigger time, at higher rates it holds less
+  /// </summary>
+  static constexpr double MAXIMUM_FRAME_RATE = 60;
+
+  void initialize(const FlightDataRecorderSamplerConfiguration& configuration);
+
+  /// <summary>
+  /// Parses a comma separated list of trigger names as used in the configuration, returns false and the name when a
+  /// name is unknown
+  /// </summary>
+  static bool parseTriggers(const std::string& names, uint64_t& triggers, std::string& unknownName);
+
+  /// <summary>
+  /// Returns the memory for the record of the current frame, the last bytes are left for the FlightDataRecorderSampling
+  /// </summary>
+  /// <param name="recordSize">Size of the record including the FlightDataRecorderSampling.</param>
+  char* beginRecord(size_t recordSize);
+
+  /// <summary>
+  /// Evaluates the triggers on the state of the current frame and adds its record to the delay line
+  /// </summary>
+  /// <param name="deltaTime">Simulation time since the last frame in seconds.</param>
+  void endRecord(double deltaTime, const FlightDataRecorderTriggerInputs& inputs);
+
+  /// <summary>
+  /// Returns the next record to write or nullptr when no record is due, the record stays valid until the next call
+  /// to beginRecord
+  /// </summary>
+  const char* nextRecord();
+
+  /// <summary>
+  /// Lets all records leave the delay line, e.g. before the recorder terminates
+  /// </summary>
+  void finish();
+
+ private:
+  struct Slot {
+    double time;
+    double deltaTime;
+    uint64_t triggers;
+  };
+
+  FlightDataRecorderSamplerConfiguration configuration;
+  size_t recordSize = 0;
+  size_t capacity = 1;
+  std::vector<char> records;
+  std::vector<Slot> slots;
+  size_t first = 0;
+  size_t count = 0;
+  bool isFinishing = false;
+
+  double time = 0;
+  double nextBaseSampleTime = 0;
+  double burstEndTime = -1;
+  uint64_t burstTriggers = 0;
+  bool hasPreviousInputs = false;
+  FlightDataRecorderTriggerInputs previousInputs = {};
+
+  uint64_t evaluateTriggers(const FlightDataRecorderTriggerInputs& inputs) const;
+
+  bool isDue(const Slot& slot, FlightDataRecorderSampling& sampling);
+};
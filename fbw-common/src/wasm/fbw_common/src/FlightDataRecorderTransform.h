@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Reversible transforms applied to the records of a block before compression. Consecutive records differ in few bytes, the xor with
+/// the previous record turns unchanged bytes into zeros and the shuffle groups each byte position of the records into one plane, so
+/// that the mode flags and the upper bytes of slowly changing doubles end up in long runs of equal bytes.
+/// </summary>
+enum class FlightDataRecorderTransform : uint8_t {
+  None = 0,
+  Xor = 1,
+  Shuffle = 2,
+  XorShuffle = 3,
+};
+
+/// <summary>
+/// Position of the records in the uncompressed stream, the bytes before the first record are not transformed
+/// </summary>
+struct FlightDataRecorderRecordLayout {
+  uint32_t offset;
+  uint32_t size;
+};
+
+/// <summary>
+/// Parses the name of a transform as used in the configuration, returns false when the name is unknown
+/// </summary>
+inline bool parseFlightDataRecorderTransform(const std::string& name, FlightDataRecorderTransform& transform) {
+  std::string lowerCaseName = name;
+  std::transform(lowerCaseName.begin(), lowerCaseName.end(), lowerCaseName.begin(), [](unsigned char c) { return std::tolower(c); });
+  if (lowerCaseName == "none") {
+    transform = FlightDataRecorderTransform::None;
+  } else if (lowerCaseName == "xor") {
+    transform = FlightDataRecorderTransform::Xor;
+  } else if (lowerCaseName == "shuffle") {
+    transform = FlightDataRecorderTransform::Shuffle;
+  } else if (lowerCaseName == "xor_shuffle") {
+    transform = FlightDataRecorderTransform::XorShuffle;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/// <summary>
+/// Returns the number of bytes of a block before its first record starts
+/// </summary>
+/// <param name="blockPosition">Position of the first byte of the block in the uncompressed stream.</param>
+inline size_t getFlightDataRecorderFirstRecord(uint64_t blockPosition, const FlightDataRecorderRecordLayout& layout) {
+  if (blockPosition <= layout.offset) {
+    return layout.offset - blockPosition;
+  }
+  uint64_t remainder = (blockPosition - layout.offset) % layout.size;
+  return remainder == 0 ? 0 : layout.size - remainder;
+}
+
+/// <summary>
+/// Transposes a matrix of bytes, byte c of row r becomes byte r of row c in the destination. Tiles of 8 x 8 bytes are transposed
+/// in registers, which is several times faster than moving single bytes between rows far apart.
+/// </summary>
+inline void transposeFlightDataRecorderBytes(const char* source, size_t rows, size_t columns, char* destination) {
+  size_t tileRows = rows - rows % 8;
+  size_t tileColumns = columns - columns % 8;
+  for (size_t r = 0; r < tileRows; r += 8) {
+    for (size_t c = 0; c < tileColumns; c += 8) {
+      uint64_t x[8];
+      for (size_t k = 0; k < 8; k++) {
+        std::memcpy(&x[k], source + (r + k) * columns + c, sizeof(uint64_t));
+      }
+      // swaps the off-diagonal blocks of 4 x 4, 2 x 2 and 1 x 1 bytes, the bytes of a row are in little endian order
+      for (size_t k = 0; k < 4; k++) {
+        uint64_t t = ((x[k] >> 32) ^ x[k + 4]) & 0x00000000FFFFFFFFull;
+        x[k] ^= t << 32;
+        x[k + 4] ^= t;
+      }
+      for (size_t k : {0, 1, 4, 5}) {
+        uint64_t t = ((x[k] >> 16) ^ x[k + 2]) & 0x0000FFFF0000FFFFull;
+        x[k] ^= t << 16;
+        x[k + 2] ^= t;
+      }
+      for (size_t k : {0, 2, 4, 6}) {
+        uint64_t t = ((x[k] >> 8) ^ x[k + 1]) & 0x00FF00FF00FF00FFull;
+        x[k] ^= t << 8;
+        x[k + 1] ^= t;
+      }
+      for (size_t k = 0; k < 8; k++) {
+        std::memcpy(destination + (c + k) * rows + r, &x[k], sizeof(uint64_t));
+      }
+    }
+  }
+
+  // remaining bytes at the right and bottom edge
+  for (size_t r = 0; r < rows; r++) {
+    for (size_t c = r < tileRows ? tileColumns : 0; c < columns; c++) {
+      destination[c * rows + r] = source[r * columns + c];
+    }
+  }
+}
+
+/// <summary>
+/// Transforms the complete records of a block in place, the first record of a block is kept so that every block can be decoded on
+/// its own
+/// </summary>
+inline void encodeFlightDataRecorderRecords(char* records,
+                                            size_t count,
+                                            size_t recordSize,
+                                            FlightDataRecorderTransform transform,
+                                            std::vector<char>& scratch) {
+  if (count == 0) {
+    return;
+  }
+
+  if (static_cast<uint8_t>(transform) & static_cast<uint8_t>(FlightDataRecorderTransform::Xor)) {
+    // backwards so that the previous record is still unchanged
+    for (size_t i = count - 1; i > 0; i--) {
+      char* record = records + i * recordSize;
+      const char* previousRecord = record - recordSize;
+      for (size_t j = 0; j < recordSize; j++) {
+        record[j] ^= previousRecord[j];
+      }
+    }
+  }
+
+  if (static_cast<uint8_t>(transform) & static_cast<uint8_t>(FlightDataRecorderTransform::Shuffle)) {
+    // byte j of record i becomes byte i of plane j
+    scratch.resize(count * recordSize);
+    transposeFlightDataRecorderBytes(records, count, recordSize, scratch.data());
+    std::memcpy(records, scratch.data(), scratch.size());
+  }
+}
+
+/// <summary>
+/// Reverts encodeFlightDataRecorderRecords()
+/// </summary>
+inline void decodeFlightDataRecorderRecords(char* records,
+                                            size_t count,
+                                            size_t recordSize,
+                                            FlightDataRecorderTransform transform,
+                                            std::vector<char>& scratch) {
+  if (count == 0) {
+    return;
+  }
+
+  if (static_cast<uint8_t>(transform) & static_cast<uint8_t>(FlightDataRecorderTransform::Shuffle)) {
+    scratch.resize(count * recordSize);
+    transposeFlightDataRecorderBytes(records, recordSize, count, scratch.data());
+    std::memcpy(records, scratch.data(), scratch.size());
+  }
+
+  if (static_cast<uint8_t>(transform) & static_cast<uint8_t>(FlightDataRecorderTransform::Xor)) {
+    for (size_t i = 1; i < count; i++) {
+      char* record = records + i * recordSize;
+      const char* previousRecord = record - recordSize;
+      for (size_t j = 0; j < recordSize; j++) {
+        record[j] ^= previousRecord[j];
+      }
+    }
+  }
+}
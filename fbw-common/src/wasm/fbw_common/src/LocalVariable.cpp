@@ -5,24 +5,23 @@ using std::endl;
 using std::set;
 using std::string;
 
-set<LocalVariable*> LocalVariable::LOCAL_VARIABLES;
+set<LocalVariable*> LocalVariable::REGISTERED_VARIABLES;
+set<LocalVariable*> LocalVariable::PENDING_VARIABLES;
 
 LocalVariable::LocalVariable(const string& variable, bool shouldUseDirtyState) {
   // initialize variables
   useDirtyState = shouldUseDirtyState;
   isDirty = false;
+  isRegistered = false;
   value = 0.0;
   name = variable;
-  // register variable
-  id = register_named_variable(name.c_str());
-  // read current value
-  read();
-  // remember in global list (for readAll)
-  LOCAL_VARIABLES.insert(this);
+  // registration is deferred until the first use, readAll and writeAll only cover registered variables
+  PENDING_VARIABLES.insert(this);
 }
 
 LocalVariable::~LocalVariable() {
-  LOCAL_VARIABLES.erase(this);
+  REGISTERED_VARIABLES.erase(this);
+  PENDING_VARIABLES.erase(this);
 }
 
 string LocalVariable::getName() {
@@ -30,6 +29,7 @@ string LocalVariable::getName() {
 }
 
 double LocalVariable::get(bool shouldRead) {
+  ensureRegistered();
   if (shouldRead) {
     read();
   }
@@ -39,12 +39,15 @@ double LocalVariable::get(bool shouldRead) {
 void LocalVariable::set(double newValue, bool shouldWrite) {
   value = newValue;
   isDirty = true;
+  // a set value has to reach the simulator with the next writeAll
+  ensureRegistered();
   if (shouldWrite) {
     write();
   }
 }
 
 void LocalVariable::read() {
+  ensureRegistered();
   value = get_named_variable_value(id);
 }
 
@@ -52,18 +55,51 @@ void LocalVariable::write() {
   if (useDirtyState && !isDirty) {
     return;
   }
+  ensureRegistered();
   set_named_variable_value(id, value);
   isDirty = false;
 }
 
 void LocalVariable::readAll() {
-  for (auto variable : LOCAL_VARIABLES) {
+  for (auto variable : REGISTERED_VARIABLES) {
     variable->read();
   }
 }
 
 void LocalVariable::writeAll() {
-  for (auto variable : LOCAL_VARIABLES) {
+  for (auto variable : REGISTERED_VARIABLES) {
     variable->write();
   }
 }
+
+size_t LocalVariable::registerPending(size_t maxCount) {
+  size_t count = 0;
+  while (count < maxCount && !PENDING_VARIABLES.empty()) {
+    (*PENDING_VARIABLES.begin())->ensureRegistered();
+    count++;
+  }
+  return count;
+}
+
+size_t LocalVariable::getCount() {
+  return REGISTERED_VARIABLES.size() + PENDING_VARIABLES.size();
+}
+
+size_t LocalVariable::getRegisteredCount() {
+  return REGISTERED_VARIABLES.size();
+}
+
+void LocalVariable::ensureRegistered() {
+  if (isRegistered) {
+    return;
+  }
+  // register variable
+  id = register_named_variable(name.c_str());
+  isRegistered = true;
+  PENDING_VARIABLES.erase(this);
+  REGISTERED_VARIABLES.insert(this);
+  // read current value unless a value has already been set, as if the variable had been registered on construction
+  if (!isDirty) {
+    value = get_named_variable_value(id);
+  }
+}
@@ -7,6 +7,11 @@
 
 #include <MSFS/Legacy/gauges.h>
 
+/// <summary>
+/// Named local variable of the simulator.
+/// The variable is registered on its first use or by registerPending, which keeps the construction of the hundreds of
+/// variables of an interface cheap and avoids registering variables which are only used in some configurations.
+/// </summary>
 class LocalVariable {
  public:
   explicit LocalVariable(const std::string& name, bool shouldUseDirtyState = true);
@@ -20,15 +25,35 @@ class LocalVariable {
   void read();
   void write();
 
+  /// <summary>
+  /// Reads or writes all registered variables, variables which have not been used yet are left pending
+  /// </summary>
   static void readAll();
   static void writeAll();
 
+  /// <summary>
+  /// Registers variables which have not been used yet, to spread their registration over several frames
+  /// </summary>
+  /// <param name="maxCount">Maximum number of variables to register.</param>
+  /// <returns>Number of variables registered.</returns>
+  static size_t registerPending(size_t maxCount);
+
+  /// <summary>
+  /// Number of existing variables and how many of them have been registered
+  /// </summary>
+  static size_t getCount();
+  static size_t getRegisteredCount();
+
  private:
-  static std::set<LocalVariable*> LOCAL_VARIABLES;
+  static std::set<LocalVariable*> REGISTERED_VARIABLES;
+  static std::set<LocalVariable*> PENDING_VARIABLES;
 
   ID id;
   std::string name;
   bool useDirtyState;
   bool isDirty;
+  bool isRegistered;
   double value;
+
+  void ensureRegistered();
 };
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/// <summary>
+/// Header which precedes the state in a snapshot blob.
+/// The state is stored as a flat copy of its memory, so a blob can only be restored by a build with the same layout.
+/// </summary>
+struct ModelSnapshotHeader {
+  static constexpr uint32_t MAGIC = 0x53574246;  // "FBWS"
+  static constexpr uint32_t VERSION = 1;
+
+  uint32_t magic;
+  uint32_t version;
+  // kind of the state, e.g. the computer it was taken from
+  uint32_t id;
+  // size of the state following the header
+  uint32_t size;
+};
+
+/// <summary>
+/// Size of the blob required for a snapshot of the given state type
+/// </summary>
+template <typename State>
+constexpr size_t getModelSnapshotSize() {
+  return sizeof(ModelSnapshotHeader) + sizeof(State);
+}
+
+/// <summary>
+/// Writes a snapshot blob of the given state
+/// </summary>
+/// <param name="state">State to store, must be trivially copyable.</param>
+/// <param name="id">Kind of the state, checked when the blob is read.</param>
+/// <param name="buffer">Destination of the blob.</param>
+/// <param name="bufferSize">Size of the destination, at least getModelSnapshotSize&lt;State&gt;().</param>
+/// <returns>False if the buffer is too small.</returns>
+template <typename State>
+bool writeModelSnapshot(const State& state, uint32_t id, void* buffer, size_t bufferSize) {
+  static_assert(std::is_trivially_copyable_v<State>, "snapshot states are stored as a flat copy of their memory");
+
+  if (bufferSize < getModelSnapshotSize<State>()) {
+    return false;
+  }
+
+  ModelSnapshotHeader header = {ModelSnapshotHeader::MAGIC, ModelSnapshotHeader::VERSION, id, static_cast<uint32_t>(sizeof(State))};
+  std::memcpy(buffer, &header, sizeof(header));
+  std::memcpy(static_cast<unsigned char*>(buffer) + sizeof(header), &state, sizeof(State));
+  return true;
+}
+
+/// <summary>
+/// Reads a snapshot blob written by writeModelSnapshot
+/// </summary>
+/// <param name="state">Destination of the state, left untouched if the blob does not match.</param>
+/// <param name="id">Expected kind of the state.</param>
+/// <param name="buffer">The blob.</param>
+/// <param name="bufferSize">Size of the blob.</param>
+/// <returns>False if the blob has been written for another state, version or layout.</returns>
+template <typename State>
+bool readModelSnapshot(State& state, uint32_t id, const void* buffer, size_t bufferSize) {
+  static_assert(std::is_trivially_copyable_v<State>, "snapshot states are stored as a flat copy of their memory");
+
+  if (bufferSize < getModelSnapshotSize<State>()) {
+    return false;
+  }
+
+  ModelSnapshotHeader header;
+  std::memcpy(&header, buffer, sizeof(header));
+  if (header.magic != ModelSnapshotHeader::MAGIC || header.version != ModelSnapshotHeader::VERSION || header.id != id ||
+      header.size != sizeof(State)) {
+    return false;
+  }
+
+  std::memcpy(&state, static_cast<const unsigned char*>(buffer) + sizeof(header), sizeof(State));
+  return true;
+}
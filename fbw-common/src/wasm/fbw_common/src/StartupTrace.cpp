@@ -0,0 +1,34 @@
+#include "StartupTrace.h"
+
+#include <iomanip>
+#include <iostream>
+
+StartupTrace::StartupTrace(const std::string& name)
+    : name(name), startTime(std::chrono::steady_clock::now()), phaseStartTime(startTime) {}
+
+void StartupTrace::beginPhase(const std::string& phase) {
+  endPhase();
+  currentPhase = phase;
+}
+
+void StartupTrace::finish() {
+  endPhase();
+
+  double totalDuration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "WASM: STARTUP   : " << name << " took " << totalDuration << " ms" << std::endl;
+  for (const auto& phase : phases) {
+    std::cout << "WASM: STARTUP   :   " << std::left << std::setw(32) << phase.name << std::right << std::setw(10) << phase.duration
+              << " ms" << std::endl;
+  }
+  std::cout << std::defaultfloat;
+}
+
+void StartupTrace::endPhase() {
+  auto now = std::chrono::steady_clock::now();
+  if (!currentPhase.empty()) {
+    phases.push_back({currentPhase, std::chrono::duration<double, std::milli>(now - phaseStartTime).count()});
+    currentPhase.clear();
+  }
+  phaseStartTime = now;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Measures the time spent in the phases of a startup sequence and prints them as a report
+/// </summary>
+class StartupTrace {
+ public:
+  /// <param name="name">Name of the startup sequence used in the report.</param>
+  explicit StartupTrace(const std::string& name);
+
+  /// <summary>
+  /// Ends the current phase and begins the next one
+  /// </summary>
+  void beginPhase(const std::string& phase);
+
+  /// <summary>
+  /// Ends the current phase and prints the time of each phase
+  /// </summary>
+  void finish();
+
+ private:
+  struct Phase {
+    std::string name;
+    double duration;
+  };
+
+  const std::string name;
+  std::chrono::steady_clock::time_point startTime;
+  std::chrono::steady_clock::time_point phaseStartTime;
+  std::string currentPhase;
+  std::vector<Phase> phases;
+
+  void endPhase();
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#ifdef FBW_FAST_TRIG
+#include "FastTrig.h"
+#endif
+
+/// <summary>
+/// Remembers the results of the trigonometric functions for the last arguments.
+/// The generated autopilot models evaluate the same angles (pitch, bank, track to heading difference, flight path) in
+/// many blocks of a step. A lookup compares the bits of the argument, so the result is identical to calling the
+/// function again. The guidance functions are used for the terms which may be approximated, the great circle distances to
+/// the navaids. With FBW_FAST_TRIG they are evaluated with the kernels of FastTrig.h instead of the library, all other
+/// functions always use the library. The calls in the generated models are replaced by tools/model-patches/trig_cache.py
+/// after each code generation.
+/// </summary>
+class TrigCache {
+ public:
+  double sin(double x) { return sinValues.get(x, &evaluateSin); }
+  double cos(double x) { return cosValues.get(x, &evaluateCos); }
+  double tan(double x) { return tanValues.get(x, &evaluateTan); }
+  double atan(double x) { return atanValues.get(x, &evaluateAtan); }
+  double asin(double x) { return asinValues.get(x, &evaluateAsin); }
+  double guidanceSin(double x) { return guidanceSinValues.get(x, &evaluateGuidanceSin); }
+  double guidanceCos(double x) { return guidanceCosValues.get(x, &evaluateGuidanceCos); }
+
+ private:
+  static constexpr int SIZE = 4;
+
+  class Values {
+   public:
+    double get(double x, double (*evaluate)(double)) {
+      uint64_t key;
+      std::memcpy(&key, &x, sizeof(key));
+      for (int i = 0; i < count; i++) {
+        if (keys[i] == key) {
+          return results[i];
+        }
+      }
+
+      double result = evaluate(x);
+      keys[next] = key;
+      results[next] = result;
+      next = (next + 1) % SIZE;
+      if (count < SIZE) {
+        count++;
+      }
+      return result;
+    }
+
+   private:
+    uint64_t keys[SIZE];
+    double results[SIZE];
+    int count = 0;
+    int next = 0;
+  };
+
+  Values sinValues;
+  Values cosValues;
+  Values tanValues;
+  Values atanValues;
+  Values asinValues;
+  // separate from the exact values, the same argument may be used by both
+  Values guidanceSinValues;
+  Values guidanceCosValues;
+
+  static double evaluateSin(double x) { return std::sin(x); }
+  static double evaluateCos(double x) { return std::cos(x); }
+  static double evaluateTan(double x) { return std::tan(x); }
+  static double evaluateAtan(double x) { return std::atan(x); }
+  static double evaluateAsin(double x) { return std::asin(x); }
+#ifdef FBW_FAST_TRIG
+  static double evaluateGuidanceSin(double x) { return FastTrig::sin(x); }
+  static double evaluateGuidanceCos(double x) { return FastTrig::cos(x); }
+#else
+  static double evaluateGuidanceSin(double x) { return std::sin(x); }
+  static double evaluateGuidanceCos(double x) { return std::cos(x); }
+#endif
+};
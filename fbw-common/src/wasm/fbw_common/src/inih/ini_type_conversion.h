@@ -15,6 +15,16 @@ class INITypeConversion {
     return getBooleanFromString(structure.get(section).get(key));
   }
 
+  static std::string getString(mINI::INIStructure structure,
+                               const std::string& section,
+                               const std::string& key,
+                               const std::string& defaultValue = "") {
+    if (!structure.has(section) || !structure.get(section).has(key)) {
+      return defaultValue;
+    }
+    return structure.get(section).get(key);
+  }
+
   static double getDouble(mINI::INIStructure structure, const std::string& section, const std::string& key, double defaultValue = 0.0) {
     if (!structure.has(section) || !structure.get(section).has(key)) {
       return defaultValue;
@@ -3,6 +3,7 @@
 #include "look1_binlxpw.h"
 #include "mod_mvZvttxs.h"
 #include "rt_modd.h"
+#include "TrigCache.h"
 
 const uint8_T AutopilotLaws_IN_any{ 1U };
 
@@ -478,6 +479,7 @@ void AutopilotLawsModelClass::step()
   int32_T rtb_fpmtoms;
   int32_T rtb_on_ground;
   boolean_T guard1{ false };
+  TrigCache trigCache;
 
   boolean_T rtb_Compare_jy;
   boolean_T rtb_Compare_l;
@@ -489,9 +491,9 @@ void AutopilotLawsModelClass::step()
   rtb_GainTheta1 = AutopilotLaws_P.GainTheta1_Gain * AutopilotLaws_U.in.data.Phi_deg;
   b_R = 0.017453292519943295 * rtb_GainTheta;
   rtb_dme = 0.017453292519943295 * rtb_GainTheta1;
-  Phi2 = std::tan(b_R);
-  a = std::sin(rtb_dme);
-  rtb_dme = std::cos(rtb_dme);
+  Phi2 = trigCache.tan(b_R);
+  a = trigCache.sin(rtb_dme);
+  rtb_dme = trigCache.cos(rtb_dme);
   result_tmp[0] = 1.0;
   result_tmp[3] = a * Phi2;
   result_tmp[6] = rtb_dme * Phi2;
@@ -499,7 +501,7 @@ void AutopilotLawsModelClass::step()
   result_tmp[4] = rtb_dme;
   result_tmp[7] = -a;
   result_tmp[2] = 0.0;
-  distance_m = std::cos(b_R);
+  distance_m = trigCache.cos(b_R);
   rtb_Add3_j4 = 1.0 / distance_m;
   result_tmp[5] = rtb_Add3_j4 * a;
   result_tmp[8] = rtb_Add3_j4 * rtb_dme;
@@ -511,7 +513,7 @@ void AutopilotLawsModelClass::step()
       result_tmp[rtb_on_ground + 6] * Phi2;
   }
 
-  rtb_error_d = std::sin(b_R);
+  rtb_error_d = trigCache.sin(b_R);
   result_tmp[0] = distance_m;
   result_tmp[3] = 0.0;
   result_tmp[6] = -rtb_error_d;
@@ -530,11 +532,11 @@ void AutopilotLawsModelClass::step()
   if (AutopilotLaws_U.in.data.nav_dme_valid != 0.0) {
     rtb_dme = AutopilotLaws_U.in.data.nav_dme_nmi;
   } else if (AutopilotLaws_U.in.data.nav_loc_valid) {
-    a = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
+    a = trigCache.guidanceSin((AutopilotLaws_U.in.data.nav_loc_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
                  0.017453292519943295 / 2.0);
-    distance_m = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon)
+    distance_m = trigCache.guidanceSin((AutopilotLaws_U.in.data.nav_loc_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon)
                           * 0.017453292519943295 / 2.0);
-    a = std::cos(0.017453292519943295 * AutopilotLaws_U.in.data.aircraft_position.lat) * std::cos(0.017453292519943295 *
+    a = trigCache.guidanceCos(0.017453292519943295 * AutopilotLaws_U.in.data.aircraft_position.lat) * trigCache.guidanceCos(0.017453292519943295 *
       AutopilotLaws_U.in.data.nav_loc_position.lat) * distance_m * distance_m + a * a;
     rtb_dme = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
     distance_m = AutopilotLaws_U.in.data.aircraft_position.alt - AutopilotLaws_U.in.data.nav_loc_position.alt;
@@ -546,14 +548,14 @@ void AutopilotLawsModelClass::step()
   rtb_error_d = 0.017453292519943295 * AutopilotLaws_U.in.data.aircraft_position.lat;
   Phi2 = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_loc_position.lat;
   rtb_Saturation = 0.017453292519943295 * AutopilotLaws_U.in.data.aircraft_position.lon;
-  a = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
+  a = trigCache.guidanceSin((AutopilotLaws_U.in.data.nav_loc_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
                0.017453292519943295 / 2.0);
-  distance_m = std::sin((AutopilotLaws_U.in.data.nav_loc_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon) *
+  distance_m = trigCache.guidanceSin((AutopilotLaws_U.in.data.nav_loc_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon) *
                         0.017453292519943295 / 2.0);
-  a = std::cos(rtb_error_d) * std::cos(Phi2) * distance_m * distance_m + a * a;
+  a = trigCache.cos(rtb_error_d) * trigCache.cos(Phi2) * distance_m * distance_m + a * a;
   distance_m = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
   a = AutopilotLaws_U.in.data.aircraft_position.alt - AutopilotLaws_U.in.data.nav_loc_position.alt;
-  L = std::cos(Phi2);
+  L = trigCache.cos(Phi2);
   R = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_loc_position.lon - rtb_Saturation;
   b_L = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(360.0) + 360.0) - (mod_mvZvttxs(mod_mvZvttxs
     (AutopilotLaws_U.in.data.nav_loc_magvar_deg) + 360.0) + 360.0)) + 360.0);
@@ -562,10 +564,10 @@ void AutopilotLawsModelClass::step()
     b_R = -b_L;
   }
 
-  rtb_Add3_j4 = std::cos(rtb_error_d);
-  rtb_error_d = std::sin(rtb_error_d);
-  L = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(std::sin(R) * L, rtb_Add3_j4 * std::sin(Phi2) - rtb_error_d * L *
-    std::cos(R)) * 57.295779513082323 + 360.0)) + 360.0) + 360.0;
+  rtb_Add3_j4 = trigCache.cos(rtb_error_d);
+  rtb_error_d = trigCache.sin(rtb_error_d);
+  L = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(trigCache.sin(R) * L, rtb_Add3_j4 * trigCache.sin(Phi2) - rtb_error_d * L *
+    trigCache.cos(R)) * 57.295779513082323 + 360.0)) + 360.0) + 360.0;
   Phi2 = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(AutopilotLaws_U.in.data.nav_loc_deg - b_R) +
     360.0)) + 360.0) - L) + 360.0);
   b_R = mod_mvZvttxs(360.0 - Phi2);
@@ -602,17 +604,17 @@ void AutopilotLawsModelClass::step()
   }
 
   Phi2 = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_gs_position.lat;
-  a = std::sin((AutopilotLaws_U.in.data.nav_gs_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
+  a = trigCache.guidanceSin((AutopilotLaws_U.in.data.nav_gs_position.lat - AutopilotLaws_U.in.data.aircraft_position.lat) *
                0.017453292519943295 / 2.0);
-  distance_m = std::sin((AutopilotLaws_U.in.data.nav_gs_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon) *
+  distance_m = trigCache.guidanceSin((AutopilotLaws_U.in.data.nav_gs_position.lon - AutopilotLaws_U.in.data.aircraft_position.lon) *
                         0.017453292519943295 / 2.0);
-  L = std::cos(Phi2);
+  L = trigCache.cos(Phi2);
   a = rtb_Add3_j4 * L * distance_m * distance_m + a * a;
   distance_m = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
   a = AutopilotLaws_U.in.data.aircraft_position.alt - AutopilotLaws_U.in.data.nav_gs_position.alt;
   distance_m = std::sqrt(distance_m * distance_m + a * a);
   rtb_Saturation = 0.017453292519943295 * AutopilotLaws_U.in.data.nav_gs_position.lon - rtb_Saturation;
-  rtb_Saturation = std::atan2(std::sin(rtb_Saturation) * L, rtb_Add3_j4 * std::sin(Phi2) - rtb_error_d * L * std::cos
+  rtb_Saturation = std::atan2(trigCache.sin(rtb_Saturation) * L, rtb_Add3_j4 * trigCache.sin(Phi2) - rtb_error_d * L * trigCache.cos
     (rtb_Saturation)) * 57.295779513082323;
   if (rtb_Saturation + 360.0 == 0.0) {
     rtb_error_d = 0.0;
@@ -692,7 +694,7 @@ void AutopilotLawsModelClass::step()
          (AutopilotLaws_U.in.data.nav_gs_position.lon != 0.0) || (AutopilotLaws_U.in.data.nav_gs_position.alt != 0.0)))
     {
       rtb_valid_d = true;
-      rtb_error_d = std::asin(a / distance_m) * 57.295779513082323 - AutopilotLaws_DWork.nav_gs_deg;
+      rtb_error_d = trigCache.asin(a / distance_m) * 57.295779513082323 - AutopilotLaws_DWork.nav_gs_deg;
     } else {
       guard1 = true;
     }
@@ -876,7 +878,7 @@ void AutopilotLawsModelClass::step()
     b_R = rtb_dme;
   }
 
-  b_R = std::sin(AutopilotLaws_P.Gain1_Gain_f * AutopilotLaws_U.in.data.nav_loc_error_deg) * b_R *
+  b_R = trigCache.sin(AutopilotLaws_P.Gain1_Gain_f * AutopilotLaws_U.in.data.nav_loc_error_deg) * b_R *
     AutopilotLaws_P.Gain_Gain_h * rtb_lo_k / AutopilotLaws_U.in.data.V_gnd_kn;
   AutopilotLaws_DWork.DelayInput1_DSTATE = (AutopilotLaws_DWork.DelayInput1_DSTATE - (rt_modd(rt_modd
     (AutopilotLaws_U.in.data.nav_loc_error_deg + R, AutopilotLaws_P.Constant3_Value_c2) +
@@ -917,7 +919,7 @@ void AutopilotLawsModelClass::step()
   L = rt_modd(AutopilotLaws_DWork.DelayInput1_DSTATE, AutopilotLaws_P.Constant3_Value_if);
   rtb_Compare_jy = (AutopilotLaws_U.in.data.H_radio_ft <= AutopilotLaws_P.CompareToConstant_const);
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_nr * AutopilotLaws_U.in.data.nav_loc_error_deg;
-  Phi2 = std::sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  Phi2 = trigCache.sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
   if (rtb_dme > AutopilotLaws_P.Saturation_UpperSat_o) {
     AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Saturation_UpperSat_o;
   } else if (rtb_dme < AutopilotLaws_P.Saturation_LowerSat_o) {
@@ -1152,7 +1154,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = (rtb_Y_i * look1_binlxpw(AutopilotLaws_U.in.data.V_tas_kn,
       AutopilotLaws_P.ScheduledGain2_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain2_Table, 6U) *
                    AutopilotLaws_P.Gain4_Gain * look1_binlxpw(AutopilotLaws_U.in.data.H_radio_ft,
-      AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain_Table, 5U) + std::sin
+      AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain_Table, 5U) + trigCache.sin
                    (AutopilotLaws_P.Gain1_Gain_b * Phi2) * AutopilotLaws_U.in.data.V_gnd_kn *
                    AutopilotLaws_P.Gain2_Gain_g) + rtb_dme;
     if (rtb_Add3_j4 > AutopilotLaws_P.Saturation1_UpperSat) {
@@ -1433,7 +1435,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  a = AutopilotLaws_P.Gain_Gain_k * std::asin(rtb_Add3_j4);
+  a = AutopilotLaws_P.Gain_Gain_k * trigCache.asin(rtb_Add3_j4);
   rtb_Compare_jy = (rtb_error_d == AutopilotLaws_P.CompareToConstant1_const_c);
   if (!AutopilotLaws_DWork.wasActive_not_empty_p) {
     AutopilotLaws_DWork.wasActive_c = rtb_Compare_jy;
@@ -1494,7 +1496,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  Phi2 = AutopilotLaws_P.Gain_Gain_es * std::asin(rtb_Add3_j4);
+  Phi2 = AutopilotLaws_P.Gain_Gain_es * trigCache.asin(rtb_Add3_j4);
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.fpmtoms_Gain * AutopilotLaws_U.in.data.H_dot_ft_min;
   rtb_Add3_j4 = AutopilotLaws_P.kntoms_Gain_m * AutopilotLaws_U.in.data.V_gnd_kn;
   if (rtb_Add3_j4 > AutopilotLaws_P.Saturation_UpperSat_j) {
@@ -1503,7 +1505,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_i;
   }
 
-  AutopilotLaws_DWork.DelayInput1_DSTATE = std::atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
+  AutopilotLaws_DWork.DelayInput1_DSTATE = trigCache.atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
     AutopilotLaws_P.Gain_Gain_e3;
   R = AutopilotLaws_P.Gain1_Gain_c * rtb_GainTheta1;
   AutopilotLaws_WashoutFilter(AutopilotLaws_P._Gain * (AutopilotLaws_P.GStoGS_CAS_Gain * (AutopilotLaws_P.ktstomps_Gain *
@@ -1518,8 +1520,8 @@ void AutopilotLawsModelClass::step()
 
   AutopilotLaws_LeadLagFilter(rtb_Y_j - AutopilotLaws_P.g_Gain * (AutopilotLaws_P.Gain1_Gain_lp *
     (AutopilotLaws_P.Gain_Gain_am * ((AutopilotLaws_P.Gain1_Gain_go * rtb_GainTheta - AutopilotLaws_P.Gain1_Gain_lx *
-    (AutopilotLaws_P.Gain_Gain_c1 * std::atan(AutopilotLaws_P.fpmtoms_Gain_g * AutopilotLaws_U.in.data.H_dot_ft_min /
-    rtb_Add3_j4))) * (AutopilotLaws_P.Constant_Value_dy - std::cos(R)) + std::sin(R) * std::sin
+    (AutopilotLaws_P.Gain_Gain_c1 * trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_g * AutopilotLaws_U.in.data.H_dot_ft_min /
+    rtb_Add3_j4))) * (AutopilotLaws_P.Constant_Value_dy - trigCache.cos(R)) + trigCache.sin(R) * trigCache.sin
     (AutopilotLaws_P.Gain1_Gain_pf * AutopilotLaws_U.in.data.Psi_magnetic_track_deg - AutopilotLaws_P.Gain1_Gain_e *
      AutopilotLaws_U.in.data.Psi_magnetic_deg)))), AutopilotLaws_P.HighPassFilter_C1, AutopilotLaws_P.HighPassFilter_C2,
     AutopilotLaws_P.HighPassFilter_C3, AutopilotLaws_P.HighPassFilter_C4, AutopilotLaws_U.in.time.dt, &rtb_Y_pf,
@@ -1561,7 +1563,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_e;
   }
 
-  AutopilotLaws_DWork.DelayInput1_DSTATE = std::atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
+  AutopilotLaws_DWork.DelayInput1_DSTATE = trigCache.atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
     AutopilotLaws_P.Gain_Gain_d4;
   R = AutopilotLaws_P.Gain1_Gain_j0 * rtb_GainTheta1;
   AutopilotLaws_WashoutFilter(AutopilotLaws_P._Gain_h * (AutopilotLaws_P.GStoGS_CAS_Gain_m *
@@ -1576,8 +1578,8 @@ void AutopilotLawsModelClass::step()
 
   AutopilotLaws_LeadLagFilter(rtb_Y_j - AutopilotLaws_P.g_Gain_h * (AutopilotLaws_P.Gain1_Gain_dv *
     (AutopilotLaws_P.Gain_Gain_id * ((AutopilotLaws_P.Gain1_Gain_kd * rtb_GainTheta - AutopilotLaws_P.Gain1_Gain_o4 *
-    (AutopilotLaws_P.Gain_Gain_bs * std::atan(AutopilotLaws_P.fpmtoms_Gain_c * AutopilotLaws_U.in.data.H_dot_ft_min /
-    rtb_Add3_j4))) * (AutopilotLaws_P.Constant_Value_c - std::cos(R)) + std::sin(R) * std::sin
+    (AutopilotLaws_P.Gain_Gain_bs * trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_c * AutopilotLaws_U.in.data.H_dot_ft_min /
+    rtb_Add3_j4))) * (AutopilotLaws_P.Constant_Value_c - trigCache.cos(R)) + trigCache.sin(R) * trigCache.sin
     (AutopilotLaws_P.Gain1_Gain_bk * AutopilotLaws_U.in.data.Psi_magnetic_track_deg - AutopilotLaws_P.Gain1_Gain_lxx *
      AutopilotLaws_U.in.data.Psi_magnetic_deg)))), AutopilotLaws_P.HighPassFilter_C1_e,
     AutopilotLaws_P.HighPassFilter_C2_c, AutopilotLaws_P.HighPassFilter_C3_f, AutopilotLaws_P.HighPassFilter_C4_c,
@@ -1622,12 +1624,12 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_ad;
   }
 
-  AutopilotLaws_DWork.DelayInput1_DSTATE = std::atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
+  AutopilotLaws_DWork.DelayInput1_DSTATE = trigCache.atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
     AutopilotLaws_P.Gain_Gain_e33;
   R = AutopilotLaws_P.Gain1_Gain_ok * AutopilotLaws_DWork.DelayInput1_DSTATE;
   Phi2 = AutopilotLaws_P.Gain1_Gain_jd * rtb_GainTheta1;
-  rtb_lo_k = std::cos(Phi2);
-  rtb_lo_b = std::sin(Phi2);
+  rtb_lo_k = trigCache.cos(Phi2);
+  rtb_lo_b = trigCache.sin(Phi2);
   Phi2 = AutopilotLaws_P.ktstomps_Gain_f * AutopilotLaws_U.in.data.V_gnd_kn;
   AutopilotLaws_WashoutFilter(AutopilotLaws_P._Gain_m * (AutopilotLaws_P.GStoGS_CAS_Gain_l * Phi2),
     AutopilotLaws_P.WashoutFilter_C1_k, AutopilotLaws_U.in.time.dt, &rtb_Gain1_pj,
@@ -1641,8 +1643,8 @@ void AutopilotLawsModelClass::step()
 
   AutopilotLaws_LeadLagFilter(rtb_Gain1_pj - AutopilotLaws_P.g_Gain_j * (AutopilotLaws_P.Gain1_Gain_ca *
     (AutopilotLaws_P.Gain_Gain_ms * ((AutopilotLaws_P.Gain1_Gain_dh * rtb_GainTheta - AutopilotLaws_P.Gain1_Gain_cv *
-    (AutopilotLaws_P.Gain_Gain_nq * std::atan(AutopilotLaws_P.fpmtoms_Gain_h * AutopilotLaws_U.in.data.H_dot_ft_min /
-    rtb_Add3_j4))) * (AutopilotLaws_P.Constant_Value_l - rtb_lo_k) + rtb_lo_b * std::sin(AutopilotLaws_P.Gain1_Gain_id *
+    (AutopilotLaws_P.Gain_Gain_nq * trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_h * AutopilotLaws_U.in.data.H_dot_ft_min /
+    rtb_Add3_j4))) * (AutopilotLaws_P.Constant_Value_l - rtb_lo_k) + rtb_lo_b * trigCache.sin(AutopilotLaws_P.Gain1_Gain_id *
     AutopilotLaws_U.in.data.Psi_magnetic_track_deg - AutopilotLaws_P.Gain1_Gain_ct *
     AutopilotLaws_U.in.data.Psi_magnetic_deg)))), AutopilotLaws_P.HighPassFilter_C1_b,
     AutopilotLaws_P.HighPassFilter_C2_g, AutopilotLaws_P.HighPassFilter_C3_n, AutopilotLaws_P.HighPassFilter_C4_b,
@@ -1706,7 +1708,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  rtb_Sum_i = AutopilotLaws_P.Gain_Gain_nz * std::asin(rtb_Add3_j4);
+  rtb_Sum_i = AutopilotLaws_P.Gain_Gain_nz * trigCache.asin(rtb_Add3_j4);
   rtb_Add3_j4 = AutopilotLaws_P.kntoms_Gain_au * AutopilotLaws_U.in.data.V_tas_kn;
   if (rtb_Add3_j4 > AutopilotLaws_P.Saturation_UpperSat_l) {
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_UpperSat_l;
@@ -1722,7 +1724,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  rtb_Y_i = AutopilotLaws_P.Gain_Gain_ey * std::asin(rtb_Add3_j4);
+  rtb_Y_i = AutopilotLaws_P.Gain_Gain_ey * trigCache.asin(rtb_Add3_j4);
   if (!AutopilotLaws_DWork.prevVerticalLaw_not_empty) {
     AutopilotLaws_DWork.prevVerticalLaw = AutopilotLaws_U.in.input.vertical_law;
     AutopilotLaws_DWork.prevVerticalLaw_not_empty = true;
@@ -1757,7 +1759,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Saturation_LowerSat_cd;
   }
 
-  Phi2 = std::atan(AutopilotLaws_P.fpmtoms_Gain_o * AutopilotLaws_U.in.data.H_dot_ft_min /
+  Phi2 = trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_o * AutopilotLaws_U.in.data.H_dot_ft_min /
                    AutopilotLaws_DWork.DelayInput1_DSTATE) * AutopilotLaws_P.Gain_Gain_lx;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_jn * rtb_GainTheta;
   rtb_Add3_j4 = AutopilotLaws_P.kntoms_Gain_d * AutopilotLaws_U.in.data.V_gnd_kn;
@@ -1767,11 +1769,11 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_k;
   }
 
-  R = AutopilotLaws_DWork.DelayInput1_DSTATE - std::atan(AutopilotLaws_P.fpmtoms_Gain_e *
+  R = AutopilotLaws_DWork.DelayInput1_DSTATE - trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_e *
     AutopilotLaws_U.in.data.H_dot_ft_min / rtb_Add3_j4) * AutopilotLaws_P.Gain_Gain_in * AutopilotLaws_P.Gain1_Gain_ps;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_hi * rtb_GainTheta1;
-  rtb_Cos_i = std::cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
-  rtb_Cos1_pk = std::sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Cos_i = trigCache.cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Cos1_pk = trigCache.sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_da * AutopilotLaws_U.in.data.Psi_magnetic_deg;
   rtb_Add3_g = AutopilotLaws_P.Gain1_Gain_hg * AutopilotLaws_U.in.data.Psi_magnetic_track_deg -
     AutopilotLaws_DWork.DelayInput1_DSTATE;
@@ -1780,7 +1782,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE), AutopilotLaws_P.WashoutFilter_C1_o, AutopilotLaws_U.in.time.dt,
     &rtb_Gain1_pj, &AutopilotLaws_DWork.sf_WashoutFilter_fs);
   AutopilotLaws_LeadLagFilter(rtb_Gain1_pj - AutopilotLaws_P.g_Gain_m * (AutopilotLaws_P.Gain1_Gain_kdq *
-    (AutopilotLaws_P.Gain_Gain_b5 * (R * (AutopilotLaws_P.Constant_Value_od - rtb_Cos_i) + rtb_Cos1_pk * std::sin
+    (AutopilotLaws_P.Gain_Gain_b5 * (R * (AutopilotLaws_P.Constant_Value_od - rtb_Cos_i) + rtb_Cos1_pk * trigCache.sin
     (rtb_Add3_g)))), AutopilotLaws_P.HighPassFilter_C1_g, AutopilotLaws_P.HighPassFilter_C2_l,
     AutopilotLaws_P.HighPassFilter_C3_j, AutopilotLaws_P.HighPassFilter_C4_i, AutopilotLaws_U.in.time.dt,
     &AutopilotLaws_DWork.DelayInput1_DSTATE, &AutopilotLaws_DWork.sf_LeadLagFilter_b);
@@ -1822,7 +1824,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Saturation_LowerSat_p;
   }
 
-  Phi2 = std::atan(AutopilotLaws_P.fpmtoms_Gain_p3 * AutopilotLaws_U.in.data.H_dot_ft_min /
+  Phi2 = trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_p3 * AutopilotLaws_U.in.data.H_dot_ft_min /
                    AutopilotLaws_DWork.DelayInput1_DSTATE) * AutopilotLaws_P.Gain_Gain_py;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_hk * rtb_GainTheta;
   rtb_Add3_j4 = AutopilotLaws_P.kntoms_Gain_l5 * AutopilotLaws_U.in.data.V_gnd_kn;
@@ -1832,11 +1834,11 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_es;
   }
 
-  R = AutopilotLaws_DWork.DelayInput1_DSTATE - std::atan(AutopilotLaws_P.fpmtoms_Gain_j *
+  R = AutopilotLaws_DWork.DelayInput1_DSTATE - trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_j *
     AutopilotLaws_U.in.data.H_dot_ft_min / rtb_Add3_j4) * AutopilotLaws_P.Gain_Gain_e5 * AutopilotLaws_P.Gain1_Gain_ja;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_er * rtb_GainTheta1;
-  rtb_Cos_i = std::cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
-  rtb_Cos1_pk = std::sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Cos_i = trigCache.cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Cos1_pk = trigCache.sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_fl * AutopilotLaws_U.in.data.Psi_magnetic_deg;
   rtb_Add3_i = AutopilotLaws_P.Gain1_Gain_ero * AutopilotLaws_U.in.data.Psi_magnetic_track_deg -
     AutopilotLaws_DWork.DelayInput1_DSTATE;
@@ -1845,7 +1847,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE), AutopilotLaws_P.WashoutFilter_C1_p, AutopilotLaws_U.in.time.dt,
     &rtb_Gain1_pj, &AutopilotLaws_DWork.sf_WashoutFilter_j);
   AutopilotLaws_LeadLagFilter(rtb_Gain1_pj - AutopilotLaws_P.g_Gain_g * (AutopilotLaws_P.Gain1_Gain_hv *
-    (AutopilotLaws_P.Gain_Gain_mx * (R * (AutopilotLaws_P.Constant_Value_ia - rtb_Cos_i) + rtb_Cos1_pk * std::sin
+    (AutopilotLaws_P.Gain_Gain_mx * (R * (AutopilotLaws_P.Constant_Value_ia - rtb_Cos_i) + rtb_Cos1_pk * trigCache.sin
     (rtb_Add3_i)))), AutopilotLaws_P.HighPassFilter_C1_n, AutopilotLaws_P.HighPassFilter_C2_m,
     AutopilotLaws_P.HighPassFilter_C3_k, AutopilotLaws_P.HighPassFilter_C4_h, AutopilotLaws_U.in.time.dt,
     &AutopilotLaws_DWork.DelayInput1_DSTATE, &AutopilotLaws_DWork.sf_LeadLagFilter_c);
@@ -1889,7 +1891,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Saturation_LowerSat_ou;
   }
 
-  rtb_Add3_g = AutopilotLaws_U.in.input.FPA_c_deg - std::atan(AutopilotLaws_P.fpmtoms_Gain_ps *
+  rtb_Add3_g = AutopilotLaws_U.in.input.FPA_c_deg - trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_ps *
     AutopilotLaws_U.in.data.H_dot_ft_min / AutopilotLaws_DWork.DelayInput1_DSTATE) * AutopilotLaws_P.Gain_Gain_gt;
   if (!AutopilotLaws_DWork.prevVerticalLaw_not_empty_n) {
     AutopilotLaws_DWork.prevVerticalLaw_b = AutopilotLaws_U.in.input.vertical_law;
@@ -1922,7 +1924,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Saturation_LowerSat_a4;
   }
 
-  Phi2 = std::atan(AutopilotLaws_P.fpmtoms_Gain_d * AutopilotLaws_U.in.data.H_dot_ft_min /
+  Phi2 = trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_d * AutopilotLaws_U.in.data.H_dot_ft_min /
                    AutopilotLaws_DWork.DelayInput1_DSTATE) * AutopilotLaws_P.Gain_Gain_hv;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_ej * rtb_GainTheta;
   rtb_Add3_j4 = AutopilotLaws_P.kntoms_Gain_k * AutopilotLaws_U.in.data.V_gnd_kn;
@@ -1932,11 +1934,11 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_py;
   }
 
-  R = AutopilotLaws_DWork.DelayInput1_DSTATE - std::atan(AutopilotLaws_P.fpmtoms_Gain_f *
+  R = AutopilotLaws_DWork.DelayInput1_DSTATE - trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_f *
     AutopilotLaws_U.in.data.H_dot_ft_min / rtb_Add3_j4) * AutopilotLaws_P.Gain_Gain_bf * AutopilotLaws_P.Gain1_Gain_jv;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_gfa * rtb_GainTheta1;
-  rtb_Add3_i = std::cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
-  rtb_Cos1_j = std::sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Add3_i = trigCache.cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Cos1_j = trigCache.sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_kw * AutopilotLaws_U.in.data.Psi_magnetic_deg;
   rtb_Add3_j4 = AutopilotLaws_P.Gain1_Gain_j4 * AutopilotLaws_U.in.data.Psi_magnetic_track_deg -
     AutopilotLaws_DWork.DelayInput1_DSTATE;
@@ -1945,7 +1947,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE), AutopilotLaws_P.WashoutFilter_C1_j, AutopilotLaws_U.in.time.dt, &rtb_Y_i,
     &AutopilotLaws_DWork.sf_WashoutFilter_h);
   AutopilotLaws_LeadLagFilter(rtb_Y_i - AutopilotLaws_P.g_Gain_l * (AutopilotLaws_P.Gain1_Gain_n4 *
-    (AutopilotLaws_P.Gain_Gain_bc * (R * (AutopilotLaws_P.Constant_Value_lf - rtb_Add3_i) + rtb_Cos1_j * std::sin
+    (AutopilotLaws_P.Gain_Gain_bc * (R * (AutopilotLaws_P.Constant_Value_lf - rtb_Add3_i) + rtb_Cos1_j * trigCache.sin
     (rtb_Add3_j4)))), AutopilotLaws_P.HighPassFilter_C1_i, AutopilotLaws_P.HighPassFilter_C2_h,
     AutopilotLaws_P.HighPassFilter_C3_m, AutopilotLaws_P.HighPassFilter_C4_n, AutopilotLaws_U.in.time.dt, &rtb_Gain1_pj,
     &AutopilotLaws_DWork.sf_LeadLagFilter_e);
@@ -1985,7 +1987,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Saturation_LowerSat_hd;
   }
 
-  Phi2 = std::atan(AutopilotLaws_P.fpmtoms_Gain_o2 * AutopilotLaws_U.in.data.H_dot_ft_min /
+  Phi2 = trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_o2 * AutopilotLaws_U.in.data.H_dot_ft_min /
                    AutopilotLaws_DWork.DelayInput1_DSTATE) * AutopilotLaws_P.Gain_Gain_pp;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_iw * rtb_GainTheta;
   rtb_Sum_kq = AutopilotLaws_P.kntoms_Gain_i * AutopilotLaws_U.in.data.V_gnd_kn;
@@ -1995,11 +1997,11 @@ void AutopilotLawsModelClass::step()
     rtb_Sum_kq = AutopilotLaws_P.Saturation_LowerSat_ae;
   }
 
-  R = AutopilotLaws_DWork.DelayInput1_DSTATE - std::atan(AutopilotLaws_P.fpmtoms_Gain_hz *
+  R = AutopilotLaws_DWork.DelayInput1_DSTATE - trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_hz *
     AutopilotLaws_U.in.data.H_dot_ft_min / rtb_Sum_kq) * AutopilotLaws_P.Gain_Gain_ej * AutopilotLaws_P.Gain1_Gain_lw;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_ky * rtb_GainTheta1;
-  rtb_Cos1_j = std::cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
-  rtb_Add3_j4 = std::sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Cos1_j = trigCache.cos(AutopilotLaws_DWork.DelayInput1_DSTATE);
+  rtb_Add3_j4 = trigCache.sin(AutopilotLaws_DWork.DelayInput1_DSTATE);
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain1_Gain_nrn * AutopilotLaws_U.in.data.Psi_magnetic_deg;
   rtb_Add3_lz = AutopilotLaws_P.Gain1_Gain_ip * AutopilotLaws_U.in.data.Psi_magnetic_track_deg -
     AutopilotLaws_DWork.DelayInput1_DSTATE;
@@ -2008,7 +2010,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.DelayInput1_DSTATE), AutopilotLaws_P.WashoutFilter_C1_c, AutopilotLaws_U.in.time.dt, &rtb_Y_i,
     &AutopilotLaws_DWork.sf_WashoutFilter_g5);
   AutopilotLaws_LeadLagFilter(rtb_Y_i - AutopilotLaws_P.g_Gain_hq * (AutopilotLaws_P.Gain1_Gain_mx *
-    (AutopilotLaws_P.Gain_Gain_d3 * (R * (AutopilotLaws_P.Constant_Value_fo - rtb_Cos1_j) + rtb_Add3_j4 * std::sin
+    (AutopilotLaws_P.Gain_Gain_d3 * (R * (AutopilotLaws_P.Constant_Value_fo - rtb_Cos1_j) + rtb_Add3_j4 * trigCache.sin
     (rtb_Add3_lz)))), AutopilotLaws_P.HighPassFilter_C1_d, AutopilotLaws_P.HighPassFilter_C2_i,
     AutopilotLaws_P.HighPassFilter_C3_d, AutopilotLaws_P.HighPassFilter_C4_nr, AutopilotLaws_U.in.time.dt, &rtb_Gain1_pj,
     &AutopilotLaws_DWork.sf_LeadLagFilter_j);
@@ -2049,7 +2051,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_P.LagFilter2_C1_d, AutopilotLaws_U.in.time.dt, &AutopilotLaws_DWork.DelayInput1_DSTATE,
     &AutopilotLaws_DWork.sf_LagFilter_f);
   Phi2 = AutopilotLaws_P.kn2ms_Gain * AutopilotLaws_U.in.data.V_gnd_kn;
-  AutopilotLaws_LagFilter(AutopilotLaws_P.Gain_Gain_os * (std::tan(AutopilotLaws_P.Gain1_Gain_ox * result[1]) * Phi2),
+  AutopilotLaws_LagFilter(AutopilotLaws_P.Gain_Gain_os * (trigCache.tan(AutopilotLaws_P.Gain1_Gain_ox * result[1]) * Phi2),
     AutopilotLaws_P.LagFilter3_C1, AutopilotLaws_U.in.time.dt, &rtb_Gain1_pj, &AutopilotLaws_DWork.sf_LagFilter_l);
   AutopilotLaws_LagFilter(AutopilotLaws_DWork.DelayInput1_DSTATE - rtb_Gain1_pj, AutopilotLaws_P.LagFilter4_C1,
     AutopilotLaws_U.in.time.dt, &Phi2, &AutopilotLaws_DWork.sf_LagFilter_i);
@@ -2111,7 +2113,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_gk;
   }
 
-  AutopilotLaws_DWork.DelayInput1_DSTATE = std::atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
+  AutopilotLaws_DWork.DelayInput1_DSTATE = trigCache.atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
     AutopilotLaws_P.Gain_Gain_ow;
   AutopilotLaws_SignalEnablerGSTrack(AutopilotLaws_P.Gain2_Gain_l * (Phi2 - AutopilotLaws_DWork.DelayInput1_DSTATE),
     rtb_Compare_l, &rtb_Gain1_pj);
@@ -2183,8 +2185,8 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  rtb_Sum1_g = AutopilotLaws_P.Gain_Gain_gr * std::asin(R) * AutopilotLaws_P.Gain1_Gain_ml +
-    AutopilotLaws_P.Gain_Gain_by * std::asin(rtb_Add3_j4) * AutopilotLaws_P.Gain2_Gain_m;
+  rtb_Sum1_g = AutopilotLaws_P.Gain_Gain_gr * trigCache.asin(R) * AutopilotLaws_P.Gain1_Gain_ml +
+    AutopilotLaws_P.Gain_Gain_by * trigCache.asin(rtb_Add3_j4) * AutopilotLaws_P.Gain2_Gain_m;
   rtb_uDLookupTable_m = look1_binlxpw(AutopilotLaws_U.in.data.total_weight_kg, AutopilotLaws_P.uDLookupTable_bp01Data,
     AutopilotLaws_P.uDLookupTable_tableData, 3U);
   rtb_Sum_es = AutopilotLaws_P.Constant1_Value_o0 - rtb_GainTheta;
@@ -2197,7 +2199,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_l;
   }
 
-  AutopilotLaws_DWork.DelayInput1_DSTATE = std::atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
+  AutopilotLaws_DWork.DelayInput1_DSTATE = trigCache.atan(AutopilotLaws_DWork.DelayInput1_DSTATE / rtb_Add3_j4) *
     AutopilotLaws_P.Gain_Gain_cr;
   R = AutopilotLaws_P.Gain1_Gain_ga * AutopilotLaws_DWork.DelayInput1_DSTATE;
   rtb_Gain1_pj = AutopilotLaws_P.Gain1_Gain_hm2 * rtb_GainTheta1;
@@ -2208,10 +2210,10 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = AutopilotLaws_P.Saturation_LowerSat_m;
   }
 
-  rtb_GainTheta1 = (AutopilotLaws_P.Gain1_Gain_ol * rtb_GainTheta - std::atan(AutopilotLaws_P.fpmtoms_Gain_k *
+  rtb_GainTheta1 = (AutopilotLaws_P.Gain1_Gain_ol * rtb_GainTheta - trigCache.atan(AutopilotLaws_P.fpmtoms_Gain_k *
     AutopilotLaws_U.in.data.H_dot_ft_min / rtb_Add3_j4) * AutopilotLaws_P.Gain_Gain_hc * AutopilotLaws_P.Gain1_Gain_ln) *
-    (AutopilotLaws_P.Constant_Value_h - std::cos(rtb_Gain1_pj));
-  rtb_Add3_j4 = std::sin(rtb_Gain1_pj);
+    (AutopilotLaws_P.Constant_Value_h - trigCache.cos(rtb_Gain1_pj));
+  rtb_Add3_j4 = trigCache.sin(rtb_Gain1_pj);
   rtb_Sum_kq = AutopilotLaws_P.Gain1_Gain_it * AutopilotLaws_U.in.data.Psi_magnetic_track_deg;
   rtb_Add3_aj = rtb_Sum_kq - AutopilotLaws_P.Gain1_Gain_a * AutopilotLaws_U.in.data.Psi_magnetic_deg;
   rtb_Gain1_pj = AutopilotLaws_P.ktstomps_Gain_k5 * AutopilotLaws_U.in.data.V_gnd_kn;
@@ -2219,7 +2221,7 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_P.WashoutFilter_C1_cn, AutopilotLaws_U.in.time.dt, &rtb_Gain1_pj,
     &AutopilotLaws_DWork.sf_WashoutFilter_i);
   AutopilotLaws_LeadLagFilter(rtb_Gain1_pj - AutopilotLaws_P.g_Gain_p * (AutopilotLaws_P.Gain1_Gain_mxw *
-    (AutopilotLaws_P.Gain_Gain_er * (rtb_GainTheta1 + rtb_Add3_j4 * std::sin(rtb_Add3_aj)))),
+    (AutopilotLaws_P.Gain_Gain_er * (rtb_GainTheta1 + rtb_Add3_j4 * trigCache.sin(rtb_Add3_aj)))),
     AutopilotLaws_P.HighPassFilter_C1_gw, AutopilotLaws_P.HighPassFilter_C2_e, AutopilotLaws_P.HighPassFilter_C3_di,
     AutopilotLaws_P.HighPassFilter_C4_a, AutopilotLaws_U.in.time.dt, &rtb_Sum_kq,
     &AutopilotLaws_DWork.sf_LeadLagFilter_g);
@@ -2280,7 +2282,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  rtb_Gain_n4 = AutopilotLaws_P.Gain_Gain_kon * std::asin(rtb_Add3_j4);
+  rtb_Gain_n4 = AutopilotLaws_P.Gain_Gain_kon * trigCache.asin(rtb_Add3_j4);
   rtb_Gain1_pj = AutopilotLaws_P.kntoms_Gain_iw * AutopilotLaws_U.in.data.V_tas_kn;
   if (rtb_Gain1_pj > AutopilotLaws_P.Saturation_UpperSat_jt) {
     rtb_Gain1_pj = AutopilotLaws_P.Saturation_UpperSat_jt;
@@ -2296,7 +2298,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  rtb_Add3_aj = AutopilotLaws_P.Gain_Gain_o1 * std::asin(rtb_Add3_j4);
+  rtb_Add3_aj = AutopilotLaws_P.Gain_Gain_o1 * trigCache.asin(rtb_Add3_j4);
   if (rtb_Compare_l) {
     rtb_Gain1_pj = rtb_GainTheta1;
   } else if (rtb_Sum3_m3 > AutopilotLaws_P.Switch_Threshold_k) {
@@ -2330,7 +2332,7 @@ void AutopilotLawsModelClass::step()
     rtb_Add3_j4 = -1.0;
   }
 
-  rtb_Sum_kq = AutopilotLaws_P.Gain_Gain_fs * std::asin(rtb_Add3_j4);
+  rtb_Sum_kq = AutopilotLaws_P.Gain_Gain_fs * trigCache.asin(rtb_Add3_j4);
   switch (static_cast<int32_T>(rtb_error_d)) {
    case 0:
     b_L = AutopilotLaws_P.Constant_Value_dh;
@@ -1,3 +1,6 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
+// step() is patched by tools/model-patches/trig_cache.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_AutopilotLaws_h_
 #define RTW_HEADER_AutopilotLaws_h_
 #include <cmath>
@@ -931,6 +934,13 @@ class AutopilotLawsModelClass
     uint8_T ManualSwitch_CurrentSetting_b;
   };
 
+  struct Snapshot_AutopilotLaws_T {
+    ExternalInputs_AutopilotLaws_T U;
+    ExternalOutputs_AutopilotLaws_T Y;
+    BlockIO_AutopilotLaws_T B;
+    D_Work_AutopilotLaws_T DWork;
+  };
+
   AutopilotLawsModelClass(AutopilotLawsModelClass const&) =delete;
   AutopilotLawsModelClass& operator= (AutopilotLawsModelClass const&) & = delete;
   void setExternalInputs(const ExternalInputs_AutopilotLaws_T *pExternalInputs_AutopilotLaws_T)
@@ -946,6 +956,22 @@ class AutopilotLawsModelClass
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_AutopilotLaws_T *pSnapshot) const
+  {
+    pSnapshot->U = AutopilotLaws_U;
+    pSnapshot->Y = AutopilotLaws_Y;
+    pSnapshot->B = AutopilotLaws_B;
+    pSnapshot->DWork = AutopilotLaws_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_AutopilotLaws_T *pSnapshot)
+  {
+    AutopilotLaws_U = pSnapshot->U;
+    AutopilotLaws_Y = pSnapshot->Y;
+    AutopilotLaws_B = pSnapshot->B;
+    AutopilotLaws_DWork = pSnapshot->DWork;
+  }
+
   AutopilotLawsModelClass();
   ~AutopilotLawsModelClass();
  private:
@@ -953,7 +979,7 @@ class AutopilotLawsModelClass
   ExternalOutputs_AutopilotLaws_T AutopilotLaws_Y;
   BlockIO_AutopilotLaws_T AutopilotLaws_B;
   D_Work_AutopilotLaws_T AutopilotLaws_DWork;
-  static Parameters_AutopilotLaws_T AutopilotLaws_P;
+  static RT_PARAMETERS_CONST Parameters_AutopilotLaws_T AutopilotLaws_P;
   static void AutopilotLaws_MATLABFunction(real_T rtu_tau, real_T rtu_zeta, real_T *rty_k2, real_T *rty_k1);
   static void AutopilotLaws_LagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_AutopilotLaws_T *localDW);
@@ -1,7 +1,7 @@
 #include "AutopilotLaws.h"
 #include "AutopilotLaws_private.h"
 
-AutopilotLawsModelClass::Parameters_AutopilotLaws_T AutopilotLawsModelClass::AutopilotLaws_P{
+RT_PARAMETERS_CONST AutopilotLawsModelClass::Parameters_AutopilotLaws_T AutopilotLawsModelClass::AutopilotLaws_P{
 
   {
     {
@@ -5,6 +5,7 @@
 #include "mod_mvZvttxs.h"
 #include "rt_remd.h"
 #include "uMultiWord2Double.h"
+#include "TrigCache.h"
 
 const uint8_T AutopilotStateMachine_IN_FLARE{ 1U };
 
@@ -2588,6 +2589,7 @@ void AutopilotStateMachineModelClass::step()
   boolean_T conditionSoftAlt;
   boolean_T engageCondition;
   boolean_T guard1{ false };
+  TrigCache trigCache;
 
   boolean_T inFlightDisarmCondition;
   boolean_T rtb_AND;
@@ -2643,9 +2645,9 @@ void AutopilotStateMachineModelClass::step()
   rtb_GainTheta1 = AutopilotStateMachine_P.GainTheta1_Gain * AutopilotStateMachine_U.in.data.Phi_deg;
   rtb_dme = 0.017453292519943295 * rtb_GainTheta;
   rtb_Saturation1 = 0.017453292519943295 * rtb_GainTheta1;
-  Phi2 = std::tan(rtb_dme);
-  L = std::sin(rtb_Saturation1);
-  rtb_Saturation1 = std::cos(rtb_Saturation1);
+  Phi2 = trigCache.tan(rtb_dme);
+  L = trigCache.sin(rtb_Saturation1);
+  rtb_Saturation1 = trigCache.cos(rtb_Saturation1);
   result_tmp_0[0] = 1.0;
   result_tmp_0[3] = L * Phi2;
   result_tmp_0[6] = rtb_Saturation1 * Phi2;
@@ -2653,7 +2655,7 @@ void AutopilotStateMachineModelClass::step()
   result_tmp_0[4] = rtb_Saturation1;
   result_tmp_0[7] = -L;
   result_tmp_0[2] = 0.0;
-  R = std::cos(rtb_dme);
+  R = trigCache.cos(rtb_dme);
   Phi2 = 1.0 / R;
   result_tmp_0[5] = Phi2 * L;
   result_tmp_0[8] = Phi2 * rtb_Saturation1;
@@ -2666,7 +2668,7 @@ void AutopilotStateMachineModelClass::step()
       result_tmp_0[rtb_on_ground + 6] * result_tmp;
   }
 
-  a = std::sin(rtb_dme);
+  a = trigCache.sin(rtb_dme);
   result_tmp_0[0] = R;
   result_tmp_0[3] = 0.0;
   result_tmp_0[6] = -a;
@@ -2685,11 +2687,11 @@ void AutopilotStateMachineModelClass::step()
   if (AutopilotStateMachine_U.in.data.nav_dme_valid != 0.0) {
     AutopilotStateMachine_B.BusAssignment_g.data.nav_dme_nmi = AutopilotStateMachine_U.in.data.nav_dme_nmi;
   } else if (AutopilotStateMachine_U.in.data.nav_loc_valid) {
-    a = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
+    a = trigCache.guidanceSin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
                   AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
-    result_tmp = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
+    result_tmp = trigCache.guidanceSin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
       AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
-    a = std::cos(0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lat) * std::cos
+    a = trigCache.guidanceCos(0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lat) * trigCache.guidanceCos
       (0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat) * result_tmp * result_tmp + a * a;
     rtb_dme = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
     a = AutopilotStateMachine_U.in.data.aircraft_position.alt - AutopilotStateMachine_U.in.data.nav_loc_position.alt;
@@ -2701,12 +2703,12 @@ void AutopilotStateMachineModelClass::step()
   rtb_dme = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lat;
   Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat;
   rtb_Saturation1 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lon;
-  a = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
+  a = trigCache.guidanceSin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
                 AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
-  result_tmp = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
+  result_tmp = trigCache.guidanceSin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
     AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
-  L = std::cos(Phi2);
-  a_tmp = std::cos(rtb_dme);
+  L = trigCache.cos(Phi2);
+  a_tmp = trigCache.cos(rtb_dme);
   a = a_tmp * L * result_tmp * result_tmp + a * a;
   a = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
   result_tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
@@ -2719,8 +2721,8 @@ void AutopilotStateMachineModelClass::step()
     b_R = -b_L;
   }
 
-  rtb_dme = std::sin(rtb_dme);
-  L = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(std::sin(R) * L, a_tmp * std::sin(Phi2) - rtb_dme * L * std::cos
+  rtb_dme = trigCache.sin(rtb_dme);
+  L = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(trigCache.sin(R) * L, a_tmp * trigCache.sin(Phi2) - rtb_dme * L * trigCache.cos
     (R)) * 57.295779513082323 + 360.0)) + 360.0) + 360.0;
   Phi2 = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(AutopilotStateMachine_U.in.data.nav_loc_deg -
     b_R) + 360.0)) + 360.0) - L) + 360.0);
@@ -2760,18 +2762,18 @@ void AutopilotStateMachineModelClass::step()
   }
 
   Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lat;
-  a = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lat -
+  a = trigCache.guidanceSin((AutopilotStateMachine_U.in.data.nav_gs_position.lat -
                 AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
-  result_tmp = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lon -
+  result_tmp = trigCache.guidanceSin((AutopilotStateMachine_U.in.data.nav_gs_position.lon -
     AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
-  b_R = std::cos(Phi2);
+  b_R = trigCache.cos(Phi2);
   a = a_tmp * b_R * result_tmp * result_tmp + a * a;
   a = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
   result_tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
     AutopilotStateMachine_U.in.data.nav_gs_position.alt;
   a = std::sqrt(a * a + result_tmp * result_tmp);
   rtb_Saturation1 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lon - rtb_Saturation1;
-  rtb_Saturation1 = std::atan2(std::sin(rtb_Saturation1) * b_R, a_tmp * std::sin(Phi2) - rtb_dme * b_R * std::cos
+  rtb_Saturation1 = std::atan2(trigCache.sin(rtb_Saturation1) * b_R, a_tmp * trigCache.sin(Phi2) - rtb_dme * b_R * trigCache.cos
     (rtb_Saturation1)) * 57.295779513082323;
   if (rtb_Saturation1 + 360.0 == 0.0) {
     rtb_dme = 0.0;
@@ -2851,7 +2853,7 @@ void AutopilotStateMachineModelClass::step()
          (AutopilotStateMachine_U.in.data.nav_gs_position.lon != 0.0) ||
          (AutopilotStateMachine_U.in.data.nav_gs_position.alt != 0.0))) {
       AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_valid = true;
-      AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_error_deg = std::asin(result_tmp / a) * 57.295779513082323 -
+      AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_error_deg = trigCache.asin(result_tmp / a) * 57.295779513082323 -
         AutopilotStateMachine_DWork.nav_gs_deg;
     } else {
       guard1 = true;
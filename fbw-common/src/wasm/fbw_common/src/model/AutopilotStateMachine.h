@@ -1,3 +1,6 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
+// step() is patched by tools/model-patches/trig_cache.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_AutopilotStateMachine_h_
 #define RTW_HEADER_AutopilotStateMachine_h_
 #include <cmath>
@@ -250,6 +253,13 @@ class AutopilotStateMachineModelClass
     real_T Falling_Value_as;
   };
 
+  struct Snapshot_AutopilotStateMachine_T {
+    ExternalInputs_AutopilotStateMachine_T U;
+    ExternalOutputs_AutopilotStateMachine_T Y;
+    BlockIO_AutopilotStateMachine_T B;
+    D_Work_AutopilotStateMachine_T DWork;
+  };
+
   AutopilotStateMachineModelClass(AutopilotStateMachineModelClass const&) =delete;
   AutopilotStateMachineModelClass& operator= (AutopilotStateMachineModelClass const&) & = delete;
   void setExternalInputs(const ExternalInputs_AutopilotStateMachine_T *pExternalInputs_AutopilotStateMachine_T)
@@ -265,6 +275,22 @@ class AutopilotStateMachineModelClass
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_AutopilotStateMachine_T *pSnapshot) const
+  {
+    pSnapshot->U = AutopilotStateMachine_U;
+    pSnapshot->Y = AutopilotStateMachine_Y;
+    pSnapshot->B = AutopilotStateMachine_B;
+    pSnapshot->DWork = AutopilotStateMachine_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_AutopilotStateMachine_T *pSnapshot)
+  {
+    AutopilotStateMachine_U = pSnapshot->U;
+    AutopilotStateMachine_Y = pSnapshot->Y;
+    AutopilotStateMachine_B = pSnapshot->B;
+    AutopilotStateMachine_DWork = pSnapshot->DWork;
+  }
+
   AutopilotStateMachineModelClass();
   ~AutopilotStateMachineModelClass();
  private:
@@ -272,7 +298,7 @@ class AutopilotStateMachineModelClass
   ExternalOutputs_AutopilotStateMachine_T AutopilotStateMachine_Y;
   BlockIO_AutopilotStateMachine_T AutopilotStateMachine_B;
   D_Work_AutopilotStateMachine_T AutopilotStateMachine_DWork;
-  static Parameters_AutopilotStateMachine_T AutopilotStateMachine_P;
+  static RT_PARAMETERS_CONST Parameters_AutopilotStateMachine_T AutopilotStateMachine_P;
   static void AutopilotStateMachine_BitShift(real_T rtu_u, real_T *rty_y);
   static void AutopilotStateMachine_BitShift1(real_T rtu_u, real_T *rty_y);
   boolean_T AutopilotStateMachine_X_TO_OFF(const ap_sm_output *BusAssignment);
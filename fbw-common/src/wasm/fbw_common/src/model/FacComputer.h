@@ -1,3 +1,5 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
+// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, apply it again after regenerating
 #ifndef RTW_HEADER_FacComputer_h_
 #define RTW_HEADER_FacComputer_h_
 #include "rtwtypes.h"
@@ -321,6 +323,12 @@ class FacComputer final
     boolean_T Constant19_Value;
   };
 
+  struct Snapshot_FacComputer_T {
+    ExternalInputs_FacComputer_T U;
+    ExternalOutputs_FacComputer_T Y;
+    D_Work_FacComputer_T DWork;
+  };
+
   FacComputer(FacComputer const&) = delete;
   FacComputer& operator= (FacComputer const&) & = delete;
   FacComputer(FacComputer &&) = delete;
@@ -338,13 +346,27 @@ class FacComputer final
   void initialize();
   void step();
   static void terminate();
+  void saveSnapshot(Snapshot_FacComputer_T *pSnapshot) const
+  {
+    pSnapshot->U = FacComputer_U;
+    pSnapshot->Y = FacComputer_Y;
+    pSnapshot->DWork = FacComputer_DWork;
+  }
+
+  void restoreSnapshot(const Snapshot_FacComputer_T *pSnapshot)
+  {
+    FacComputer_U = pSnapshot->U;
+    FacComputer_Y = pSnapshot->Y;
+    FacComputer_DWork = pSnapshot->DWork;
+  }
+
   FacComputer();
   ~FacComputer();
  private:
   ExternalInputs_FacComputer_T FacComputer_U;
   ExternalOutputs_FacComputer_T FacComputer_Y;
   D_Work_FacComputer_T FacComputer_DWork;
-  static Parameters_FacComputer_T FacComputer_P;
+  static RT_PARAMETERS_CONST Parameters_FacComputer_T FacComputer_P;
   static void FacComputer_MATLABFunction(const base_arinc_429 *rtu_u, boolean_T *rty_y);
   static void FacComputer_MATLABFunction_f(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void FacComputer_LagFilter_Reset(rtDW_LagFilter_FacComputer_T *localDW);
@@ -1,6 +1,6 @@
 #include "FacComputer.h"
 
-FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
+RT_PARAMETERS_CONST FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
   {
     false,
     false,
@@ -1,3 +1,4 @@
+// the parameters are made constant by tools/model-patches/model_parameters.py after the code generation, apply it again after regenerating
 #ifndef RTWTYPES_H
 #define RTWTYPES_H
 
@@ -41,5 +42,13 @@ typedef char_T byte_T;
 
 typedef void * pointer_T;
 
+// Model parameters are constant so that they can be folded into the model code. Define
+// FBW_TUNABLE_MODEL_PARAMETERS to keep them mutable, e.g. to tune them at runtime during development.
+#ifdef FBW_TUNABLE_MODEL_PARAMETERS
+#define RT_PARAMETERS_CONST
+#else
+#define RT_PARAMETERS_CONST            const
+#endif
+
 #endif
 
@@ -11,5 +11,5 @@ class SRFlipFlop {
  private:
   bool output = false;
 
-  const bool hasSetPrecedence;
+  bool hasSetPrecedence;
 };
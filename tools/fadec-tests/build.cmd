@@ -0,0 +1,21 @@
+@echo off
+
+:: go to current directory
+pushd %~dp0
+
+:: clean build directory
+rd /s /q build
+
+:: create build files
+cmake -B build
+
+:: build
+cmake --build build --config Release
+
+:: run tests
+pushd build
+ctest -C Release --output-on-failure
+popd
+
+:: restore directory
+popd
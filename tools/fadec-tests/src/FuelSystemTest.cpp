@@ -0,0 +1,144 @@
+// steps the fuel system through a sequence of tank transfers and cross-feed configurations and checks that the tanks
+// neither gain nor lose fuel apart from what the engines and the APU burn
+
+#include "FuelSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+const double KGS_TO_LBS = 1 / 0.4535934;
+const double FUEL_WEIGHT_GALLON = 6.7;
+
+// the sum of the tanks accumulates the rounding of some 200000 steps
+const double CONSERVATION_TOLERANCE = 1e-6;  // LBS
+
+// the frame rate of the simulation varies, the fuel system is driven by the sim time of each frame
+const double FRAME_TIMES[] = {1.0 / 30, 1.0 / 24, 1.0 / 60, 1.0 / 45};
+const int FRAME_TIME_COUNT = 4;
+
+struct Phase {
+  const char* name;
+  double duration;  // seconds
+  // the simulation drains the tanks the fuel is transferred from, the fuel system adds it to the inner tanks
+  double centerTransferRate;  // LBS/ sec
+  double outerTransferRate;   // LBS/ sec of each wing
+  bool xfrValveCenterLeftOpen;
+  bool xfrValveCenterRightOpen;
+  double lineLeftToCenterFlow;
+  double lineRightToCenterFlow;
+  bool xFeedOpen;
+  bool leftPumpsOn;
+  bool rightPumpsOn;
+  bool enginesRunning;
+  double apuLineFlow;  // gallons/ hr
+};
+
+// with the cross-feed valve open and all pumps off the engines burn no fuel from the tanks, so the APU is the only
+// consumer in that phase
+const Phase PHASES[] = {
+    {"center to both wings, equal line flow", 600, 3, 0, true, true, 0, 0, false, true, true, false, 0},
+    {"center to both wings, uneven line flow", 600, 3, 0, true, true, 3, 1, false, true, true, false, 0},
+    {"center to the left wing", 600, 3, 0, true, false, 0, 0, false, true, true, false, 0},
+    {"center to the right wing", 600, 3, 0, false, true, 0, 0, false, true, true, false, 0},
+    {"outer to inner tanks", 600, 0, 0.5, false, false, 0, 0, false, true, true, false, 0},
+    {"all transfers", 600, 3, 0.5, true, true, 1, 2, false, true, true, false, 0},
+    {"all transfers, engines and APU burning", 600, 3, 0.5, true, true, 1, 2, false, true, true, true, 30},
+    {"cross-feed, left pumps off", 600, 0, 0, false, false, 0, 0, true, false, true, true, 30},
+    {"cross-feed, right pumps off", 600, 0, 0, false, false, 0, 0, true, true, false, true, 30},
+    {"cross-feed, all pumps on", 600, 3, 0, true, true, 0, 0, true, true, true, true, 30},
+    {"cross-feed, all pumps off", 600, 0, 0, false, false, 0, 0, true, false, false, false, 30},
+};
+
+// fuel flow of each engine, varied over time so that the burn of a step depends on the flow of the previous step
+static double engineFuelFlow(double time) {
+  return 2400 + 300 * std::sin(0.1 * time);  // KG/H
+}
+
+static void drain(double& quantity, double amount) {
+  quantity -= std::min(quantity, amount);
+}
+
+int main() {
+  FuelSystemState state;
+  state.pre = {12000, 12000, 1500, 1500, 14000};
+
+  double time = 0;
+  double engineFF = 0;
+  long long steps = 0;
+  bool isPassed = true;
+  double transferStart = state.pre.total();
+  double maximumDifference = 0;
+
+  for (const Phase& phase : PHASES) {
+    double phaseStart = state.pre.total();
+    double burn = 0;  // LBS
+
+    for (double phaseTime = 0; phaseTime < phase.duration; steps++) {
+      double deltaTime = FRAME_TIMES[steps % FRAME_TIME_COUNT];
+      phaseTime += deltaTime;
+      time += deltaTime;
+
+      // the inner tanks of the simulation are overwritten with the quantities of the fuel system after each step
+      FuelSystemInputs in;
+      in.actual = state.pre;
+      drain(in.actual.center, phase.centerTransferRate * deltaTime);
+      drain(in.actual.leftAux, phase.outerTransferRate * deltaTime);
+      drain(in.actual.rightAux, phase.outerTransferRate * deltaTime);
+      in.fuelWeightGallon = FUEL_WEIGHT_GALLON;
+      in.isReady = 1;
+
+      double previousEngineFF = engineFF;
+      engineFF = phase.enginesRunning ? engineFuelFlow(time) : 0;
+      in.engine1FF = engineFF;
+      in.engine2FF = engineFF;
+
+      in.xfrValveCenterLeftOpen = phase.xfrValveCenterLeftOpen;
+      in.xfrValveCenterRightOpen = phase.xfrValveCenterRightOpen;
+      in.xfrValveOuterLeft1 = phase.outerTransferRate > 0;
+      in.xfrValveOuterRight1 = phase.outerTransferRate > 0;
+      in.lineLeftToCenterFlow = phase.lineLeftToCenterFlow;
+      in.lineRightToCenterFlow = phase.lineRightToCenterFlow;
+      in.xFeedValve = phase.xFeedOpen;
+      in.leftPump1 = phase.leftPumpsOn;
+      in.leftPump2 = phase.leftPumpsOn;
+      in.rightPump1 = phase.rightPumpsOn;
+      in.rightPump2 = phase.rightPumpsOn;
+      in.apuLineFlow = phase.apuLineFlow;
+      in.apuNpercent = phase.apuLineFlow > 0 ? 100 : 0;
+
+      // the flow changes linearly over the step, each of the two engines burns the mean of its flows unless no tank supplies
+      // fuel
+      if (!(phase.xFeedOpen && !phase.leftPumpsOn && !phase.rightPumpsOn)) {
+        burn += (previousEngineFF + engineFF) * deltaTime / 3600 * KGS_TO_LBS;
+      }
+      burn += phase.apuLineFlow * FUEL_WEIGHT_GALLON * deltaTime / 3600;
+
+      if (FuelSystem::step(state, in, deltaTime) != FuelTankWrite::Inner) {
+        std::cout << phase.name << ": the fuel system did not write the inner tanks FAILED" << std::endl;
+        isPassed = false;
+      }
+    }
+
+    double difference = state.pre.total() - (phaseStart - burn);
+    bool isConserved = std::abs(difference) <= CONSERVATION_TOLERANCE;
+    isPassed = isPassed && isConserved;
+    maximumDifference = std::max(maximumDifference, std::abs(difference));
+    std::cout << "  " << phase.name << ": " << phaseStart << " lbs, burnt " << burn << " lbs, difference " << difference << " lbs"
+              << (isConserved ? "" : " FAILED") << std::endl;
+
+    // the transfer phases come first, after each of them the tanks hold the fuel they held at the start
+    if (!phase.enginesRunning && phase.apuLineFlow == 0) {
+      double transferDifference = state.pre.total() - transferStart;
+      if (std::abs(transferDifference) > CONSERVATION_TOLERANCE) {
+        std::cout << "  transfer sequence: difference " << transferDifference << " lbs FAILED" << std::endl;
+        isPassed = false;
+      }
+    }
+  }
+
+  std::cout << "stepped " << steps << " frames of " << time << " s sim time, tolerance " << CONSERVATION_TOLERANCE
+            << " lbs, maximum difference " << maximumDifference << " lbs" << std::endl;
+  std::cout << (isPassed ? "PASSED" : "FAILED") << std::endl;
+  return isPassed ? 0 : 1;
+}
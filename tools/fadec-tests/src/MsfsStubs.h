@@ -0,0 +1,42 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// the parts of the MSFS gauge API which the FADEC headers need to compile natively, the tests do not read or write simulation
+// variables, so every variable reads as zero
+
+typedef int ENUM;
+typedef int ID;
+typedef int32_t SINT32;
+typedef double FLOAT64;
+typedef void* HANDLE;
+
+inline ENUM get_units_enum(const char*) {
+  return 0;
+}
+
+inline ENUM get_aircraft_var_enum(const char*) {
+  return 0;
+}
+
+inline FLOAT64 aircraft_varget(ENUM, ENUM, SINT32) {
+  return 0;
+}
+
+inline ID register_named_variable(const char*) {
+  return 0;
+}
+
+inline FLOAT64 get_named_variable_value(ID) {
+  return 0;
+}
+
+inline void set_named_variable_value(ID, FLOAT64) {}
+
+// the gauge headers of the simulator provide min and max globally
+using std::max;
+using std::min;
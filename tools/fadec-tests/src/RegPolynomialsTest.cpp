@@ -0,0 +1,155 @@
+// compares the regression polynomials in Horner form with the expanded power sums they replaced over the operating range
+// of their inputs
+
+#include "MsfsStubs.h"
+
+#include "RegPolynomials.h"
+
+#include "ReferencePolynomials.h"
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Horner form and power sum differ by the rounding of their operations only, see hornerFBW
+const double PARITY_TOLERANCE = 1e-9;  // relative to the result, at least 1
+
+const int SAMPLES = 200000;
+
+struct Range {
+  double lower;
+  double upper;
+};
+
+struct Deviation {
+  double maximum = 0;
+  std::vector<double> inputs;
+};
+
+static Polynomial polynomial;
+static reference::Polynomial referencePolynomial;
+
+// the start-up polynomials of the core spool, N2 of the A32NX and N3 of the A380X, scale to the idle values of the engine
+#ifdef FADEC_TEST_A380X
+const char* CORE_SPOOL = "N3";
+static double startCore(Polynomial& p, double n, double preN, double idleN) {
+  return p.startN3(n, preN, idleN);
+}
+static double startCore(reference::Polynomial& p, double n, double preN, double idleN) {
+  return p.startN3(n, preN, idleN);
+}
+#else
+const char* CORE_SPOOL = "N2";
+static double startCore(Polynomial& p, double n, double preN, double idleN) {
+  return p.startN2(n, preN, idleN);
+}
+static double startCore(reference::Polynomial& p, double n, double preN, double idleN) {
+  return p.startN2(n, preN, idleN);
+}
+#endif
+
+// the core spool during the start as a fraction of its idle value, slightly beyond idle where the start ends
+const Range START_FRACTION = {0, 1.05};
+const Range IDLE_CORE = {55, 75};              // %
+const Range IDLE_N1 = {15, 25};                // %
+const Range IDLE_FF = {200, 1500};             // kg/h
+const Range IDLE_EGT = {300, 650};             // degrees C
+const Range AMBIENT_TEMPERATURE = {-60, 55};   // degrees C
+const Range CORRECTED_N1 = {0, 110};           // %
+const Range CORRECTED_FUEL_FLOW = {0, 30000};  // lbs/h
+const Range MACH = {0, 0.95};
+const Range ALTITUDE = {-2000, 45000};  // ft
+const Range THRUST = {0, 80000};        // lbs
+const Range CORE_SPEED = {0, 110};      // %
+
+static bool isPassed = true;
+
+// evaluates both forms at random inputs and the corners of the ranges and reports the largest difference
+static void compare(const char* name,
+                    const std::vector<Range>& ranges,
+                    const std::function<double(Polynomial&, const std::vector<double>&)>& evaluate,
+                    const std::function<double(reference::Polynomial&, const std::vector<double>&)>& evaluateReference) {
+  Deviation deviation;
+  std::mt19937_64 generator(1);
+  std::vector<double> inputs(ranges.size());
+
+  auto check = [&]() {
+    double expected = evaluateReference(referencePolynomial, inputs);
+    double difference = std::abs(evaluate(polynomial, inputs) - expected) / std::max(1.0, std::abs(expected));
+    if (!(difference <= deviation.maximum)) {
+      deviation.maximum = difference;
+      deviation.inputs = inputs;
+    }
+  };
+
+  for (size_t corner = 0; corner < (size_t{1} << ranges.size()); corner++) {
+    for (size_t i = 0; i < ranges.size(); i++) {
+      inputs[i] = (corner >> i) & 1 ? ranges[i].upper : ranges[i].lower;
+    }
+    check();
+  }
+  for (int sample = 0; sample < SAMPLES; sample++) {
+    for (size_t i = 0; i < ranges.size(); i++) {
+      inputs[i] = std::uniform_real_distribution<double>(ranges[i].lower, ranges[i].upper)(generator);
+    }
+    check();
+  }
+
+  bool isWithin = deviation.maximum <= PARITY_TOLERANCE;
+  isPassed = isPassed && isWithin;
+  std::cout << "  " << name << ": maximum difference " << deviation.maximum << " at (";
+  for (size_t i = 0; i < deviation.inputs.size(); i++) {
+    std::cout << (i > 0 ? ", " : "") << deviation.inputs[i];
+  }
+  std::cout << ")" << (isWithin ? "" : " FAILED") << std::endl;
+}
+
+int main() {
+  // the start-up values are compared as fractions of their idle values, which is what the polynomials compute, as the
+  // scaling to the idle values amplifies the rounding where a polynomial crosses zero
+  std::cout << "start-up, core spool " << CORE_SPOOL << std::endl;
+  compare(
+      "core spool", {START_FRACTION, IDLE_CORE},
+      [](Polynomial& p, const std::vector<double>& x) { return startCore(p, x[0] * x[1], 0, x[1]) / x[1]; },
+      [](reference::Polynomial& p, const std::vector<double>& x) { return startCore(p, x[0] * x[1], 0, x[1]) / x[1]; });
+  compare(
+      "N1", {START_FRACTION, IDLE_CORE, IDLE_N1},
+      [](Polynomial& p, const std::vector<double>& x) { return p.startN1(x[0] * x[1], x[1], x[2]) / x[2]; },
+      [](reference::Polynomial& p, const std::vector<double>& x) { return p.startN1(x[0] * x[1], x[1], x[2]) / x[2]; });
+  compare(
+      "fuel flow", {START_FRACTION, IDLE_CORE, IDLE_FF},
+      [](Polynomial& p, const std::vector<double>& x) { return p.startFF(x[0] * x[1], x[1], x[2]) / x[2]; },
+      [](reference::Polynomial& p, const std::vector<double>& x) { return p.startFF(x[0] * x[1], x[1], x[2]) / x[2]; });
+  compare(
+      "EGT", {START_FRACTION, IDLE_CORE, AMBIENT_TEMPERATURE, IDLE_EGT},
+      [](Polynomial& p, const std::vector<double>& x) {
+        return (p.startEGT(x[0] * x[1], x[1], x[2], x[3]) - x[2]) / (x[3] - x[2]);
+      },
+      [](reference::Polynomial& p, const std::vector<double>& x) {
+        return (p.startEGT(x[0] * x[1], x[1], x[2], x[3]) - x[2]) / (x[3] - x[2]);
+      });
+
+  std::cout << "corrected" << std::endl;
+  compare(
+      "EGT", {CORRECTED_N1, CORRECTED_FUEL_FLOW, MACH, ALTITUDE},
+      [](Polynomial& p, const std::vector<double>& x) { return p.correctedEGT(x[0], x[1], x[2], x[3]); },
+      [](reference::Polynomial& p, const std::vector<double>& x) { return p.correctedEGT(x[0], x[1], x[2], x[3]); });
+  compare(
+      "fuel flow", {CORRECTED_N1, MACH, ALTITUDE},
+      [](Polynomial& p, const std::vector<double>& x) { return p.correctedFuelFlow(x[0], x[1], x[2]); },
+      [](reference::Polynomial& p, const std::vector<double>& x) { return p.correctedFuelFlow(x[0], x[1], x[2]); });
+
+  std::cout << "oil" << std::endl;
+  compare(
+      "gulp", {THRUST}, [](Polynomial& p, const std::vector<double>& x) { return p.oilGulpPct(x[0]); },
+      [](reference::Polynomial& p, const std::vector<double>& x) { return p.oilGulpPct(x[0]); });
+  compare(
+      "pressure", {CORE_SPEED}, [](Polynomial& p, const std::vector<double>& x) { return p.oilPressure(x[0]); },
+      [](reference::Polynomial& p, const std::vector<double>& x) { return p.oilPressure(x[0]); });
+
+  std::cout << "tolerance " << PARITY_TOLERANCE << " of the result" << std::endl;
+  std::cout << (isPassed ? "PASSED" : "FAILED") << std::endl;
+  return isPassed ? 0 : 1;
+}
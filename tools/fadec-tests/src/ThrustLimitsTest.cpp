@@ -0,0 +1,148 @@
+// compares the table driven ThrustLimits with the N1 limit computation it replaced over the flight envelope
+
+#include "MsfsStubs.h"
+
+#include "ThrustLimits.h"
+
+#include "ReferenceThrustLimits.h"
+
+#include <cmath>
+#include <iostream>
+
+// the tables and the interpolation are the same, only the order of the floating point operations differs
+const double PARITY_TOLERANCE = 1e-9;
+
+const char* LIMIT_NAMES[] = {"TO", "GA", "FLEX TO", "FLEX GA", "CLB", "MCT"};
+const int LIMIT_COUNT = 6;
+
+struct Deviation {
+  double maximum = 0;
+  double altitude = 0;
+  double temperature = 0;
+  double pressure = 0;
+  double flexTemp = 0;
+  int bleed = 0;
+};
+
+// pressure of the standard atmosphere in hPa
+static double standardPressure(double altitude) {
+  if (altitude < 36089) {
+    return 1013.25 * std::pow(1 - 6.8755856e-6 * altitude, 5.2558797);
+  }
+  return 226.32 * std::exp(-(altitude - 36089) / 20805.8);
+}
+
+// the limits as the FADEC computed them before, TO and GA are limited to 16600 ft and FLEX is only computed with a flex temperature
+static void referenceLimits(double altitude,
+                            double temperature,
+                            double pressure,
+                            double flexTemp,
+                            double ac,
+                            double nacelle,
+                            double wing,
+                            double* limits) {
+  double takeoffAltitude = std::min(16600.0, altitude);
+  limits[0] = reference::limitN1(0, takeoffAltitude, temperature, pressure, 0, ac, nacelle, wing);
+  limits[1] = reference::limitN1(1, takeoffAltitude, temperature, pressure, 0, ac, nacelle, wing);
+  limits[2] = flexTemp > 0 ? reference::limitN1(0, takeoffAltitude, temperature, pressure, flexTemp, ac, nacelle, wing) : 0;
+  limits[3] = flexTemp > 0 ? reference::limitN1(1, takeoffAltitude, temperature, pressure, flexTemp, ac, nacelle, wing) : 0;
+  limits[4] = reference::limitN1(2, altitude, temperature, pressure, 0, ac, nacelle, wing);
+  limits[5] = reference::limitN1(3, altitude, temperature, pressure, 0, ac, nacelle, wing);
+}
+
+// records the largest difference of the result to the reference limits, a result may match one of two sets of limits
+static void compare(const N1Limits& result,
+                    const double* expected,
+                    const double* alternative,
+                    double altitude,
+                    double temperature,
+                    double pressure,
+                    double flexTemp,
+                    int bleed,
+                    Deviation* deviations) {
+  const double actual[LIMIT_COUNT] = {result.to, result.ga, result.flexTo, result.flexGa, result.clb, result.mct};
+  for (int i = 0; i < LIMIT_COUNT; i++) {
+    double difference = std::abs(actual[i] - expected[i]);
+    if (alternative != nullptr) {
+      difference = std::min(difference, std::abs(actual[i] - alternative[i]));
+    }
+    if (!(difference <= deviations[i].maximum)) {
+      deviations[i] = {difference, altitude, temperature, pressure, flexTemp, bleed};
+    }
+  }
+}
+
+// prints the largest differences, without tolerance they are only reported
+static bool report(const char* title, const Deviation* deviations, double tolerance) {
+  bool isPassed = true;
+  std::cout << title;
+  if (tolerance >= 0) {
+    std::cout << ", tolerance " << tolerance << " N1";
+  }
+  std::cout << std::endl;
+  for (int i = 0; i < LIMIT_COUNT; i++) {
+    const Deviation& deviation = deviations[i];
+    bool isWithinTolerance = tolerance < 0 || deviation.maximum <= tolerance;
+    isPassed = isPassed && isWithinTolerance;
+    std::cout << "  " << LIMIT_NAMES[i] << ": maximum difference " << deviation.maximum;
+    if (deviation.maximum > 0) {
+      std::cout << " at " << deviation.altitude << " ft, " << deviation.temperature << " C, " << deviation.pressure << " hPa, flex "
+                << deviation.flexTemp << " C, bleed " << deviation.bleed;
+    }
+    std::cout << (isWithinTolerance ? "" : " FAILED") << std::endl;
+  }
+  return isPassed;
+}
+
+int main() {
+  // the pressure is varied around the standard atmosphere, it sets the Mach number of the CLB and MCT speed schedules
+  const double pressureFactors[] = {0.97, 1.0, 1.03};
+  const double flexTemps[] = {0, 30, 50, 70};
+
+  ThrustLimits thrustLimits;
+  Deviation parity[LIMIT_COUNT];
+  Deviation quantization[LIMIT_COUNT];
+  Deviation quantizationStep[LIMIT_COUNT];
+  long long points = 0;
+
+  for (double altitude = -2000; altitude <= 45000; altitude += 100) {
+    for (double pressureFactor : pressureFactors) {
+      double pressure = standardPressure(altitude) * pressureFactor;
+      for (double temperature = -60; temperature <= 55; temperature += 1) {
+        for (double flexTemp : flexTemps) {
+          for (int bleed = 0; bleed < 8; bleed++) {
+            double ac = bleed & 1;
+            double nacelle = (bleed >> 1) & 1;
+            double wing = (bleed >> 2) & 1;
+
+            // every point of the grid differs from the previous one by more than the quantization, so the limits are computed
+            double expected[LIMIT_COUNT];
+            referenceLimits(altitude, temperature, pressure, flexTemp, ac, nacelle, wing, expected);
+            const N1Limits& limits = thrustLimits.compute(altitude, temperature, pressure, flexTemp, ac, nacelle, wing);
+            compare(limits, expected, nullptr, altitude, temperature, pressure, flexTemp, bleed, parity);
+
+            // a change within the quantization step reuses the limits of the point, so the result has to be the limits of either
+            // input, the difference to the limits of the later input is only reported: it is large where the bleed correction of
+            // the reference steps between its bands
+            double nearAltitude = altitude + 0.4 * ThrustLimits::ALTITUDE_STEP;
+            double nearTemperature = temperature + 0.4 * ThrustLimits::TEMPERATURE_STEP;
+            double nearPressure = pressure + 0.4 * ThrustLimits::PRESSURE_STEP;
+            double nearExpected[LIMIT_COUNT];
+            referenceLimits(nearAltitude, nearTemperature, nearPressure, flexTemp, ac, nacelle, wing, nearExpected);
+            const N1Limits& nearLimits = thrustLimits.compute(nearAltitude, nearTemperature, nearPressure, flexTemp, ac, nacelle, wing);
+            compare(nearLimits, nearExpected, expected, nearAltitude, nearTemperature, nearPressure, flexTemp, bleed, quantization);
+            compare(nearLimits, nearExpected, nullptr, nearAltitude, nearTemperature, nearPressure, flexTemp, bleed, quantizationStep);
+            points++;
+          }
+        }
+      }
+    }
+  }
+
+  std::cout << "compared " << points << " points of altitude, temperature, pressure, flex temperature and bleed" << std::endl;
+  bool isPassed = report("parity with the reference", parity, PARITY_TOLERANCE);
+  isPassed = report("parity within a quantization step", quantization, PARITY_TOLERANCE) && isPassed;
+  report("difference to the reference within a quantization step", quantizationStep, -1);
+  std::cout << (isPassed ? "PASSED" : "FAILED") << std::endl;
+  return isPassed ? 0 : 1;
+}
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "common.h"
+
+// the regression polynomials of the FADEC before they were evaluated in Horner form, kept unchanged as the reference of
+// the parity test
+namespace reference {
+
+/// <summary>
+/// A collection of multi-variate regression polynomials for engine parameters
+/// </summary>
+/// <returns>True if successful, false otherwise.</returns>
+class Polynomial {
+ public:
+  /// <summary>
+  /// Shutdown polynomials - N3 (%)
+  /// </summary>
+  double shutdownN3(double preN3, double deltaTime) {
+    double outN3 = 0;
+    double k = -0.08183;
+
+    if (preN3 < 30)
+      k = -0.0515;
+
+    outN3 = preN3 * expFBW(k * deltaTime);
+
+    return outN3;
+  }
+
+  /// <summary>
+  /// Shutdown polynomials - N1 (%)
+  /// </summary>
+  double shutdownN1(double preN1, double deltaTime) {
+    double outN1 = 0;
+    double k = -0.164;
+
+    if (preN1 < 4)
+      k = -0.08;
+
+    outN1 = preN1 * expFBW(k * deltaTime);
+
+    return outN1;
+  }
+
+  /// <summary>
+  /// Shutdown polynomials - EGT (degrees C)
+  /// </summary>
+  double shutdownEGT(double preEGT, double ambientTemp, double deltaTime) {
+    double outEGT = 0;
+    double threshold = ambientTemp + 140;
+    double k = 0;
+    double ts = 0;
+
+    if (preEGT > threshold) {
+      k = 0.0257743;
+      ts = 135 + ambientTemp;
+    } else {
+      k = 0.00072756;
+      ts = 30 + ambientTemp;
+    }
+
+    outEGT = ts + (preEGT - ts) * expFBW(-k * deltaTime);
+
+    return outEGT;
+  }
+
+  /// <summary>
+  /// Start-up polynomials - N3 (%)
+  /// </summary>
+  double startN3(double n3, double preN3, double idleN3) {
+    double outN3 = 0;
+    double normalN3 = 0;
+
+    normalN3 = n3 * 60.0 / idleN3;
+
+    double c_N3[16] = {4.03649879e+00,  -9.41981960e-01, 1.98426614e-01,  -2.11907840e-02, 1.00777507e-03,  -1.57319166e-06,
+                       -2.15034888e-06, 1.08288379e-07,  -2.48504632e-09, 2.52307089e-11,  -2.06869243e-14, 8.99045761e-16,
+                       -9.94853959e-17, 1.85366499e-18,  -1.44869928e-20, 4.31033031e-23};
+
+    outN3 = c_N3[0] + (c_N3[1] * normalN3) + (c_N3[2] * powFBW(normalN3, 2)) + (c_N3[3] * powFBW(normalN3, 3)) +
+            (c_N3[4] * powFBW(normalN3, 4)) + (c_N3[5] * powFBW(normalN3, 5)) + (c_N3[6] * powFBW(normalN3, 6)) +
+            (c_N3[7] * powFBW(normalN3, 7)) + (c_N3[8] * powFBW(normalN3, 8)) + (c_N3[9] * powFBW(normalN3, 9)) +
+            (c_N3[10] * powFBW(normalN3, 10)) + (c_N3[11] * powFBW(normalN3, 11)) + (c_N3[12] * powFBW(normalN3, 12)) +
+            (c_N3[13] * powFBW(normalN3, 13)) + (c_N3[14] * powFBW(normalN3, 14)) + (c_N3[15] * powFBW(normalN3, 15));
+
+    outN3 = outN3 * n3;
+
+    if (outN3 < preN3) {
+      outN3 = preN3 + 0.002;
+    }
+    if (outN3 >= idleN3 + 0.1) {
+      outN3 = idleN3 + 0.05;
+    }
+
+    return outN3;
+  }
+
+  /// <summary>
+  /// Start-up polynomials - N1 (%)
+  /// </summary>
+  double startN1(double fbwN3, double idleN3, double idleN1) {
+    double normalN1pre = 0;
+    double normalN1post = 0;
+    double normalN3 = fbwN3 / idleN3;
+    double c_N1[9] = {-2.2812156e-12, -5.9830374e+01, 7.0629094e+02,  -3.4580361e+03, 9.1428923e+03,
+                      -1.4097740e+04, 1.2704110e+04,  -6.2099935e+03, 1.2733071e+03};
+
+    normalN1pre = (-2.4698087 * powFBW(normalN3, 3)) + (0.9662026 * powFBW(normalN3, 2)) + (0.0701367 * normalN3);
+
+    normalN1post = c_N1[0] + (c_N1[1] * normalN3) + (c_N1[2] * powFBW(normalN3, 2)) + (c_N1[3] * powFBW(normalN3, 3)) +
+                   (c_N1[4] * powFBW(normalN3, 4)) + (c_N1[5] * powFBW(normalN3, 5)) + (c_N1[6] * powFBW(normalN3, 6)) +
+                   (c_N1[7] * powFBW(normalN3, 7)) + (c_N1[8] * powFBW(normalN3, 8));
+
+    if (normalN1post >= normalN1pre)
+      return normalN1post * idleN1;
+    else
+      return normalN1pre * idleN1;
+  }
+
+  /// <summary>
+  /// Start-up polynomials - Fuel Flow (Kg/hr)
+  /// </summary>
+  double startFF(double fbwN3, double idleN3, double idleFF) {
+    double normalFF = 0;
+    double outFF = 0;
+    double normalN3 = fbwN3 / idleN3;
+
+    if (normalN3 <= 0.37) {
+      normalFF = 0;
+    } else {
+      double c_FF[9] = {3.1110282e-12, 1.0804331e+02,  -1.3972629e+03, 7.4874131e+03, -2.1511983e+04,
+                        3.5957757e+04, -3.5093994e+04, 1.8573033e+04,  -4.1220062e+03};
+
+      normalFF = c_FF[0] + (c_FF[1] * normalN3) + (c_FF[2] * powFBW(normalN3, 2)) + (c_FF[3] * powFBW(normalN3, 3)) +
+                 (c_FF[4] * powFBW(normalN3, 4)) + (c_FF[5] * powFBW(normalN3, 5)) + (c_FF[6] * powFBW(normalN3, 6)) +
+                 (c_FF[7] * powFBW(normalN3, 7)) + (c_FF[8] * powFBW(normalN3, 8));
+    }
+
+    if (normalFF < 0) {
+      normalFF = 0;
+    }
+
+    return normalFF * idleFF;
+  }
+
+  /// <summary>
+  /// Start-up polynomials - EGT (Celsius)
+  /// </summary>
+  double startEGT(double fbwN3, double idleN3, double ambientTemp, double idleEGT) {
+    double normalEGT = 0;
+    double outEGT = 0;
+    double normalN3 = fbwN3 / idleN3;
+
+    if (normalN3 < 0.17) {
+      normalEGT = 0;
+    } else if (normalN3 <= 0.4) {
+      normalEGT = (0.04783 * normalN3) - 0.00813;
+    } else {
+      double c_EGT[9] = {-6.8725167e+02, 7.7548864e+03,  -3.7507098e+04, 1.0147016e+05, -1.6779273e+05,
+                         1.7357157e+05,  -1.0960924e+05, 3.8591956e+04,  -5.7912600e+03};
+
+      normalEGT = c_EGT[0] + (c_EGT[1] * normalN3) + (c_EGT[2] * powFBW(normalN3, 2)) + (c_EGT[3] * powFBW(normalN3, 3)) +
+                  (c_EGT[4] * powFBW(normalN3, 4)) + (c_EGT[5] * powFBW(normalN3, 5)) + (c_EGT[6] * powFBW(normalN3, 6)) +
+                  (c_EGT[7] * powFBW(normalN3, 7)) + (c_EGT[8] * powFBW(normalN3, 8));
+    }
+
+    outEGT = (normalEGT * (idleEGT - (ambientTemp))) + (ambientTemp);
+
+    return outEGT;
+  }
+
+  /// <summary>
+  /// Start-up polynomials - Oil Temperature (Celsius)
+  /// </summary>
+  double startOilTemp(double fbwN3, double idleN3, double ambientTemp) {
+    double outOilTemp = 0;
+
+    if (fbwN3 < 0.79 * idleN3) {
+      outOilTemp = ambientTemp;
+    } else if (fbwN3 < 0.98 * idleN3) {
+      outOilTemp = ambientTemp + 5;
+    } else {
+      outOilTemp = ambientTemp + 10;
+    }
+
+    return outOilTemp;
+  }
+
+  /// <summary>
+  /// Real-life modeled polynomials - Corrected EGT (Celsius)
+  /// </summary>
+  double correctedEGT(double cn1, double cff, double mach, double alt) {
+    double outCEGT = 0;
+    cff = cff / 2; // to account for the A380 double fuel flow. Will have to be taken care of
+
+    double c_EGT[16] = {3.2636e+02,  0.0000e+00, 9.2893e-01, 3.9505e-02,  3.9070e+02, -4.7911e-04, 7.7679e-03,  5.8361e-05,
+                        -2.5566e+00, 5.1227e-06, 1.0178e-07, -7.4602e-03, 1.2106e-07, -5.1639e+01, -2.7356e-03, 1.9312e-08};
+
+    outCEGT = c_EGT[0] + c_EGT[1] + (c_EGT[2] * cn1) + (c_EGT[3] * cff) + (c_EGT[4] * mach) + (c_EGT[5] * alt) +
+              (c_EGT[6] * powFBW(cn1, 2)) + (c_EGT[7] * cn1 * cff) + (c_EGT[8] * cn1 * mach) + (c_EGT[9] * cn1 * alt) +
+              (c_EGT[10] * powFBW(cff, 2)) + (c_EGT[11] * mach * cff) + (c_EGT[12] * cff * alt) + (c_EGT[13] * powFBW(mach, 2)) +
+              (c_EGT[14] * mach * alt) + (c_EGT[15] * powFBW(alt, 2));
+
+    return outCEGT;
+  }
+
+  /// <summary>
+  /// Real-life modeled polynomials - Corrected Fuel Flow (lbs/ hr)
+  /// </summary>
+  double correctedFuelFlow(double cn1, double mach, double alt) {
+    double outCFF = 0;
+
+    double c_Flow[21] = {-1.7630e+02, -2.1542e-01, 4.7119e+01,  6.1519e+02,  1.8047e-03, -4.4554e-01, -4.3940e+01,
+                         4.0459e-05,  -3.2912e+01, -6.2894e-03, -1.2544e-07, 1.0938e-02, 4.0936e-01,  -5.5841e-06,
+                         -2.3829e+01, 9.3269e-04,  2.0273e-11,  -2.4100e+02, 1.4171e-02, -9.5581e-07, 1.2728e-11};
+
+    outCFF = c_Flow[0] + c_Flow[1] + (c_Flow[2] * cn1) + (c_Flow[3] * mach) + (c_Flow[4] * alt) + (c_Flow[5] * powFBW(cn1, 2)) +
+             (c_Flow[6] * cn1 * mach) + (c_Flow[7] * cn1 * alt) + (c_Flow[8] * powFBW(mach, 2)) + (c_Flow[9] * mach * alt) +
+             (c_Flow[10] * powFBW(alt, 2)) + (c_Flow[11] * powFBW(cn1, 3)) + (c_Flow[12] * powFBW(cn1, 2) * mach) +
+             (c_Flow[13] * powFBW(cn1, 2) * alt) + (c_Flow[14] * cn1 * powFBW(mach, 2)) + (c_Flow[15] * cn1 * mach * alt) +
+             (c_Flow[16] * cn1 * powFBW(alt, 2)) + (c_Flow[17] * powFBW(mach, 3)) + (c_Flow[18] * powFBW(mach, 2) * alt) +
+             (c_Flow[19] * mach * powFBW(alt, 2)) + (c_Flow[20] * powFBW(alt, 3));
+
+    return 2*outCFF;
+  }
+
+  double oilTemperature(double energy, double preOilTemp, double maxOilTemp, double deltaTime) {
+    double t_steady = 0;
+    double k = 0.001;
+    double dt = 0;
+    double oilTemp_out;
+
+    dt = energy * deltaTime * 0.002;
+
+    t_steady = ((maxOilTemp * k * deltaTime) + preOilTemp) / (1 + (k * deltaTime));
+
+    if (t_steady - dt >= maxOilTemp) {
+      oilTemp_out = maxOilTemp;
+    } else if (t_steady - dt >= maxOilTemp - 10) {
+      oilTemp_out = (t_steady - dt) * 0.999997;
+    } else {
+      oilTemp_out = (t_steady - dt);
+    }
+
+    // std::cout << "FADEC: Max= " << maxOilTemp << " Energy = " << energy << " dt = " << dt << " preT= " << preOilTemp
+    //          << " Tss = " << t_steady << " To = " << oilTemp_out << std::flush;
+
+    return oilTemp_out;
+  }
+
+  /// <summary>
+  /// Real-life modeled polynomials - Oil Gulping (%)
+  /// </summary>
+  double oilGulpPct(double thrust) {
+    double outOilGulpPct = 0;
+
+    double c_OilGulp[3] = {20.1968848, -1.2270302e-4, 1.78442e-8};
+
+    outOilGulpPct = c_OilGulp[0] + (c_OilGulp[1] * thrust) + (c_OilGulp[2] * powFBW(thrust, 2));
+
+    return outOilGulpPct / 100;
+  }
+
+  /// <summary>
+  /// Real-life modeled polynomials - Oil Pressure (PSI)
+  /// </summary>
+  double oilPressure(double simN3) {
+    double outOilPressure = 0;
+
+    double c_OilPress[3] = {-0.88921, 0.23711, 0.00682};
+
+    outOilPressure = c_OilPress[0] + (c_OilPress[1] * simN3) + (c_OilPress[2] * powFBW(simN3, 2));
+
+    return outOilPressure;
+  }
+};
+
+}  // namespace reference
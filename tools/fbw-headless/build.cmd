@@ -0,0 +1,23 @@
+@echo off
+
+:: go to current directory
+pushd %~dp0
+
+:: clean build directory
+rd /s /q build
+
+:: create build files
+cmake -B build
+
+:: build
+cmake --build build --config Release
+
+:: get current sha
+for /f %%i in ('git rev-parse --short HEAD') do set GIT_SHA=%%i
+
+:: copy result
+copy build\Release\fbw-headless-a32nx.exe fbw-headless-a32nx_%GIT_SHA%.exe
+copy build\Release\fbw-headless-a380x.exe fbw-headless-a380x_%GIT_SHA%.exe
+
+:: restore directory
+popd
@@ -0,0 +1,207 @@
+#include <ini.h>
+#include <ini_type_conversion.h>
+#include <algorithm>
+#include <cmath>
+
+#include "ApproachPilot.h"
+#include "PlantSensors.h"
+
+using namespace mINI;
+
+static constexpr double DEG_TO_RAD = M_PI / 180.0;
+static constexpr double RAD_TO_DEG = 180.0 / M_PI;
+static constexpr double FEET_TO_METERS = 0.3048;
+static constexpr double METERS_TO_FEET = 1.0 / 0.3048;
+static constexpr double KNOTS_TO_MS = 0.514444;
+static constexpr double NAUTICAL_MILES_TO_METERS = 1852.0;
+
+// detent of the thrust levers that lets the autothrust use the climb thrust
+static constexpr double CLIMB_DETENT_TLA_DEG = 25.0;
+
+// the autothrust instinctive pushbutton is pressed for a moment once the computers are up
+static constexpr double AUTOTHRUST_PUSH_TIME_S = 25.0;
+static constexpr double AUTOTHRUST_PUSH_DURATION_S = 0.1;
+
+// the autothrust mode requested by the autopilot state machine for the speed mode
+static constexpr double AUTOTHRUST_MODE_SPEED = 1;
+
+// glide path: the flight path is corrected proportionally to the height deviation, the sidestick commands the load factor
+// in normal law and therefore the rate of the flight path, the stick gains are set per aircraft
+static constexpr double GLIDE_PATH_GAIN_DEG_PER_FT = 0.03;
+static constexpr double GLIDE_PATH_CORRECTION_LIMIT_DEG = 1.5;
+static constexpr double PITCH_INTEGRAL_LIMIT_DEG_S = 60.0;
+
+// the flare mode of the pitch law lowers the nose, the pilot pulls firmly against it, damps the pitch rate and only
+// relaxes the stick when the aircraft floats
+static constexpr double FLARE_PITCH_RATE_GAIN_PER_DEG_S = 0.1;
+
+// localizer: bank from the lateral deviation and its rate, the sidestick commands the roll rate in normal law
+static constexpr double LATERAL_GAIN_RAD_PER_M = 0.0023;
+static constexpr double LATERAL_RATE_GAIN_RAD_PER_M_S = 0.021;
+static constexpr double BANK_LIMIT_DEG = 15.0;
+static constexpr double ROLL_GAIN_PER_DEG = 0.044;
+
+// the rudder keeps the aircraft on the centreline during the roll out
+static constexpr double ROLLOUT_GAIN_PER_M = 0.02;
+static constexpr double ROLLOUT_RATE_GAIN_PER_M_S = 0.1;
+
+bool ApproachConfiguration::load(const std::string& filePath) {
+  INIStructure structure;
+  INIFile file(filePath);
+  bool success = file.read(structure);
+
+  runwayHeadingDeg = INITypeConversion::getDouble(structure, "APPROACH", "RUNWAY_HEADING_DEG", 90.0);
+  fieldElevationFt = INITypeConversion::getDouble(structure, "APPROACH", "FIELD_ELEVATION_FT", 0.0);
+  fieldLatitudeDeg = INITypeConversion::getDouble(structure, "APPROACH", "FIELD_LATITUDE_DEG", 47.0);
+  fieldLongitudeDeg = INITypeConversion::getDouble(structure, "APPROACH", "FIELD_LONGITUDE_DEG", 8.0);
+
+  startDistanceNm = INITypeConversion::getDouble(structure, "APPROACH", "START_DISTANCE_NM", 5.0);
+  glideSlopeDeg = INITypeConversion::getDouble(structure, "APPROACH", "GLIDE_SLOPE_DEG", 3.0);
+  glidePathOriginM = INITypeConversion::getDouble(structure, "APPROACH", "GLIDE_PATH_ORIGIN_M", 300.0);
+  approachSpeedKn = INITypeConversion::getDouble(structure, "APPROACH", "SPEED_KN", 135.0);
+  flapsConfiguration =
+      std::clamp(INITypeConversion::getInteger(structure, "APPROACH", "FLAPS_CONFIGURATION", 5), 0, FLAPS_CONFIGURATION_COUNT - 1);
+
+  pitchGainPerDeg = INITypeConversion::getDouble(structure, "APPROACH", "PITCH_GAIN_PER_DEG", 0.035);
+  pitchIntegralGainPerDegS = INITypeConversion::getDouble(structure, "APPROACH", "PITCH_INTEGRAL_GAIN_PER_DEG_S", 0.005);
+
+  flareHeightFt = INITypeConversion::getDouble(structure, "APPROACH", "FLARE_HEIGHT_FT", 40.0);
+  flarePitchGainPerDeg = INITypeConversion::getDouble(structure, "APPROACH", "FLARE_PITCH_GAIN_PER_DEG", 0.25);
+  retardHeightFt = INITypeConversion::getDouble(structure, "APPROACH", "RETARD_HEIGHT_FT", 20.0);
+  touchdownSinkRateFtS = INITypeConversion::getDouble(structure, "APPROACH", "TOUCHDOWN_SINK_RATE_FT_S", 2.0);
+  brake = INITypeConversion::getDouble(structure, "APPROACH", "BRAKE", 0.4);
+  stopGroundSpeedKn = INITypeConversion::getDouble(structure, "APPROACH", "STOP_GROUND_SPEED_KN", 30.0);
+
+  return success;
+}
+
+ApproachPilot::ApproachPilot(const ApproachConfiguration& configuration) : configuration(configuration) {}
+
+double ApproachPilot::getAlongTrackM(const FlightPlant& plant) const {
+  const auto& state = plant.getState();
+  double heading = configuration.runwayHeadingDeg * DEG_TO_RAD;
+  return state.northM * std::cos(heading) + state.eastM * std::sin(heading);
+}
+
+double ApproachPilot::getCrossTrackM(const FlightPlant& plant) const {
+  const auto& state = plant.getState();
+  double heading = configuration.runwayHeadingDeg * DEG_TO_RAD;
+  return -state.northM * std::sin(heading) + state.eastM * std::cos(heading);
+}
+
+FlightPlantInitialCondition ApproachPilot::getInitialCondition(double lateralOffsetM, double heightOffsetFt, double speedOffsetKn) const {
+  double heading = configuration.runwayHeadingDeg * DEG_TO_RAD;
+  double alongTrack = -configuration.startDistanceNm * NAUTICAL_MILES_TO_METERS;
+  double glidePathHeightM = (configuration.glidePathOriginM - alongTrack) * std::tan(configuration.glideSlopeDeg * DEG_TO_RAD);
+
+  FlightPlantInitialCondition initialCondition = {};
+  initialCondition.northM = alongTrack * std::cos(heading) - lateralOffsetM * std::sin(heading);
+  initialCondition.eastM = alongTrack * std::sin(heading) + lateralOffsetM * std::cos(heading);
+  // the glide path guides the main gear wheels, the pilot corrects the height of the struts during the first seconds
+  initialCondition.heightAboveFieldFt = glidePathHeightM * METERS_TO_FEET + heightOffsetFt;
+  initialCondition.headingDeg = configuration.runwayHeadingDeg;
+  initialCondition.indicatedAirspeedKn = configuration.approachSpeedKn + speedOffsetKn;
+  initialCondition.flightPathAngleDeg = -configuration.glideSlopeDeg;
+  initialCondition.flapsConfiguration = configuration.flapsConfiguration;
+  initialCondition.gearDown = true;
+  return initialCondition;
+}
+
+PilotInputs ApproachPilot::getWarmUpInputs(double warmUpTime) const {
+  PilotInputs warmUpInputs = {};
+  warmUpInputs.thrustLeverAngleDeg.fill(CLIMB_DETENT_TLA_DEG);
+  warmUpInputs.autothrustPushed =
+      warmUpTime >= AUTOTHRUST_PUSH_TIME_S && warmUpTime < AUTOTHRUST_PUSH_TIME_S + AUTOTHRUST_PUSH_DURATION_S;
+  warmUpInputs.autothrustModeRequested = AUTOTHRUST_MODE_SPEED;
+  warmUpInputs.speedTargetKn = configuration.approachSpeedKn;
+  warmUpInputs.groundSpoilersArmed = true;
+  warmUpInputs.flapsConfiguration = configuration.flapsConfiguration;
+  warmUpInputs.gearDown = true;
+  return warmUpInputs;
+}
+
+double ApproachPilot::computeFlightPathCommandDeg(const FlightPlant& plant, double radioHeightFt) {
+  const auto& state = plant.getState();
+
+  if (phase == ApproachPhase::Flare) {
+    // exponential flare towards the touchdown sink rate
+    double sinkRateFtS = radioHeightFt / flareTimeConstantS + configuration.touchdownSinkRateFtS;
+    return -std::atan2(sinkRateFtS * FEET_TO_METERS, std::max(state.groundSpeedMS, 1.0)) * RAD_TO_DEG;
+  }
+
+  double glidePathHeightFt =
+      (configuration.glidePathOriginM - getAlongTrackM(plant)) * std::tan(configuration.glideSlopeDeg * DEG_TO_RAD) * METERS_TO_FEET;
+  double correction = std::clamp(GLIDE_PATH_GAIN_DEG_PER_FT * (glidePathHeightFt - radioHeightFt), -GLIDE_PATH_CORRECTION_LIMIT_DEG,
+                                 GLIDE_PATH_CORRECTION_LIMIT_DEG);
+  return -configuration.glideSlopeDeg + correction;
+}
+
+PilotInputs ApproachPilot::update(double deltaTime, const FlightPlant& plant) {
+  const auto& state = plant.getState();
+  double radioHeightFt = PlantSensors::computeRadioHeightFt(plant);
+  bool mainGearOnGround = PlantSensors::isLeftMainGearPressed(plant) || PlantSensors::isRightMainGearPressed(plant);
+  bool noseGearOnGround = PlantSensors::isNoseGearPressed(plant);
+
+  double heading = configuration.runwayHeadingDeg * DEG_TO_RAD;
+  double crossTrack = getCrossTrackM(plant);
+  double crossTrackRate = -state.velocityNorthMS * std::sin(heading) + state.velocityEastMS * std::cos(heading);
+  double sinkRateFtS = state.velocityDownMS * METERS_TO_FEET;
+
+  switch (phase) {
+    case ApproachPhase::Approach:
+      if (radioHeightFt < configuration.flareHeightFt) {
+        // the flare starts with the sink rate of the approach and decays to the touchdown sink rate
+        phase = ApproachPhase::Flare;
+        flareTimeConstantS = configuration.flareHeightFt / std::max(sinkRateFtS - configuration.touchdownSinkRateFtS, 1.0);
+      }
+      [[fallthrough]];
+    case ApproachPhase::Flare:
+      if (mainGearOnGround) {
+        phase = ApproachPhase::Rollout;
+      }
+      break;
+    case ApproachPhase::Rollout:
+      if (noseGearOnGround && state.groundSpeedMS < configuration.stopGroundSpeedKn * KNOTS_TO_MS) {
+        phase = ApproachPhase::Stopped;
+      }
+      break;
+    case ApproachPhase::Stopped:
+      break;
+  }
+
+  PilotInputs inputs = getWarmUpInputs(0);
+
+  if (phase == ApproachPhase::Approach || phase == ApproachPhase::Flare) {
+    double flightPathDeg = std::atan2(-state.velocityDownMS, std::max(state.groundSpeedMS, 1.0)) * RAD_TO_DEG;
+    double flightPathError = computeFlightPathCommandDeg(plant, radioHeightFt) - flightPathDeg;
+    pitchIntegral = std::clamp(pitchIntegral + flightPathError * deltaTime, -PITCH_INTEGRAL_LIMIT_DEG_S, PITCH_INTEGRAL_LIMIT_DEG_S);
+    double integralStick = configuration.pitchIntegralGainPerDegS * pitchIntegral;
+    if (phase == ApproachPhase::Flare) {
+      inputs.pitchStick = std::clamp(configuration.flarePitchGainPerDeg * flightPathError + integralStick -
+                                         FLARE_PITCH_RATE_GAIN_PER_DEG_S * state.qRadS * RAD_TO_DEG,
+                                     0.0, 1.0);
+    } else {
+      inputs.pitchStick = std::clamp(configuration.pitchGainPerDeg * flightPathError + integralStick, -1.0, 1.0);
+    }
+
+    double bankCommandDeg = std::clamp(-(LATERAL_GAIN_RAD_PER_M * crossTrack + LATERAL_RATE_GAIN_RAD_PER_M_S * crossTrackRate) * RAD_TO_DEG,
+                                       -BANK_LIMIT_DEG, BANK_LIMIT_DEG);
+    inputs.rollStick = std::clamp(ROLL_GAIN_PER_DEG * (bankCommandDeg - state.phiRad * RAD_TO_DEG), -1.0, 1.0);
+  } else {
+    // the stick is released on the ground, the wings are kept level and the rudder tracks the centreline
+    inputs.rollStick = std::clamp(-ROLL_GAIN_PER_DEG * state.phiRad * RAD_TO_DEG, -1.0, 1.0);
+    inputs.rudderPedal = std::clamp(-(ROLLOUT_GAIN_PER_M * crossTrack + ROLLOUT_RATE_GAIN_PER_M_S * crossTrackRate), -1.0, 1.0);
+  }
+
+  retarded = retarded || radioHeightFt < configuration.retardHeightFt || mainGearOnGround;
+  if (retarded) {
+    inputs.thrustLeverAngleDeg.fill(0);
+  }
+
+  if (noseGearOnGround && phase != ApproachPhase::Approach && phase != ApproachPhase::Flare) {
+    inputs.brakeLeft = configuration.brake;
+    inputs.brakeRight = configuration.brake;
+  }
+
+  return inputs;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+
+#include "FlightControlSystem.h"
+#include "FlightPlant.h"
+
+struct ApproachConfiguration {
+  // the runway threshold is the reference point of the field
+  double runwayHeadingDeg;
+  double fieldElevationFt;
+  double fieldLatitudeDeg;
+  double fieldLongitudeDeg;
+
+  double startDistanceNm;
+  double glideSlopeDeg;
+  // distance of the glide path origin beyond the threshold
+  double glidePathOriginM;
+  double approachSpeedKn;
+  int flapsConfiguration;
+  // stick per degree of flight path error and per integrated error on the glide path
+  double pitchGainPerDeg;
+  double pitchIntegralGainPerDegS;
+
+  double flareHeightFt;
+  double flarePitchGainPerDeg;
+  double retardHeightFt;
+  double touchdownSinkRateFtS;
+  double brake;
+  // the run ends when the aircraft has slowed down to this ground speed
+  double stopGroundSpeedKn;
+
+  // returns false and leaves the defaults in place when the file cannot be read
+  bool load(const std::string& filePath);
+};
+
+enum class ApproachPhase {
+  Approach,
+  Flare,
+  Rollout,
+  Stopped,
+};
+
+// flies a stabilised manual approach with the autothrust engaged in speed mode, flares, retards and brakes to a stop
+class ApproachPilot {
+ public:
+  ApproachPilot(const ApproachConfiguration& configuration);
+
+  // the start of the approach on the glide path, offset from the nominal position and speed
+  FlightPlantInitialCondition getInitialCondition(double lateralOffsetM, double heightOffsetFt, double speedOffsetKn) const;
+
+  // the controls during the warm up of the computers, the autothrust is engaged
+  PilotInputs getWarmUpInputs(double warmUpTime) const;
+
+  PilotInputs update(double deltaTime, const FlightPlant& plant);
+
+  ApproachPhase getPhase() const { return phase; }
+
+  // distance past the threshold along the runway and lateral deviation from the centreline, right positive
+  double getAlongTrackM(const FlightPlant& plant) const;
+  double getCrossTrackM(const FlightPlant& plant) const;
+
+ private:
+  const ApproachConfiguration configuration;
+  ApproachPhase phase = ApproachPhase::Approach;
+  double pitchIntegral = 0;
+  double flareTimeConstantS = 0;
+  bool retarded = false;
+
+  double computeFlightPathCommandDeg(const FlightPlant& plant, double radioHeightFt);
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "FlightPlant.h"
+
+// the cockpit controls as the pilot sets them
+struct PilotInputs {
+  // sidestick deflection from -1 to 1, positive pulling back and to the right
+  double pitchStick;
+  double rollStick;
+  // rudder pedal deflection from -1 to 1, positive pushing the right pedal
+  double rudderPedal;
+
+  std::array<double, MAX_ENGINE_COUNT> thrustLeverAngleDeg;
+  bool autothrustPushed;
+  // the autothrust mode request of the autopilot state machine and the selected speed
+  double autothrustModeRequested;
+  double speedTargetKn;
+
+  bool groundSpoilersArmed;
+  int flapsConfiguration;
+  bool gearDown;
+  double brakeLeft;
+  double brakeRight;
+};
+
+struct FlightControlStatus {
+  // the status of the autothrust model: disengaged, engaged armed or engaged active
+  static constexpr int AUTOTHRUST_STATUS_ACTIVE = 2;
+
+  bool computersHealthy;
+  bool normalLawActive;
+  int autothrustStatus;
+  int autothrustMode;
+};
+
+// the flight control and autothrust computers of an aircraft, wired like the FlyByWireInterface of the aircraft does it
+class FlightControlSystem {
+ public:
+  virtual ~FlightControlSystem() = default;
+
+  // the interface of the sim is a static object, the computers rely on its zero initialised storage for the members
+  // their constructors leave alone
+  static void* operator new(std::size_t size) {
+    void* storage = std::calloc(1, size);
+    if (storage == nullptr) {
+      throw std::bad_alloc();
+    }
+    return storage;
+  }
+
+  static void operator delete(void* storage) { std::free(storage); }
+
+  // the computers are powered and engaged during this time before the plant starts to move
+  static constexpr double WARM_UP_TIME_S = 30.0;
+
+  // runs one step of the computers with the sensors of the plant and returns the commands of the actuators
+  virtual FlightPlantCommands update(double deltaTime, const FlightPlant& plant, const PilotInputs& pilotInputs) = 0;
+
+  virtual FlightControlStatus getStatus() const = 0;
+
+  // stores the state of all computers and of their wiring as a blob of ModelSnapshot.h
+  virtual std::vector<unsigned char> saveSnapshot() const = 0;
+
+  // continues from a blob of saveSnapshot, a blob of another aircraft or build is rejected and leaves the computers untouched
+  virtual bool restoreSnapshot(const std::vector<unsigned char>& blob) = 0;
+
+ protected:
+  // copies the outputs of a kind of computer between the system and its snapshot
+  template <typename T, std::size_t N>
+  static void copyArray(const T (&source)[N], T (&destination)[N]) {
+    std::copy(std::begin(source), std::end(source), std::begin(destination));
+  }
+};
+
+// implemented once per aircraft, each aircraft builds its own executable
+std::unique_ptr<FlightControlSystem> createFlightControlSystem();
+
+// the coefficients of the aircraft used when none are given on the command line
+const char* getDefaultAircraftFile();
@@ -0,0 +1,547 @@
+#include <ini.h>
+#include <ini_type_conversion.h>
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "FlightPlant.h"
+
+using namespace mINI;
+
+static constexpr double GRAVITY_MS2 = 9.80665;
+static constexpr double SEA_LEVEL_TEMPERATURE_K = 288.15;
+static constexpr double SEA_LEVEL_PRESSURE_PA = 101325.0;
+static constexpr double SEA_LEVEL_DENSITY_KGM3 = 1.225;
+static constexpr double SEA_LEVEL_SPEED_OF_SOUND_MS = 340.294;
+static constexpr double TEMPERATURE_LAPSE_RATE_KM = 0.0065;
+static constexpr double GAS_CONSTANT_AIR = 287.053;
+static constexpr double FEET_TO_METERS = 0.3048;
+static constexpr double KNOTS_TO_MS = 0.514444;
+static constexpr double DEG_TO_RAD = M_PI / 180.0;
+
+// strut compression beyond the travel is stopped by a much stiffer bump stop
+static constexpr double BUMP_STOP_STIFFNESS_FACTOR = 10.0;
+
+// friction forces fade in over this speed to avoid chattering around standstill
+static constexpr double FRICTION_VELOCITY_MS = 0.5;
+
+// reads a comma separated list of the flaps configurations, missing entries keep their default
+static void readFlapsList(INIStructure& structure,
+                          const std::string& key,
+                          std::array<double, FLAPS_CONFIGURATION_COUNT>& values,
+                          const std::array<double, FLAPS_CONFIGURATION_COUNT>& defaultValues) {
+  values = defaultValues;
+  std::stringstream stream(INITypeConversion::getString(structure, "FLAPS", key, ""));
+  std::string item;
+  for (int i = 0; i < FLAPS_CONFIGURATION_COUNT && std::getline(stream, item, ','); i++) {
+    std::stringstream itemStream(item);
+    double value;
+    itemStream >> value;
+    if (!itemStream.fail()) {
+      values[i] = value;
+    }
+  }
+}
+
+bool FlightPlantConfiguration::load(const std::string& filePath) {
+  INIStructure structure;
+  INIFile file(filePath);
+  bool success = file.read(structure);
+
+  name = INITypeConversion::getString(structure, "AIRCRAFT", "NAME", "unknown");
+
+  massKg = INITypeConversion::getDouble(structure, "MASS", "MASS_KG", 60000.0);
+  cgPercentMac = INITypeConversion::getDouble(structure, "MASS", "CG_PERCENT_MAC", 28.0);
+  referenceCgPercentMac = INITypeConversion::getDouble(structure, "MASS", "REFERENCE_CG_PERCENT_MAC", 25.0);
+  inertiaXxKgM2 = INITypeConversion::getDouble(structure, "MASS", "INERTIA_XX_KG_M2", 1.5e6);
+  inertiaYyKgM2 = INITypeConversion::getDouble(structure, "MASS", "INERTIA_YY_KG_M2", 3.8e6);
+  inertiaZzKgM2 = INITypeConversion::getDouble(structure, "MASS", "INERTIA_ZZ_KG_M2", 5.1e6);
+  inertiaXzKgM2 = INITypeConversion::getDouble(structure, "MASS", "INERTIA_XZ_KG_M2", 0.05e6);
+
+  wingAreaM2 = INITypeConversion::getDouble(structure, "GEOMETRY", "WING_AREA_M2", 122.6);
+  chordM = INITypeConversion::getDouble(structure, "GEOMETRY", "CHORD_M", 4.19);
+  spanM = INITypeConversion::getDouble(structure, "GEOMETRY", "SPAN_M", 34.1);
+
+  liftZero = INITypeConversion::getDouble(structure, "AERODYNAMICS", "LIFT_ZERO", 0.25);
+  liftAlpha = INITypeConversion::getDouble(structure, "AERODYNAMICS", "LIFT_ALPHA", 5.5);
+  liftPitchRate = INITypeConversion::getDouble(structure, "AERODYNAMICS", "LIFT_PITCH_RATE", 4.0);
+  liftElevator = INITypeConversion::getDouble(structure, "AERODYNAMICS", "LIFT_ELEVATOR", 0.35);
+  liftStabilizer = INITypeConversion::getDouble(structure, "AERODYNAMICS", "LIFT_STABILIZER", 0.8);
+  liftSpoiler = INITypeConversion::getDouble(structure, "AERODYNAMICS", "LIFT_SPOILER", -0.6);
+  dragZero = INITypeConversion::getDouble(structure, "AERODYNAMICS", "DRAG_ZERO", 0.022);
+  dragInduced = INITypeConversion::getDouble(structure, "AERODYNAMICS", "DRAG_INDUCED", 0.045);
+  dragGear = INITypeConversion::getDouble(structure, "AERODYNAMICS", "DRAG_GEAR", 0.02);
+  dragSpoiler = INITypeConversion::getDouble(structure, "AERODYNAMICS", "DRAG_SPOILER", 0.12);
+  dragElevator = INITypeConversion::getDouble(structure, "AERODYNAMICS", "DRAG_ELEVATOR", 0.02);
+  pitchZero = INITypeConversion::getDouble(structure, "AERODYNAMICS", "PITCH_ZERO", 0.05);
+  pitchAlpha = INITypeConversion::getDouble(structure, "AERODYNAMICS", "PITCH_ALPHA", -1.2);
+  pitchRate = INITypeConversion::getDouble(structure, "AERODYNAMICS", "PITCH_RATE", -20.0);
+  pitchElevator = INITypeConversion::getDouble(structure, "AERODYNAMICS", "PITCH_ELEVATOR", -1.3);
+  pitchStabilizer = INITypeConversion::getDouble(structure, "AERODYNAMICS", "PITCH_STABILIZER", -3.0);
+  pitchSpoiler = INITypeConversion::getDouble(structure, "AERODYNAMICS", "PITCH_SPOILER", 0.05);
+  pitchGear = INITypeConversion::getDouble(structure, "AERODYNAMICS", "PITCH_GEAR", 0.0);
+  stallLiftDrop = INITypeConversion::getDouble(structure, "AERODYNAMICS", "STALL_LIFT_DROP", 2.0);
+
+  sideBeta = INITypeConversion::getDouble(structure, "AERODYNAMICS", "SIDE_BETA", -0.8);
+  sideRudder = INITypeConversion::getDouble(structure, "AERODYNAMICS", "SIDE_RUDDER", 0.2);
+  rollBeta = INITypeConversion::getDouble(structure, "AERODYNAMICS", "ROLL_BETA", -0.1);
+  rollRollRate = INITypeConversion::getDouble(structure, "AERODYNAMICS", "ROLL_ROLL_RATE", -0.45);
+  rollYawRate = INITypeConversion::getDouble(structure, "AERODYNAMICS", "ROLL_YAW_RATE", 0.25);
+  rollAileron = INITypeConversion::getDouble(structure, "AERODYNAMICS", "ROLL_AILERON", 0.1);
+  rollSpoiler = INITypeConversion::getDouble(structure, "AERODYNAMICS", "ROLL_SPOILER", 0.08);
+  rollRudder = INITypeConversion::getDouble(structure, "AERODYNAMICS", "ROLL_RUDDER", 0.015);
+  yawBeta = INITypeConversion::getDouble(structure, "AERODYNAMICS", "YAW_BETA", 0.12);
+  yawRollRate = INITypeConversion::getDouble(structure, "AERODYNAMICS", "YAW_ROLL_RATE", -0.05);
+  yawYawRate = INITypeConversion::getDouble(structure, "AERODYNAMICS", "YAW_YAW_RATE", -0.2);
+  yawAileron = INITypeConversion::getDouble(structure, "AERODYNAMICS", "YAW_AILERON", -0.005);
+  yawRudder = INITypeConversion::getDouble(structure, "AERODYNAMICS", "YAW_RUDDER", -0.1);
+
+  readFlapsList(structure, "LIFT", flapsLift, {0.0, 0.35, 0.45, 0.6, 0.7, 0.85});
+  readFlapsList(structure, "DRAG", flapsDrag, {0.0, 0.01, 0.018, 0.03, 0.045, 0.07});
+  readFlapsList(structure, "PITCH", flapsPitch, {0.0, -0.01, -0.04, -0.07, -0.09, -0.12});
+  readFlapsList(structure, "STALL_ALPHA_DEG", flapsStallAlphaDeg, {12.0, 15.0, 15.0, 15.5, 15.5, 16.0});
+
+  groundEffectSpanFraction = INITypeConversion::getDouble(structure, "AERODYNAMICS", "GROUND_EFFECT_SPAN_FRACTION", 1.0);
+  groundEffectLift = INITypeConversion::getDouble(structure, "AERODYNAMICS", "GROUND_EFFECT_LIFT", 0.1);
+  groundEffectInducedDrag = INITypeConversion::getDouble(structure, "AERODYNAMICS", "GROUND_EFFECT_INDUCED_DRAG", 0.4);
+
+  engineCount = std::clamp(INITypeConversion::getInteger(structure, "ENGINE", "COUNT", 2), 1, MAX_ENGINE_COUNT);
+  engineMaximumThrustN = INITypeConversion::getDouble(structure, "ENGINE", "MAXIMUM_THRUST_N", 120000.0);
+  engineThrustExponent = INITypeConversion::getDouble(structure, "ENGINE", "THRUST_EXPONENT", 2.5);
+  engineDensityLapse = INITypeConversion::getDouble(structure, "ENGINE", "DENSITY_LAPSE", 0.7);
+  engineMachLapse = INITypeConversion::getDouble(structure, "ENGINE", "MACH_LAPSE", 0.8);
+  engineIdleN1Percent = INITypeConversion::getDouble(structure, "ENGINE", "IDLE_N1_PERCENT", 19.0);
+  engineSpoolUpTimeConstantS = INITypeConversion::getDouble(structure, "ENGINE", "SPOOL_UP_TIME_CONSTANT_S", 1.8);
+  engineSpoolDownTimeConstantS = INITypeConversion::getDouble(structure, "ENGINE", "SPOOL_DOWN_TIME_CONSTANT_S", 1.4);
+  double engineY = INITypeConversion::getDouble(structure, "ENGINE", "INNER_Y_M", 5.75);
+  double outerEngineY = INITypeConversion::getDouble(structure, "ENGINE", "OUTER_Y_M", 0.0);
+  engineZM = INITypeConversion::getDouble(structure, "ENGINE", "Z_M", 1.8);
+  if (engineCount == 4) {
+    engineYM = {-outerEngineY, -engineY, engineY, outerEngineY};
+  } else {
+    engineYM = {-engineY, engineY, 0.0, 0.0};
+  }
+
+  elevatorRateDegS = INITypeConversion::getDouble(structure, "ACTUATORS", "ELEVATOR_RATE_DEG_S", 45.0);
+  stabilizerRateDegS = INITypeConversion::getDouble(structure, "ACTUATORS", "STABILIZER_RATE_DEG_S", 1.0);
+  aileronRateDegS = INITypeConversion::getDouble(structure, "ACTUATORS", "AILERON_RATE_DEG_S", 60.0);
+  spoilerRateDegS = INITypeConversion::getDouble(structure, "ACTUATORS", "SPOILER_RATE_DEG_S", 50.0);
+  rudderRateDegS = INITypeConversion::getDouble(structure, "ACTUATORS", "RUDDER_RATE_DEG_S", 50.0);
+  actuatorTimeConstantS = INITypeConversion::getDouble(structure, "ACTUATORS", "TIME_CONSTANT_S", 0.05);
+
+  noseGearXM = INITypeConversion::getDouble(structure, "GEAR", "NOSE_X_M", 11.0);
+  noseGearZM = INITypeConversion::getDouble(structure, "GEAR", "NOSE_Z_M", 3.6);
+  mainGearXM = INITypeConversion::getDouble(structure, "GEAR", "MAIN_X_M", -1.6);
+  mainGearYM = INITypeConversion::getDouble(structure, "GEAR", "MAIN_Y_M", 3.8);
+  mainGearZM = INITypeConversion::getDouble(structure, "GEAR", "MAIN_Z_M", 3.6);
+  noseGearStiffnessNM = INITypeConversion::getDouble(structure, "GEAR", "NOSE_STIFFNESS_N_M", 2.5e5);
+  noseGearDampingNsM = INITypeConversion::getDouble(structure, "GEAR", "NOSE_DAMPING_NS_M", 4.0e4);
+  mainGearStiffnessNM = INITypeConversion::getDouble(structure, "GEAR", "MAIN_STIFFNESS_N_M", 1.0e6);
+  mainGearDampingNsM = INITypeConversion::getDouble(structure, "GEAR", "MAIN_DAMPING_NS_M", 1.6e5);
+  strutTravelM = INITypeConversion::getDouble(structure, "GEAR", "STRUT_TRAVEL_M", 0.45);
+  rollingFriction = INITypeConversion::getDouble(structure, "GEAR", "ROLLING_FRICTION", 0.02);
+  brakingFriction = INITypeConversion::getDouble(structure, "GEAR", "BRAKING_FRICTION", 0.4);
+  corneringFriction = INITypeConversion::getDouble(structure, "GEAR", "CORNERING_FRICTION", 0.6);
+  corneringSlipVelocityMS = INITypeConversion::getDouble(structure, "GEAR", "CORNERING_SLIP_VELOCITY_M_S", 1.0);
+  wheelRadiusM = INITypeConversion::getDouble(structure, "GEAR", "WHEEL_RADIUS_M", 0.58);
+
+  return success;
+}
+
+// quaternion helpers, the quaternion rotates from body to north-east-down axes
+using Matrix3 = std::array<std::array<double, 3>, 3>;
+
+static Matrix3 bodyToEarth(double q0, double q1, double q2, double q3) {
+  return {{{q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3, 2 * (q1 * q2 - q0 * q3), 2 * (q1 * q3 + q0 * q2)},
+           {2 * (q1 * q2 + q0 * q3), q0 * q0 - q1 * q1 + q2 * q2 - q3 * q3, 2 * (q2 * q3 - q0 * q1)},
+           {2 * (q1 * q3 - q0 * q2), 2 * (q2 * q3 + q0 * q1), q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3}}};
+}
+
+static std::array<double, 3> multiply(const Matrix3& m, const std::array<double, 3>& v) {
+  return {m[0][0] * v[0] + m[0][1] * v[1] + m[0][2] * v[2], m[1][0] * v[0] + m[1][1] * v[1] + m[1][2] * v[2],
+          m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2]};
+}
+
+static std::array<double, 3> multiplyTransposed(const Matrix3& m, const std::array<double, 3>& v) {
+  return {m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2], m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2],
+          m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2]};
+}
+
+static std::array<double, 3> cross(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+  return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+// moves towards the command with a first order lag that is rate limited
+static double updateActuator(double position, double command, double rateLimit, double timeConstant, double deltaTime) {
+  double rate = std::clamp((command - position) / std::max(timeConstant, deltaTime), -rateLimit, rateLimit);
+  double next = position + rate * deltaTime;
+  return (command - position) * (command - next) < 0 ? command : next;
+}
+
+FlightPlant::FlightPlant(const FlightPlantConfiguration& configuration) : configuration(configuration) {}
+
+FlightPlant::Atmosphere FlightPlant::computeAtmosphere(double altitudeFt) const {
+  // international standard atmosphere of the troposphere, the temperature offset does not change the pressure
+  double altitudeM = altitudeFt * FEET_TO_METERS;
+  double standardTemperature = SEA_LEVEL_TEMPERATURE_K - TEMPERATURE_LAPSE_RATE_KM * altitudeM;
+  Atmosphere atmosphere;
+  atmosphere.temperatureK = standardTemperature + environment.temperatureOffsetK;
+  atmosphere.pressurePa = SEA_LEVEL_PRESSURE_PA * std::pow(standardTemperature / SEA_LEVEL_TEMPERATURE_K, 5.25588);
+  atmosphere.densityKgM3 = atmosphere.pressurePa / (GAS_CONSTANT_AIR * atmosphere.temperatureK);
+  atmosphere.speedOfSoundMS = std::sqrt(1.4 * GAS_CONSTANT_AIR * atmosphere.temperatureK);
+  return atmosphere;
+}
+
+double FlightPlant::computeEngineThrust(double n1Percent, const Atmosphere& atmosphere, double mach) const {
+  double n1Fraction = std::clamp(n1Percent / 100.0, 0.0, 1.2);
+  double lapse = std::pow(atmosphere.densityKgM3 / SEA_LEVEL_DENSITY_KGM3, configuration.engineDensityLapse) *
+                 std::max(0.0, 1.0 - configuration.engineMachLapse * mach);
+  return configuration.engineMaximumThrustN * std::pow(n1Fraction, configuration.engineThrustExponent) * lapse;
+}
+
+double FlightPlant::computeN1ForThrust(double thrustN, const Atmosphere& atmosphere, double mach) const {
+  double maximumThrust = computeEngineThrust(100.0, atmosphere, mach);
+  double n1 = 100.0 * std::pow(std::max(thrustN, 0.0) / maximumThrust, 1.0 / configuration.engineThrustExponent);
+  return std::clamp(n1, configuration.engineIdleN1Percent, 110.0);
+}
+
+FlightPlant::Derivative FlightPlant::computeDerivative(const StateVector& s) const {
+  const auto& c = configuration;
+  Derivative derivative = {};
+
+  double u = s[3], v = s[4], w = s[5];
+  double q0 = s[6], q1 = s[7], q2 = s[8], q3 = s[9];
+  double p = s[10], q = s[11], r = s[12];
+  Matrix3 dcm = bodyToEarth(q0, q1, q2, q3);
+
+  double heightAboveField = -s[2];
+  Atmosphere atmosphere = computeAtmosphere(environment.fieldElevationFt + heightAboveField / FEET_TO_METERS);
+
+  // air relative velocity
+  std::array<double, 3> wind = multiplyTransposed(dcm, {environment.windNorthMS, environment.windEastMS, environment.windDownMS});
+  double ua = u - wind[0], va = v - wind[1], wa = w - wind[2];
+  double airspeed = std::max(std::sqrt(ua * ua + va * va + wa * wa), 1.0);
+  double alpha = std::atan2(wa, ua);
+  double beta = std::asin(std::clamp(va / airspeed, -1.0, 1.0));
+  double dynamicPressure = 0.5 * atmosphere.densityKgM3 * airspeed * airspeed;
+
+  // the aerodynamic model only needs a reasonable behaviour at low speed, the rates are normalised with a floor speed
+  double normalisationSpeed = std::max(airspeed, 30.0);
+  double pHat = p * c.spanM / (2 * normalisationSpeed);
+  double qHat = q * c.chordM / (2 * normalisationSpeed);
+  double rHat = r * c.spanM / (2 * normalisationSpeed);
+
+  double elevator = 0.5 * (state.elevatorLeftDeg + state.elevatorRightDeg) * DEG_TO_RAD;
+  double stabilizer = state.stabilizerDeg * DEG_TO_RAD;
+  double aileron = 0.5 * (state.aileronLeftDeg - state.aileronRightDeg) * DEG_TO_RAD;
+  double spoilerSymmetric = 0.5 * (state.spoilerLeftDeg + state.spoilerRightDeg) * DEG_TO_RAD;
+  double spoilerDifferential = 0.5 * (state.spoilerRightDeg - state.spoilerLeftDeg) * DEG_TO_RAD;
+  double rudder = state.rudderDeg * DEG_TO_RAD;
+  int flaps = std::clamp(state.flapsConfiguration, 0, FLAPS_CONFIGURATION_COUNT - 1);
+  double gear = state.gearDown ? 1.0 : 0.0;
+
+  // lift with a linear post stall drop
+  double stallAlpha = c.flapsStallAlphaDeg[flaps] * DEG_TO_RAD;
+  double effectiveAlpha = alpha > stallAlpha ? stallAlpha - c.stallLiftDrop / c.liftAlpha * (alpha - stallAlpha) : alpha;
+  double groundEffect = std::clamp(1.0 - (heightAboveField - c.mainGearZM) / (c.groundEffectSpanFraction * c.spanM), 0.0, 1.0);
+  double lift = (c.liftZero + c.flapsLift[flaps] + c.liftAlpha * effectiveAlpha + c.liftPitchRate * qHat + c.liftElevator * elevator +
+                 c.liftStabilizer * stabilizer + c.liftSpoiler * spoilerSymmetric) *
+                (1.0 + c.groundEffectLift * groundEffect);
+  double drag = c.dragZero + c.flapsDrag[flaps] + c.dragInduced * lift * lift * (1.0 - c.groundEffectInducedDrag * groundEffect) +
+                c.dragGear * gear + c.dragSpoiler * spoilerSymmetric + c.dragElevator * std::abs(elevator);
+  double pitch = c.pitchZero + c.flapsPitch[flaps] + c.pitchAlpha * alpha + c.pitchRate * qHat + c.pitchElevator * elevator +
+                 c.pitchStabilizer * stabilizer + c.pitchSpoiler * spoilerSymmetric + c.pitchGear * gear +
+                 lift * (c.cgPercentMac - c.referenceCgPercentMac) / 100.0;
+  double side = c.sideBeta * beta + c.sideRudder * rudder;
+  double roll = c.rollBeta * beta + c.rollRollRate * pHat + c.rollYawRate * rHat + c.rollAileron * aileron +
+                c.rollSpoiler * spoilerDifferential + c.rollRudder * rudder;
+  double yaw = c.yawBeta * beta + c.yawRollRate * pHat + c.yawYawRate * rHat + c.yawAileron * aileron + c.yawRudder * rudder;
+
+  double qS = dynamicPressure * c.wingAreaM2;
+  std::array<double, 3> force = {qS * (lift * std::sin(alpha) - drag * std::cos(alpha)), qS * side,
+                                 qS * (-lift * std::cos(alpha) - drag * std::sin(alpha))};
+  std::array<double, 3> moment = {qS * c.spanM * roll, qS * c.chordM * pitch, qS * c.spanM * yaw};
+
+  // engines, the thrust line is parallel to the body x axis
+  for (int i = 0; i < c.engineCount; i++) {
+    double thrust = state.engineThrustN[i];
+    force[0] += thrust;
+    moment[1] += c.engineZM * thrust;
+    moment[2] -= c.engineYM[i] * thrust;
+  }
+
+  // landing gear: nose, left main, right main
+  if (state.gearDown) {
+    const std::array<std::array<double, 3>, 3> gearPositions = {{{c.noseGearXM, 0.0, c.noseGearZM},
+                                                                  {c.mainGearXM, -c.mainGearYM, c.mainGearZM},
+                                                                  {c.mainGearXM, c.mainGearYM, c.mainGearZM}}};
+    const std::array<double, 3> stiffness = {c.noseGearStiffnessNM, c.mainGearStiffnessNM, c.mainGearStiffnessNM};
+    const std::array<double, 3> damping = {c.noseGearDampingNsM, c.mainGearDampingNsM, c.mainGearDampingNsM};
+    const std::array<double, 3> braking = {0.0, brakeLeft, brakeRight};
+    double psi = std::atan2(dcm[1][0], dcm[0][0]);
+    std::array<double, 2> alongTrack = {std::cos(psi), std::sin(psi)};
+    std::array<double, 2> crossTrack = {-std::sin(psi), std::cos(psi)};
+
+    for (int i = 0; i < 3; i++) {
+      std::array<double, 3> position = multiply(dcm, gearPositions[i]);
+      double penetration = s[2] + position[2];
+      if (penetration <= 0) {
+        continue;
+      }
+
+      std::array<double, 3> pointVelocityBody = cross({p, q, r}, gearPositions[i]);
+      std::array<double, 3> pointVelocity = multiply(dcm, {u + pointVelocityBody[0], v + pointVelocityBody[1], w + pointVelocityBody[2]});
+
+      double springForce = stiffness[i] * penetration;
+      if (penetration > c.strutTravelM) {
+        springForce += BUMP_STOP_STIFFNESS_FACTOR * stiffness[i] * (penetration - c.strutTravelM);
+      }
+      double normalForce = std::max(0.0, springForce + damping[i] * pointVelocity[2]);
+
+      double alongVelocity = pointVelocity[0] * alongTrack[0] + pointVelocity[1] * alongTrack[1];
+      double crossVelocity = pointVelocity[0] * crossTrack[0] + pointVelocity[1] * crossTrack[1];
+      double friction = c.rollingFriction + c.brakingFriction * braking[i];
+      double alongForce = -friction * normalForce * std::tanh(alongVelocity / FRICTION_VELOCITY_MS);
+      double crossForce = -c.corneringFriction * normalForce * std::tanh(crossVelocity / c.corneringSlipVelocityMS);
+
+      std::array<double, 3> gearForce = multiplyTransposed(
+          dcm, {alongForce * alongTrack[0] + crossForce * crossTrack[0], alongForce * alongTrack[1] + crossForce * crossTrack[1],
+                -normalForce});
+      std::array<double, 3> gearMoment = cross(gearPositions[i], gearForce);
+      for (int k = 0; k < 3; k++) {
+        force[k] += gearForce[k];
+        moment[k] += gearMoment[k];
+      }
+
+      derivative.gearCompressionM[i] = std::min(penetration, c.strutTravelM);
+      derivative.gearNormalForceN[i] = normalForce;
+    }
+  }
+
+  double mass = c.massKg;
+  derivative.specificForceX = force[0] / mass;
+  derivative.specificForceY = force[1] / mass;
+  derivative.specificForceZ = force[2] / mass;
+
+  // translational dynamics in body axes
+  std::array<double, 3> gravity = multiplyTransposed(dcm, {0.0, 0.0, GRAVITY_MS2});
+  std::array<double, 3> velocityEarth = multiply(dcm, {u, v, w});
+  derivative.value[0] = velocityEarth[0];
+  derivative.value[1] = velocityEarth[1];
+  derivative.value[2] = velocityEarth[2];
+  derivative.value[3] = derivative.specificForceX + gravity[0] - (q * w - r * v);
+  derivative.value[4] = derivative.specificForceY + gravity[1] - (r * u - p * w);
+  derivative.value[5] = derivative.specificForceZ + gravity[2] - (p * v - q * u);
+
+  // attitude kinematics
+  derivative.value[6] = 0.5 * (-p * q1 - q * q2 - r * q3);
+  derivative.value[7] = 0.5 * (p * q0 + r * q2 - q * q3);
+  derivative.value[8] = 0.5 * (q * q0 - r * q1 + p * q3);
+  derivative.value[9] = 0.5 * (r * q0 + q * q1 - p * q2);
+
+  // rotational dynamics with the xz product of inertia
+  double ixx = c.inertiaXxKgM2, iyy = c.inertiaYyKgM2, izz = c.inertiaZzKgM2, ixz = c.inertiaXzKgM2;
+  std::array<double, 3> angularMomentum = {ixx * p - ixz * r, iyy * q, izz * r - ixz * p};
+  std::array<double, 3> gyroscopic = cross({p, q, r}, angularMomentum);
+  double l = moment[0] - gyroscopic[0], m = moment[1] - gyroscopic[1], n = moment[2] - gyroscopic[2];
+  double gamma = ixx * izz - ixz * ixz;
+  derivative.value[10] = (izz * l + ixz * n) / gamma;
+  derivative.value[11] = m / iyy;
+  derivative.value[12] = (ixz * l + ixx * n) / gamma;
+
+  return derivative;
+}
+
+bool FlightPlant::initialize(const FlightPlantInitialCondition& initialCondition, const FlightPlantEnvironment& initialEnvironment) {
+  const auto& c = configuration;
+  environment = initialEnvironment;
+  state = {};
+  state.flapsConfiguration = std::clamp(initialCondition.flapsConfiguration, 0, FLAPS_CONFIGURATION_COUNT - 1);
+  state.gearDown = initialCondition.gearDown;
+
+  double altitudeFt = environment.fieldElevationFt + initialCondition.heightAboveFieldFt;
+  Atmosphere atmosphere = computeAtmosphere(altitudeFt);
+  double equivalentAirspeed = initialCondition.indicatedAirspeedKn * KNOTS_TO_MS;
+  double airspeed = equivalentAirspeed * std::sqrt(SEA_LEVEL_DENSITY_KGM3 / atmosphere.densityKgM3);
+  double mach = airspeed / atmosphere.speedOfSoundMS;
+  double qS = 0.5 * atmosphere.densityKgM3 * airspeed * airspeed * c.wingAreaM2;
+  double weight = c.massKg * GRAVITY_MS2;
+  double gamma = initialCondition.flightPathAngleDeg * DEG_TO_RAD;
+  int flaps = state.flapsConfiguration;
+  double gear = state.gearDown ? 1.0 : 0.0;
+
+  // trim for steady wings level flight with the elevator neutral: the lift balances the weight, the stabilizer the pitching
+  // moment and the thrust the drag
+  double alpha = 5.0 * DEG_TO_RAD;
+  double stabilizer = 0.0;
+  double thrust = weight * (0.1 + std::sin(gamma));
+  for (int i = 0; i < 200; i++) {
+    double lift = (weight * std::cos(gamma) - thrust * std::sin(alpha)) / qS;
+    alpha = (lift - c.liftZero - c.flapsLift[flaps] - c.liftStabilizer * stabilizer) / c.liftAlpha;
+    double pitch = c.pitchZero + c.flapsPitch[flaps] + c.pitchAlpha * alpha + c.pitchGear * gear +
+                   lift * (c.cgPercentMac - c.referenceCgPercentMac) / 100.0;
+    stabilizer = -(pitch + c.engineZM * thrust / (qS * c.chordM)) / c.pitchStabilizer;
+    double drag = c.dragZero + c.flapsDrag[flaps] + c.dragInduced * lift * lift + c.dragGear * gear;
+    thrust = (drag * qS + weight * std::sin(gamma)) / std::cos(alpha);
+  }
+  trimStabilizerDeg = stabilizer / DEG_TO_RAD;
+  trimN1Percent = computeN1ForThrust(thrust / c.engineCount, atmosphere, mach);
+
+  // attitude from the flight path and the angle of attack, wings level
+  double theta = gamma + alpha;
+  double psi = initialCondition.headingDeg * DEG_TO_RAD;
+  double cy = std::cos(0.5 * psi), sy = std::sin(0.5 * psi);
+  double cp = std::cos(0.5 * theta), sp = std::sin(0.5 * theta);
+  x = {};
+  x[0] = initialCondition.northM;
+  x[1] = initialCondition.eastM;
+  x[2] = -initialCondition.heightAboveFieldFt * FEET_TO_METERS;
+  x[6] = cy * cp;
+  x[7] = -sy * sp;
+  x[8] = cy * sp;
+  x[9] = sy * cp;
+
+  // the air relative velocity plus the wind gives the inertial velocity
+  Matrix3 dcm = bodyToEarth(x[6], x[7], x[8], x[9]);
+  std::array<double, 3> wind = multiplyTransposed(dcm, {environment.windNorthMS, environment.windEastMS, environment.windDownMS});
+  x[3] = airspeed * std::cos(alpha) + wind[0];
+  x[4] = wind[1];
+  x[5] = airspeed * std::sin(alpha) + wind[2];
+
+  state.stabilizerDeg = trimStabilizerDeg;
+  for (int i = 0; i < c.engineCount; i++) {
+    state.engineN1Percent[i] = trimN1Percent;
+    state.engineN1CommandPercent[i] = trimN1Percent;
+    state.engineThrustN[i] = computeEngineThrust(trimN1Percent, atmosphere, mach);
+  }
+
+  updateObservations(computeDerivative(x));
+  return std::isfinite(trimStabilizerDeg) && std::isfinite(trimN1Percent) && alpha < c.flapsStallAlphaDeg[flaps] * DEG_TO_RAD;
+}
+
+void FlightPlant::setEnvironment(const FlightPlantEnvironment& newEnvironment) {
+  environment = newEnvironment;
+}
+
+void FlightPlant::updateActuators(double deltaTime, const FlightPlantCommands& commands) {
+  const auto& c = configuration;
+  double tau = c.actuatorTimeConstantS;
+  state.elevatorLeftDeg = updateActuator(state.elevatorLeftDeg, commands.elevatorLeftDeg, c.elevatorRateDegS, tau, deltaTime);
+  state.elevatorRightDeg = updateActuator(state.elevatorRightDeg, commands.elevatorRightDeg, c.elevatorRateDegS, tau, deltaTime);
+  state.stabilizerDeg = updateActuator(state.stabilizerDeg, commands.stabilizerDeg, c.stabilizerRateDegS, tau, deltaTime);
+  state.aileronLeftDeg = updateActuator(state.aileronLeftDeg, commands.aileronLeftDeg, c.aileronRateDegS, tau, deltaTime);
+  state.aileronRightDeg = updateActuator(state.aileronRightDeg, commands.aileronRightDeg, c.aileronRateDegS, tau, deltaTime);
+  state.spoilerLeftDeg = updateActuator(state.spoilerLeftDeg, commands.spoilerLeftDeg, c.spoilerRateDegS, tau, deltaTime);
+  state.spoilerRightDeg = updateActuator(state.spoilerRightDeg, commands.spoilerRightDeg, c.spoilerRateDegS, tau, deltaTime);
+  state.rudderDeg = updateActuator(state.rudderDeg, commands.rudderDeg, c.rudderRateDegS, tau, deltaTime);
+
+  // flaps and gear are moved instantly, the scenarios keep the configuration during the approach
+  state.flapsConfiguration = std::clamp(commands.flapsConfiguration, 0, FLAPS_CONFIGURATION_COUNT - 1);
+  state.gearDown = commands.gearDown;
+
+  for (int i = 0; i < c.engineCount; i++) {
+    state.engineN1CommandPercent[i] = commands.engineN1CommandPercent[i];
+  }
+}
+
+void FlightPlant::updateEngines(double deltaTime) {
+  const auto& c = configuration;
+  Atmosphere atmosphere = computeAtmosphere(state.altitudeFt);
+  for (int i = 0; i < c.engineCount; i++) {
+    double target = std::max(state.engineN1CommandPercent[i], c.engineIdleN1Percent);
+    double timeConstant = target > state.engineN1Percent[i] ? c.engineSpoolUpTimeConstantS : c.engineSpoolDownTimeConstantS;
+    state.engineN1Percent[i] += (target - state.engineN1Percent[i]) * (1.0 - std::exp(-deltaTime / timeConstant));
+    state.engineThrustN[i] = computeEngineThrust(state.engineN1Percent[i], atmosphere, state.mach);
+  }
+}
+
+void FlightPlant::step(double deltaTime, const FlightPlantCommands& commands) {
+  updateActuators(deltaTime, commands);
+  updateEngines(deltaTime);
+  brakeLeft = std::clamp(commands.brakeLeft, 0.0, 1.0);
+  brakeRight = std::clamp(commands.brakeRight, 0.0, 1.0);
+
+  // classic fourth order runge kutta of the rigid body, the actuators and engines are held over the step
+  auto add = [](const StateVector& a, const StateVector& b, double factor) {
+    StateVector result;
+    for (int i = 0; i < STATE_SIZE; i++) {
+      result[i] = a[i] + factor * b[i];
+    }
+    return result;
+  };
+  StateVector k1 = computeDerivative(x).value;
+  StateVector k2 = computeDerivative(add(x, k1, 0.5 * deltaTime)).value;
+  StateVector k3 = computeDerivative(add(x, k2, 0.5 * deltaTime)).value;
+  StateVector k4 = computeDerivative(add(x, k3, deltaTime)).value;
+  for (int i = 0; i < STATE_SIZE; i++) {
+    x[i] += deltaTime / 6.0 * (k1[i] + 2 * k2[i] + 2 * k3[i] + k4[i]);
+  }
+
+  // keep the quaternion normalised
+  double norm = std::sqrt(x[6] * x[6] + x[7] * x[7] + x[8] * x[8] + x[9] * x[9]);
+  for (int i = 6; i < 10; i++) {
+    x[i] /= norm;
+  }
+
+  state.timeS += deltaTime;
+  updateObservations(computeDerivative(x));
+
+  // the wheels spin up on contact and slowly spin down in the air
+  double wheelSpeed = state.groundSpeedMS / configuration.wheelRadiusM;
+  double spinDown = std::exp(-deltaTime / 5.0);
+  state.wheelSpeedLeftRadS = state.gearNormalForceN[1] > 0 ? wheelSpeed : state.wheelSpeedLeftRadS * spinDown;
+  state.wheelSpeedRightRadS = state.gearNormalForceN[2] > 0 ? wheelSpeed : state.wheelSpeedRightRadS * spinDown;
+}
+
+void FlightPlant::updateObservations(const Derivative& derivative) {
+  double q0 = x[6], q1 = x[7], q2 = x[8], q3 = x[9];
+  Matrix3 dcm = bodyToEarth(q0, q1, q2, q3);
+
+  state.northM = x[0];
+  state.eastM = x[1];
+  state.heightAboveFieldM = -x[2];
+  state.altitudeFt = environment.fieldElevationFt + state.heightAboveFieldM / FEET_TO_METERS;
+
+  state.phiRad = std::atan2(2 * (q0 * q1 + q2 * q3), 1 - 2 * (q1 * q1 + q2 * q2));
+  state.thetaRad = std::asin(std::clamp(2 * (q0 * q2 - q3 * q1), -1.0, 1.0));
+  state.psiRad = std::atan2(2 * (q0 * q3 + q1 * q2), 1 - 2 * (q2 * q2 + q3 * q3));
+  state.pRadS = x[10];
+  state.qRadS = x[11];
+  state.rRadS = x[12];
+
+  std::array<double, 3> velocityEarth = multiply(dcm, {x[3], x[4], x[5]});
+  state.velocityNorthMS = velocityEarth[0];
+  state.velocityEastMS = velocityEarth[1];
+  state.velocityDownMS = velocityEarth[2];
+  state.groundSpeedMS = std::hypot(velocityEarth[0], velocityEarth[1]);
+
+  Atmosphere atmosphere = computeAtmosphere(state.altitudeFt);
+  std::array<double, 3> wind = multiplyTransposed(dcm, {environment.windNorthMS, environment.windEastMS, environment.windDownMS});
+  double ua = x[3] - wind[0], va = x[4] - wind[1], wa = x[5] - wind[2];
+  state.trueAirspeedMS = std::sqrt(ua * ua + va * va + wa * wa);
+  state.alphaRad = std::atan2(wa, ua);
+  state.betaRad = std::asin(std::clamp(va / std::max(state.trueAirspeedMS, 1.0), -1.0, 1.0));
+  state.mach = state.trueAirspeedMS / atmosphere.speedOfSoundMS;
+
+  // calibrated airspeed from the impact pressure of subsonic compressible flow
+  double impactPressure = atmosphere.pressurePa * (std::pow(1.0 + 0.2 * state.mach * state.mach, 3.5) - 1.0);
+  state.calibratedAirspeedMS =
+      SEA_LEVEL_SPEED_OF_SOUND_MS * std::sqrt(5.0 * (std::pow(impactPressure / SEA_LEVEL_PRESSURE_PA + 1.0, 2.0 / 7.0) - 1.0));
+
+  state.ambientTemperatureK = atmosphere.temperatureK;
+  state.ambientPressurePa = atmosphere.pressurePa;
+  state.ambientDensityKgM3 = atmosphere.densityKgM3;
+  state.totalAirTemperatureK = atmosphere.temperatureK * (1.0 + 0.2 * state.mach * state.mach);
+
+  // kinematic acceleration of the centre of gravity in body axes
+  std::array<double, 3> gravity = multiplyTransposed(dcm, {0.0, 0.0, GRAVITY_MS2});
+  state.accelerationXMS2 = derivative.specificForceX + gravity[0];
+  state.accelerationYMS2 = derivative.specificForceY + gravity[1];
+  state.accelerationZMS2 = derivative.specificForceZ + gravity[2];
+  state.specificForceXMS2 = derivative.specificForceX;
+  state.specificForceYMS2 = derivative.specificForceY;
+  state.specificForceZMS2 = derivative.specificForceZ;
+
+  state.gearCompressionM = derivative.gearCompressionM;
+  state.gearNormalForceN = derivative.gearNormalForceN;
+}
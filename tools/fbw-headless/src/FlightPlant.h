@@ -0,0 +1,288 @@
+#pragma once
+
+#include <array>
+#include <string>
+
+// the plant uses standard aeronautical conventions: body axes x forward, y right, z down, north-east-down earth axes,
+// angles in radians and SI units internally, the interface structs state their units in the member names
+
+constexpr int MAX_ENGINE_COUNT = 4;
+
+// flaps configurations as used by the flaps handle index of the interface: 0, 1, 1+F, 2, 3, FULL
+constexpr int FLAPS_CONFIGURATION_COUNT = 6;
+
+struct FlightPlantConfiguration {
+  std::string name;
+
+  // mass and geometry
+  double massKg;
+  double cgPercentMac;
+  double referenceCgPercentMac;
+  double wingAreaM2;
+  double chordM;
+  double spanM;
+  double inertiaXxKgM2;
+  double inertiaYyKgM2;
+  double inertiaZzKgM2;
+  double inertiaXzKgM2;
+
+  // longitudinal aerodynamics, derivatives per radian, rate derivatives per normalised rate
+  double liftZero;
+  double liftAlpha;
+  double liftPitchRate;
+  double liftElevator;
+  double liftStabilizer;
+  double liftSpoiler;
+  double dragZero;
+  double dragInduced;
+  double dragGear;
+  double dragSpoiler;
+  double dragElevator;
+  double pitchZero;
+  double pitchAlpha;
+  double pitchRate;
+  double pitchElevator;
+  double pitchStabilizer;
+  double pitchSpoiler;
+  double pitchGear;
+  double stallLiftDrop;
+
+  // lateral aerodynamics, derivatives per radian, rate derivatives per normalised rate
+  double sideBeta;
+  double sideRudder;
+  double rollBeta;
+  double rollRollRate;
+  double rollYawRate;
+  double rollAileron;
+  double rollSpoiler;
+  double rollRudder;
+  double yawBeta;
+  double yawRollRate;
+  double yawYawRate;
+  double yawAileron;
+  double yawRudder;
+
+  // increments of the flaps configurations
+  std::array<double, FLAPS_CONFIGURATION_COUNT> flapsLift;
+  std::array<double, FLAPS_CONFIGURATION_COUNT> flapsDrag;
+  std::array<double, FLAPS_CONFIGURATION_COUNT> flapsPitch;
+  std::array<double, FLAPS_CONFIGURATION_COUNT> flapsStallAlphaDeg;
+
+  // ground effect is active below this fraction of the span
+  double groundEffectSpanFraction;
+  double groundEffectLift;
+  double groundEffectInducedDrag;
+
+  // engines
+  int engineCount;
+  double engineMaximumThrustN;
+  double engineThrustExponent;
+  double engineDensityLapse;
+  double engineMachLapse;
+  double engineIdleN1Percent;
+  double engineSpoolUpTimeConstantS;
+  double engineSpoolDownTimeConstantS;
+  std::array<double, MAX_ENGINE_COUNT> engineYM;
+  double engineZM;
+
+  // surface actuators
+  double elevatorRateDegS;
+  double stabilizerRateDegS;
+  double aileronRateDegS;
+  double spoilerRateDegS;
+  double rudderRateDegS;
+  double actuatorTimeConstantS;
+
+  // landing gear, positions relative to the centre of gravity with the struts fully extended
+  double noseGearXM;
+  double noseGearZM;
+  double mainGearXM;
+  double mainGearYM;
+  double mainGearZM;
+  double noseGearStiffnessNM;
+  double noseGearDampingNsM;
+  double mainGearStiffnessNM;
+  double mainGearDampingNsM;
+  double strutTravelM;
+  double rollingFriction;
+  double brakingFriction;
+  double corneringFriction;
+  double corneringSlipVelocityMS;
+  double wheelRadiusM;
+
+  // returns false and leaves the defaults in place when the file cannot be read
+  bool load(const std::string& filePath);
+};
+
+struct FlightPlantCommands {
+  // trailing edge down positive
+  double elevatorLeftDeg;
+  double elevatorRightDeg;
+  double stabilizerDeg;
+  double aileronLeftDeg;
+  double aileronRightDeg;
+  // extension, mean of the panels of each wing
+  double spoilerLeftDeg;
+  double spoilerRightDeg;
+  // trailing edge left positive
+  double rudderDeg;
+
+  std::array<double, MAX_ENGINE_COUNT> engineN1CommandPercent;
+
+  int flapsConfiguration;
+  bool gearDown;
+  double brakeLeft;
+  double brakeRight;
+};
+
+struct FlightPlantEnvironment {
+  // the reference point of the field, positions are flat earth offsets from it
+  double fieldLatitudeDeg;
+  double fieldLongitudeDeg;
+  double fieldElevationFt;
+  double temperatureOffsetK;
+  // wind and gust in north-east-down axes, the velocity of the air mass
+  double windNorthMS;
+  double windEastMS;
+  double windDownMS;
+};
+
+struct FlightPlantInitialCondition {
+  double northM;
+  double eastM;
+  double heightAboveFieldFt;
+  double headingDeg;
+  double indicatedAirspeedKn;
+  double flightPathAngleDeg;
+  int flapsConfiguration;
+  bool gearDown;
+};
+
+// everything that is observable from outside, sensors are derived from this
+struct FlightPlantState {
+  double timeS;
+
+  // position relative to the field reference point
+  double northM;
+  double eastM;
+  double heightAboveFieldM;
+  double altitudeFt;
+
+  // attitude and rates
+  double thetaRad;
+  double phiRad;
+  double psiRad;
+  double pRadS;
+  double qRadS;
+  double rRadS;
+
+  // velocities
+  double velocityNorthMS;
+  double velocityEastMS;
+  double velocityDownMS;
+  double groundSpeedMS;
+  double trueAirspeedMS;
+  double calibratedAirspeedMS;
+  double mach;
+  double alphaRad;
+  double betaRad;
+
+  // body accelerations, the specific force measures what an accelerometer senses
+  double accelerationXMS2;
+  double accelerationYMS2;
+  double accelerationZMS2;
+  double specificForceXMS2;
+  double specificForceYMS2;
+  double specificForceZMS2;
+
+  // atmosphere
+  double ambientTemperatureK;
+  double ambientPressurePa;
+  double ambientDensityKgM3;
+  double totalAirTemperatureK;
+
+  // surfaces as positioned by the actuators
+  double elevatorLeftDeg;
+  double elevatorRightDeg;
+  double stabilizerDeg;
+  double aileronLeftDeg;
+  double aileronRightDeg;
+  double spoilerLeftDeg;
+  double spoilerRightDeg;
+  double rudderDeg;
+  int flapsConfiguration;
+  bool gearDown;
+
+  std::array<double, MAX_ENGINE_COUNT> engineN1Percent;
+  std::array<double, MAX_ENGINE_COUNT> engineN1CommandPercent;
+  std::array<double, MAX_ENGINE_COUNT> engineThrustN;
+
+  // landing gear: nose, left main, right main
+  std::array<double, 3> gearCompressionM;
+  std::array<double, 3> gearNormalForceN;
+  double wheelSpeedLeftRadS;
+  double wheelSpeedRightRadS;
+};
+
+class FlightPlant {
+ public:
+  FlightPlant(const FlightPlantConfiguration& configuration);
+
+  // starts in steady flight with the given condition, returns false when no trim was found
+  bool initialize(const FlightPlantInitialCondition& initialCondition, const FlightPlantEnvironment& environment);
+
+  void setEnvironment(const FlightPlantEnvironment& environment);
+
+  const FlightPlantEnvironment& getEnvironment() const { return environment; }
+
+  void step(double deltaTime, const FlightPlantCommands& commands);
+
+  const FlightPlantState& getState() const { return state; }
+
+  const FlightPlantConfiguration& getConfiguration() const { return configuration; }
+
+  // trimmed values of the initial condition
+  double getTrimStabilizerDeg() const { return trimStabilizerDeg; }
+  double getTrimN1Percent() const { return trimN1Percent; }
+
+ private:
+  // rigid body state: position north-east-down, body velocities, attitude quaternion and body rates
+  static constexpr int STATE_SIZE = 13;
+  using StateVector = std::array<double, STATE_SIZE>;
+
+  struct Atmosphere {
+    double temperatureK;
+    double pressurePa;
+    double densityKgM3;
+    double speedOfSoundMS;
+  };
+
+  struct Derivative {
+    StateVector value;
+    double specificForceX;
+    double specificForceY;
+    double specificForceZ;
+    std::array<double, 3> gearCompressionM;
+    std::array<double, 3> gearNormalForceN;
+  };
+
+  const FlightPlantConfiguration configuration;
+  FlightPlantEnvironment environment = {};
+  FlightPlantState state = {};
+  StateVector x = {};
+
+  double brakeLeft = 0;
+  double brakeRight = 0;
+
+  double trimStabilizerDeg = 0;
+  double trimN1Percent = 0;
+
+  Atmosphere computeAtmosphere(double altitudeFt) const;
+  double computeEngineThrust(double n1Percent, const Atmosphere& atmosphere, double mach) const;
+  double computeN1ForThrust(double thrustN, const Atmosphere& atmosphere, double mach) const;
+  Derivative computeDerivative(const StateVector& s) const;
+
+  void updateActuators(double deltaTime, const FlightPlantCommands& commands);
+  void updateEngines(double deltaTime);
+  void updateObservations(const Derivative& derivative);
+};
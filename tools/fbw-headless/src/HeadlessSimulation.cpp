@@ -0,0 +1,270 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "FlightControlSystem.h"
+#include "HeadlessSimulation.h"
+#include "ModelSnapshot.h"
+#include "PlantSensors.h"
+#include "fmt/include/fmt/core.h"
+
+static constexpr double DEG_TO_RAD = M_PI / 180.0;
+static constexpr double RAD_TO_DEG = 180.0 / M_PI;
+static constexpr double KNOTS_TO_MS = 0.514444;
+static constexpr double MS_TO_KNOTS = 1.0 / 0.514444;
+static constexpr double MS_TO_FPM = 196.850394;
+static constexpr double GRAVITY_MS2 = 9.80665;
+
+// standard deviations of the scatter at a scatter of one
+static constexpr double LATERAL_OFFSET_SIGMA_M = 30.0;
+static constexpr double HEIGHT_OFFSET_SIGMA_FT = 30.0;
+static constexpr double SPEED_OFFSET_SIGMA_KN = 3.0;
+static constexpr double HEADWIND_MEAN_KN = 5.0;
+static constexpr double HEADWIND_SIGMA_KN = 8.0;
+static constexpr double CROSSWIND_SIGMA_KN = 8.0;
+
+// first order gusts with the length scale of low altitude turbulence, the vertical gusts are weaker
+static constexpr double TURBULENCE_LENGTH_SCALE_M = 300.0;
+static constexpr double VERTICAL_TURBULENCE_FACTOR = 0.6;
+
+// the run is abandoned when the plant leaves any reasonable envelope
+static constexpr double MAXIMUM_BANK_DEG = 60.0;
+
+// the largest difference between two sets of actuator commands
+static double computeCommandDifference(const FlightPlantCommands& first, const FlightPlantCommands& second) {
+  double difference = std::max({std::abs(first.elevatorLeftDeg - second.elevatorLeftDeg),
+                                std::abs(first.elevatorRightDeg - second.elevatorRightDeg),
+                                std::abs(first.stabilizerDeg - second.stabilizerDeg),
+                                std::abs(first.aileronLeftDeg - second.aileronLeftDeg),
+                                std::abs(first.aileronRightDeg - second.aileronRightDeg),
+                                std::abs(first.spoilerLeftDeg - second.spoilerLeftDeg),
+                                std::abs(first.spoilerRightDeg - second.spoilerRightDeg),
+                                std::abs(first.rudderDeg - second.rudderDeg),
+                                std::abs(first.brakeLeft - second.brakeLeft),
+                                std::abs(first.brakeRight - second.brakeRight)});
+  for (size_t i = 0; i < first.engineN1CommandPercent.size(); i++) {
+    difference = std::max(difference, std::abs(first.engineN1CommandPercent[i] - second.engineN1CommandPercent[i]));
+  }
+  if (first.flapsConfiguration != second.flapsConfiguration || first.gearDown != second.gearDown) {
+    difference = std::max(difference, 1.0);
+  }
+  return difference;
+}
+
+// flies on without gusts and returns the commands of every step
+static std::vector<FlightPlantCommands> flySteps(FlightControlSystem& flightControlSystem,
+                                                 FlightPlant& plant,
+                                                 ApproachPilot& pilot,
+                                                 double stepTime,
+                                                 int32_t steps) {
+  std::vector<FlightPlantCommands> commands;
+  commands.reserve(steps);
+  for (int32_t i = 0; i < steps; i++) {
+    PilotInputs pilotInputs = pilot.update(stepTime, plant);
+    commands.push_back(flightControlSystem.update(stepTime, plant, pilotInputs));
+    plant.step(stepTime, commands.back());
+  }
+  return commands;
+}
+
+HeadlessSimulation::HeadlessSimulation(const FlightPlantConfiguration& plantConfiguration,
+                                       const ApproachConfiguration& approachConfiguration,
+                                       double stepTime,
+                                       double maximumTimeS)
+    : plantConfiguration(plantConfiguration),
+      approachConfiguration(approachConfiguration),
+      stepTime(stepTime),
+      maximumTimeS(maximumTimeS) {}
+
+RunCondition HeadlessSimulation::createRunCondition(uint32_t seed, double scatter, double turbulenceMS) {
+  std::mt19937 generator(seed);
+  std::normal_distribution<double> normal;
+
+  RunCondition condition = {};
+  condition.seed = seed;
+  condition.lateralOffsetM = scatter * LATERAL_OFFSET_SIGMA_M * normal(generator);
+  condition.heightOffsetFt = scatter * HEIGHT_OFFSET_SIGMA_FT * normal(generator);
+  condition.speedOffsetKn = scatter * SPEED_OFFSET_SIGMA_KN * normal(generator);
+  condition.headwindKn = scatter * (HEADWIND_MEAN_KN + HEADWIND_SIGMA_KN * normal(generator));
+  condition.crosswindKn = scatter * CROSSWIND_SIGMA_KN * normal(generator);
+  condition.turbulenceMS = turbulenceMS;
+  return condition;
+}
+
+RunResult HeadlessSimulation::run(const RunCondition& condition, std::FILE* trace) const {
+  RunResult result = {};
+  result.condition = condition;
+  result.normalLawKept = true;
+  result.minimumNormalLoadFactor = 1.0;
+  result.maximumNormalLoadFactor = 1.0;
+
+  auto flightControlSystem = createFlightControlSystem();
+  FlightPlant plant(plantConfiguration);
+  ApproachPilot pilot(approachConfiguration);
+
+  const FlightPlantEnvironment meanEnvironment = createMeanEnvironment(condition);
+  FlightPlantEnvironment environment = meanEnvironment;
+
+  result.trimmed =
+      plant.initialize(pilot.getInitialCondition(condition.lateralOffsetM, condition.heightOffsetFt, condition.speedOffsetKn), environment);
+  if (!result.trimmed) {
+    return result;
+  }
+
+  // the computers are powered and engaged while the plant is held in its initial condition
+  for (double warmUpTime = 0; warmUpTime < FlightControlSystem::WARM_UP_TIME_S; warmUpTime += stepTime) {
+    flightControlSystem->update(stepTime, plant, pilot.getWarmUpInputs(warmUpTime));
+  }
+  FlightControlStatus status = flightControlSystem->getStatus();
+  result.computersHealthy = status.computersHealthy;
+  result.autothrustActive = status.autothrustStatus == FlightControlStatus::AUTOTHRUST_STATUS_ACTIVE;
+
+  if (trace != nullptr) {
+    fmt::print(trace,
+               "time,phase,along_track_m,cross_track_m,radio_height_ft,cas_kn,ground_speed_kn,vertical_speed_fpm,theta_deg,phi_deg,"
+               "psi_deg,alpha_deg,nz_g,pitch_stick,roll_stick,rudder_pedal,elevator_deg,stabilizer_deg,aileron_left_deg,"
+               "aileron_right_deg,spoiler_left_deg,spoiler_right_deg,rudder_deg,n1_percent,n1_command_percent,normal_law,"
+               "autothrust_status\n");
+  }
+
+  std::mt19937 generator(condition.seed);
+  std::normal_distribution<double> normal;
+  std::array<double, 3> gust = {};
+
+  while (plant.getState().timeS < maximumTimeS) {
+    const auto& state = plant.getState();
+
+    // gusts in north-east-down axes, correlated over the time the aircraft needs to fly through the length scale
+    if (condition.turbulenceMS > 0) {
+      double correlation = std::exp(-stepTime * std::max(state.trueAirspeedMS, 10.0) / TURBULENCE_LENGTH_SCALE_M);
+      double innovation = std::sqrt(1.0 - correlation * correlation);
+      const std::array<double, 3> sigma = {condition.turbulenceMS, condition.turbulenceMS,
+                                           VERTICAL_TURBULENCE_FACTOR * condition.turbulenceMS};
+      for (int i = 0; i < 3; i++) {
+        gust[i] = correlation * gust[i] + sigma[i] * innovation * normal(generator);
+      }
+      environment.windNorthMS = meanEnvironment.windNorthMS + gust[0];
+      environment.windEastMS = meanEnvironment.windEastMS + gust[1];
+      environment.windDownMS = meanEnvironment.windDownMS + gust[2];
+      plant.setEnvironment(environment);
+    }
+
+    PilotInputs pilotInputs = pilot.update(stepTime, plant);
+    if (pilot.getPhase() == ApproachPhase::Stopped) {
+      result.stopped = true;
+      result.stopDistanceM = pilot.getAlongTrackM(plant);
+      break;
+    }
+
+    FlightPlantCommands commands = flightControlSystem->update(stepTime, plant, pilotInputs);
+    status = flightControlSystem->getStatus();
+    plant.step(stepTime, commands);
+
+    double normalLoadFactor = -state.specificForceZMS2 / GRAVITY_MS2;
+    double bankDeg = state.phiRad * RAD_TO_DEG;
+    result.normalLawKept = result.normalLawKept && status.normalLawActive;
+    result.minimumNormalLoadFactor = std::min(result.minimumNormalLoadFactor, normalLoadFactor);
+    result.maximumNormalLoadFactor = std::max(result.maximumNormalLoadFactor, normalLoadFactor);
+    result.maximumBankDeg = std::max(result.maximumBankDeg, std::abs(bankDeg));
+
+    bool mainGearOnGround = PlantSensors::isLeftMainGearPressed(plant) || PlantSensors::isRightMainGearPressed(plant);
+    if (!result.landed && mainGearOnGround) {
+      result.landed = true;
+      result.touchdownSinkRateFpm = state.velocityDownMS * MS_TO_FPM;
+      result.touchdownDistanceM = pilot.getAlongTrackM(plant);
+      result.touchdownLateralM = pilot.getCrossTrackM(plant);
+      result.touchdownCasKn = state.calibratedAirspeedMS * MS_TO_KNOTS;
+      result.touchdownPitchDeg = state.thetaRad * RAD_TO_DEG;
+      result.touchdownBankDeg = bankDeg;
+    }
+
+    if (trace != nullptr) {
+      fmt::print(trace, "{:.2f},{},{:.1f},{:.2f},{:.1f},{:.2f},{:.2f},{:.0f},{:.3f},{:.3f},{:.3f},{:.3f},{:.4f},{:.4f},{:.4f},{:.4f},",
+                 state.timeS, static_cast<int>(pilot.getPhase()), pilot.getAlongTrackM(plant), pilot.getCrossTrackM(plant),
+                 PlantSensors::computeRadioHeightFt(plant), state.calibratedAirspeedMS * MS_TO_KNOTS, state.groundSpeedMS * MS_TO_KNOTS,
+                 -state.velocityDownMS * MS_TO_FPM, state.thetaRad * RAD_TO_DEG, bankDeg, state.psiRad * RAD_TO_DEG,
+                 state.alphaRad * RAD_TO_DEG, normalLoadFactor, pilotInputs.pitchStick, pilotInputs.rollStick, pilotInputs.rudderPedal);
+      fmt::print(trace, "{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.2f},{:.2f},{},{}\n",
+                 0.5 * (state.elevatorLeftDeg + state.elevatorRightDeg), state.stabilizerDeg, state.aileronLeftDeg, state.aileronRightDeg,
+                 state.spoilerLeftDeg, state.spoilerRightDeg, state.rudderDeg, state.engineN1Percent[0], state.engineN1CommandPercent[0],
+                 status.normalLawActive ? 1 : 0, status.autothrustStatus);
+    }
+
+    // a diverged plant ends the run as not landed
+    if (!std::isfinite(state.heightAboveFieldM) || std::abs(bankDeg) > MAXIMUM_BANK_DEG ||
+        (!result.landed && state.heightAboveFieldM < 0)) {
+      break;
+    }
+  }
+
+  result.simulatedTimeS = plant.getState().timeS;
+  return result;
+}
+
+SnapshotCheckResult HeadlessSimulation::checkSnapshot(const RunCondition& condition, double snapshotTimeS, double durationS) const {
+  SnapshotCheckResult result = {};
+
+  auto flightControlSystem = createFlightControlSystem();
+  FlightPlant plant(plantConfiguration);
+  ApproachPilot pilot(approachConfiguration);
+
+  FlightPlantInitialCondition initialCondition =
+      pilot.getInitialCondition(condition.lateralOffsetM, condition.heightOffsetFt, condition.speedOffsetKn);
+  result.trimmed = plant.initialize(initialCondition, createMeanEnvironment(condition));
+  if (!result.trimmed) {
+    return result;
+  }
+
+  for (double warmUpTime = 0; warmUpTime < FlightControlSystem::WARM_UP_TIME_S; warmUpTime += stepTime) {
+    flightControlSystem->update(stepTime, plant, pilot.getWarmUpInputs(warmUpTime));
+  }
+  flySteps(*flightControlSystem, plant, pilot, stepTime, static_cast<int32_t>(std::round(snapshotTimeS / stepTime)));
+
+  std::vector<unsigned char> blob = flightControlSystem->saveSnapshot();
+  result.snapshotSize = blob.size();
+  FlightPlant restoredPlant(plant);
+  ApproachPilot restoredPilot(pilot);
+
+  int32_t steps = static_cast<int32_t>(std::round(durationS / stepTime));
+  std::vector<FlightPlantCommands> commands = flySteps(*flightControlSystem, plant, pilot, stepTime, steps);
+
+  // the new computers have only been initialized, everything they continue with has to come from the blob
+  auto restoredFlightControlSystem = createFlightControlSystem();
+  std::vector<unsigned char> truncatedBlob(blob.begin(), blob.end() - 1);
+  std::vector<unsigned char> foreignBlob = blob;
+  foreignBlob[offsetof(ModelSnapshotHeader, id)] ^= 1;
+  result.foreignBlobsRejected =
+      !restoredFlightControlSystem->restoreSnapshot(truncatedBlob) && !restoredFlightControlSystem->restoreSnapshot(foreignBlob);
+  result.restored = restoredFlightControlSystem->restoreSnapshot(blob);
+  if (!result.restored) {
+    return result;
+  }
+
+  std::vector<FlightPlantCommands> restoredCommands = flySteps(*restoredFlightControlSystem, restoredPlant, restoredPilot, stepTime, steps);
+  result.comparedSteps = steps;
+  for (int32_t i = 0; i < steps; i++) {
+    double difference = computeCommandDifference(commands[i], restoredCommands[i]);
+    // a NaN command differs as well
+    if (!(difference == 0)) {
+      result.differingSteps++;
+      result.maximumDifference = std::max(result.maximumDifference, std::isnan(difference) ? INFINITY : difference);
+    }
+  }
+  return result;
+}
+
+FlightPlantEnvironment HeadlessSimulation::createMeanEnvironment(const RunCondition& condition) const {
+  // the mean wind is the velocity of the air mass, a headwind blows against the runway heading
+  double heading = approachConfiguration.runwayHeadingDeg * DEG_TO_RAD;
+  double headwind = condition.headwindKn * KNOTS_TO_MS;
+  double crosswind = condition.crosswindKn * KNOTS_TO_MS;
+  FlightPlantEnvironment environment = {};
+  environment.fieldLatitudeDeg = approachConfiguration.fieldLatitudeDeg;
+  environment.fieldLongitudeDeg = approachConfiguration.fieldLongitudeDeg;
+  environment.fieldElevationFt = approachConfiguration.fieldElevationFt;
+  environment.windNorthMS = -headwind * std::cos(heading) + crosswind * std::sin(heading);
+  environment.windEastMS = -headwind * std::sin(heading) - crosswind * std::cos(heading);
+  return environment;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "ApproachPilot.h"
+#include "FlightPlant.h"
+
+// the conditions of one run, all offsets are zero for the nominal approach
+struct RunCondition {
+  uint32_t seed;
+  double lateralOffsetM;
+  double heightOffsetFt;
+  double speedOffsetKn;
+  double headwindKn;
+  // wind from the right of the runway positive
+  double crosswindKn;
+  // standard deviation of the horizontal gusts
+  double turbulenceMS;
+};
+
+struct RunResult {
+  RunCondition condition;
+
+  bool trimmed;
+  bool computersHealthy;
+  bool autothrustActive;
+  bool normalLawKept;
+  bool landed;
+  bool stopped;
+
+  // at the first contact of a main gear
+  double touchdownSinkRateFpm;
+  double touchdownDistanceM;
+  double touchdownLateralM;
+  double touchdownCasKn;
+  double touchdownPitchDeg;
+  double touchdownBankDeg;
+
+  double stopDistanceM;
+  double maximumBankDeg;
+  double minimumNormalLoadFactor;
+  double maximumNormalLoadFactor;
+  double simulatedTimeS;
+};
+
+// the commands of the computers flying on from a snapshot, compared with the commands of new computers restored from it
+struct SnapshotCheckResult {
+  bool trimmed;
+  bool restored;
+  // blobs of another kind or size are rejected
+  bool foreignBlobsRejected;
+  size_t snapshotSize;
+
+  int32_t comparedSteps;
+  // steps in which a command of the restored computers is not identical
+  int32_t differingSteps;
+  double maximumDifference;
+};
+
+// closes the loop between the approach pilot, the flight control computers of the aircraft and the plant
+class HeadlessSimulation {
+ public:
+  HeadlessSimulation(const FlightPlantConfiguration& plantConfiguration,
+                     const ApproachConfiguration& approachConfiguration,
+                     double stepTime,
+                     double maximumTimeS);
+
+  // the scatter scales the random offsets of the initial condition and the wind, zero gives the nominal approach
+  static RunCondition createRunCondition(uint32_t seed, double scatter, double turbulenceMS);
+
+  // flies one approach from the warm up of the computers to the stop on the runway, the trace receives one csv line per step
+  RunResult run(const RunCondition& condition, std::FILE* trace) const;
+
+  // flies one approach without gusts up to the snapshot time, then flies on for the duration once with the computers
+  // which took the snapshot and once with new computers restored from it, from the same plant and pilot state
+  SnapshotCheckResult checkSnapshot(const RunCondition& condition, double snapshotTimeS, double durationS) const;
+
+ private:
+  // the wind of the condition without the gusts
+  FlightPlantEnvironment createMeanEnvironment(const RunCondition& condition) const;
+
+
+  const FlightPlantConfiguration plantConfiguration;
+  const ApproachConfiguration approachConfiguration;
+  const double stepTime;
+  const double maximumTimeS;
+};
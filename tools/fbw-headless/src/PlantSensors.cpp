@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Arinc429.h"
+#include "Arinc429Utils.h"
+#include "PlantSensors.h"
+
+static constexpr double GRAVITY_MS2 = 9.80665;
+static constexpr double RAD_TO_DEG = 180.0 / M_PI;
+static constexpr double MS_TO_KNOTS = 1.0 / 0.514444;
+static constexpr double METERS_TO_FEET = 1.0 / 0.3048;
+static constexpr double EARTH_RADIUS_M = 6371000.0;
+
+// the radio altimeters do not compute data above this height
+static constexpr double RADIO_ALTIMETER_RANGE_FT = 8192.0;
+
+// wheel speed of the sim in rpm from the angular rate of the wheel
+static constexpr double RAD_S_TO_RPM = 60.0 / (2.0 * M_PI);
+
+// slat and flap angles of the feedback position pick off units for the flaps configurations 0, 1, 1+F, 2, 3 and FULL
+static constexpr std::array<double, FLAPS_CONFIGURATION_COUNT> SLAT_FPPU_ANGLE_DEG = {0.0, 222.27, 222.27, 272.27, 272.27, 334.16};
+static constexpr std::array<double, FLAPS_CONFIGURATION_COUNT> FLAP_FPPU_ANGLE_DEG = {0.0, 0.0, 120.22, 145.51, 168.35, 251.97};
+
+static base_arinc_429 normalWord(double value) {
+  base_arinc_429 word;
+  word.SSM = Arinc429SignStatus::NormalOperation;
+  word.Data = static_cast<float>(value);
+  return word;
+}
+
+static double normalizeHeading(double angleDeg) {
+  double heading = std::fmod(angleDeg, 360.0);
+  return heading < 0 ? heading + 360.0 : heading;
+}
+
+static double normalizeAngle(double angleDeg) {
+  double angle = normalizeHeading(angleDeg);
+  return angle > 180.0 ? angle - 360.0 : angle;
+}
+
+double PlantSensors::computeRadioHeightFt(const FlightPlant& plant) {
+  const auto& state = plant.getState();
+  const auto& c = plant.getConfiguration();
+  double height = state.heightAboveFieldM + c.mainGearXM * std::sin(state.thetaRad) -
+                  c.mainGearZM * std::cos(state.thetaRad) * std::cos(state.phiRad);
+  return std::max(0.0, height * METERS_TO_FEET);
+}
+
+HeadlessSimData PlantSensors::computeSimData(const FlightPlant& plant) {
+  const auto& state = plant.getState();
+  const auto& c = plant.getConfiguration();
+  const auto& environment = plant.getEnvironment();
+
+  HeadlessSimData simData = {};
+  simData.simulationTime = state.timeS;
+  simData.nz_g = -state.specificForceZMS2 / GRAVITY_MS2;
+  // the sim measures pitch positive nose down and bank positive left wing down
+  simData.Theta_deg = -state.thetaRad * RAD_TO_DEG;
+  simData.Phi_deg = -state.phiRad * RAD_TO_DEG;
+  simData.bodyRotationVelocityX = -state.qRadS;
+  simData.bodyRotationVelocityY = state.rRadS;
+  simData.bodyRotationVelocityZ = -state.pRadS;
+  simData.bx_m_s2 = state.accelerationXMS2;
+  simData.by_m_s2 = state.accelerationYMS2;
+  simData.bz_m_s2 = -state.accelerationZMS2;
+  simData.Psi_true_deg = normalizeHeading(state.psiRad * RAD_TO_DEG);
+  simData.Psi_magnetic_deg = simData.Psi_true_deg;
+  simData.Psi_magnetic_track_deg = normalizeHeading(std::atan2(state.velocityEastMS, state.velocityNorthMS) * RAD_TO_DEG);
+  // the sim trims nose up with a positive elevator trim
+  simData.eta_trim_deg = -state.stabilizerDeg;
+  simData.zeta_trim_pos = 0;
+  simData.alpha_deg = state.alphaRad * RAD_TO_DEG;
+  simData.beta_deg = state.betaRad * RAD_TO_DEG;
+  simData.V_ias_kn = state.calibratedAirspeedMS * MS_TO_KNOTS;
+  simData.V_tas_kn = state.trueAirspeedMS * MS_TO_KNOTS;
+  simData.V_mach = state.mach;
+  simData.V_gnd_kn = state.groundSpeedMS * MS_TO_KNOTS;
+  simData.H_ft = state.altitudeFt;
+  simData.H_ind_ft = state.altitudeFt;
+  simData.H_radio_ft = computeRadioHeightFt(plant);
+  simData.H_dot_fpm = -state.velocityDownMS * METERS_TO_FEET * 60.0;
+  // the sim reports the centre of gravity as a fraction of the chord
+  simData.CG_percent_MAC = c.cgPercentMac / 100.0;
+  simData.total_weight_kg = c.massKg;
+  // the animation of the struts is half way when extended and one when fully compressed
+  simData.gear_animation_pos_0 = state.gearDown ? 0.5 + 0.5 * state.gearCompressionM[0] / c.strutTravelM : 0.0;
+  simData.gear_animation_pos_1 = state.gearDown ? 0.5 + 0.5 * state.gearCompressionM[1] / c.strutTravelM : 0.0;
+  simData.gear_animation_pos_2 = state.gearDown ? 0.5 + 0.5 * state.gearCompressionM[2] / c.strutTravelM : 0.0;
+  simData.ambient_density_kg_per_m3 = state.ambientDensityKgM3;
+  simData.ambient_pressure_mbar = state.ambientPressurePa / 100.0;
+  simData.ambient_temperature_celsius = state.ambientTemperatureK - 273.15;
+  simData.total_air_temperature_celsius = state.totalAirTemperatureK - 273.15;
+  simData.latitude_deg = environment.fieldLatitudeDeg + state.northM / EARTH_RADIUS_M * RAD_TO_DEG;
+  simData.longitude_deg =
+      environment.fieldLongitudeDeg + state.eastM / (EARTH_RADIUS_M * std::cos(environment.fieldLatitudeDeg / RAD_TO_DEG)) * RAD_TO_DEG;
+  double temperatureRatio = std::sqrt(state.totalAirTemperatureK / 288.15);
+  for (int i = 0; i < c.engineCount; i++) {
+    simData.commanded_engine_N1_percent[i] = state.engineN1CommandPercent[i];
+    simData.engine_N1_percent[i] = state.engineN1Percent[i];
+    simData.corrected_engine_N1_percent[i] = state.engineN1Percent[i] / temperatureRatio;
+    simData.engine_combustion[i] = true;
+  }
+  simData.wheelRpmLeft = state.wheelSpeedLeftRadS * RAD_S_TO_RPM;
+  simData.wheelRpmRight = state.wheelSpeedRightRadS * RAD_S_TO_RPM;
+  return simData;
+}
+
+base_adr_bus PlantSensors::computeAdrBus(const FlightPlant& plant) {
+  const auto& state = plant.getState();
+
+  // only the labels the interface provides to the computers are filled
+  base_adr_bus bus = {};
+  bus.altitude_corrected_ft = normalWord(state.altitudeFt);
+  bus.mach = normalWord(state.mach);
+  bus.airspeed_computed_kn = normalWord(state.calibratedAirspeedMS * MS_TO_KNOTS);
+  bus.airspeed_true_kn = normalWord(state.trueAirspeedMS * MS_TO_KNOTS);
+  bus.vertical_speed_ft_min = normalWord(-state.velocityDownMS * METERS_TO_FEET * 60.0);
+  bus.aoa_corrected_deg = normalWord(state.alphaRad * RAD_TO_DEG);
+  bus.corrected_average_static_pressure = normalWord(state.ambientPressurePa / 100.0);
+  return bus;
+}
+
+base_ir_bus PlantSensors::computeIrBus(const FlightPlant& plant) {
+  const auto& state = plant.getState();
+  const auto& environment = plant.getEnvironment();
+  HeadlessSimData simData = computeSimData(plant);
+
+  double phi = state.phiRad, theta = state.thetaRad;
+  double p = state.pRadS, q = state.qRadS, r = state.rRadS;
+  double heading = normalizeHeading(state.psiRad * RAD_TO_DEG);
+  double track = normalizeHeading(std::atan2(state.velocityEastMS, state.velocityNorthMS) * RAD_TO_DEG);
+
+  // only the labels the interface provides to the computers are filled, the accelerations are the specific forces an
+  // accelerometer senses so that the normal acceleration reads one in steady level flight
+  base_ir_bus bus = {};
+  bus.latitude_deg = normalWord(simData.latitude_deg);
+  bus.longitude_deg = normalWord(simData.longitude_deg);
+  bus.ground_speed_kn = normalWord(state.groundSpeedMS * MS_TO_KNOTS);
+  bus.wind_speed_kn = normalWord(std::hypot(environment.windNorthMS, environment.windEastMS) * MS_TO_KNOTS);
+  bus.wind_direction_true_deg = normalWord(normalizeHeading(std::atan2(-environment.windEastMS, -environment.windNorthMS) * RAD_TO_DEG));
+  bus.track_angle_magnetic_deg = normalWord(track);
+  bus.heading_magnetic_deg = normalWord(heading);
+  bus.drift_angle_deg = normalWord(normalizeAngle(track - heading));
+  bus.flight_path_angle_deg = normalWord(std::atan2(-state.velocityDownMS, std::max(state.groundSpeedMS, 0.1)) * RAD_TO_DEG);
+  bus.pitch_angle_deg = normalWord(theta * RAD_TO_DEG);
+  bus.roll_angle_deg = normalWord(phi * RAD_TO_DEG);
+  bus.body_pitch_rate_deg_s = normalWord(q * RAD_TO_DEG);
+  bus.body_roll_rate_deg_s = normalWord(p * RAD_TO_DEG);
+  bus.body_yaw_rate_deg_s = normalWord(r * RAD_TO_DEG);
+  bus.body_long_accel_g = normalWord(state.specificForceXMS2 / GRAVITY_MS2);
+  bus.body_lat_accel_g = normalWord(state.specificForceYMS2 / GRAVITY_MS2);
+  bus.body_normal_accel_g = normalWord(-state.specificForceZMS2 / GRAVITY_MS2);
+  bus.track_angle_rate_deg_s = normalWord((r * std::cos(phi) + q * std::sin(phi)) / std::cos(theta) * RAD_TO_DEG);
+  bus.pitch_att_rate_deg_s = normalWord((q * std::cos(phi) - r * std::sin(phi)) * RAD_TO_DEG);
+  bus.roll_att_rate_deg_s = normalWord((p + (q * std::sin(phi) + r * std::cos(phi)) * std::tan(theta)) * RAD_TO_DEG);
+  // the label carries feet per minute despite its name, as in the systems
+  bus.inertial_vertical_speed_ft_s = normalWord(-state.velocityDownMS * METERS_TO_FEET * 60.0);
+  return bus;
+}
+
+base_arinc_429 PlantSensors::computeRadioHeight(const FlightPlant& plant) {
+  double height = computeRadioHeightFt(plant);
+  base_arinc_429 word = normalWord(height);
+  if (height > RADIO_ALTIMETER_RANGE_FT) {
+    word.SSM = Arinc429SignStatus::NoComputedData;
+  }
+  return word;
+}
+
+base_sfcc_bus PlantSensors::computeSfccBus(const FlightPlant& plant) {
+  int configuration = std::clamp(plant.getState().flapsConfiguration, 0, FLAPS_CONFIGURATION_COUNT - 1);
+  double slatAngle = SLAT_FPPU_ANGLE_DEG[configuration];
+  double flapAngle = FLAP_FPPU_ANGLE_DEG[configuration];
+
+  base_sfcc_bus bus = {};
+  bus.slat_flap_component_status_word = normalWord(0);
+
+  bus.slat_flap_system_status_word = normalWord(0);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 17, configuration == 0);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 18, configuration == 1 || configuration == 2);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 19, configuration == 3);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 20, configuration == 4);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 21, configuration == 5);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 26, configuration == 1);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 28, true);
+  Arinc429Utils::setBit(bus.slat_flap_system_status_word, 29, true);
+
+  bus.slat_flap_actual_position_word = normalWord(0);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 11, true);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 12, slatAngle > -5.0 && slatAngle < 6.2);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 13, slatAngle > 210.4 && slatAngle < 337.0);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 14, slatAngle > 321.8 && slatAngle < 337.0);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 15, slatAngle > 327.4 && slatAngle < 337.0);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 18, true);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 19, flapAngle > -5.0 && flapAngle < 2.5);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 20, flapAngle > 140.7 && flapAngle < 254.0);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 21, flapAngle > 163.7 && flapAngle < 254.0);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 22, flapAngle > 247.8 && flapAngle < 254.0);
+  Arinc429Utils::setBit(bus.slat_flap_actual_position_word, 23, flapAngle > 250.0 && flapAngle < 254.0);
+
+  bus.slat_actual_position_deg = normalWord(slatAngle);
+  bus.flap_actual_position_deg = normalWord(flapAngle);
+  return bus;
+}
+
+base_lgciu_bus PlantSensors::computeLgciuBus(const FlightPlant& plant) {
+  bool gearDown = plant.getState().gearDown;
+  bool nosePressed = isNoseGearPressed(plant);
+  bool leftPressed = isLeftMainGearPressed(plant);
+  bool rightPressed = isRightMainGearPressed(plant);
+
+  // the gear moves instantly, it is either down and locked with the doors closed or up and locked
+  base_lgciu_bus bus = {};
+  bus.discrete_word_1 = normalWord(0);
+  for (int bit = 17; bit <= 19; bit++) {
+    Arinc429Utils::setBit(bus.discrete_word_1, bit, gearDown);
+  }
+  for (int bit = 23; bit <= 25; bit++) {
+    Arinc429Utils::setBit(bus.discrete_word_1, bit, gearDown);
+  }
+  Arinc429Utils::setBit(bus.discrete_word_1, 26, leftPressed);
+  Arinc429Utils::setBit(bus.discrete_word_1, 27, rightPressed);
+  Arinc429Utils::setBit(bus.discrete_word_1, 28, nosePressed);
+  Arinc429Utils::setBit(bus.discrete_word_1, 29, gearDown);
+
+  bus.discrete_word_2 = normalWord(0);
+  Arinc429Utils::setBit(bus.discrete_word_2, 11, leftPressed && rightPressed);
+  Arinc429Utils::setBit(bus.discrete_word_2, 12, nosePressed);
+  Arinc429Utils::setBit(bus.discrete_word_2, 13, leftPressed);
+  Arinc429Utils::setBit(bus.discrete_word_2, 14, rightPressed);
+  Arinc429Utils::setBit(bus.discrete_word_2, 15, gearDown);
+
+  bus.discrete_word_3 = normalWord(0);
+  for (int bit = 11; bit <= 13; bit++) {
+    Arinc429Utils::setBit(bus.discrete_word_3, bit, gearDown);
+  }
+  Arinc429Utils::setBit(bus.discrete_word_3, 14, !gearDown);
+
+  bus.discrete_word_4 = normalWord(0);
+  return bus;
+}
+
+bool PlantSensors::isNoseGearPressed(const FlightPlant& plant) {
+  return plant.getState().gearCompressionM[0] > GEAR_PRESSED_COMPRESSION_M;
+}
+
+bool PlantSensors::isLeftMainGearPressed(const FlightPlant& plant) {
+  return plant.getState().gearCompressionM[1] > GEAR_PRESSED_COMPRESSION_M;
+}
+
+bool PlantSensors::isRightMainGearPressed(const FlightPlant& plant) {
+  return plant.getState().gearCompressionM[2] > GEAR_PRESSED_COMPRESSION_M;
+}
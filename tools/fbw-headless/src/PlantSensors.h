@@ -0,0 +1,78 @@
+#pragma once
+
+#include "FacComputer_types.h"
+#include "FlightPlant.h"
+
+// the simulation variables the interface reads from the sim, with the names, units and sign conventions of SimData so that
+// the wiring of the models can be copied from the FlyByWireInterface
+struct HeadlessSimData {
+  double simulationTime;
+  double nz_g;
+  double Theta_deg;
+  double Phi_deg;
+  // sim body axes: x pitch, y yaw, z roll
+  double bodyRotationVelocityX;
+  double bodyRotationVelocityY;
+  double bodyRotationVelocityZ;
+  // bx longitudinal, by lateral and bz vertical acceleration
+  double bx_m_s2;
+  double by_m_s2;
+  double bz_m_s2;
+  double Psi_magnetic_deg;
+  double Psi_true_deg;
+  double Psi_magnetic_track_deg;
+  double eta_trim_deg;
+  double zeta_trim_pos;
+  double alpha_deg;
+  double beta_deg;
+  double V_ias_kn;
+  double V_tas_kn;
+  double V_mach;
+  double V_gnd_kn;
+  double H_ft;
+  double H_ind_ft;
+  double H_radio_ft;
+  double H_dot_fpm;
+  double CG_percent_MAC;
+  double total_weight_kg;
+  double gear_animation_pos_0;
+  double gear_animation_pos_1;
+  double gear_animation_pos_2;
+  double ambient_density_kg_per_m3;
+  double ambient_pressure_mbar;
+  double ambient_temperature_celsius;
+  double total_air_temperature_celsius;
+  double latitude_deg;
+  double longitude_deg;
+  std::array<double, MAX_ENGINE_COUNT> commanded_engine_N1_percent;
+  std::array<double, MAX_ENGINE_COUNT> engine_N1_percent;
+  std::array<double, MAX_ENGINE_COUNT> corrected_engine_N1_percent;
+  std::array<bool, MAX_ENGINE_COUNT> engine_combustion;
+  double wheelRpmLeft;
+  double wheelRpmRight;
+};
+
+// the sensors and systems the flight control computers read, filled from the plant like the sim and the systems do it in flight
+namespace PlantSensors {
+HeadlessSimData computeSimData(const FlightPlant& plant);
+
+base_adr_bus computeAdrBus(const FlightPlant& plant);
+
+base_ir_bus computeIrBus(const FlightPlant& plant);
+
+// the height of the main gear wheels, it reads zero when the struts touch the runway
+double computeRadioHeightFt(const FlightPlant& plant);
+
+base_arinc_429 computeRadioHeight(const FlightPlant& plant);
+
+base_sfcc_bus computeSfccBus(const FlightPlant& plant);
+
+base_lgciu_bus computeLgciuBus(const FlightPlant& plant);
+
+// the compression of a strut that the landing gear interface reports as pressed
+constexpr double GEAR_PRESSED_COMPRESSION_M = 0.01;
+
+bool isNoseGearPressed(const FlightPlant& plant);
+bool isLeftMainGearPressed(const FlightPlant& plant);
+bool isRightMainGearPressed(const FlightPlant& plant);
+}  // namespace PlantSensors
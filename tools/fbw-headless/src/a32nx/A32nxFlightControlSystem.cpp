@@ -0,0 +1,752 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "Arinc429Utils.h"
+#include "FlightControlSystem.h"
+#include "ModelSnapshot.h"
+#include "PlantSensors.h"
+#include "elac/Elac.h"
+#include "fac/Fac.h"
+#include "fcdc/Fcdc.h"
+#include "model/Autothrust.h"
+#include "sec/Sec.h"
+
+// the computers are wired like the FlyByWireInterface of the A32NX does it, the hydraulic and electrical systems are
+// always available and the actuators of the plant take the place of the servo controls
+class A32nxFlightControlSystem final : public FlightControlSystem {
+ public:
+  void initialize();
+
+  FlightPlantCommands update(double deltaTime, const FlightPlant& plant, const PilotInputs& pilotInputs) override;
+
+  FlightControlStatus getStatus() const override;
+
+  std::vector<unsigned char> saveSnapshot() const override;
+
+  bool restoreSnapshot(const std::vector<unsigned char>& blob) override;
+
+ private:
+  // the surfaces as the computers see them, the plant moves them towards the order of the active servo control
+  struct SurfacePositions {
+    double leftElevatorDeg;
+    double rightElevatorDeg;
+    double thsDeg;
+    double leftAileronDeg;
+    double rightAileronDeg;
+    std::array<double, 5> leftSpoilerDeg;
+    std::array<double, 5> rightSpoilerDeg;
+    double rudderTrimDeg;
+    double rudderTravelLimitDeg;
+  };
+
+  // the computers, the buses between them and the surfaces
+  struct Snapshot {
+    static constexpr uint32_t ID = 0x584e3233;  // "32NX"
+
+    Elac::Snapshot elacs[2];
+    base_elac_discrete_outputs elacsDiscreteOutputs[2];
+    base_elac_analog_outputs elacsAnalogOutputs[2];
+    base_elac_out_bus elacsBusOutputs[2];
+
+    Sec::Snapshot secs[3];
+    base_sec_discrete_outputs secsDiscreteOutputs[3];
+    base_sec_analog_outputs secsAnalogOutputs[3];
+    base_sec_out_bus secsBusOutputs[3];
+
+    Fcdc::Snapshot fcdcs[2];
+    FcdcDiscreteOutputs fcdcsDiscreteOutputs[2];
+    base_fcdc_bus fcdcsBusOutputs[2];
+
+    Fac::Snapshot facs[2];
+    base_fac_discrete_outputs facsDiscreteOutputs[2];
+    base_fac_analog_outputs facsAnalogOutputs[2];
+    base_fac_bus facsBusOutputs[2];
+
+    AutothrustModelClass::Snapshot_Autothrust_T autoThrust;
+    AutothrustModelClass::ExternalInputs_Autothrust_T autoThrustInput;
+    athr_output autoThrustOutput;
+
+    base_adr_bus adrBusOutputs[3];
+    base_ir_bus irBusOutputs[3];
+    base_ra_bus raBusOutputs[2];
+    base_sfcc_bus sfccBusOutputs[2];
+    base_lgciu_bus lgciuBusOutputs[2];
+    base_fmgc_b_bus fmgcBBusOutputs;
+
+    SurfacePositions surfaces;
+    double monotonicTime;
+    bool powered;
+    bool pushbuttonsPressed;
+  };
+
+  void updateAutothrust(double deltaTime, const HeadlessSimData& simData, const PilotInputs& pilotInputs);
+  void updateElac(double deltaTime, int elacIndex, const HeadlessSimData& simData, const PilotInputs& pilotInputs);
+  void updateSec(double deltaTime, int secIndex, const HeadlessSimData& simData, const PilotInputs& pilotInputs);
+  void updateFac(double deltaTime, int facIndex, const HeadlessSimData& simData);
+  void updateFcdc(double deltaTime, int fcdcIndex);
+  FlightPlantCommands updateServoControls(const FlightPlant& plant, const PilotInputs& pilotInputs);
+
+  Elac elacs[2] = {Elac(true), Elac(false)};
+  base_elac_discrete_outputs elacsDiscreteOutputs[2];
+  base_elac_analog_outputs elacsAnalogOutputs[2];
+  base_elac_out_bus elacsBusOutputs[2];
+
+  Sec secs[3] = {Sec(true, false), Sec(false, false), Sec(false, true)};
+  base_sec_discrete_outputs secsDiscreteOutputs[3];
+  base_sec_analog_outputs secsAnalogOutputs[3];
+  base_sec_out_bus secsBusOutputs[3];
+
+  Fcdc fcdcs[2] = {Fcdc(true), Fcdc(false)};
+  FcdcDiscreteOutputs fcdcsDiscreteOutputs[2];
+  base_fcdc_bus fcdcsBusOutputs[2];
+
+  Fac facs[2] = {Fac(true), Fac(false)};
+  base_fac_discrete_outputs facsDiscreteOutputs[2];
+  base_fac_analog_outputs facsAnalogOutputs[2];
+  base_fac_bus facsBusOutputs[2];
+
+  AutothrustModelClass autoThrust;
+  AutothrustModelClass::ExternalInputs_Autothrust_T autoThrustInput;
+  athr_output autoThrustOutput;
+
+  base_adr_bus adrBusOutputs[3];
+  base_ir_bus irBusOutputs[3];
+  base_ra_bus raBusOutputs[2];
+  base_sfcc_bus sfccBusOutputs[2];
+  base_lgciu_bus lgciuBusOutputs[2];
+  base_fmgc_b_bus fmgcBBusOutputs;
+
+  SurfacePositions surfaces;
+  double monotonicTime;
+  bool powered;
+  bool pushbuttonsPressed;
+};
+
+// the power is applied after a short outage so that the computers run their self tests, the pushbuttons follow so that
+// the computers which need a reset in flight engage
+static constexpr double POWER_UP_TIME_S = 0.5;
+static constexpr double PUSHBUTTON_TIME_S = 1.0;
+
+// the sidestick and pedal axes as the sim provides them
+static constexpr double SIDESTICK_PITCH_INPUT_SIGN = 1.0;
+static constexpr double SIDESTICK_ROLL_INPUT_SIGN = 1.0;
+static constexpr double RUDDER_PEDAL_INPUT_SIGN = -1.0;
+
+// mechanical rudder deflection at full pedal travel
+static constexpr double RUDDER_PEDAL_MAXIMUM_DEG = 30.0;
+
+// wheel speed of the sim in rpm to the speed of the tachometers in knots
+static constexpr double WHEEL_RPM_TO_KNOTS = 0.118921;
+
+void A32nxFlightControlSystem::initialize() {
+  autoThrust.initialize();
+}
+
+FlightPlantCommands A32nxFlightControlSystem::update(double deltaTime, const FlightPlant& plant, const PilotInputs& pilotInputs) {
+  monotonicTime += deltaTime;
+  powered = monotonicTime > POWER_UP_TIME_S;
+  pushbuttonsPressed = monotonicTime > PUSHBUTTON_TIME_S;
+
+  // the sim time keeps running while the plant is held during the warm up
+  HeadlessSimData simData = PlantSensors::computeSimData(plant);
+  simData.simulationTime = monotonicTime;
+
+  updateAutothrust(deltaTime, simData, pilotInputs);
+
+  for (int i = 0; i < 2; i++) {
+    raBusOutputs[i].radio_height_ft = PlantSensors::computeRadioHeight(plant);
+    lgciuBusOutputs[i] = PlantSensors::computeLgciuBus(plant);
+    sfccBusOutputs[i] = PlantSensors::computeSfccBus(plant);
+  }
+  for (int i = 0; i < 3; i++) {
+    adrBusOutputs[i] = PlantSensors::computeAdrBus(plant);
+    irBusOutputs[i] = PlantSensors::computeIrBus(plant);
+  }
+
+  // the autopilot is not engaged, the flight guidance only provides the weight and balance and the radio height
+  base_arinc_429 raToUse = Arinc429Utils::isFw(raBusOutputs[0].radio_height_ft) ? raBusOutputs[1].radio_height_ft
+                                                                                  : raBusOutputs[0].radio_height_ft;
+  fmgcBBusOutputs.fg_radio_height_ft = raToUse;
+  fmgcBBusOutputs.delta_p_ail_cmd_deg = {Arinc429SignStatus::NormalOperation, 0};
+  fmgcBBusOutputs.delta_p_splr_cmd_deg = {Arinc429SignStatus::NormalOperation, 0};
+  fmgcBBusOutputs.delta_r_cmd_deg = {Arinc429SignStatus::NormalOperation, 0};
+  fmgcBBusOutputs.delta_q_cmd_deg = {Arinc429SignStatus::NormalOperation, 0};
+  fmgcBBusOutputs.fm_weight_lbs = {Arinc429SignStatus::NormalOperation, static_cast<float>(simData.total_weight_kg / 1000.0 * 2205)};
+  fmgcBBusOutputs.fm_cg_percent = {Arinc429SignStatus::NormalOperation, static_cast<float>(simData.CG_percent_MAC)};
+  fmgcBBusOutputs.fac_weight_lbs = {Arinc429SignStatus::NormalOperation, static_cast<float>(simData.total_weight_kg * 2.20462262)};
+  fmgcBBusOutputs.fac_cg_percent = {Arinc429SignStatus::NormalOperation, static_cast<float>(simData.CG_percent_MAC)};
+
+  for (int i = 0; i < 2; i++) {
+    updateElac(deltaTime, i, simData, pilotInputs);
+  }
+  for (int i = 0; i < 3; i++) {
+    updateSec(deltaTime, i, simData, pilotInputs);
+  }
+  for (int i = 0; i < 2; i++) {
+    updateFac(deltaTime, i, simData);
+  }
+  for (int i = 0; i < 2; i++) {
+    updateFcdc(deltaTime, i);
+  }
+
+  return updateServoControls(plant, pilotInputs);
+}
+
+FlightControlStatus A32nxFlightControlSystem::getStatus() const {
+  FlightControlStatus status = {};
+  status.computersHealthy = elacsDiscreteOutputs[0].digital_output_validated && elacsDiscreteOutputs[1].digital_output_validated &&
+                            !secsDiscreteOutputs[0].sec_failed && !secsDiscreteOutputs[1].sec_failed &&
+                            !secsDiscreteOutputs[2].sec_failed && facsDiscreteOutputs[0].fac_healthy && facsDiscreteOutputs[1].fac_healthy;
+
+  // the law reported by the first valid FCDC, as the flight data recorder of the interface uses it
+  int lawFcdcIndex = Arinc429Utils::isNo(fcdcsBusOutputs[0].efcs_status_word_1) ? 0 : 1;
+  const auto& efcsStatusWord = fcdcsBusOutputs[lawFcdcIndex].efcs_status_word_1;
+  status.normalLawActive = Arinc429Utils::bitFromValue(efcsStatusWord, 11) && Arinc429Utils::bitFromValue(efcsStatusWord, 16);
+
+  status.autothrustStatus = autoThrustOutput.status;
+  status.autothrustMode = autoThrustOutput.mode;
+  return status;
+}
+
+std::vector<unsigned char> A32nxFlightControlSystem::saveSnapshot() const {
+  // the snapshot is too large for the stack of the worker threads on some platforms
+  auto snapshot = std::make_unique<Snapshot>();
+  for (int i = 0; i < 2; i++) {
+    elacs[i].saveSnapshot(snapshot->elacs[i]);
+    fcdcs[i].saveSnapshot(snapshot->fcdcs[i]);
+    facs[i].saveSnapshot(snapshot->facs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    secs[i].saveSnapshot(snapshot->secs[i]);
+  }
+  autoThrust.saveSnapshot(&snapshot->autoThrust);
+
+  copyArray(elacsDiscreteOutputs, snapshot->elacsDiscreteOutputs);
+  copyArray(elacsAnalogOutputs, snapshot->elacsAnalogOutputs);
+  copyArray(elacsBusOutputs, snapshot->elacsBusOutputs);
+  copyArray(secsDiscreteOutputs, snapshot->secsDiscreteOutputs);
+  copyArray(secsAnalogOutputs, snapshot->secsAnalogOutputs);
+  copyArray(secsBusOutputs, snapshot->secsBusOutputs);
+  copyArray(fcdcsDiscreteOutputs, snapshot->fcdcsDiscreteOutputs);
+  copyArray(fcdcsBusOutputs, snapshot->fcdcsBusOutputs);
+  copyArray(facsDiscreteOutputs, snapshot->facsDiscreteOutputs);
+  copyArray(facsAnalogOutputs, snapshot->facsAnalogOutputs);
+  copyArray(facsBusOutputs, snapshot->facsBusOutputs);
+  snapshot->autoThrustInput = autoThrustInput;
+  snapshot->autoThrustOutput = autoThrustOutput;
+
+  copyArray(adrBusOutputs, snapshot->adrBusOutputs);
+  copyArray(irBusOutputs, snapshot->irBusOutputs);
+  copyArray(raBusOutputs, snapshot->raBusOutputs);
+  copyArray(sfccBusOutputs, snapshot->sfccBusOutputs);
+  copyArray(lgciuBusOutputs, snapshot->lgciuBusOutputs);
+  snapshot->fmgcBBusOutputs = fmgcBBusOutputs;
+
+  snapshot->surfaces = surfaces;
+  snapshot->monotonicTime = monotonicTime;
+  snapshot->powered = powered;
+  snapshot->pushbuttonsPressed = pushbuttonsPressed;
+
+  std::vector<unsigned char> blob(getModelSnapshotSize<Snapshot>());
+  writeModelSnapshot(*snapshot, Snapshot::ID, blob.data(), blob.size());
+  return blob;
+}
+
+bool A32nxFlightControlSystem::restoreSnapshot(const std::vector<unsigned char>& blob) {
+  auto snapshot = std::make_unique<Snapshot>();
+  if (!readModelSnapshot(*snapshot, Snapshot::ID, blob.data(), blob.size())) {
+    return false;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    elacs[i].restoreSnapshot(snapshot->elacs[i]);
+    fcdcs[i].restoreSnapshot(snapshot->fcdcs[i]);
+    facs[i].restoreSnapshot(snapshot->facs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    secs[i].restoreSnapshot(snapshot->secs[i]);
+  }
+  autoThrust.restoreSnapshot(&snapshot->autoThrust);
+
+  copyArray(snapshot->elacsDiscreteOutputs, elacsDiscreteOutputs);
+  copyArray(snapshot->elacsAnalogOutputs, elacsAnalogOutputs);
+  copyArray(snapshot->elacsBusOutputs, elacsBusOutputs);
+  copyArray(snapshot->secsDiscreteOutputs, secsDiscreteOutputs);
+  copyArray(snapshot->secsAnalogOutputs, secsAnalogOutputs);
+  copyArray(snapshot->secsBusOutputs, secsBusOutputs);
+  copyArray(snapshot->fcdcsDiscreteOutputs, fcdcsDiscreteOutputs);
+  copyArray(snapshot->fcdcsBusOutputs, fcdcsBusOutputs);
+  copyArray(snapshot->facsDiscreteOutputs, facsDiscreteOutputs);
+  copyArray(snapshot->facsAnalogOutputs, facsAnalogOutputs);
+  copyArray(snapshot->facsBusOutputs, facsBusOutputs);
+  autoThrustInput = snapshot->autoThrustInput;
+  autoThrustOutput = snapshot->autoThrustOutput;
+
+  copyArray(snapshot->adrBusOutputs, adrBusOutputs);
+  copyArray(snapshot->irBusOutputs, irBusOutputs);
+  copyArray(snapshot->raBusOutputs, raBusOutputs);
+  copyArray(snapshot->sfccBusOutputs, sfccBusOutputs);
+  copyArray(snapshot->lgciuBusOutputs, lgciuBusOutputs);
+  fmgcBBusOutputs = snapshot->fmgcBBusOutputs;
+
+  surfaces = snapshot->surfaces;
+  monotonicTime = snapshot->monotonicTime;
+  powered = snapshot->powered;
+  pushbuttonsPressed = snapshot->pushbuttonsPressed;
+  return true;
+}
+
+void A32nxFlightControlSystem::updateAutothrust(double deltaTime, const HeadlessSimData& simData, const PilotInputs& pilotInputs) {
+  autoThrustInput.in.time.dt = deltaTime;
+  autoThrustInput.in.time.simulation_time = simData.simulationTime;
+
+  autoThrustInput.in.data.nz_g = simData.nz_g;
+  autoThrustInput.in.data.Theta_deg = simData.Theta_deg;
+  autoThrustInput.in.data.Phi_deg = simData.Phi_deg;
+  autoThrustInput.in.data.V_ias_kn = simData.V_ias_kn;
+  autoThrustInput.in.data.V_tas_kn = simData.V_tas_kn;
+  autoThrustInput.in.data.V_mach = simData.V_mach;
+  autoThrustInput.in.data.V_gnd_kn = simData.V_gnd_kn;
+  autoThrustInput.in.data.alpha_deg = simData.alpha_deg;
+  autoThrustInput.in.data.H_ft = simData.H_ft;
+  autoThrustInput.in.data.H_ind_ft = simData.H_ind_ft;
+  autoThrustInput.in.data.H_radio_ft = simData.H_radio_ft;
+  autoThrustInput.in.data.H_dot_fpm = simData.H_dot_fpm;
+  autoThrustInput.in.data.bx_m_s2 = simData.bx_m_s2;
+  autoThrustInput.in.data.by_m_s2 = simData.by_m_s2;
+  autoThrustInput.in.data.bz_m_s2 = simData.bz_m_s2;
+  autoThrustInput.in.data.gear_strut_compression_1 = simData.gear_animation_pos_1;
+  autoThrustInput.in.data.gear_strut_compression_2 = simData.gear_animation_pos_2;
+  autoThrustInput.in.data.flap_handle_index = pilotInputs.flapsConfiguration;
+  autoThrustInput.in.data.is_engine_operative_1 = simData.engine_combustion[0];
+  autoThrustInput.in.data.is_engine_operative_2 = simData.engine_combustion[1];
+  autoThrustInput.in.data.commanded_engine_N1_1_percent = simData.commanded_engine_N1_percent[0];
+  autoThrustInput.in.data.commanded_engine_N1_2_percent = simData.commanded_engine_N1_percent[1];
+  autoThrustInput.in.data.engine_N1_1_percent = simData.engine_N1_percent[0];
+  autoThrustInput.in.data.engine_N1_2_percent = simData.engine_N1_percent[1];
+  autoThrustInput.in.data.corrected_engine_N1_1_percent = simData.corrected_engine_N1_percent[0];
+  autoThrustInput.in.data.corrected_engine_N1_2_percent = simData.corrected_engine_N1_percent[1];
+  autoThrustInput.in.data.TAT_degC = simData.total_air_temperature_celsius;
+  autoThrustInput.in.data.OAT_degC = simData.ambient_temperature_celsius;
+
+  autoThrustInput.in.input.ATHR_push = pilotInputs.autothrustPushed;
+  autoThrustInput.in.input.ATHR_disconnect = false;
+  autoThrustInput.in.input.TLA_1_deg = pilotInputs.thrustLeverAngleDeg[0];
+  autoThrustInput.in.input.TLA_2_deg = pilotInputs.thrustLeverAngleDeg[1];
+  autoThrustInput.in.input.V_c_kn = pilotInputs.speedTargetKn;
+  autoThrustInput.in.input.V_LS_kn = facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_ls_kn.Data : facsBusOutputs[1].v_ls_kn.Data;
+  autoThrustInput.in.input.V_MAX_kn =
+      facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_max_kn.Data : facsBusOutputs[1].v_max_kn.Data;
+  autoThrustInput.in.input.thrust_limit_REV_percent = 70.0;
+  autoThrustInput.in.input.thrust_limit_IDLE_percent = 21.0;
+  autoThrustInput.in.input.thrust_limit_CLB_percent = 89.0;
+  autoThrustInput.in.input.thrust_limit_MCT_percent = 90.0;
+  autoThrustInput.in.input.thrust_limit_FLEX_percent = 0.0;
+  autoThrustInput.in.input.thrust_limit_TOGA_percent = 94.0;
+  autoThrustInput.in.input.flex_temperature_degC = 0.0;
+  autoThrustInput.in.input.mode_requested = pilotInputs.autothrustModeRequested;
+  autoThrustInput.in.input.is_mach_mode_active = false;
+  autoThrustInput.in.input.alpha_floor_condition = Arinc429Utils::bitFromValueOr(facsBusOutputs[0].discrete_word_5, 29, false) ||
+                                                   Arinc429Utils::bitFromValueOr(facsBusOutputs[1].discrete_word_5, 29, false);
+  autoThrustInput.in.input.is_approach_mode_active = false;
+  autoThrustInput.in.input.is_SRS_TO_mode_active = false;
+  autoThrustInput.in.input.is_SRS_GA_mode_active = false;
+  autoThrustInput.in.input.is_LAND_mode_active = false;
+  autoThrustInput.in.input.thrust_reduction_altitude = 0;
+  autoThrustInput.in.input.thrust_reduction_altitude_go_around = 0;
+  autoThrustInput.in.input.flight_phase = 5;
+  autoThrustInput.in.input.is_alt_soft_mode_active = false;
+  autoThrustInput.in.input.is_anti_ice_wing_active = false;
+  autoThrustInput.in.input.is_anti_ice_engine_1_active = false;
+  autoThrustInput.in.input.is_anti_ice_engine_2_active = false;
+  autoThrustInput.in.input.is_air_conditioning_1_active = true;
+  autoThrustInput.in.input.is_air_conditioning_2_active = true;
+  autoThrustInput.in.input.FD_active = false;
+  autoThrustInput.in.input.ATHR_reset_disable = false;
+  autoThrustInput.in.input.is_TCAS_active = false;
+  autoThrustInput.in.input.target_TCAS_RA_rate_fpm = 0;
+
+  autoThrust.setExternalInputs(&autoThrustInput);
+  autoThrust.step();
+  autoThrustOutput = autoThrust.getExternalOutputs().out.output;
+}
+
+void A32nxFlightControlSystem::updateElac(double deltaTime,
+                                          int elacIndex,
+                                          const HeadlessSimData& simData,
+                                          const PilotInputs& pilotInputs) {
+  const int oppElacIndex = elacIndex == 0 ? 1 : 0;
+  auto& in = elacs[elacIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simData.simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.slew_on = false;
+  in.sim_data.pause_on = false;
+  in.sim_data.tracking_mode_on_override = false;
+  in.sim_data.tailstrike_protection_on = false;
+
+  in.discrete_inputs.ground_spoilers_active_1 = secsDiscreteOutputs[0].ground_spoiler_out;
+  in.discrete_inputs.ground_spoilers_active_2 =
+      elacIndex == 0 ? secsDiscreteOutputs[1].ground_spoiler_out : secsDiscreteOutputs[2].ground_spoiler_out;
+  in.discrete_inputs.is_unit_1 = elacIndex == 0;
+  in.discrete_inputs.is_unit_2 = elacIndex == 1;
+  in.discrete_inputs.opp_axis_pitch_failure = !elacsDiscreteOutputs[oppElacIndex].pitch_axis_ok;
+  in.discrete_inputs.ap_1_disengaged = true;
+  in.discrete_inputs.ap_2_disengaged = true;
+  in.discrete_inputs.opp_left_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].left_aileron_ok;
+  in.discrete_inputs.opp_right_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].right_aileron_ok;
+  in.discrete_inputs.fac_1_yaw_control_lost = !facsDiscreteOutputs[0].yaw_damper_avail_for_norm_law;
+  in.discrete_inputs.lgciu_1_nose_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[0].discrete_word_2, 12);
+  in.discrete_inputs.lgciu_2_nose_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[1].discrete_word_2, 12);
+  in.discrete_inputs.fac_2_yaw_control_lost = !facsDiscreteOutputs[1].yaw_damper_avail_for_norm_law;
+  in.discrete_inputs.lgciu_1_right_main_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[0].discrete_word_2, 14);
+  in.discrete_inputs.lgciu_2_right_main_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[1].discrete_word_2, 14);
+  in.discrete_inputs.lgciu_1_left_main_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[0].discrete_word_2, 13);
+  in.discrete_inputs.lgciu_2_left_main_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[1].discrete_word_2, 13);
+  in.discrete_inputs.ths_motor_fault = false;
+  in.discrete_inputs.sfcc_1_slats_out = false;
+  in.discrete_inputs.sfcc_2_slats_out = false;
+  in.discrete_inputs.l_ail_servo_failed = false;
+  in.discrete_inputs.l_elev_servo_failed = false;
+  in.discrete_inputs.r_ail_servo_failed = false;
+  in.discrete_inputs.r_elev_servo_failed = false;
+  in.discrete_inputs.ths_override_active = false;
+  in.discrete_inputs.yellow_low_pressure = false;
+  in.discrete_inputs.capt_priority_takeover_pressed = false;
+  in.discrete_inputs.fo_priority_takeover_pressed = false;
+  in.discrete_inputs.blue_low_pressure = false;
+  in.discrete_inputs.green_low_pressure = false;
+  in.discrete_inputs.elac_engaged_from_switch = pushbuttonsPressed;
+  in.discrete_inputs.normal_powersupply_lost = false;
+
+  in.analog_inputs.capt_pitch_stick_pos = SIDESTICK_PITCH_INPUT_SIGN * pilotInputs.pitchStick;
+  in.analog_inputs.fo_pitch_stick_pos = 0;
+  in.analog_inputs.capt_roll_stick_pos = SIDESTICK_ROLL_INPUT_SIGN * pilotInputs.rollStick;
+  in.analog_inputs.fo_roll_stick_pos = 0;
+  in.analog_inputs.left_elevator_pos_deg = surfaces.leftElevatorDeg;
+  in.analog_inputs.right_elevator_pos_deg = surfaces.rightElevatorDeg;
+  in.analog_inputs.ths_pos_deg = -simData.eta_trim_deg;
+  in.analog_inputs.left_aileron_pos_deg = surfaces.leftAileronDeg;
+  in.analog_inputs.right_aileron_pos_deg = surfaces.rightAileronDeg;
+  in.analog_inputs.rudder_pedal_pos = RUDDER_PEDAL_INPUT_SIGN * pilotInputs.rudderPedal;
+  in.analog_inputs.load_factor_acc_1_g = 0;
+  in.analog_inputs.load_factor_acc_2_g = 0;
+  in.analog_inputs.blue_hyd_pressure_psi = 3000;
+  in.analog_inputs.green_hyd_pressure_psi = 3000;
+  in.analog_inputs.yellow_hyd_pressure_psi = 3000;
+
+  in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+  in.bus_inputs.adr_2_bus = adrBusOutputs[1];
+  in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  in.bus_inputs.ir_1_bus = irBusOutputs[0];
+  in.bus_inputs.ir_2_bus = irBusOutputs[1];
+  in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  in.bus_inputs.fmgc_1_bus = fmgcBBusOutputs;
+  in.bus_inputs.fmgc_2_bus = fmgcBBusOutputs;
+  in.bus_inputs.ra_1_bus = raBusOutputs[0];
+  in.bus_inputs.ra_2_bus = raBusOutputs[1];
+  in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+  in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+  in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+  in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+  in.bus_inputs.sec_1_bus = secsBusOutputs[0];
+  in.bus_inputs.sec_2_bus = secsBusOutputs[1];
+  in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
+
+  elacs[elacIndex].update(deltaTime, simData.simulationTime, false, powered);
+
+  elacsDiscreteOutputs[elacIndex] = elacs[elacIndex].getDiscreteOutputs();
+  elacsAnalogOutputs[elacIndex] = elacs[elacIndex].getAnalogOutputs();
+  elacsBusOutputs[elacIndex] = elacs[elacIndex].getBusOutputs();
+}
+
+void A32nxFlightControlSystem::updateSec(double deltaTime, int secIndex, const HeadlessSimData& simData, const PilotInputs& pilotInputs) {
+  const int oppSecIndex = secIndex == 0 ? 1 : 0;
+  auto& in = secs[secIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simData.simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.slew_on = false;
+  in.sim_data.pause_on = false;
+  in.sim_data.tracking_mode_on_override = false;
+  in.sim_data.tailstrike_protection_on = false;
+
+  in.discrete_inputs.sec_engaged_from_switch = pushbuttonsPressed;
+  in.discrete_inputs.sec_in_emergency_powersupply = false;
+  in.discrete_inputs.is_unit_1 = secIndex == 0;
+  in.discrete_inputs.is_unit_2 = secIndex == 1;
+  in.discrete_inputs.is_unit_3 = secIndex == 2;
+  if (secIndex < 2) {
+    in.discrete_inputs.pitch_not_avail_elac_1 = !elacsDiscreteOutputs[0].pitch_axis_ok;
+    in.discrete_inputs.pitch_not_avail_elac_2 = !elacsDiscreteOutputs[1].pitch_axis_ok;
+    in.discrete_inputs.left_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].left_elevator_ok;
+    in.discrete_inputs.right_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].right_elevator_ok;
+  } else {
+    in.discrete_inputs.pitch_not_avail_elac_1 = false;
+    in.discrete_inputs.pitch_not_avail_elac_2 = false;
+    in.discrete_inputs.left_elev_not_avail_sec_opp = false;
+    in.discrete_inputs.right_elev_not_avail_sec_opp = false;
+  }
+  in.discrete_inputs.ths_motor_fault = false;
+  in.discrete_inputs.l_elev_servo_failed = false;
+  in.discrete_inputs.r_elev_servo_failed = false;
+  in.discrete_inputs.ths_override_active = false;
+
+  in.discrete_inputs.digital_output_failed_elac_1 = !elacsDiscreteOutputs[0].digital_output_validated;
+  in.discrete_inputs.digital_output_failed_elac_2 = !elacsDiscreteOutputs[1].digital_output_validated;
+  in.discrete_inputs.green_low_pressure = false;
+  in.discrete_inputs.blue_low_pressure = false;
+  in.discrete_inputs.yellow_low_pressure = false;
+  in.discrete_inputs.sfcc_1_slats_out = false;
+  in.discrete_inputs.sfcc_2_slats_out = false;
+  in.discrete_inputs.l_spoiler_1_servo_failed = false;
+  in.discrete_inputs.r_spoiler_1_servo_failed = false;
+  in.discrete_inputs.l_spoiler_2_servo_failed = false;
+  in.discrete_inputs.r_spoiler_2_servo_failed = false;
+  in.discrete_inputs.capt_priority_takeover_pressed = false;
+  in.discrete_inputs.fo_priority_takeover_pressed = false;
+
+  if (secIndex < 2) {
+    in.analog_inputs.capt_pitch_stick_pos = SIDESTICK_PITCH_INPUT_SIGN * pilotInputs.pitchStick;
+    in.analog_inputs.left_elevator_pos_deg = surfaces.leftElevatorDeg;
+    in.analog_inputs.right_elevator_pos_deg = surfaces.rightElevatorDeg;
+    in.analog_inputs.ths_pos_deg = -simData.eta_trim_deg;
+  } else {
+    in.analog_inputs.capt_pitch_stick_pos = 0;
+    in.analog_inputs.left_elevator_pos_deg = 0;
+    in.analog_inputs.right_elevator_pos_deg = 0;
+    in.analog_inputs.ths_pos_deg = 0;
+  }
+  in.analog_inputs.fo_pitch_stick_pos = 0;
+  in.analog_inputs.load_factor_acc_1_g = 0;
+  in.analog_inputs.load_factor_acc_2_g = 0;
+  in.analog_inputs.capt_roll_stick_pos = SIDESTICK_ROLL_INPUT_SIGN * pilotInputs.rollStick;
+  in.analog_inputs.fo_roll_stick_pos = 0;
+  in.analog_inputs.spd_brk_lever_pos = pilotInputs.groundSpoilersArmed ? -0.05 : 0;
+  in.analog_inputs.thr_lever_1_pos = pilotInputs.thrustLeverAngleDeg[0];
+  in.analog_inputs.thr_lever_2_pos = pilotInputs.thrustLeverAngleDeg[1];
+
+  int splrIndex = secIndex == 2 ? 0 : (secIndex == 0 ? 2 : 4);
+  in.analog_inputs.left_spoiler_1_pos_deg = surfaces.leftSpoilerDeg[splrIndex];
+  in.analog_inputs.right_spoiler_1_pos_deg = surfaces.rightSpoilerDeg[splrIndex];
+  in.analog_inputs.left_spoiler_2_pos_deg = splrIndex < 4 ? surfaces.leftSpoilerDeg[splrIndex + 1] : 0;
+  in.analog_inputs.right_spoiler_2_pos_deg = splrIndex < 4 ? surfaces.rightSpoilerDeg[splrIndex + 1] : 0;
+  in.analog_inputs.wheel_speed_left = simData.wheelRpmLeft * WHEEL_RPM_TO_KNOTS;
+  in.analog_inputs.wheel_speed_right = simData.wheelRpmRight * WHEEL_RPM_TO_KNOTS;
+
+  const int adirsIndices[3][2] = {{0, 2}, {0, 1}, {1, 2}};
+  in.bus_inputs.adr_1_bus = adrBusOutputs[adirsIndices[secIndex][0]];
+  in.bus_inputs.adr_2_bus = adrBusOutputs[adirsIndices[secIndex][1]];
+  in.bus_inputs.ir_1_bus = irBusOutputs[adirsIndices[secIndex][0]];
+  in.bus_inputs.ir_2_bus = irBusOutputs[adirsIndices[secIndex][1]];
+
+  in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+  in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+  in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+  in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+  in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+  in.bus_inputs.lgciu_1_bus = lgciuBusOutputs[0];
+  in.bus_inputs.lgciu_2_bus = lgciuBusOutputs[1];
+
+  secs[secIndex].update(deltaTime, simData.simulationTime, false, powered);
+
+  secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
+  secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
+  secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
+}
+
+void A32nxFlightControlSystem::updateFac(double deltaTime, int facIndex, const HeadlessSimData& simData) {
+  const int oppFacIndex = facIndex == 0 ? 1 : 0;
+  auto& in = facs[facIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simData.simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.slew_on = false;
+  in.sim_data.pause_on = false;
+  in.sim_data.tracking_mode_on_override = false;
+  in.sim_data.tailstrike_protection_on = false;
+
+  in.discrete_inputs.ap_own_engaged = false;
+  in.discrete_inputs.ap_opp_engaged = false;
+  in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
+  in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
+  in.discrete_inputs.rudder_travel_lim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
+  in.discrete_inputs.elac_1_healthy = elacsDiscreteOutputs[0].digital_output_validated;
+  in.discrete_inputs.elac_2_healthy = elacsDiscreteOutputs[1].digital_output_validated;
+  in.discrete_inputs.engine_1_stopped = true;
+  in.discrete_inputs.engine_2_stopped = true;
+  in.discrete_inputs.rudder_trim_switch_left = false;
+  in.discrete_inputs.rudder_trim_switch_right = false;
+  in.discrete_inputs.rudder_trim_reset_button = false;
+  in.discrete_inputs.fac_engaged_from_switch = pushbuttonsPressed;
+  in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
+  in.discrete_inputs.is_unit_1 = facIndex == 0;
+  in.discrete_inputs.rudder_trim_actuator_healthy = true;
+  in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
+  in.discrete_inputs.slats_extended = false;
+  in.discrete_inputs.nose_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[facIndex].discrete_word_2, 12);
+  in.discrete_inputs.ir_3_switch = false;
+  in.discrete_inputs.adr_3_switch = false;
+  in.discrete_inputs.yaw_damper_has_hyd_press = true;
+
+  in.analog_inputs.yaw_damper_position_deg = 0;
+  in.analog_inputs.rudder_trim_position_deg = surfaces.rudderTrimDeg;
+  in.analog_inputs.rudder_travel_lim_position_deg = surfaces.rudderTravelLimitDeg;
+
+  in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+  in.bus_inputs.adr_own_bus = facIndex == 0 ? adrBusOutputs[0] : adrBusOutputs[1];
+  in.bus_inputs.adr_opp_bus = facIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
+  in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  in.bus_inputs.ir_own_bus = facIndex == 0 ? irBusOutputs[0] : irBusOutputs[1];
+  in.bus_inputs.ir_opp_bus = facIndex == 0 ? irBusOutputs[1] : irBusOutputs[0];
+  in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  in.bus_inputs.fmgc_own_bus = fmgcBBusOutputs;
+  in.bus_inputs.fmgc_opp_bus = fmgcBBusOutputs;
+  in.bus_inputs.sfcc_own_bus = sfccBusOutputs[facIndex];
+  in.bus_inputs.lgciu_own_bus = lgciuBusOutputs[facIndex];
+  in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+
+  facs[facIndex].update(deltaTime, simData.simulationTime, false, powered);
+
+  facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
+  facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
+  facsBusOutputs[facIndex] = facs[facIndex].getBusOutputs();
+}
+
+void A32nxFlightControlSystem::updateFcdc(double deltaTime, int fcdcIndex) {
+  const int oppFcdcIndex = fcdcIndex == 0 ? 1 : 0;
+  auto& fcdc = fcdcs[fcdcIndex];
+
+  fcdc.discreteInputs.elac1Off = !pushbuttonsPressed;
+  fcdc.discreteInputs.elac1Valid = elacsDiscreteOutputs[0].digital_output_validated;
+  fcdc.discreteInputs.elac2Valid = elacsDiscreteOutputs[1].digital_output_validated;
+  fcdc.discreteInputs.sec1Off = !pushbuttonsPressed;
+  fcdc.discreteInputs.sec1Valid = !secsDiscreteOutputs[0].sec_failed;
+  fcdc.discreteInputs.sec2Valid = !secsDiscreteOutputs[1].sec_failed;
+  fcdc.discreteInputs.eng1NotOnGroundAndNotLowOilPress = false;
+  fcdc.discreteInputs.eng2NotOnGroundAndNotLowOilPress = false;
+  fcdc.discreteInputs.noseGearPressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[0].discrete_word_2, 12);
+  fcdc.discreteInputs.oppFcdcFailed = !fcdcsDiscreteOutputs[oppFcdcIndex].fcdcValid;
+  fcdc.discreteInputs.sec3Off = !pushbuttonsPressed;
+  fcdc.discreteInputs.sec3Valid = !secsDiscreteOutputs[2].sec_failed;
+  fcdc.discreteInputs.elac2Off = !pushbuttonsPressed;
+  fcdc.discreteInputs.sec2Off = !pushbuttonsPressed;
+
+  fcdc.busInputs.elac1 = elacsBusOutputs[0];
+  fcdc.busInputs.sec1 = secsBusOutputs[0];
+  fcdc.busInputs.fcdcOpp = fcdcsBusOutputs[oppFcdcIndex];
+  fcdc.busInputs.elac2 = elacsBusOutputs[1];
+  fcdc.busInputs.sec2 = secsBusOutputs[1];
+  fcdc.busInputs.sec3 = secsBusOutputs[2];
+
+  fcdc.update(deltaTime, false, powered);
+
+  fcdcsDiscreteOutputs[fcdcIndex] = fcdc.getDiscreteOutputs();
+  // the FCDC bus has the layout of the bus of the model, it is copied instead of punned to keep strict aliasing
+  FcdcBus bus = fcdc.getBusOutputs();
+  static_assert(sizeof(FcdcBus) == sizeof(base_fcdc_bus));
+  std::memcpy(&fcdcsBusOutputs[fcdcIndex], &bus, sizeof(base_fcdc_bus));
+}
+
+FlightPlantCommands A32nxFlightControlSystem::updateServoControls(const FlightPlant& plant, const PilotInputs& pilotInputs) {
+  const auto& state = plant.getState();
+
+  // each surface follows the order of the servo control in active mode, the other one is in damping mode, the order is
+  // taken as the position the computers read back since the plant reports the surfaces in its own frame
+  if (elacsDiscreteOutputs[0].left_aileron_active_mode) {
+    surfaces.leftAileronDeg = elacsAnalogOutputs[0].left_aileron_pos_order;
+  } else if (elacsDiscreteOutputs[1].left_aileron_active_mode) {
+    surfaces.leftAileronDeg = elacsAnalogOutputs[1].left_aileron_pos_order;
+  }
+  if (elacsDiscreteOutputs[0].right_aileron_active_mode) {
+    surfaces.rightAileronDeg = elacsAnalogOutputs[0].right_aileron_pos_order;
+  } else if (elacsDiscreteOutputs[1].right_aileron_active_mode) {
+    surfaces.rightAileronDeg = elacsAnalogOutputs[1].right_aileron_pos_order;
+  }
+
+  // the damping mode of a computer commands the servo control of the other side to damping, its own one is active
+  if (elacsDiscreteOutputs[0].left_elevator_damping_mode || secsDiscreteOutputs[0].left_elevator_damping_mode) {
+    surfaces.leftElevatorDeg = elacsAnalogOutputs[0].left_elev_pos_order_deg + secsAnalogOutputs[0].left_elev_pos_order_deg;
+  } else if (elacsDiscreteOutputs[1].left_elevator_damping_mode || secsDiscreteOutputs[1].left_elevator_damping_mode) {
+    surfaces.leftElevatorDeg = elacsAnalogOutputs[1].left_elev_pos_order_deg + secsAnalogOutputs[1].left_elev_pos_order_deg;
+  }
+  if (elacsDiscreteOutputs[0].right_elevator_damping_mode || secsDiscreteOutputs[0].right_elevator_damping_mode) {
+    surfaces.rightElevatorDeg = elacsAnalogOutputs[0].right_elev_pos_order_deg + secsAnalogOutputs[0].right_elev_pos_order_deg;
+  } else if (elacsDiscreteOutputs[1].right_elevator_damping_mode || secsDiscreteOutputs[1].right_elevator_damping_mode) {
+    surfaces.rightElevatorDeg = elacsAnalogOutputs[1].right_elev_pos_order_deg + secsAnalogOutputs[1].right_elev_pos_order_deg;
+  }
+
+  // the trimmable horizontal stabilizer keeps its position without an active motor
+  surfaces.thsDeg = state.stabilizerDeg;
+  if (elacsDiscreteOutputs[0].ths_active || secsDiscreteOutputs[0].ths_active) {
+    surfaces.thsDeg = elacsAnalogOutputs[0].ths_pos_order + secsAnalogOutputs[0].ths_pos_order_deg;
+  } else if (elacsDiscreteOutputs[1].ths_active) {
+    surfaces.thsDeg = elacsAnalogOutputs[1].ths_pos_order;
+  } else if (secsDiscreteOutputs[1].ths_active) {
+    surfaces.thsDeg = secsAnalogOutputs[1].ths_pos_order_deg;
+  }
+
+  const std::array<int, 5> spoilerSecIndex = {2, 2, 0, 0, 1};
+  for (int i = 0; i < 5; i++) {
+    const auto& outputs = secsAnalogOutputs[spoilerSecIndex[i]];
+    bool isFirstSpoiler = i == 0 || i == 2 || i == 4;
+    surfaces.leftSpoilerDeg[i] = isFirstSpoiler ? outputs.left_spoiler_1_pos_order_deg : outputs.left_spoiler_2_pos_order_deg;
+    surfaces.rightSpoilerDeg[i] = isFirstSpoiler ? outputs.right_spoiler_1_pos_order_deg : outputs.right_spoiler_2_pos_order_deg;
+  }
+
+  // the rudder is driven mechanically by the pedals and the trim, the yaw damper adds its order and the travel limiter
+  // restricts the total deflection
+  int facIndex = facsDiscreteOutputs[0].fac_healthy ? 0 : 1;
+  if (facsDiscreteOutputs[facIndex].rudder_trim_engaged) {
+    surfaces.rudderTrimDeg = facsAnalogOutputs[facIndex].rudder_trim_order_deg;
+  }
+  if (facsDiscreteOutputs[facIndex].rudder_travel_lim_engaged) {
+    surfaces.rudderTravelLimitDeg = facsAnalogOutputs[facIndex].rudder_travel_limit_order_deg;
+  }
+  double yawDamperDeg = facsDiscreteOutputs[facIndex].yaw_damper_engaged ? facsAnalogOutputs[facIndex].yaw_damper_order_deg : 0;
+  double rudderLimitDeg = surfaces.rudderTravelLimitDeg > 0 ? surfaces.rudderTravelLimitDeg : RUDDER_PEDAL_MAXIMUM_DEG;
+  double rudderDeg = std::clamp(RUDDER_PEDAL_INPUT_SIGN * pilotInputs.rudderPedal * RUDDER_PEDAL_MAXIMUM_DEG + surfaces.rudderTrimDeg +
+                                    yawDamperDeg,
+                                -rudderLimitDeg, rudderLimitDeg);
+
+  FlightPlantCommands commands = {};
+  commands.elevatorLeftDeg = surfaces.leftElevatorDeg;
+  commands.elevatorRightDeg = surfaces.rightElevatorDeg;
+  commands.stabilizerDeg = surfaces.thsDeg;
+  commands.aileronLeftDeg = surfaces.leftAileronDeg;
+  commands.aileronRightDeg = surfaces.rightAileronDeg;
+  for (int i = 0; i < 5; i++) {
+    commands.spoilerLeftDeg -= surfaces.leftSpoilerDeg[i] / 5;
+    commands.spoilerRightDeg -= surfaces.rightSpoilerDeg[i] / 5;
+  }
+  commands.rudderDeg = rudderDeg;
+
+  commands.engineN1CommandPercent[0] = autoThrustOutput.N1_c_1_percent;
+  commands.engineN1CommandPercent[1] = autoThrustOutput.N1_c_2_percent;
+
+  commands.flapsConfiguration = pilotInputs.flapsConfiguration;
+  commands.gearDown = pilotInputs.gearDown;
+  commands.brakeLeft = pilotInputs.brakeLeft;
+  commands.brakeRight = pilotInputs.brakeRight;
+  return commands;
+}
+
+std::unique_ptr<FlightControlSystem> createFlightControlSystem() {
+  // the storage comes zeroed like the one of the static interface, see FlightControlSystem::operator new
+  auto system = std::make_unique<A32nxFlightControlSystem>();
+  system->initialize();
+  return system;
+}
+
+const char* getDefaultAircraftFile() {
+  return "aircraft/a32nx.ini";
+}
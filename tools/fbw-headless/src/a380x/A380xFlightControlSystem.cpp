@@ -0,0 +1,777 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Arinc429Utils.h"
+#include "FlightControlSystem.h"
+#include "ModelSnapshot.h"
+#include "PlantSensors.h"
+#include "fac/Fac.h"
+#include "model/Autothrust.h"
+#include "prim/Prim.h"
+#include "sec/Sec.h"
+
+// the computers are wired like the FlyByWireInterface of the A380X does it, the hydraulic and electrical systems are
+// always available and the actuators of the plant take the place of the servo controls
+class A380xFlightControlSystem final : public FlightControlSystem {
+ public:
+  void initialize();
+
+  FlightPlantCommands update(double deltaTime, const FlightPlant& plant, const PilotInputs& pilotInputs) override;
+
+  FlightControlStatus getStatus() const override;
+
+  std::vector<unsigned char> saveSnapshot() const override;
+
+  bool restoreSnapshot(const std::vector<unsigned char>& blob) override;
+
+ private:
+  // the surfaces as the computers see them, the plant moves them towards the order of the active servo control
+  struct SurfacePositions {
+    double leftInboardElevatorDeg;
+    double leftOutboardElevatorDeg;
+    double rightInboardElevatorDeg;
+    double rightOutboardElevatorDeg;
+    double thsDeg;
+    double leftInboardAileronDeg;
+    double leftMidboardAileronDeg;
+    double leftOutboardAileronDeg;
+    double rightInboardAileronDeg;
+    double rightMidboardAileronDeg;
+    double rightOutboardAileronDeg;
+    std::array<double, 8> leftSpoilerDeg;
+    std::array<double, 8> rightSpoilerDeg;
+    double upperRudderDeg;
+    double lowerRudderDeg;
+  };
+
+  // the computers, the buses between them and the surfaces
+  struct Snapshot {
+    static constexpr uint32_t ID = 0x58303833;  // "380X"
+
+    Prim::Snapshot prims[3];
+    base_prim_discrete_outputs primsDiscreteOutputs[3];
+    base_prim_analog_outputs primsAnalogOutputs[3];
+    base_prim_out_bus primsBusOutputs[3];
+
+    Sec::Snapshot secs[3];
+    base_sec_discrete_outputs secsDiscreteOutputs[3];
+    base_sec_analog_outputs secsAnalogOutputs[3];
+    base_sec_out_bus secsBusOutputs[3];
+
+    Fac::Snapshot facs[2];
+    base_fac_discrete_outputs facsDiscreteOutputs[2];
+    base_fac_analog_outputs facsAnalogOutputs[2];
+    base_fac_bus facsBusOutputs[2];
+
+    Autothrust::Snapshot_Autothrust_T autoThrust;
+    Autothrust::ExternalInputs_Autothrust_T autoThrustInput;
+    athr_output autoThrustOutput;
+
+    base_adr_bus adrBusOutputs[3];
+    base_ir_bus irBusOutputs[3];
+    base_ra_bus raBusOutputs[3];
+    base_sfcc_bus sfccBusOutputs[2];
+    base_lgciu_bus lgciuBusOutputs[2];
+
+    SurfacePositions surfaces;
+    double monotonicTime;
+    bool powered;
+    bool pushbuttonsPressed;
+  };
+
+  // the positions of the surfaces a computer reads back, they depend on the unit like in the interface
+  struct SurfaceFeedback {
+    double leftAileron1Deg;
+    double rightAileron1Deg;
+    double leftAileron2Deg;
+    double rightAileron2Deg;
+    double elevator1Deg;
+    double elevator2Deg;
+    double elevator3Deg;
+    double thsDeg;
+    double rudder1Deg;
+    double rudder2Deg;
+  };
+
+  SurfaceFeedback getSurfaceFeedback(int unitIndex, bool isSec) const;
+
+  void updateAutothrust(double deltaTime, const HeadlessSimData& simData, const PilotInputs& pilotInputs);
+  void updatePrim(double deltaTime, int primIndex, const HeadlessSimData& simData, const PilotInputs& pilotInputs);
+  void updateSec(double deltaTime, int secIndex, const HeadlessSimData& simData, const PilotInputs& pilotInputs);
+  void updateFac(double deltaTime, int facIndex, const HeadlessSimData& simData);
+  FlightPlantCommands updateServoControls(const FlightPlant& plant, const PilotInputs& pilotInputs);
+
+  Prim prims[3] = {Prim(true, false, false), Prim(false, true, false), Prim(false, false, true)};
+  base_prim_discrete_outputs primsDiscreteOutputs[3];
+  base_prim_analog_outputs primsAnalogOutputs[3];
+  base_prim_out_bus primsBusOutputs[3];
+
+  Sec secs[3] = {Sec(true, false, false), Sec(false, true, false), Sec(false, false, true)};
+  base_sec_discrete_outputs secsDiscreteOutputs[3];
+  base_sec_analog_outputs secsAnalogOutputs[3];
+  base_sec_out_bus secsBusOutputs[3];
+
+  Fac facs[2] = {Fac(true), Fac(false)};
+  base_fac_discrete_outputs facsDiscreteOutputs[2];
+  base_fac_analog_outputs facsAnalogOutputs[2];
+  base_fac_bus facsBusOutputs[2];
+
+  Autothrust autoThrust;
+  Autothrust::ExternalInputs_Autothrust_T autoThrustInput;
+  athr_output autoThrustOutput;
+
+  base_adr_bus adrBusOutputs[3];
+  base_ir_bus irBusOutputs[3];
+  base_ra_bus raBusOutputs[3];
+  base_sfcc_bus sfccBusOutputs[2];
+  base_lgciu_bus lgciuBusOutputs[2];
+
+  SurfacePositions surfaces;
+  double monotonicTime;
+  bool powered;
+  bool pushbuttonsPressed;
+};
+
+// the power is applied after a short outage so that the computers run their self tests, the pushbuttons follow so that
+// the computers which need a reset in flight engage
+static constexpr double POWER_UP_TIME_S = 0.5;
+static constexpr double PUSHBUTTON_TIME_S = 1.0;
+
+// the pilot inputs to the sidestick and pedal axes of the computers
+static constexpr double SIDESTICK_PITCH_INPUT_SIGN = 1.0;
+static constexpr double SIDESTICK_ROLL_INPUT_SIGN = 1.0;
+static constexpr double RUDDER_PEDAL_INPUT_SIGN = -1.0;
+
+void A380xFlightControlSystem::initialize() {
+  autoThrust.initialize();
+}
+
+FlightPlantCommands A380xFlightControlSystem::update(double deltaTime, const FlightPlant& plant, const PilotInputs& pilotInputs) {
+  monotonicTime += deltaTime;
+  powered = monotonicTime > POWER_UP_TIME_S;
+  pushbuttonsPressed = monotonicTime > PUSHBUTTON_TIME_S;
+
+  // the sim time keeps running while the plant is held during the warm up
+  HeadlessSimData simData = PlantSensors::computeSimData(plant);
+  simData.simulationTime = monotonicTime;
+
+  for (int i = 0; i < 3; i++) {
+    raBusOutputs[i].radio_height_ft = PlantSensors::computeRadioHeight(plant);
+    adrBusOutputs[i] = PlantSensors::computeAdrBus(plant);
+    irBusOutputs[i] = PlantSensors::computeIrBus(plant);
+  }
+  for (int i = 0; i < 2; i++) {
+    lgciuBusOutputs[i] = PlantSensors::computeLgciuBus(plant);
+    sfccBusOutputs[i] = PlantSensors::computeSfccBus(plant);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    updatePrim(deltaTime, i, simData, pilotInputs);
+  }
+  for (int i = 0; i < 3; i++) {
+    updateSec(deltaTime, i, simData, pilotInputs);
+  }
+  for (int i = 0; i < 2; i++) {
+    updateFac(deltaTime, i, simData);
+  }
+
+  updateAutothrust(deltaTime, simData, pilotInputs);
+
+  return updateServoControls(plant, pilotInputs);
+}
+
+FlightControlStatus A380xFlightControlSystem::getStatus() const {
+  FlightControlStatus status = {};
+  status.computersHealthy = primsDiscreteOutputs[0].prim_healthy && primsDiscreteOutputs[1].prim_healthy &&
+                            primsDiscreteOutputs[2].prim_healthy && secsDiscreteOutputs[0].sec_healthy &&
+                            secsDiscreteOutputs[1].sec_healthy && secsDiscreteOutputs[2].sec_healthy &&
+                            facsDiscreteOutputs[0].fac_healthy && facsDiscreteOutputs[1].fac_healthy;
+
+  // the law reported by the first valid PRIM as the flight data recorder of the interface uses it, the pitch law is in
+  // bits 16 to 18 (normal law 001) and the lateral law in bits 19 and 20 (normal law 10)
+  const base_arinc_429* lawStatusWord = &primsBusOutputs[0].fctl_law_status_word;
+  for (const auto& primBusOutputs : primsBusOutputs) {
+    if (Arinc429Utils::isNo(primBusOutputs.fctl_law_status_word)) {
+      lawStatusWord = &primBusOutputs.fctl_law_status_word;
+      break;
+    }
+  }
+  status.normalLawActive = !Arinc429Utils::bitFromValue(*lawStatusWord, 16) && !Arinc429Utils::bitFromValue(*lawStatusWord, 17) &&
+                           Arinc429Utils::bitFromValue(*lawStatusWord, 18) && Arinc429Utils::bitFromValue(*lawStatusWord, 19) &&
+                           !Arinc429Utils::bitFromValue(*lawStatusWord, 20);
+
+  status.autothrustStatus = static_cast<int>(autoThrustOutput.status);
+  status.autothrustMode = static_cast<int>(autoThrustOutput.mode);
+  return status;
+}
+
+std::vector<unsigned char> A380xFlightControlSystem::saveSnapshot() const {
+  // the snapshot is too large for the stack of the worker threads on some platforms
+  auto snapshot = std::make_unique<Snapshot>();
+  for (int i = 0; i < 3; i++) {
+    prims[i].saveSnapshot(snapshot->prims[i]);
+    secs[i].saveSnapshot(snapshot->secs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    facs[i].saveSnapshot(snapshot->facs[i]);
+  }
+  autoThrust.saveSnapshot(&snapshot->autoThrust);
+
+  copyArray(primsDiscreteOutputs, snapshot->primsDiscreteOutputs);
+  copyArray(primsAnalogOutputs, snapshot->primsAnalogOutputs);
+  copyArray(primsBusOutputs, snapshot->primsBusOutputs);
+  copyArray(secsDiscreteOutputs, snapshot->secsDiscreteOutputs);
+  copyArray(secsAnalogOutputs, snapshot->secsAnalogOutputs);
+  copyArray(secsBusOutputs, snapshot->secsBusOutputs);
+  copyArray(facsDiscreteOutputs, snapshot->facsDiscreteOutputs);
+  copyArray(facsAnalogOutputs, snapshot->facsAnalogOutputs);
+  copyArray(facsBusOutputs, snapshot->facsBusOutputs);
+  snapshot->autoThrustInput = autoThrustInput;
+  snapshot->autoThrustOutput = autoThrustOutput;
+
+  copyArray(adrBusOutputs, snapshot->adrBusOutputs);
+  copyArray(irBusOutputs, snapshot->irBusOutputs);
+  copyArray(raBusOutputs, snapshot->raBusOutputs);
+  copyArray(sfccBusOutputs, snapshot->sfccBusOutputs);
+  copyArray(lgciuBusOutputs, snapshot->lgciuBusOutputs);
+
+  snapshot->surfaces = surfaces;
+  snapshot->monotonicTime = monotonicTime;
+  snapshot->powered = powered;
+  snapshot->pushbuttonsPressed = pushbuttonsPressed;
+
+  std::vector<unsigned char> blob(getModelSnapshotSize<Snapshot>());
+  writeModelSnapshot(*snapshot, Snapshot::ID, blob.data(), blob.size());
+  return blob;
+}
+
+bool A380xFlightControlSystem::restoreSnapshot(const std::vector<unsigned char>& blob) {
+  auto snapshot = std::make_unique<Snapshot>();
+  if (!readModelSnapshot(*snapshot, Snapshot::ID, blob.data(), blob.size())) {
+    return false;
+  }
+
+  for (int i = 0; i < 3; i++) {
+    prims[i].restoreSnapshot(snapshot->prims[i]);
+    secs[i].restoreSnapshot(snapshot->secs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    facs[i].restoreSnapshot(snapshot->facs[i]);
+  }
+  autoThrust.restoreSnapshot(&snapshot->autoThrust);
+
+  copyArray(snapshot->primsDiscreteOutputs, primsDiscreteOutputs);
+  copyArray(snapshot->primsAnalogOutputs, primsAnalogOutputs);
+  copyArray(snapshot->primsBusOutputs, primsBusOutputs);
+  copyArray(snapshot->secsDiscreteOutputs, secsDiscreteOutputs);
+  copyArray(snapshot->secsAnalogOutputs, secsAnalogOutputs);
+  copyArray(snapshot->secsBusOutputs, secsBusOutputs);
+  copyArray(snapshot->facsDiscreteOutputs, facsDiscreteOutputs);
+  copyArray(snapshot->facsAnalogOutputs, facsAnalogOutputs);
+  copyArray(snapshot->facsBusOutputs, facsBusOutputs);
+  autoThrustInput = snapshot->autoThrustInput;
+  autoThrustOutput = snapshot->autoThrustOutput;
+
+  copyArray(snapshot->adrBusOutputs, adrBusOutputs);
+  copyArray(snapshot->irBusOutputs, irBusOutputs);
+  copyArray(snapshot->raBusOutputs, raBusOutputs);
+  copyArray(snapshot->sfccBusOutputs, sfccBusOutputs);
+  copyArray(snapshot->lgciuBusOutputs, lgciuBusOutputs);
+
+  surfaces = snapshot->surfaces;
+  monotonicTime = snapshot->monotonicTime;
+  powered = snapshot->powered;
+  pushbuttonsPressed = snapshot->pushbuttonsPressed;
+  return true;
+}
+
+void A380xFlightControlSystem::updateAutothrust(double deltaTime, const HeadlessSimData& simData, const PilotInputs& pilotInputs) {
+  autoThrustInput.in.time.dt = deltaTime;
+  autoThrustInput.in.time.simulation_time = simData.simulationTime;
+
+  autoThrustInput.in.data.nz_g = simData.nz_g;
+  autoThrustInput.in.data.Theta_deg = simData.Theta_deg;
+  autoThrustInput.in.data.Phi_deg = simData.Phi_deg;
+  autoThrustInput.in.data.V_ias_kn = simData.V_ias_kn;
+  autoThrustInput.in.data.V_tas_kn = simData.V_tas_kn;
+  autoThrustInput.in.data.V_mach = simData.V_mach;
+  autoThrustInput.in.data.V_gnd_kn = simData.V_gnd_kn;
+  autoThrustInput.in.data.alpha_deg = simData.alpha_deg;
+  autoThrustInput.in.data.H_ft = simData.H_ft;
+  autoThrustInput.in.data.H_ind_ft = simData.H_ind_ft;
+  autoThrustInput.in.data.H_radio_ft = simData.H_radio_ft;
+  autoThrustInput.in.data.H_dot_fpm = simData.H_dot_fpm;
+  autoThrustInput.in.data.bx_m_s2 = simData.bx_m_s2;
+  autoThrustInput.in.data.by_m_s2 = simData.by_m_s2;
+  autoThrustInput.in.data.bz_m_s2 = simData.bz_m_s2;
+  autoThrustInput.in.data.gear_strut_compression_1 = simData.gear_animation_pos_1;
+  autoThrustInput.in.data.gear_strut_compression_2 = simData.gear_animation_pos_2;
+  autoThrustInput.in.data.flap_handle_index = pilotInputs.flapsConfiguration;
+  autoThrustInput.in.data.is_engine_operative_1 = simData.engine_combustion[0];
+  autoThrustInput.in.data.is_engine_operative_2 = simData.engine_combustion[1];
+  autoThrustInput.in.data.is_engine_operative_3 = simData.engine_combustion[2];
+  autoThrustInput.in.data.is_engine_operative_4 = simData.engine_combustion[3];
+  autoThrustInput.in.data.commanded_engine_N1_1_percent = simData.commanded_engine_N1_percent[0];
+  autoThrustInput.in.data.commanded_engine_N1_2_percent = simData.commanded_engine_N1_percent[1];
+  autoThrustInput.in.data.commanded_engine_N1_3_percent = simData.commanded_engine_N1_percent[2];
+  autoThrustInput.in.data.commanded_engine_N1_4_percent = simData.commanded_engine_N1_percent[3];
+  autoThrustInput.in.data.engine_N1_1_percent = simData.engine_N1_percent[0];
+  autoThrustInput.in.data.engine_N1_2_percent = simData.engine_N1_percent[1];
+  autoThrustInput.in.data.engine_N1_3_percent = simData.engine_N1_percent[2];
+  autoThrustInput.in.data.engine_N1_4_percent = simData.engine_N1_percent[3];
+  autoThrustInput.in.data.corrected_engine_N1_1_percent = simData.corrected_engine_N1_percent[0];
+  autoThrustInput.in.data.corrected_engine_N1_2_percent = simData.corrected_engine_N1_percent[1];
+  autoThrustInput.in.data.corrected_engine_N1_3_percent = simData.corrected_engine_N1_percent[2];
+  autoThrustInput.in.data.corrected_engine_N1_4_percent = simData.corrected_engine_N1_percent[3];
+  autoThrustInput.in.data.TAT_degC = simData.total_air_temperature_celsius;
+  autoThrustInput.in.data.OAT_degC = simData.ambient_temperature_celsius;
+
+  autoThrustInput.in.input.ATHR_push = pilotInputs.autothrustPushed;
+  autoThrustInput.in.input.ATHR_disconnect = false;
+  autoThrustInput.in.input.TLA_1_deg = pilotInputs.thrustLeverAngleDeg[0];
+  autoThrustInput.in.input.TLA_2_deg = pilotInputs.thrustLeverAngleDeg[1];
+  autoThrustInput.in.input.TLA_3_deg = pilotInputs.thrustLeverAngleDeg[2];
+  autoThrustInput.in.input.TLA_4_deg = pilotInputs.thrustLeverAngleDeg[3];
+  autoThrustInput.in.input.V_c_kn = pilotInputs.speedTargetKn;
+  autoThrustInput.in.input.V_LS_kn = facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_ls_kn.Data : facsBusOutputs[1].v_ls_kn.Data;
+  autoThrustInput.in.input.V_MAX_kn =
+      facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_max_kn.Data : facsBusOutputs[1].v_max_kn.Data;
+  autoThrustInput.in.input.thrust_limit_REV_percent = 70.0;
+  autoThrustInput.in.input.thrust_limit_IDLE_percent = 21.0;
+  autoThrustInput.in.input.thrust_limit_CLB_percent = 89.0;
+  autoThrustInput.in.input.thrust_limit_MCT_percent = 90.0;
+  autoThrustInput.in.input.thrust_limit_FLEX_percent = 0.0;
+  autoThrustInput.in.input.thrust_limit_TOGA_percent = 94.0;
+  autoThrustInput.in.input.flex_temperature_degC = 0.0;
+  autoThrustInput.in.input.mode_requested = pilotInputs.autothrustModeRequested;
+  autoThrustInput.in.input.is_mach_mode_active = false;
+  // like in the interface the alpha floor of the FAC is not wired to the autothrust of the A380X
+  autoThrustInput.in.input.alpha_floor_condition = false;
+  autoThrustInput.in.input.is_approach_mode_active = false;
+  autoThrustInput.in.input.is_SRS_TO_mode_active = false;
+  autoThrustInput.in.input.is_SRS_GA_mode_active = false;
+  autoThrustInput.in.input.is_LAND_mode_active = false;
+  autoThrustInput.in.input.thrust_reduction_altitude = 0;
+  autoThrustInput.in.input.thrust_reduction_altitude_go_around = 0;
+  autoThrustInput.in.input.flight_phase = 5;
+  autoThrustInput.in.input.is_alt_soft_mode_active = false;
+  autoThrustInput.in.input.is_anti_ice_wing_active = false;
+  autoThrustInput.in.input.is_anti_ice_engine_1_active = false;
+  autoThrustInput.in.input.is_anti_ice_engine_2_active = false;
+  autoThrustInput.in.input.is_air_conditioning_1_active = true;
+  autoThrustInput.in.input.is_air_conditioning_2_active = true;
+  autoThrustInput.in.input.FD_active = false;
+  autoThrustInput.in.input.ATHR_reset_disable = false;
+  autoThrustInput.in.input.is_TCAS_active = false;
+  autoThrustInput.in.input.target_TCAS_RA_rate_fpm = 0;
+
+  autoThrust.setExternalInputs(&autoThrustInput);
+  autoThrust.step();
+  autoThrustOutput = autoThrust.getExternalOutputs().out.output;
+}
+
+A380xFlightControlSystem::SurfaceFeedback A380xFlightControlSystem::getSurfaceFeedback(int unitIndex, bool isSec) const {
+  SurfaceFeedback feedback = {};
+  if (unitIndex == 0) {
+    feedback.leftAileron1Deg = surfaces.leftInboardAileronDeg;
+    feedback.rightAileron1Deg = surfaces.rightInboardAileronDeg;
+    feedback.leftAileron2Deg = surfaces.leftMidboardAileronDeg;
+    feedback.rightAileron2Deg = surfaces.rightMidboardAileronDeg;
+    feedback.elevator1Deg = surfaces.leftOutboardElevatorDeg;
+    feedback.elevator2Deg = surfaces.leftInboardElevatorDeg;
+    feedback.elevator3Deg = surfaces.rightOutboardElevatorDeg;
+    feedback.thsDeg = surfaces.thsDeg;
+    feedback.rudder1Deg = isSec ? surfaces.lowerRudderDeg : surfaces.upperRudderDeg;
+    feedback.rudder2Deg = isSec ? surfaces.upperRudderDeg : surfaces.lowerRudderDeg;
+  } else if (unitIndex == 1) {
+    feedback.leftAileron1Deg = surfaces.leftOutboardAileronDeg;
+    feedback.rightAileron1Deg = surfaces.rightOutboardAileronDeg;
+    feedback.leftAileron2Deg = surfaces.leftInboardAileronDeg;
+    feedback.rightAileron2Deg = surfaces.rightInboardAileronDeg;
+    feedback.elevator1Deg = surfaces.rightOutboardElevatorDeg;
+    feedback.elevator2Deg = surfaces.leftOutboardElevatorDeg;
+    feedback.elevator3Deg = surfaces.rightInboardElevatorDeg;
+    feedback.rudder1Deg = surfaces.upperRudderDeg;
+  } else {
+    feedback.leftAileron1Deg = surfaces.leftMidboardAileronDeg;
+    feedback.rightAileron1Deg = surfaces.rightMidboardAileronDeg;
+    feedback.leftAileron2Deg = surfaces.leftOutboardAileronDeg;
+    feedback.rightAileron2Deg = surfaces.rightOutboardAileronDeg;
+    feedback.elevator1Deg = surfaces.leftInboardElevatorDeg;
+    feedback.elevator2Deg = surfaces.rightInboardElevatorDeg;
+    feedback.thsDeg = surfaces.thsDeg;
+    feedback.rudder1Deg = surfaces.lowerRudderDeg;
+  }
+  return feedback;
+}
+
+void A380xFlightControlSystem::updatePrim(double deltaTime,
+                                          int primIndex,
+                                          const HeadlessSimData& simData,
+                                          const PilotInputs& pilotInputs) {
+  auto& in = prims[primIndex].modelInputs.in;
+  const SurfaceFeedback feedback = getSurfaceFeedback(primIndex, false);
+  const int spoilerIndex = 5 - primIndex;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simData.simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.slew_on = false;
+  in.sim_data.pause_on = false;
+  in.sim_data.tracking_mode_on_override = false;
+  in.sim_data.tailstrike_protection_on = false;
+
+  in.discrete_inputs.prim_overhead_button_pressed = pushbuttonsPressed;
+  in.discrete_inputs.is_unit_1 = primIndex == 0;
+  in.discrete_inputs.is_unit_2 = primIndex == 1;
+  in.discrete_inputs.is_unit_3 = primIndex == 2;
+  in.discrete_inputs.capt_priority_takeover_pressed = false;
+  in.discrete_inputs.fo_priority_takeover_pressed = false;
+  in.discrete_inputs.ap_1_pushbutton_pressed = false;
+  in.discrete_inputs.ap_2_pushbutton_pressed = false;
+  in.discrete_inputs.fcu_healthy = false;
+  in.discrete_inputs.athr_pushbutton = false;
+  in.discrete_inputs.ir_3_on_capt = false;
+  in.discrete_inputs.ir_3_on_fo = false;
+  in.discrete_inputs.adr_3_on_capt = false;
+  in.discrete_inputs.adr_3_on_fo = false;
+  in.discrete_inputs.pitch_trim_up_pressed = false;
+  in.discrete_inputs.pitch_trim_down_pressed = false;
+  in.discrete_inputs.green_low_pressure = false;
+  in.discrete_inputs.yellow_low_pressure = false;
+
+  in.analog_inputs.capt_pitch_stick_pos = SIDESTICK_PITCH_INPUT_SIGN * pilotInputs.pitchStick;
+  in.analog_inputs.fo_pitch_stick_pos = 0;
+  in.analog_inputs.capt_roll_stick_pos = SIDESTICK_ROLL_INPUT_SIGN * pilotInputs.rollStick;
+  in.analog_inputs.fo_roll_stick_pos = 0;
+  in.analog_inputs.speed_brake_lever_pos = pilotInputs.groundSpoilersArmed ? -0.05 : 0;
+  in.analog_inputs.thr_lever_1_pos = pilotInputs.thrustLeverAngleDeg[0];
+  in.analog_inputs.thr_lever_2_pos = pilotInputs.thrustLeverAngleDeg[1];
+  in.analog_inputs.thr_lever_3_pos = pilotInputs.thrustLeverAngleDeg[2];
+  in.analog_inputs.thr_lever_4_pos = pilotInputs.thrustLeverAngleDeg[3];
+  in.analog_inputs.elevator_1_pos_deg = feedback.elevator1Deg;
+  in.analog_inputs.elevator_2_pos_deg = feedback.elevator2Deg;
+  in.analog_inputs.elevator_3_pos_deg = feedback.elevator3Deg;
+  in.analog_inputs.ths_pos_deg = feedback.thsDeg;
+  in.analog_inputs.left_aileron_1_pos_deg = feedback.leftAileron1Deg;
+  in.analog_inputs.left_aileron_2_pos_deg = feedback.leftAileron2Deg;
+  in.analog_inputs.right_aileron_1_pos_deg = feedback.rightAileron1Deg;
+  in.analog_inputs.right_aileron_2_pos_deg = feedback.rightAileron2Deg;
+  in.analog_inputs.left_spoiler_pos_deg = surfaces.leftSpoilerDeg[spoilerIndex];
+  in.analog_inputs.right_spoiler_pos_deg = surfaces.rightSpoilerDeg[spoilerIndex];
+  in.analog_inputs.rudder_1_pos_deg = feedback.rudder1Deg;
+  in.analog_inputs.rudder_2_pos_deg = feedback.rudder2Deg;
+  in.analog_inputs.rudder_pedal_pos = RUDDER_PEDAL_INPUT_SIGN * pilotInputs.rudderPedal;
+  in.analog_inputs.yellow_hyd_pressure_psi = 5000;
+  in.analog_inputs.green_hyd_pressure_psi = 5000;
+  in.analog_inputs.vert_acc_1_g = 0;
+  in.analog_inputs.vert_acc_2_g = 0;
+  in.analog_inputs.vert_acc_3_g = 0;
+  in.analog_inputs.lat_acc_1_g = 0;
+  in.analog_inputs.lat_acc_2_g = 0;
+  in.analog_inputs.lat_acc_3_g = 0;
+  in.analog_inputs.left_body_wheel_speed = simData.wheelRpmLeft;
+  in.analog_inputs.left_wing_wheel_speed = simData.wheelRpmLeft;
+  in.analog_inputs.right_body_wheel_speed = simData.wheelRpmRight;
+  in.analog_inputs.right_wing_wheel_speed = simData.wheelRpmRight;
+
+  in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+  in.bus_inputs.adr_2_bus = adrBusOutputs[1];
+  in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  in.bus_inputs.ir_1_bus = irBusOutputs[0];
+  in.bus_inputs.ir_2_bus = irBusOutputs[1];
+  in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  in.bus_inputs.isis_1_bus = {};
+  in.bus_inputs.isis_2_bus = {};
+  in.bus_inputs.rate_gyro_pitch_1_bus = {};
+  in.bus_inputs.rate_gyro_pitch_2_bus = {};
+  in.bus_inputs.rate_gyro_roll_1_bus = {};
+  in.bus_inputs.rate_gyro_roll_2_bus = {};
+  in.bus_inputs.rate_gyro_yaw_1_bus = {};
+  in.bus_inputs.rate_gyro_yaw_2_bus = {};
+  const int raIndices[3][2] = {{0, 2}, {1, 2}, {0, 1}};
+  in.bus_inputs.ra_1_bus = raBusOutputs[raIndices[primIndex][0]];
+  in.bus_inputs.ra_2_bus = raBusOutputs[raIndices[primIndex][1]];
+  in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+  in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+  in.bus_inputs.fcu_own_bus = {};
+  in.bus_inputs.fcu_opp_bus = {};
+  const int oppPrimIndices[3][2] = {{1, 2}, {0, 2}, {0, 1}};
+  in.bus_inputs.prim_x_bus = primsBusOutputs[oppPrimIndices[primIndex][0]];
+  in.bus_inputs.prim_y_bus = primsBusOutputs[oppPrimIndices[primIndex][1]];
+  in.bus_inputs.sec_1_bus = secsBusOutputs[0];
+  in.bus_inputs.sec_2_bus = secsBusOutputs[1];
+  in.bus_inputs.sec_3_bus = secsBusOutputs[2];
+
+  // the autopilot is not engaged, the approach is flown by hand
+  in.temporary_ap_input.ap_engaged = false;
+  in.temporary_ap_input.roll_command = 0;
+  in.temporary_ap_input.pitch_command = 0;
+  in.temporary_ap_input.yaw_command = 0;
+
+  prims[primIndex].update(deltaTime, simData.simulationTime, false, powered);
+
+  primsDiscreteOutputs[primIndex] = prims[primIndex].getDiscreteOutputs();
+  primsAnalogOutputs[primIndex] = prims[primIndex].getAnalogOutputs();
+  primsBusOutputs[primIndex] = prims[primIndex].getBusOutputs();
+}
+
+void A380xFlightControlSystem::updateSec(double deltaTime, int secIndex, const HeadlessSimData& simData, const PilotInputs& pilotInputs) {
+  auto& in = secs[secIndex].modelInputs.in;
+  const SurfaceFeedback feedback = getSurfaceFeedback(secIndex, true);
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simData.simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.slew_on = false;
+  in.sim_data.pause_on = false;
+  in.sim_data.tracking_mode_on_override = false;
+  in.sim_data.tailstrike_protection_on = false;
+
+  in.discrete_inputs.sec_overhead_button_pressed = pushbuttonsPressed;
+  in.discrete_inputs.is_unit_1 = secIndex == 0;
+  in.discrete_inputs.is_unit_2 = secIndex == 1;
+  in.discrete_inputs.is_unit_3 = secIndex == 2;
+  in.discrete_inputs.capt_priority_takeover_pressed = false;
+  in.discrete_inputs.fo_priority_takeover_pressed = false;
+  in.discrete_inputs.rudder_trim_left_pressed = false;
+  in.discrete_inputs.rudder_trim_right_pressed = false;
+  in.discrete_inputs.rudder_trim_reset_pressed = false;
+  in.discrete_inputs.pitch_trim_up_pressed = false;
+  in.discrete_inputs.pitch_trim_down_pressed = false;
+  in.discrete_inputs.green_low_pressure = false;
+  in.discrete_inputs.yellow_low_pressure = false;
+
+  // the spoiler positions fed back to each SEC, wired as in the interface
+  const int spoiler1Index = 2 - secIndex;
+  const int spoiler2Index = 5 + secIndex;
+
+  in.analog_inputs.capt_pitch_stick_pos = SIDESTICK_PITCH_INPUT_SIGN * pilotInputs.pitchStick;
+  in.analog_inputs.fo_pitch_stick_pos = 0;
+  in.analog_inputs.capt_roll_stick_pos = SIDESTICK_ROLL_INPUT_SIGN * pilotInputs.rollStick;
+  in.analog_inputs.fo_roll_stick_pos = 0;
+  in.analog_inputs.elevator_1_pos_deg = feedback.elevator1Deg;
+  in.analog_inputs.elevator_2_pos_deg = feedback.elevator2Deg;
+  in.analog_inputs.elevator_3_pos_deg = feedback.elevator3Deg;
+  in.analog_inputs.ths_pos_deg = feedback.thsDeg;
+  in.analog_inputs.left_aileron_1_pos_deg = feedback.leftAileron1Deg;
+  in.analog_inputs.left_aileron_2_pos_deg = feedback.leftAileron2Deg;
+  in.analog_inputs.right_aileron_1_pos_deg = feedback.rightAileron1Deg;
+  in.analog_inputs.right_aileron_2_pos_deg = feedback.rightAileron2Deg;
+  in.analog_inputs.left_spoiler_1_pos_deg = surfaces.leftSpoilerDeg[spoiler1Index];
+  in.analog_inputs.right_spoiler_1_pos_deg = surfaces.rightSpoilerDeg[spoiler1Index];
+  in.analog_inputs.left_spoiler_2_pos_deg = secIndex == 0 ? 0 : surfaces.leftSpoilerDeg[spoiler2Index];
+  in.analog_inputs.right_spoiler_2_pos_deg = secIndex == 0 ? 0 : surfaces.rightSpoilerDeg[spoiler2Index];
+  in.analog_inputs.rudder_1_pos_deg = feedback.rudder1Deg;
+  in.analog_inputs.rudder_2_pos_deg = feedback.rudder2Deg;
+  in.analog_inputs.rudder_pedal_pos_deg = RUDDER_PEDAL_INPUT_SIGN * pilotInputs.rudderPedal;
+  in.analog_inputs.rudder_trim_pos_deg = 0;
+
+  const int adirsIndices[3][2] = {{0, 1}, {1, 2}, {0, 2}};
+  in.bus_inputs.adr_1_bus = adrBusOutputs[adirsIndices[secIndex][0]];
+  in.bus_inputs.adr_2_bus = adrBusOutputs[adirsIndices[secIndex][1]];
+  in.bus_inputs.ir_1_bus = irBusOutputs[adirsIndices[secIndex][0]];
+  in.bus_inputs.ir_2_bus = irBusOutputs[adirsIndices[secIndex][1]];
+
+  in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+  in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+  in.bus_inputs.irdc_5_a_bus = 0;
+  in.bus_inputs.irdc_5_b_bus = 0;
+  in.bus_inputs.prim_1_bus = primsBusOutputs[0];
+  in.bus_inputs.prim_2_bus = primsBusOutputs[1];
+  in.bus_inputs.prim_3_bus = primsBusOutputs[2];
+  const int oppSecIndices[3][2] = {{1, 2}, {0, 2}, {0, 1}};
+  in.bus_inputs.sec_x_bus = secsBusOutputs[oppSecIndices[secIndex][0]];
+  in.bus_inputs.sec_y_bus = secsBusOutputs[oppSecIndices[secIndex][1]];
+
+  secs[secIndex].update(deltaTime, simData.simulationTime, false, powered);
+
+  secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
+  secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
+  secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
+}
+
+void A380xFlightControlSystem::updateFac(double deltaTime, int facIndex, const HeadlessSimData& simData) {
+  const int oppFacIndex = facIndex == 0 ? 1 : 0;
+  auto& in = facs[facIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simData.simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.slew_on = false;
+  in.sim_data.pause_on = false;
+  in.sim_data.tracking_mode_on_override = false;
+  in.sim_data.tailstrike_protection_on = false;
+
+  in.discrete_inputs.ap_own_engaged = false;
+  in.discrete_inputs.ap_opp_engaged = false;
+  in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
+  in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
+  in.discrete_inputs.rudder_travel_lim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
+  in.discrete_inputs.elac_1_healthy = true;
+  in.discrete_inputs.elac_2_healthy = true;
+  in.discrete_inputs.engine_1_stopped = true;
+  in.discrete_inputs.engine_2_stopped = true;
+  in.discrete_inputs.rudder_trim_switch_left = false;
+  in.discrete_inputs.rudder_trim_switch_right = false;
+  in.discrete_inputs.rudder_trim_reset_button = false;
+  in.discrete_inputs.fac_engaged_from_switch = pushbuttonsPressed;
+  in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
+  in.discrete_inputs.is_unit_1 = facIndex == 0;
+  in.discrete_inputs.rudder_trim_actuator_healthy = true;
+  in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
+  in.discrete_inputs.slats_extended = false;
+  in.discrete_inputs.nose_gear_pressed = Arinc429Utils::bitFromValue(lgciuBusOutputs[facIndex].discrete_word_2, 12);
+  in.discrete_inputs.ir_3_switch = false;
+  in.discrete_inputs.adr_3_switch = false;
+  in.discrete_inputs.yaw_damper_has_hyd_press = true;
+
+  // the rudder of the A380X is commanded by the PRIMs and SECs, the FAC provides the characteristic speeds
+  in.analog_inputs.yaw_damper_position_deg = 0;
+  in.analog_inputs.rudder_trim_position_deg = 0;
+  in.analog_inputs.rudder_travel_lim_position_deg = 0;
+
+  in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+  in.bus_inputs.adr_own_bus = facIndex == 0 ? adrBusOutputs[0] : adrBusOutputs[1];
+  in.bus_inputs.adr_opp_bus = facIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
+  in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  in.bus_inputs.ir_own_bus = facIndex == 0 ? irBusOutputs[0] : irBusOutputs[1];
+  in.bus_inputs.ir_opp_bus = facIndex == 0 ? irBusOutputs[1] : irBusOutputs[0];
+  in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  in.bus_inputs.fmgc_own_bus = {};
+  in.bus_inputs.fmgc_opp_bus = {};
+  in.bus_inputs.sfcc_own_bus = sfccBusOutputs[facIndex];
+  in.bus_inputs.lgciu_own_bus = lgciuBusOutputs[facIndex];
+  in.bus_inputs.elac_1_bus = {};
+  in.bus_inputs.elac_2_bus = {};
+
+  facs[facIndex].update(deltaTime, simData.simulationTime, false, true);
+
+  facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
+  facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
+  facsBusOutputs[facIndex] = facs[facIndex].getBusOutputs();
+}
+
+FlightPlantCommands A380xFlightControlSystem::updateServoControls(const FlightPlant& plant, const PilotInputs& pilotInputs) {
+  const auto& state = plant.getState();
+
+  // each surface has two servo controls, it follows the order of the first one in active mode, the order is taken as the
+  // position the computers read back since the plant reports the surfaces in its own frame
+  auto follow = [](double& position, bool firstActive, double firstOrder, bool secondActive, double secondOrder) {
+    if (firstActive) {
+      position = firstOrder;
+    } else if (secondActive) {
+      position = secondOrder;
+    }
+  };
+  const auto& primD = primsDiscreteOutputs;
+  const auto& primA = primsAnalogOutputs;
+  const auto& secD = secsDiscreteOutputs;
+  const auto& secA = secsAnalogOutputs;
+
+  follow(surfaces.leftInboardAileronDeg, primD[0].left_aileron_1_active_mode || secD[0].left_aileron_1_active_mode,
+         primA[0].left_aileron_1_pos_order_deg + secA[0].left_aileron_1_pos_order_deg,
+         primD[1].left_aileron_2_active_mode || secD[1].left_aileron_2_active_mode,
+         primA[1].left_aileron_2_pos_order_deg + secA[1].left_aileron_2_pos_order_deg);
+  follow(surfaces.rightInboardAileronDeg, primD[0].right_aileron_1_active_mode || secD[0].right_aileron_1_active_mode,
+         primA[0].right_aileron_1_pos_order_deg + secA[0].right_aileron_1_pos_order_deg,
+         primD[1].right_aileron_2_active_mode || secD[1].right_aileron_2_active_mode,
+         primA[1].right_aileron_2_pos_order_deg + secA[1].right_aileron_2_pos_order_deg);
+  follow(surfaces.leftMidboardAileronDeg, primD[2].left_aileron_1_active_mode || secD[2].left_aileron_1_active_mode,
+         primA[2].left_aileron_1_pos_order_deg + secA[2].left_aileron_1_pos_order_deg,
+         primD[0].left_aileron_2_active_mode || secD[0].left_aileron_2_active_mode,
+         primA[0].left_aileron_2_pos_order_deg + secA[0].left_aileron_2_pos_order_deg);
+  follow(surfaces.rightMidboardAileronDeg, primD[2].right_aileron_1_active_mode || secD[2].right_aileron_1_active_mode,
+         primA[2].right_aileron_1_pos_order_deg + secA[2].right_aileron_1_pos_order_deg,
+         primD[0].right_aileron_2_active_mode || secD[0].right_aileron_2_active_mode,
+         primA[0].right_aileron_2_pos_order_deg + secA[0].right_aileron_2_pos_order_deg);
+  follow(surfaces.leftOutboardAileronDeg, primD[1].left_aileron_1_active_mode, primA[1].left_aileron_1_pos_order_deg,
+         primD[2].left_aileron_2_active_mode, primA[2].left_aileron_2_pos_order_deg);
+  follow(surfaces.rightOutboardAileronDeg, primD[1].right_aileron_1_active_mode, primA[1].right_aileron_1_pos_order_deg,
+         primD[2].right_aileron_2_active_mode, primA[2].right_aileron_2_pos_order_deg);
+
+  follow(surfaces.leftInboardElevatorDeg, primD[2].elevator_1_active_mode || secD[2].elevator_1_active_mode,
+         primA[2].elevator_1_pos_order_deg + secA[2].elevator_1_pos_order_deg,
+         primD[0].elevator_2_active_mode || secD[0].elevator_2_active_mode,
+         primA[0].elevator_2_pos_order_deg + secA[0].elevator_2_pos_order_deg);
+  follow(surfaces.rightInboardElevatorDeg, primD[2].elevator_2_active_mode || secD[2].elevator_2_active_mode,
+         primA[2].elevator_2_pos_order_deg + secA[2].elevator_2_pos_order_deg,
+         primD[1].elevator_3_active_mode || secD[1].elevator_3_active_mode,
+         primA[1].elevator_3_pos_order_deg + secA[1].elevator_3_pos_order_deg);
+  follow(surfaces.leftOutboardElevatorDeg, primD[0].elevator_1_active_mode || secD[0].elevator_1_active_mode,
+         primA[0].elevator_1_pos_order_deg + secA[0].elevator_1_pos_order_deg,
+         primD[1].elevator_2_active_mode || secD[1].elevator_2_active_mode,
+         primA[1].elevator_2_pos_order_deg + secA[1].elevator_2_pos_order_deg);
+  follow(surfaces.rightOutboardElevatorDeg, primD[1].elevator_1_active_mode || secD[1].elevator_1_active_mode,
+         primA[1].elevator_1_pos_order_deg + secA[1].elevator_1_pos_order_deg,
+         primD[0].elevator_3_active_mode || secD[0].elevator_3_active_mode,
+         primA[0].elevator_3_pos_order_deg + secA[0].elevator_3_pos_order_deg);
+
+  // the trimmable horizontal stabilizer keeps its position without an active motor
+  surfaces.thsDeg = state.stabilizerDeg;
+  follow(surfaces.thsDeg, primD[2].ths_active_mode || secD[2].ths_active_mode, primA[2].ths_pos_order_deg + secA[2].ths_pos_order_deg,
+         primD[0].ths_active_mode || secD[0].ths_active_mode, primA[0].ths_pos_order_deg + secA[0].ths_pos_order_deg);
+
+  // the rudders are driven by the hydraulic or the electric servo controls
+  follow(surfaces.upperRudderDeg,
+         primD[0].rudder_1_hydraulic_active_mode || primD[0].rudder_1_electric_active_mode ||
+             secD[0].rudder_1_hydraulic_active_mode || secD[0].rudder_1_electric_active_mode,
+         primA[0].rudder_1_pos_order_deg + secA[0].rudder_1_pos_order_deg,
+         primD[1].rudder_1_hydraulic_active_mode || primD[1].rudder_1_electric_active_mode ||
+             secD[1].rudder_1_hydraulic_active_mode || secD[1].rudder_1_electric_active_mode,
+         primA[1].rudder_1_pos_order_deg + secA[1].rudder_1_pos_order_deg);
+  follow(surfaces.lowerRudderDeg,
+         primD[0].rudder_2_hydraulic_active_mode || primD[0].rudder_2_electric_active_mode ||
+             secD[0].rudder_2_hydraulic_active_mode || secD[0].rudder_2_electric_active_mode,
+         primA[0].rudder_2_pos_order_deg + secA[0].rudder_2_pos_order_deg,
+         primD[2].rudder_1_hydraulic_active_mode || primD[2].rudder_1_electric_active_mode ||
+             secD[2].rudder_1_hydraulic_active_mode || secD[2].rudder_1_electric_active_mode,
+         primA[2].rudder_1_pos_order_deg + secA[2].rudder_1_pos_order_deg);
+
+  // spoilers 1 to 3 and 7 to 8 are driven by the SECs, spoilers 4 to 6 by the PRIMs
+  surfaces.leftSpoilerDeg = {secA[2].left_spoiler_1_pos_order_deg,  secA[1].left_spoiler_1_pos_order_deg,
+                             secA[0].left_spoiler_1_pos_order_deg,  primA[2].left_spoiler_pos_order_deg,
+                             primA[1].left_spoiler_pos_order_deg,   primA[0].left_spoiler_pos_order_deg,
+                             secA[1].left_spoiler_2_pos_order_deg,  secA[2].left_spoiler_2_pos_order_deg};
+  surfaces.rightSpoilerDeg = {secA[2].right_spoiler_1_pos_order_deg, secA[1].right_spoiler_1_pos_order_deg,
+                              secA[0].right_spoiler_1_pos_order_deg, primA[2].right_spoiler_pos_order_deg,
+                              primA[1].right_spoiler_pos_order_deg,  primA[0].right_spoiler_pos_order_deg,
+                              secA[1].right_spoiler_2_pos_order_deg, secA[2].right_spoiler_2_pos_order_deg};
+
+  FlightPlantCommands commands = {};
+  commands.elevatorLeftDeg = 0.5 * (surfaces.leftInboardElevatorDeg + surfaces.leftOutboardElevatorDeg);
+  commands.elevatorRightDeg = 0.5 * (surfaces.rightInboardElevatorDeg + surfaces.rightOutboardElevatorDeg);
+  commands.stabilizerDeg = surfaces.thsDeg;
+  commands.aileronLeftDeg = (surfaces.leftInboardAileronDeg + surfaces.leftMidboardAileronDeg + surfaces.leftOutboardAileronDeg) / 3;
+  commands.aileronRightDeg = (surfaces.rightInboardAileronDeg + surfaces.rightMidboardAileronDeg + surfaces.rightOutboardAileronDeg) / 3;
+  for (int i = 0; i < 8; i++) {
+    commands.spoilerLeftDeg -= surfaces.leftSpoilerDeg[i] / 8;
+    commands.spoilerRightDeg -= surfaces.rightSpoilerDeg[i] / 8;
+  }
+  commands.rudderDeg = 0.5 * (surfaces.upperRudderDeg + surfaces.lowerRudderDeg);
+
+  commands.engineN1CommandPercent[0] = autoThrustOutput.N1_c_1_percent;
+  commands.engineN1CommandPercent[1] = autoThrustOutput.N1_c_2_percent;
+  commands.engineN1CommandPercent[2] = autoThrustOutput.N1_c_3_percent;
+  commands.engineN1CommandPercent[3] = autoThrustOutput.N1_c_4_percent;
+
+  commands.flapsConfiguration = pilotInputs.flapsConfiguration;
+  commands.gearDown = pilotInputs.gearDown;
+  commands.brakeLeft = pilotInputs.brakeLeft;
+  commands.brakeRight = pilotInputs.brakeRight;
+  return commands;
+}
+
+std::unique_ptr<FlightControlSystem> createFlightControlSystem() {
+  // the storage comes zeroed like the one of the static interface, see FlightControlSystem::operator new
+  auto system = std::make_unique<A380xFlightControlSystem>();
+  system->initialize();
+  return system;
+}
+
+const char* getDefaultAircraftFile() {
+  return "aircraft/a380x.ini";
+}
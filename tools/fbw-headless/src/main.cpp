@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ApproachPilot.h"
+#include "FlightControlSystem.h"
+#include "FlightPlant.h"
+#include "HeadlessSimulation.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/core.h"
+
+// an approach that has not stopped on the runway after this time is counted as not stopped
+const double DEFAULT_MAXIMUM_TIME_S = 600.0;
+
+// touchdowns harder than this are counted separately
+const double HARD_LANDING_SINK_RATE_FPM = 600.0;
+
+// the snapshot check takes the snapshot on the glide path and compares the commands until well before the flare
+const double SNAPSHOT_CHECK_TIME_S = 30.0;
+const double SNAPSHOT_CHECK_DURATION_S = 60.0;
+
+struct Options {
+  std::string configFilePath;
+  int32_t runs;
+  int32_t jobs;
+  uint32_t seed;
+  double scatter;
+  double turbulence;
+  double stepTime;
+  double maximumTime;
+  std::string traceFilePath;
+  std::string summaryFilePath;
+  double maximumSinkRate;
+  bool snapshotCheck;
+};
+
+// messages of runs flown in parallel must not interleave
+static std::mutex printMutex;
+
+template <typename... Args>
+static void printMessage(fmt::format_string<Args...> format, Args&&... args) {
+  std::lock_guard<std::mutex> lock(printMutex);
+  fmt::print(format, std::forward<Args>(args)...);
+}
+
+static void writeSummary(std::FILE* file, const std::vector<RunResult>& results) {
+  fmt::print(file,
+             "seed,lateral_offset_m,height_offset_ft,speed_offset_kn,headwind_kn,crosswind_kn,turbulence_m_s,trimmed,computers_healthy,"
+             "autothrust_active,normal_law_kept,landed,stopped,touchdown_sink_rate_fpm,touchdown_distance_m,touchdown_lateral_m,"
+             "touchdown_cas_kn,touchdown_pitch_deg,touchdown_bank_deg,stop_distance_m,maximum_bank_deg,minimum_nz_g,maximum_nz_g,"
+             "simulated_time_s\n");
+  for (const auto& result : results) {
+    const auto& condition = result.condition;
+    fmt::print(file, "{},{:.2f},{:.2f},{:.2f},{:.2f},{:.2f},{:.2f},{},{},{},{},{},{},", condition.seed, condition.lateralOffsetM,
+               condition.heightOffsetFt, condition.speedOffsetKn, condition.headwindKn, condition.crosswindKn, condition.turbulenceMS,
+               result.trimmed, result.computersHealthy, result.autothrustActive, result.normalLawKept, result.landed, result.stopped);
+    fmt::print(file, "{:.1f},{:.1f},{:.2f},{:.2f},{:.2f},{:.2f},{:.1f},{:.2f},{:.3f},{:.3f},{:.2f}\n", result.touchdownSinkRateFpm,
+               result.touchdownDistanceM, result.touchdownLateralM, result.touchdownCasKn, result.touchdownPitchDeg,
+               result.touchdownBankDeg, result.stopDistanceM, result.maximumBankDeg, result.minimumNormalLoadFactor,
+               result.maximumNormalLoadFactor, result.simulatedTimeS);
+  }
+}
+
+static void printStatistics(const std::vector<RunResult>& results) {
+  size_t trimmed = 0, healthy = 0, autothrust = 0, normalLaw = 0, landed = 0, stopped = 0, hard = 0;
+  double sinkRateSum = 0, sinkRateMaximum = 0, distanceSum = 0, distanceSquareSum = 0, lateralMaximum = 0;
+  double bankMaximum = 0, nzMinimum = 1.0, nzMaximum = 1.0;
+  for (const auto& result : results) {
+    trimmed += result.trimmed;
+    healthy += result.computersHealthy;
+    autothrust += result.autothrustActive;
+    normalLaw += result.trimmed && result.normalLawKept;
+    stopped += result.stopped;
+    bankMaximum = std::max(bankMaximum, result.maximumBankDeg);
+    nzMinimum = std::min(nzMinimum, result.minimumNormalLoadFactor);
+    nzMaximum = std::max(nzMaximum, result.maximumNormalLoadFactor);
+    if (result.landed) {
+      landed++;
+      hard += result.touchdownSinkRateFpm > HARD_LANDING_SINK_RATE_FPM;
+      sinkRateSum += result.touchdownSinkRateFpm;
+      sinkRateMaximum = std::max(sinkRateMaximum, result.touchdownSinkRateFpm);
+      distanceSum += result.touchdownDistanceM;
+      distanceSquareSum += result.touchdownDistanceM * result.touchdownDistanceM;
+      lateralMaximum = std::max(lateralMaximum, std::abs(result.touchdownLateralM));
+    }
+  }
+
+  fmt::print("Runs: {}, trimmed {}, computers healthy {}, autothrust active {}, normal law kept {}\n", results.size(), trimmed, healthy,
+             autothrust, normalLaw);
+  fmt::print("Landed: {}, stopped {}, hard landings {}\n", landed, stopped, hard);
+  if (landed > 0) {
+    double distanceMean = distanceSum / landed;
+    double distanceDeviation = std::sqrt(std::max(0.0, distanceSquareSum / landed - distanceMean * distanceMean));
+    fmt::print("Touchdown: sink rate mean {:.0f} fpm max {:.0f} fpm, distance {:.0f} m +- {:.0f} m, lateral max {:.1f} m\n",
+               sinkRateSum / landed, sinkRateMaximum, distanceMean, distanceDeviation, lateralMaximum);
+  }
+  fmt::print("Envelope: bank max {:.1f} deg, nz {:.2f} to {:.2f} g\n", bankMaximum, nzMinimum, nzMaximum);
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  Options options = {getDefaultAircraftFile(), 1, 0, 1, 0.0, 0.0, 0.02, DEFAULT_MAXIMUM_TIME_S, "", "", 0.0, false};
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Flies approaches with the flight control computers in a closed loop with a plant model, without the sim");
+  args.addArgument({"-c", "--config"}, &options.configFilePath, "Aircraft file with the coefficients of the plant and the approach");
+  args.addArgument({"-n", "--runs"}, &options.runs, "Number of approaches to fly");
+  args.addArgument({"-j", "--jobs"}, &options.jobs, "Number of approaches flown in parallel, all cores by default");
+  args.addArgument({"-s", "--seed"}, &options.seed, "Seed of the first run, the runs use consecutive seeds");
+  args.addArgument({"--scatter"}, &options.scatter, "Scale of the random offsets of the initial condition and the wind");
+  args.addArgument({"--turbulence"}, &options.turbulence, "Standard deviation of the gusts in m/s");
+  args.addArgument({"--step"}, &options.stepTime, "Simulation step in seconds");
+  args.addArgument({"--max-time"}, &options.maximumTime, "Simulation time after which a run is ended");
+  args.addArgument({"-r", "--trace"}, &options.traceFilePath, "Writes the first run step by step to this csv file");
+  args.addArgument({"-o", "--summary"}, &options.summaryFilePath, "Writes one csv line with the results of each run to this file");
+  args.addArgument({"--max-sink-rate"}, &options.maximumSinkRate,
+                   "Touchdown sink rate in fpm from which a run fails, not checked by default");
+  args.addArgument({"--snapshot-check"}, &options.snapshotCheck,
+                   "Checks that computers restored from a snapshot of the first run continue with identical commands");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  // check parameters
+  if (!std::filesystem::is_regular_file(options.configFilePath)) {
+    fmt::print("Aircraft file '{}' does not exist!\n", options.configFilePath);
+    return 1;
+  }
+  if (options.runs <= 0 || options.stepTime <= 0) {
+    fmt::print("Runs and step must be positive!\n");
+    return 1;
+  }
+
+  FlightPlantConfiguration plantConfiguration = {};
+  ApproachConfiguration approachConfiguration = {};
+  if (!plantConfiguration.load(options.configFilePath) || !approachConfiguration.load(options.configFilePath)) {
+    fmt::print("Failed to read aircraft file '{}'!\n", options.configFilePath);
+    return 1;
+  }
+  HeadlessSimulation simulation(plantConfiguration, approachConfiguration, options.stepTime, options.maximumTime);
+
+  if (options.snapshotCheck) {
+    auto condition = HeadlessSimulation::createRunCondition(options.seed, options.scatter, options.turbulence);
+    SnapshotCheckResult result = simulation.checkSnapshot(condition, SNAPSHOT_CHECK_TIME_S, SNAPSHOT_CHECK_DURATION_S);
+    fmt::print("Snapshot of '{}': {} bytes, trimmed {}, restored {}, foreign blobs rejected {}\n", plantConfiguration.name,
+               result.snapshotSize, result.trimmed, result.restored, result.foreignBlobsRejected);
+    fmt::print("Compared {} steps, {} differ, maximum difference {}\n", result.comparedSteps, result.differingSteps,
+               result.maximumDifference);
+    bool passed =
+        result.trimmed && result.restored && result.foreignBlobsRejected && result.comparedSteps > 0 && result.differingSteps == 0;
+    fmt::print("{}\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 2;
+  }
+
+  std::FILE* trace = nullptr;
+  if (!options.traceFilePath.empty()) {
+    trace = std::fopen(options.traceFilePath.c_str(), "w");
+    if (trace == nullptr) {
+      fmt::print("Failed to open trace file '{}'!\n", options.traceFilePath);
+      return 1;
+    }
+  }
+
+  int jobs = options.jobs;
+  if (jobs <= 0) {
+    jobs = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  }
+  jobs = std::min(jobs, options.runs);
+  fmt::print("Flying {} approaches of '{}' with {} jobs\n", options.runs, plantConfiguration.name, jobs);
+
+  std::vector<RunResult> results(options.runs);
+  std::atomic<size_t> next = 0;
+  auto worker = [&]() {
+    for (size_t i = next++; i < results.size(); i = next++) {
+      auto condition = HeadlessSimulation::createRunCondition(options.seed + static_cast<uint32_t>(i), options.scatter, options.turbulence);
+      results[i] = simulation.run(condition, i == 0 ? trace : nullptr);
+      if (!results[i].landed) {
+        printMessage("Run with seed {} did not land\n", condition.seed);
+      }
+    }
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < jobs; i++) {
+    threads.emplace_back(worker);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (trace != nullptr) {
+    std::fclose(trace);
+  }
+
+  if (!options.summaryFilePath.empty()) {
+    std::FILE* summary = std::fopen(options.summaryFilePath.c_str(), "w");
+    if (summary == nullptr) {
+      fmt::print("Failed to open summary file '{}'!\n", options.summaryFilePath);
+      return 1;
+    }
+    writeSummary(summary, results);
+    std::fclose(summary);
+  }
+
+  printStatistics(results);
+
+  // the warm up of the computers is simulated as well and counts towards the throughput
+  double simulatedTime = 0;
+  for (const auto& result : results) {
+    simulatedTime += result.simulatedTimeS + FlightControlSystem::WARM_UP_TIME_S;
+  }
+  fmt::print("Simulated {:.0f} s in {:.2f} s wall time, {:.0f} times faster than real time, {:.0f} steps per second\n", simulatedTime,
+             wallTime, simulatedTime / wallTime, simulatedTime / options.stepTime / wallTime);
+
+  // a run passes when it landed and stopped without leaving the normal law and, if a limit is given, below the limit of
+  // the sink rate
+  size_t failed = 0;
+  for (const auto& result : results) {
+    bool isSinkRateExceeded = options.maximumSinkRate > 0 && result.landed && result.touchdownSinkRateFpm >= options.maximumSinkRate;
+    if (!result.landed || !result.stopped || !result.normalLawKept || isSinkRateExceeded) {
+      fmt::print("Run with seed {} failed: landed {}, stopped {}, normal law kept {}, touchdown sink rate {:.0f} fpm\n",
+                 result.condition.seed, result.landed, result.stopped, result.normalLawKept, result.touchdownSinkRateFpm);
+      failed++;
+    }
+  }
+  fmt::print("{}\n", failed == 0 ? "PASSED" : "FAILED");
+  return failed == 0 ? 0 : 2;
+}
@@ -0,0 +1,242 @@
+// drives a SharedMemoryComputerTransport and a SharedMemoryComputerEndpoint attached to the same segment through the
+// lockstep protocol, the endpoint runs in a thread in place of the process executing the computers
+
+#include "ComputerTransport.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+const uint32_t COMPUTER = 3;
+const uint32_t INPUT_ID = 10;
+const uint32_t OUTPUT_ID = 20;
+
+// generous, a lockstep exchange only runs into it when the endpoint does not respond
+const double TIMEOUT = 5;
+// for the exchanges which are expected to run into the timeout
+const double SHORT_TIMEOUT = 0.5;
+
+struct Input {
+  uint64_t frame;
+  double value;
+};
+
+struct Output {
+  uint64_t frame;
+  double value;
+};
+
+struct Received {
+  uint32_t id;
+  uint32_t size;
+  Output output;
+};
+
+static bool isPassed = true;
+
+static void check(bool condition, const char* description) {
+  std::cout << "  " << description << (condition ? "" : " FAILED") << std::endl;
+  isPassed = isPassed && condition;
+}
+
+// the computer doubles the value of its input
+static void serveSteps(SharedMemoryComputerEndpoint* endpoint, int steps) {
+  Input input = {};
+  for (int step = 0; step < steps;) {
+    uint32_t computer;
+    uint64_t frame;
+    bool isStepRequested = endpoint->receive(
+        [&input](uint32_t id, const void* data, uint32_t size) {
+          if (id == INPUT_ID) {
+            readComputerData(input, data, size);
+          }
+        },
+        computer, frame);
+    if (!isStepRequested) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    Output output = {frame, 2 * input.value};
+    endpoint->send(OUTPUT_ID, &output, sizeof(output));
+    endpoint->complete(computer, frame);
+    step++;
+  }
+}
+
+static ComputerTransportReceiver collect(std::vector<Received>& received) {
+  return [&received](uint32_t id, const void* data, uint32_t size) {
+    Received message = {id, size, {}};
+    readComputerData(message.output, data, size);
+    received.push_back(message);
+  };
+}
+
+static void testLockstep(const std::string& name) {
+  std::cout << "lockstep" << std::endl;
+
+  auto transport = SharedMemoryComputerTransport::open(name, TIMEOUT);
+  auto endpoint = SharedMemoryComputerEndpoint::open(name);
+  check(transport && endpoint, "the endpoint attaches to the segment of the host");
+  if (!transport || !endpoint) {
+    return;
+  }
+
+  const int frames = 1000;
+  std::thread computer(serveSteps, endpoint.get(), frames);
+
+  int exchanged = 0;
+  int matching = 0;
+  for (uint64_t frame = 1; frame <= frames; frame++) {
+    Input input = {frame, 0.5 * frame};
+    transport->send(INPUT_ID, &input, sizeof(input));
+
+    std::vector<Received> received;
+    exchanged += transport->exchange(COMPUTER, frame, collect(received));
+    // the outputs of a frame are the ones computed from the inputs of the same frame
+    if (received.size() == 1 && received[0].id == OUTPUT_ID && received[0].size == sizeof(Output) &&
+        received[0].output.frame == frame && received[0].output.value == frame) {
+      matching++;
+    }
+  }
+  computer.join();
+
+  check(exchanged == frames, "every exchange completes");
+  check(matching == frames, "every exchange delivers the outputs of its own frame");
+}
+
+static void testFullRing(const std::string& name) {
+  std::cout << "full ring" << std::endl;
+
+  auto transport = SharedMemoryComputerTransport::open(name, TIMEOUT);
+  auto endpoint = SharedMemoryComputerEndpoint::open(name);
+  if (!transport || !endpoint) {
+    check(false, "the endpoint attaches to the segment of the host");
+    return;
+  }
+
+  int sent = 0;
+  for (uint32_t message = 0; message <= ComputerMessageRing::SLOT_COUNT; message++) {
+    Input input = {message, 0};
+    sent += transport->send(INPUT_ID, &input, sizeof(input));
+  }
+  check(sent == static_cast<int>(ComputerMessageRing::SLOT_COUNT), "a message beyond the slots of the ring is rejected");
+
+  // the step request is rejected as well, so the exchange fails without waiting
+  std::vector<Received> received;
+  check(!transport->exchange(COMPUTER, 1, collect(received)), "an exchange fails when its step request does not fit into the ring");
+
+  uint32_t computer;
+  uint64_t frame;
+  uint64_t expectedFrame = 0;
+  bool isInOrder = true;
+  bool isStepRequested = endpoint->receive(
+      [&](uint32_t, const void* data, uint32_t size) {
+        Input input = {};
+        readComputerData(input, data, size);
+        isInOrder = isInOrder && input.frame == expectedFrame++;
+      },
+      computer, frame);
+  check(!isStepRequested && isInOrder && expectedFrame == ComputerMessageRing::SLOT_COUNT,
+        "the endpoint receives the accepted messages in order and no step request");
+
+  // the drained ring wraps around
+  std::thread computerThread(serveSteps, endpoint.get(), 1);
+  Input input = {2, 4};
+  transport->send(INPUT_ID, &input, sizeof(input));
+  bool isExchanged = transport->exchange(COMPUTER, 2, collect(received));
+  computerThread.join();
+  check(isExchanged && received.size() == 1 && received[0].output.value == 8, "the drained ring is used again");
+}
+
+static void testStaleSync(const std::string& name) {
+  std::cout << "timeout and stale step completion" << std::endl;
+
+  auto transport = SharedMemoryComputerTransport::open(name, SHORT_TIMEOUT);
+  auto endpoint = SharedMemoryComputerEndpoint::open(name);
+  if (!transport || !endpoint) {
+    check(false, "the endpoint attaches to the segment of the host");
+    return;
+  }
+
+  Input input = {1, 1};
+  transport->send(INPUT_ID, &input, sizeof(input));
+  std::vector<Received> received;
+  check(!transport->exchange(COMPUTER, 1, collect(received)) && received.empty(),
+        "an exchange without a response runs into the timeout");
+
+  // the computer responds late to the first frame and then to the second
+  std::thread computer(serveSteps, endpoint.get(), 2);
+  input = {2, 3};
+  transport->send(INPUT_ID, &input, sizeof(input));
+  bool isExchanged = transport->exchange(COMPUTER, 2, collect(received));
+  computer.join();
+
+  check(isExchanged, "the exchange after a timeout completes with its own frame");
+  check(received.size() == 2 && received[0].output.frame == 1 && received[0].output.value == 2,
+        "the late outputs of the timed out frame are delivered first");
+  check(received.size() == 2 && received[1].output.frame == 2 && received[1].output.value == 6,
+        "the stale step completion does not end the exchange before its own outputs");
+}
+
+static void testSizeMismatch(const std::string& name) {
+  std::cout << "size mismatch" << std::endl;
+
+  auto transport = SharedMemoryComputerTransport::open(name, TIMEOUT);
+  auto endpoint = SharedMemoryComputerEndpoint::open(name);
+  if (!transport || !endpoint) {
+    check(false, "the endpoint attaches to the segment of the host");
+    return;
+  }
+
+  std::vector<unsigned char> oversized(ComputerMessageRing::PAYLOAD_SIZE + 1);
+  check(!transport->send(INPUT_ID, oversized.data(), static_cast<uint32_t>(oversized.size())),
+        "a data area larger than a slot is rejected");
+
+  // a computer built with another layout of its outputs sends a shorter data area
+  std::thread computer([&endpoint]() {
+    uint32_t computer;
+    uint64_t frame;
+    while (!endpoint->receive([](uint32_t, const void*, uint32_t) {}, computer, frame)) {
+      std::this_thread::yield();
+    }
+    uint64_t truncated = frame;
+    endpoint->send(OUTPUT_ID, &truncated, sizeof(truncated));
+    endpoint->complete(computer, frame);
+  });
+
+  Output output = {0, -1};
+  uint32_t receivedSize = 0;
+  bool isRead = true;
+  bool isExchanged = transport->exchange(COMPUTER, 1, [&](uint32_t, const void* data, uint32_t size) {
+    receivedSize = size;
+    isRead = readComputerData(output, data, size);
+  });
+  computer.join();
+
+  check(isExchanged && receivedSize == sizeof(uint64_t), "the receiver gets the size of the data area as sent");
+  check(!isRead && output.frame == 0 && output.value == -1, "a data area shorter than its destination is not read");
+
+  unsigned char padded[sizeof(Output) + 4] = {};
+  Output source = {7, 1.5};
+  std::memcpy(padded, &source, sizeof(source));
+  check(readComputerData(output, padded, sizeof(padded)) && output.frame == 7 && output.value == 1.5,
+        "a padded data area is read up to the size of its destination");
+}
+
+int main() {
+  std::string name = "/fbw_computer_transport_test_" + std::to_string(getpid());
+
+  testLockstep(name);
+  testFullRing(name);
+  testStaleSync(name);
+  testSizeMismatch(name);
+
+  shm_unlink(name.c_str());
+  std::cout << (isPassed ? "PASSED" : "FAILED") << std::endl;
+  return isPassed ? 0 : 1;
+}
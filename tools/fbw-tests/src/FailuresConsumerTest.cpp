@@ -0,0 +1,142 @@
+// applies failure schedules step by step and checks when the failures become active and inactive
+
+#include "failures/FailuresConsumer.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// the step of the laws at the default rate
+const double STEP_TIME = 0.02;
+
+// the first failures of the aircraft, the test does not depend on which computers they are
+const Failures FIRST = FAILURES[0];
+const Failures SECOND = FAILURES[1];
+const Failures THIRD = FAILURES[2];
+
+static bool isPassed = true;
+
+static void check(bool condition, const char* description) {
+  std::cout << "  " << description << (condition ? "" : " FAILED") << std::endl;
+  isPassed = isPassed && condition;
+}
+
+// number of the step after which the failure is active for the first time, -1 if it never is
+static int findActivationStep(FailuresConsumer& consumer, Failures failure, int maximumSteps) {
+  for (int step = 1; step <= maximumSteps; step++) {
+    consumer.updateSchedule(STEP_TIME);
+    if (consumer.isActive(failure)) {
+      return step;
+    }
+  }
+  return -1;
+}
+
+static void testOrdering() {
+  std::cout << "ordering" << std::endl;
+
+  // the schedule is sorted by time, entries with the same time keep their order
+  FailuresConsumer consumer;
+  consumer.loadSchedule({
+      {0.1, SECOND, true},
+      {0.04, FIRST, true},
+      {0.1, SECOND, false},
+      {0.06, THIRD, false},
+      {0.06, THIRD, true},
+  });
+  consumer.updateSchedule(STEP_TIME);
+  check(!consumer.isAnyActive(), "nothing active before the first entry");
+  consumer.updateSchedule(STEP_TIME);
+  check(consumer.isActive(FIRST) && !consumer.isActive(THIRD), "the earliest entry is applied first although it is listed second");
+  consumer.updateSchedule(STEP_TIME);
+  check(consumer.isActive(THIRD), "of two entries at the same time the one listed last wins");
+  consumer.updateSchedule(STEP_TIME);
+  consumer.updateSchedule(STEP_TIME);
+  check(!consumer.isActive(SECOND), "an activation and a deactivation at the same time are applied in the given order");
+}
+
+static void testActivateDeactivate() {
+  std::cout << "activate and deactivate" << std::endl;
+
+  FailuresConsumer consumer;
+  consumer.loadSchedule({{0.5, FIRST, true}, {1.0, FIRST, false}, {1.0, SECOND, true}});
+  check(findActivationStep(consumer, FIRST, 100) == 25, "activated in the step which reaches its time");
+  for (int step = 26; step < 50; step++) {
+    consumer.updateSchedule(STEP_TIME);
+  }
+  check(consumer.isActive(FIRST) && !consumer.isActive(SECOND), "active until the deactivation");
+  consumer.updateSchedule(STEP_TIME);
+  check(!consumer.isActive(FIRST) && consumer.isActive(SECOND), "deactivated in the step which reaches its time");
+
+  // entries with failures unknown to the aircraft are dropped when the schedule is loaded
+  consumer.loadSchedule({{0.0, static_cast<Failures>(-1), true}, {0.0, THIRD, true}});
+  consumer.updateSchedule(STEP_TIME);
+  check(consumer.isActive(THIRD), "unknown failures are ignored");
+
+  // failures activated by the schedule stay active when it is cleared
+  consumer.clearSchedule();
+  consumer.updateSchedule(STEP_TIME);
+  check(consumer.isActive(THIRD), "clearing the schedule keeps the active failures");
+}
+
+static void testStepTolerance() {
+  std::cout << "step tolerance" << std::endl;
+
+  // 0.02 can not be represented exactly, the sum of 10 steps is below 0.2
+  double sum = 0;
+  for (int step = 0; step < 10; step++) {
+    sum += STEP_TIME;
+  }
+  check(sum < 0.2, "the sum of the steps is below the scheduled time");
+
+  FailuresConsumer consumer;
+  consumer.loadSchedule({{0.2, FIRST, true}});
+  check(findActivationStep(consumer, FIRST, 100) == 10, "an entry at a multiple of the step is not delayed by rounding");
+
+  consumer.loadSchedule({{0.1 + 0.5e-6, FIRST, false}});
+  consumer.updateSchedule(5 * STEP_TIME);
+  check(!consumer.isActive(FIRST), "an entry within the tolerance after the time is applied");
+
+  consumer.loadSchedule({{0.1 + 2e-6, FIRST, true}});
+  consumer.updateSchedule(0.1);
+  check(!consumer.isActive(FIRST), "an entry more than the tolerance after the time is not applied");
+  consumer.updateSchedule(STEP_TIME);
+  check(consumer.isActive(FIRST), "it is applied in the next step");
+}
+
+static void testScheduleFile() {
+  std::cout << "schedule file" << std::endl;
+
+  auto filePath = std::filesystem::temp_directory_path() / "failures-consumer-test.txt";
+  {
+    std::ofstream file(filePath);
+    file << "# time failure action\n";
+    file << "0.04 " << static_cast<int>(FIRST) << " activate  # first\n";
+    file << "\n";
+    file << "0.08 " << static_cast<int>(FIRST) << " deactivate\n";
+  }
+
+  FailuresConsumer consumer;
+  check(consumer.loadScheduleFromFile(filePath.string()), "a file with comments and empty lines is read");
+  check(findActivationStep(consumer, FIRST, 100) == 2, "its activation is applied");
+  consumer.updateSchedule(STEP_TIME);
+  consumer.updateSchedule(STEP_TIME);
+  check(!consumer.isActive(FIRST), "its deactivation is applied");
+
+  {
+    std::ofstream file(filePath);
+    file << "0.04 " << static_cast<int>(FIRST) << " fail\n";
+  }
+  check(!consumer.loadScheduleFromFile(filePath.string()), "a file with an unknown action is rejected");
+  std::filesystem::remove(filePath);
+}
+
+int main() {
+  testOrdering();
+  testActivateDeactivate();
+  testStepTolerance();
+  testScheduleFile();
+  std::cout << (isPassed ? "PASSED" : "FAILED") << std::endl;
+  return isPassed ? 0 : 1;
+}
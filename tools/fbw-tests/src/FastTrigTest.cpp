@@ -0,0 +1,128 @@
+// compares the kernels of FastTrig.h with the library over the reduced range and over large arguments, and checks that
+// a TrigCache built with FBW_FAST_TRIG only approximates the guidance terms
+
+#include "FastTrig.h"
+#include "TrigCache.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+// the bounds documented in FastTrig.h
+const double TOLERANCE = 2e-15;  // absolute
+// beyond this the kernels pass the argument to the library
+const double LARGEST_REDUCED_ARGUMENT = 1e5;
+
+const double PI = 3.14159265358979323846;
+
+struct Deviation {
+  double maximum = 0;
+  double argument = 0;
+};
+
+static bool isPassed = true;
+
+static void record(Deviation& deviation, double x, double error) {
+  if (!(error <= deviation.maximum)) {
+    deviation.maximum = error;
+    deviation.argument = x;
+  }
+}
+
+// the reference is evaluated in extended precision, so that the rounding of the library does not count as an error
+static void compare(double x, Deviation& sinDeviation, Deviation& cosDeviation) {
+  long double extended = x;
+  record(sinDeviation, x, std::abs(static_cast<long double>(FastTrig::sin(x)) - std::sin(extended)));
+  record(cosDeviation, x, std::abs(static_cast<long double>(FastTrig::cos(x)) - std::cos(extended)));
+}
+
+static void report(const char* name, const Deviation& deviation, double tolerance) {
+  bool isWithin = deviation.maximum <= tolerance;
+  isPassed = isPassed && isWithin;
+  std::cout << "  " << name << ": maximum error " << deviation.maximum << " at " << deviation.argument << ", tolerance " << tolerance
+            << (isWithin ? "" : " FAILED") << std::endl;
+}
+
+static void testRange(const char* name, double lower, double upper, int samples) {
+  std::cout << name << std::endl;
+
+  Deviation sinDeviation;
+  Deviation cosDeviation;
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(lower, upper);
+  for (int i = 0; i <= samples; i++) {
+    compare(lower + (upper - lower) * i / samples, sinDeviation, cosDeviation);
+    compare(distribution(generator), sinDeviation, cosDeviation);
+  }
+
+  report("sin", sinDeviation, TOLERANCE);
+  report("cos", cosDeviation, TOLERANCE);
+}
+
+static void testQuadrantBoundaries() {
+  std::cout << "multiples of pi/4" << std::endl;
+
+  // the arguments at which the reduction changes the quadrant and the kernels are evaluated at the edge of their range
+  Deviation sinDeviation;
+  Deviation cosDeviation;
+  for (int k = -127000; k <= 127000; k++) {
+    double x = k * PI / 4;
+    compare(std::nextafter(x, -1e9), sinDeviation, cosDeviation);
+    compare(std::nextafter(x, 1e9), sinDeviation, cosDeviation);
+  }
+
+  report("sin", sinDeviation, TOLERANCE);
+  report("cos", cosDeviation, TOLERANCE);
+}
+
+static void testLibraryArguments() {
+  std::cout << "arguments passed to the library" << std::endl;
+
+  const double arguments[] = {std::nextafter(LARGEST_REDUCED_ARGUMENT, 1e9), -2e5, 1e10, 1e300};
+  bool isIdentical = true;
+  for (double x : arguments) {
+    isIdentical = isIdentical && FastTrig::sin(x) == std::sin(x) && FastTrig::cos(x) == std::cos(x);
+  }
+  bool isNan = true;
+  for (double x : {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity()}) {
+    isNan = isNan && std::isnan(FastTrig::sin(x)) && std::isnan(FastTrig::cos(x));
+  }
+
+  isPassed = isPassed && isIdentical && isNan;
+  std::cout << "  large arguments give the results of the library" << (isIdentical ? "" : " FAILED") << std::endl;
+  std::cout << "  NaN and infinity give NaN" << (isNan ? "" : " FAILED") << std::endl;
+}
+
+static void testTrigCache() {
+  std::cout << "trig cache" << std::endl;
+
+  // the attitude and law terms use the library, only the guidance terms the kernels
+  bool isExact = true;
+  bool isApproximated = true;
+  std::mt19937_64 generator(7);
+  std::uniform_real_distribution<double> distribution(-10, 10);
+  for (int i = 0; i < 10000; i++) {
+    TrigCache trigCache;
+    double x = distribution(generator);
+    isExact = isExact && trigCache.sin(x) == std::sin(x) && trigCache.cos(x) == std::cos(x) && trigCache.tan(x) == std::tan(x);
+    isApproximated = isApproximated && trigCache.guidanceSin(x) == FastTrig::sin(x) && trigCache.guidanceCos(x) == FastTrig::cos(x);
+    // the exact result is not replaced by the approximation of the same argument
+    isExact = isExact && trigCache.sin(x) == std::sin(x) && trigCache.cos(x) == std::cos(x);
+  }
+
+  isPassed = isPassed && isExact && isApproximated;
+  std::cout << "  sin, cos and tan are the library functions" << (isExact ? "" : " FAILED") << std::endl;
+  std::cout << "  the guidance functions are the kernels" << (isApproximated ? "" : " FAILED") << std::endl;
+}
+
+int main() {
+  testRange("reduced range [-pi/4, pi/4]", -PI / 4, PI / 4, 1000000);
+  testRange("angles of the models [-4 pi, 4 pi]", -4 * PI, 4 * PI, 1000000);
+  testRange("large arguments [-1e5, 1e5]", -LARGEST_REDUCED_ARGUMENT, LARGEST_REDUCED_ARGUMENT, 1000000);
+  testQuadrantBoundaries();
+  testLibraryArguments();
+  testTrigCache();
+  std::cout << (isPassed ? "PASSED" : "FAILED") << std::endl;
+  return isPassed ? 0 : 1;
+}
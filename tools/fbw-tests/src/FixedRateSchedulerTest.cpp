@@ -0,0 +1,178 @@
+// advances a FixedRateScheduler over jittery frame times and checks the steps of each frame against an exact reference,
+// the limit of the steps per frame and the inputs consumed by the steps the way FlyByWireInterface::update does
+
+#include "FixedRateScheduler.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// the frame times are whole microseconds and the rates divide a second into whole microseconds, so that the reference
+// counts the accumulated time exactly
+const int64_t MICROSECONDS = 1000000;
+
+const int MAX_STEPS_PER_FRAME = 8;
+
+static bool isPassed = true;
+
+static void check(bool condition, const char* description) {
+  std::cout << "  " << description << (condition ? "" : " FAILED") << std::endl;
+  isPassed = isPassed && condition;
+}
+
+static bool isEqual(double a, double b) {
+  return std::abs(a - b) <= 1e-12;
+}
+
+// jittery frame times between 5 ms and 60 ms, around 30 frames per second
+static std::vector<int64_t> jitteryFrameTimes(int frames, uint64_t seed) {
+  std::mt19937_64 generator(seed);
+  std::uniform_int_distribution<int64_t> distribution(5000, 60000);
+  std::vector<int64_t> frameTimes(frames);
+  for (auto& frameTime : frameTimes) {
+    frameTime = distribution(generator);
+  }
+  return frameTimes;
+}
+
+static void testJitter(int rate) {
+  std::cout << "jittery frames at " << rate << " Hz" << std::endl;
+
+  FixedRateScheduler scheduler("TEST", rate, MAX_STEPS_PER_FRAME);
+  const int64_t stepTime = MICROSECONDS / rate;
+
+  int64_t accumulatedTime = 0;
+  int64_t steps = 0;
+  int64_t totalTime = 0;
+  bool isMatching = true;
+  bool isStepTimeFixed = true;
+  bool isAccumulatorBounded = true;
+  for (int64_t frameTime : jitteryFrameTimes(100000, rate)) {
+    int frameSteps = scheduler.advance(static_cast<double>(frameTime) / MICROSECONDS);
+
+    // even the longest frame takes no more steps than the limit, so no step is dropped
+    accumulatedTime += frameTime;
+    int64_t expectedSteps = accumulatedTime / stepTime;
+    accumulatedTime -= expectedSteps * stepTime;
+
+    isMatching = isMatching && frameSteps == expectedSteps;
+    isStepTimeFixed = isStepTimeFixed && isEqual(scheduler.getStepTime(), 1.0 / rate);
+    steps += frameSteps;
+    totalTime += frameTime;
+    isAccumulatorBounded = isAccumulatorBounded && totalTime - steps * stepTime >= 0 && totalTime - steps * stepTime < stepTime;
+  }
+
+  check(isMatching, "every frame takes the steps of the exact accumulated time");
+  check(isStepTimeFixed, "the steps have the fixed step time");
+  check(isAccumulatorBounded, "the time not stepped stays below one step, no time is lost or gained");
+}
+
+static void testFrameTimeEqualToStepTime() {
+  std::cout << "frame time equal to the step time" << std::endl;
+
+  // the rounding of the accumulated time must not hold a frame and take two steps in the next
+  FixedRateScheduler scheduler("TEST", 60, MAX_STEPS_PER_FRAME);
+  bool isOneStepEach = true;
+  for (int frame = 0; frame < 1000000; frame++) {
+    isOneStepEach = isOneStepEach && scheduler.advance(1.0 / 60) == 1;
+  }
+  check(isOneStepEach, "every frame takes one step");
+
+  FixedRateScheduler halfRateScheduler("TEST", 60, MAX_STEPS_PER_FRAME);
+  bool isAlternating = true;
+  for (int frame = 0; frame < 1000000; frame++) {
+    isAlternating = isAlternating && halfRateScheduler.advance(1.0 / 120) == frame % 2;
+  }
+  check(isAlternating, "at twice the rate every second frame takes one step and the others are held");
+}
+
+static void testCatchUpLimit() {
+  std::cout << "catch-up limit" << std::endl;
+
+  FixedRateScheduler scheduler("TEST", 50, 4);
+  int steps = scheduler.advance(0.21);
+  check(steps == 4, "a long frame takes no more than the maximum steps");
+  check(isEqual(scheduler.getStepTime(), 0.02) && isEqual(scheduler.getEffectiveStepTime(), 0.21 / 4),
+        "the steps keep their step time and the effective step time covers the frame");
+
+  // 0.01 s of the long frame are left over, the 6 dropped steps are not
+  steps = scheduler.advance(0.005);
+  check(steps == 0, "the dropped steps are not caught up in the next frame");
+  steps = scheduler.advance(0.005);
+  check(steps == 1 && isEqual(scheduler.getEffectiveStepTime(), 0.02), "the time left over of the long frame is kept");
+
+  // with 1 ms per step a budget of 3 ms fits 3 steps
+  scheduler.setFrameBudget(0.003);
+  scheduler.recordExecutionTime(0.001);
+  steps = scheduler.advance(0.2);
+  check(steps == 3, "the frame budget limits the steps below the maximum");
+  scheduler.recordExecutionTime(0.03);
+  steps = scheduler.advance(0.2);
+  check(steps == 1, "at least one step is taken when a step exceeds the frame budget");
+
+  FixedRateScheduler subSteppedScheduler("TEST", 0, 4);
+  steps = subSteppedScheduler.advance(0.25);
+  check(steps == 1 && isEqual(subSteppedScheduler.getStepTime(), 0.25), "with a rate of 0 a frame is one step");
+  subSteppedScheduler.setMaxStepTime(0.1);
+  steps = subSteppedScheduler.advance(0.25);
+  check(steps == 3 && isEqual(subSteppedScheduler.getStepTime(), 0.25 / 3), "sub-stepping splits a frame into equal steps");
+  steps = subSteppedScheduler.advance(1);
+  check(steps == 4 && isEqual(subSteppedScheduler.getStepTime(), 0.25), "sub-stepping always simulates the whole frame");
+}
+
+// the steps of a frame as FlyByWireInterface::update takes them, the pushes are reset once the first step consumed them
+static void testInputLatching(int rate) {
+  std::cout << "inputs at " << rate << " Hz" << std::endl;
+
+  FixedRateScheduler scheduler("TEST", rate, MAX_STEPS_PER_FRAME);
+  // the pushes of the FCU buttons as the SimConnect events count them
+  int input = 0;
+  std::mt19937_64 generator(rate);
+  std::bernoulli_distribution isPushed(0.3);
+
+  int pushes = 0;
+  int consumedPushes = 0;
+  int pendingPushes = 0;
+  int heldFramesWithPushes = 0;
+  int framesWithSeveralSteps = 0;
+  bool isConsumedByFirstStep = true;
+  for (int64_t frameTime : jitteryFrameTimes(100000, rate + 1)) {
+    // the events of the frame, several pushes in a frame are consumed by the same step
+    int framePushes = isPushed(generator) ? 1 + static_cast<int>(generator() % 3) : 0;
+    input += framePushes;
+    pushes += framePushes;
+    pendingPushes += framePushes;
+
+    int steps = scheduler.advance(static_cast<double>(frameTime) / MICROSECONDS);
+    for (int step = 0; step < steps; step++) {
+      // the first step consumes the pushes of the held frames since the last step and of this frame, the others none
+      isConsumedByFirstStep = isConsumedByFirstStep && input == (step == 0 ? pendingPushes : 0);
+      consumedPushes += input;
+      input = 0;
+    }
+    heldFramesWithPushes += steps == 0 && pendingPushes > 0;
+    framesWithSeveralSteps += steps > 1;
+    if (steps > 0) {
+      pendingPushes = 0;
+    }
+  }
+
+  check(consumedPushes + pendingPushes == pushes, "every push is consumed exactly once");
+  check(isConsumedByFirstStep, "the pushes are kept through held frames and consumed by the first step of a frame only");
+  std::cout << "  " << heldFramesWithPushes << " held frames with pushes, " << framesWithSeveralSteps << " frames with several steps"
+            << std::endl;
+}
+
+int main() {
+  testJitter(50);
+  testJitter(100);
+  testJitter(125);
+  testFrameTimeEqualToStepTime();
+  testCatchUpLimit();
+  testInputLatching(20);
+  testInputLatching(125);
+  std::cout << (isPassed ? "PASSED" : "FAILED") << std::endl;
+  return isPassed ? 0 : 1;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+// the parts of the MSFS gauge API which the fly-by-wire sources under test need to compile natively, the tests do not
+// read or write simulation variables, so every variable reads as zero
+
+typedef int ID;
+typedef double FLOAT64;
+
+inline ID register_named_variable(const char*) {
+  return 0;
+}
+
+inline FLOAT64 get_named_variable_value(ID) {
+  return 0;
+}
+
+inline void set_named_variable_value(ID, FLOAT64) {}
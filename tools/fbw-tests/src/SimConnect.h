@@ -0,0 +1,25 @@
+#pragma once
+
+// the parts of the SimConnect API which the fly-by-wire sources under test need to compile natively, the tests do not
+// connect to a simulator, so every call succeeds without effect
+
+typedef void* HANDLE;
+typedef long HRESULT;
+typedef unsigned long DWORD;
+
+#define S_OK ((HRESULT)0L)
+
+typedef DWORD SIMCONNECT_CLIENT_DATA_ID;
+typedef DWORD SIMCONNECT_CLIENT_DATA_DEFINITION_ID;
+
+enum SIMCONNECT_CLIENT_DATA_SET_FLAG { SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT = 0 };
+
+inline HRESULT SimConnect_SetClientData(HANDLE,
+                                        SIMCONNECT_CLIENT_DATA_ID,
+                                        SIMCONNECT_CLIENT_DATA_DEFINITION_ID,
+                                        SIMCONNECT_CLIENT_DATA_SET_FLAG,
+                                        DWORD,
+                                        DWORD,
+                                        void*) {
+  return S_OK;
+}
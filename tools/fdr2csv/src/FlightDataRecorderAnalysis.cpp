@@ -0,0 +1,235 @@
+#include "FlightDataRecorderAnalysis.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "FlightDataRecorderJson.h"
+
+// width of the bins of a histogram which has seen a single value only
+static constexpr double HISTOGRAM_MINIMUM_WIDTH = 1.0 / 1024.0;
+
+// fields whose changes are reported, fields which do not exist in a schema are skipped
+static constexpr std::string_view TRANSITION_FIELDS[] = {
+    "ap_sm.output.enabled_AP1",
+    "ap_sm.output.enabled_AP2",
+    "ap_sm.output.lateral_law",
+    "ap_sm.output.lateral_mode",
+    "ap_sm.output.lateral_mode_armed",
+    "ap_sm.output.vertical_law",
+    "ap_sm.output.vertical_mode",
+    "ap_sm.output.vertical_mode_armed",
+    "ap_sm.output.autothrust_mode",
+    "athr.output.status",
+    "athr.output.mode",
+    "data.alpha_floor_condition",
+    "data.high_aoa_protection",
+    "data.master_warning_active",
+};
+
+void FlightDataRecorderAnalysis::Histogram::add(double value) {
+  if (!isInitialized) {
+    isInitialized = true;
+    width = HISTOGRAM_MINIMUM_WIDTH;
+    origin = std::floor(value / width) * width;
+  }
+
+  // double the width of the bins until the value is covered, the old range ends up in the lower or upper half
+  while (value >= origin + HISTOGRAM_BINS * width) {
+    for (size_t i = 0; i < HISTOGRAM_BINS / 2; i++) {
+      counts[i] = counts[2 * i] + counts[2 * i + 1];
+    }
+    std::fill(counts.begin() + HISTOGRAM_BINS / 2, counts.end(), 0);
+    width *= 2.0;
+  }
+  while (value < origin) {
+    for (size_t i = HISTOGRAM_BINS / 2; i-- > 0;) {
+      counts[HISTOGRAM_BINS / 2 + i] = counts[2 * i] + counts[2 * i + 1];
+    }
+    std::fill(counts.begin(), counts.begin() + HISTOGRAM_BINS / 2, 0);
+    origin -= HISTOGRAM_BINS * width;
+    width *= 2.0;
+  }
+
+  auto bin = static_cast<size_t>((value - origin) / width);
+  counts[std::min(bin, HISTOGRAM_BINS - 1)]++;
+}
+
+FlightDataRecorderAnalysis::FlightDataRecorderAnalysis(const FlightDataRecorderSchema& schema, const Limits& limits)
+    : schema(schema),
+      simulationTimeField(findFlightDataRecorderField(schema, "ap_sm.time.simulation_time")),
+      timeSinceTouchdownField(findFlightDataRecorderField(schema, "athr.data_computed.time_since_touchdown")),
+      onGroundField(findFlightDataRecorderField(schema, "athr.data.on_ground")),
+      verticalSpeedField(findFlightDataRecorderField(schema, "ap_sm.data.H_dot_ft_min")),
+      values(schema.fields.size()),
+      previousValues(schema.fields.size()),
+      statistics(schema.fields.size()) {
+  for (auto name : TRANSITION_FIELDS) {
+    addTransition(name);
+  }
+  addExceedance("athr.data.nz_g", limits.nzMax, false, true);
+  addExceedance("athr.data.nz_g", limits.nzMin, false, false);
+  addExceedance("ap_sm.data.Phi_deg", limits.bankMax, true, true);
+}
+
+void FlightDataRecorderAnalysis::addTransition(std::string_view name) {
+  int field = findFlightDataRecorderField(schema, name);
+  if (field >= 0) {
+    transitions.push_back({field});
+  }
+}
+
+void FlightDataRecorderAnalysis::addExceedance(std::string_view name, double limit, bool isAbsolute, bool isUpper) {
+  int field = findFlightDataRecorderField(schema, name);
+  if (field >= 0) {
+    exceedances.push_back({field, limit, isAbsolute, isUpper});
+  }
+}
+
+void FlightDataRecorderAnalysis::process(const char* record) {
+  schema.decodeRecord(record, values.data());
+
+  double time = simulationTimeField >= 0 ? values[simulationTimeField] : static_cast<double>(recordCount);
+  if (recordCount == 0) {
+    startTime = time;
+  }
+  endTime = time;
+
+  updateStatistics();
+  updateEvents(time);
+
+  values.swap(previousValues);
+  recordCount++;
+}
+
+void FlightDataRecorderAnalysis::updateStatistics() {
+  for (size_t i = 0; i < values.size(); i++) {
+    double value = values[i];
+    if (!std::isfinite(value)) {
+      continue;
+    }
+
+    auto& field = statistics[i];
+    if (field.count == 0) {
+      field.minimum = value;
+      field.maximum = value;
+    } else {
+      field.minimum = std::min(field.minimum, value);
+      field.maximum = std::max(field.maximum, value);
+    }
+
+    // running mean and variance after Welford
+    field.count++;
+    double delta = value - field.mean;
+    field.mean += delta / static_cast<double>(field.count);
+    field.m2 += delta * (value - field.mean);
+
+    field.histogram.add(value);
+  }
+}
+
+void FlightDataRecorderAnalysis::updateEvents(double time) {
+  for (auto& watch : transitions) {
+    double value = values[watch.field];
+    if (watch.isInitialized && value != watch.value) {
+      events.push_back({time, "transition", watch.field, watch.value, value, 0.0});
+    }
+    watch.isInitialized = true;
+    watch.value = value;
+  }
+
+  // the time since touchdown is zero while airborne and starts counting on the ground
+  if (timeSinceTouchdownField >= 0) {
+    double timeSinceTouchdown = values[timeSinceTouchdownField];
+    if (timeSinceTouchdown > 0.0) {
+      if (wasAirborne) {
+        double verticalSpeed = verticalSpeedField >= 0 ? previousValues[verticalSpeedField] : 0.0;
+        events.push_back({time - timeSinceTouchdown, "touchdown", verticalSpeedField, 0.0, verticalSpeed, 0.0});
+      }
+      wasAirborne = false;
+    } else if (onGroundField < 0 || values[onGroundField] == 0.0) {
+      wasAirborne = true;
+    }
+  }
+
+  for (auto& watch : exceedances) {
+    double value = watch.isAbsolute ? std::abs(values[watch.field]) : values[watch.field];
+    bool isExceeded = watch.isUpper ? value > watch.limit : value < watch.limit;
+    if (isExceeded) {
+      if (!watch.isActive) {
+        watch.isActive = true;
+        watch.startTime = time;
+        watch.peak = value;
+      }
+      watch.peak = watch.isUpper ? std::max(watch.peak, value) : std::min(watch.peak, value);
+    } else if (watch.isActive) {
+      closeExceedance(watch, time);
+    }
+  }
+}
+
+void FlightDataRecorderAnalysis::closeExceedance(ExceedanceWatch& watch, double time) {
+  watch.isActive = false;
+  events.push_back({watch.startTime, "exceedance", watch.field, watch.limit, watch.peak, time - watch.startTime});
+}
+
+void FlightDataRecorderAnalysis::writeJson(fmt::memory_buffer& buffer, std::string_view source) const {
+  // exceedances lasting until the end of the recording are reported as well
+  std::vector<Event> allEvents = events;
+  for (auto watch : exceedances) {
+    if (watch.isActive) {
+      allEvents.push_back({watch.startTime, "exceedance", watch.field, watch.limit, watch.peak, endTime - watch.startTime});
+    }
+  }
+  std::stable_sort(allEvents.begin(), allEvents.end(), [](const Event& a, const Event& b) { return a.time < b.time; });
+
+  buffer.append(std::string_view("{\n  \"file\": "));
+  appendJsonString(buffer, source);
+  fmt::format_to(fmt::appender(buffer), ",\n  \"aircraft\": \"{}\",\n  \"version\": {},\n  \"records\": {},\n", schema.aircraft,
+                 schema.version, recordCount);
+  fmt::format_to(fmt::appender(buffer), "  \"start_time\": {},\n  \"end_time\": {},\n", startTime, endTime);
+
+  buffer.append(std::string_view("  \"fields\": {"));
+  for (size_t i = 0; i < statistics.size(); i++) {
+    const auto& field = statistics[i];
+    fmt::format_to(fmt::appender(buffer), "{}\n    \"{}\": {{\"count\": {}", i == 0 ? "" : ",", schema.fields[i].name, field.count);
+    if (field.count > 0) {
+      double stddev = std::sqrt(field.m2 / static_cast<double>(field.count));
+      fmt::format_to(fmt::appender(buffer), ", \"min\": {}, \"max\": {}, \"mean\": {}, \"stddev\": {}", field.minimum, field.maximum,
+                     field.mean, stddev);
+
+      // empty bins at both ends are omitted
+      const auto& counts = field.histogram.counts;
+      size_t first = 0;
+      size_t last = HISTOGRAM_BINS - 1;
+      while (counts[first] == 0) {
+        first++;
+      }
+      while (counts[last] == 0) {
+        last--;
+      }
+      fmt::format_to(fmt::appender(buffer), ", \"histogram\": {{\"origin\": {}, \"width\": {}, \"counts\": [",
+                     field.histogram.origin + first * field.histogram.width, field.histogram.width);
+      for (size_t bin = first; bin <= last; bin++) {
+        fmt::format_to(fmt::appender(buffer), "{}{}", bin == first ? "" : ", ", counts[bin]);
+      }
+      buffer.append(std::string_view("]}"));
+    }
+    buffer.push_back('}');
+  }
+  buffer.append(std::string_view("\n  },\n  \"events\": ["));
+
+  for (size_t i = 0; i < allEvents.size(); i++) {
+    const auto& event = allEvents[i];
+    fmt::format_to(fmt::appender(buffer), "{}\n    {{\"time\": {}, \"type\": \"{}\"", i == 0 ? "" : ",", event.time, event.type);
+    if (event.type == "transition") {
+      fmt::format_to(fmt::appender(buffer), ", \"field\": \"{}\", \"from\": {}, \"to\": {}}}", schema.fields[event.field].name, event.from,
+                     event.to);
+    } else if (event.type == "touchdown") {
+      fmt::format_to(fmt::appender(buffer), ", \"vertical_speed_ft_min\": {}}}", event.to);
+    } else {
+      fmt::format_to(fmt::appender(buffer), ", \"field\": \"{}\", \"limit\": {}, \"peak\": {}, \"duration\": {}}}",
+                     schema.fields[event.field].name, event.from, event.to, event.duration);
+    }
+  }
+  buffer.append(std::string_view("\n  ]\n}\n"));
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FlightDataRecorderSchema.h"
+
+// computes statistics of every field and extracts events while streaming the records of a recording once
+class FlightDataRecorderAnalysis {
+ public:
+  // thresholds for exceedance events
+  struct Limits {
+    double nzMax = 2.5;
+    double nzMin = -1.0;
+    double bankMax = 45.0;
+  };
+
+  FlightDataRecorderAnalysis(const FlightDataRecorderSchema& schema, const Limits& limits);
+
+  void process(const char* record);
+
+  // writes the summary as json object
+  void writeJson(fmt::memory_buffer& buffer, std::string_view source) const;
+
+ private:
+  static constexpr size_t HISTOGRAM_BINS = 32;
+
+  // histogram with bins of a power of two width, the range grows by merging bins so that no second pass is needed
+  struct Histogram {
+    bool isInitialized = false;
+    double origin = 0.0;
+    double width = 0.0;
+    std::array<uint64_t, HISTOGRAM_BINS> counts = {};
+
+    void add(double value);
+  };
+
+  struct FieldStatistics {
+    uint64_t count = 0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;
+    Histogram histogram;
+  };
+
+  // field whose changes are reported as events
+  struct TransitionWatch {
+    int field;
+    bool isInitialized = false;
+    double value = 0.0;
+  };
+
+  // field whose excursions beyond a limit are reported as events
+  struct ExceedanceWatch {
+    int field;
+    double limit;
+    bool isAbsolute;
+    bool isUpper;
+    bool isActive = false;
+    double startTime = 0.0;
+    double peak = 0.0;
+  };
+
+  struct Event {
+    double time;
+    std::string type;
+    int field;
+    double from;
+    double to;
+    double duration;
+  };
+
+  const FlightDataRecorderSchema& schema;
+  const int simulationTimeField;
+  const int timeSinceTouchdownField;
+  const int onGroundField;
+  const int verticalSpeedField;
+
+  std::vector<double> values;
+  std::vector<double> previousValues;
+  std::vector<FieldStatistics> statistics;
+  std::vector<TransitionWatch> transitions;
+  std::vector<ExceedanceWatch> exceedances;
+  std::vector<Event> events;
+
+  uint64_t recordCount = 0;
+  double startTime = 0.0;
+  double endTime = 0.0;
+  bool wasAirborne = false;
+
+  void addTransition(std::string_view name);
+  void addExceedance(std::string_view name, double limit, bool isAbsolute, bool isUpper);
+  void updateStatistics();
+  void updateEvents(double time);
+  void closeExceedance(ExceedanceWatch& watch, double time);
+};
@@ -0,0 +1,229 @@
+#include "FlightDataRecorderComparison.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "FlightDataRecorderJson.h"
+
+FlightDataRecorderComparison::FlightDataRecorderComparison(const FlightDataRecorderSchema& baselineSchema,
+                                                           const FlightDataRecorderSchema& schema,
+                                                           const Tolerance& defaultTolerance)
+    : baselineSchema(baselineSchema),
+      schema(schema),
+      timeField(findFlightDataRecorderField(baselineSchema, "ap_sm.time.simulation_time")),
+      defaultTolerance(defaultTolerance),
+      baselineValues(baselineSchema.fields.size()),
+      values(schema.fields.size()) {
+  std::vector<int> allFields(baselineSchema.fields.size());
+  std::iota(allFields.begin(), allFields.end(), 0);
+  mapFields(allFields);
+
+  for (const auto& field : schema.fields) {
+    if (findFlightDataRecorderField(baselineSchema, field.name) < 0) {
+      onlyInRecording.emplace_back(field.name);
+    }
+  }
+}
+
+void FlightDataRecorderComparison::mapFields(const std::vector<int>& candidateBaselineFields) {
+  baselineFields.clear();
+  fields.clear();
+  onlyInBaseline.clear();
+  for (int baselineField : candidateBaselineFields) {
+    int field = findFlightDataRecorderField(schema, baselineSchema.fields[baselineField].name);
+    if (field >= 0) {
+      baselineFields.push_back(baselineField);
+      fields.push_back(field);
+    } else {
+      onlyInBaseline.emplace_back(baselineSchema.fields[baselineField].name);
+    }
+  }
+
+  isIdentityMapping = &baselineSchema == &schema && baselineFields.size() == baselineSchema.fields.size();
+  for (size_t i = 0; isIdentityMapping && i < fields.size(); i++) {
+    isIdentityMapping = baselineFields[i] == static_cast<int>(i) && fields[i] == static_cast<int>(i);
+  }
+
+  size_t count = fields.size();
+  comparedBaselineValues.assign(count, 0.0);
+  comparedValues.assign(count, 0.0);
+  absoluteTolerances.assign(count, defaultTolerance.absolute);
+  relativeTolerances.assign(count, defaultTolerance.relative);
+  maximumErrors.assign(count, 0.0);
+  maximumErrorTimes.assign(count, 0.0);
+  squaredErrorSums.assign(count, 0.0);
+  exceedanceCounts.assign(count, 0);
+  firstExceedanceTimes.assign(count, 0.0);
+}
+
+bool FlightDataRecorderComparison::selectFields(const std::string& patterns, std::string& unmatchedPattern) {
+  std::vector<int> selectedFields;
+  if (!selectFlightDataRecorderFields(baselineSchema, patterns, selectedFields, unmatchedPattern)) {
+    return false;
+  }
+  mapFields(selectedFields);
+  return true;
+}
+
+bool FlightDataRecorderComparison::setTolerance(std::string_view pattern, const Tolerance& tolerance) {
+  bool hasMatch = false;
+  for (size_t i = 0; i < baselineFields.size(); i++) {
+    if (matchesFlightDataRecorderFieldPattern(pattern, baselineSchema.fields[baselineFields[i]].name)) {
+      absoluteTolerances[i] = tolerance.absolute;
+      relativeTolerances[i] = tolerance.relative;
+      hasMatch = true;
+    }
+  }
+  return hasMatch;
+}
+
+void FlightDataRecorderComparison::compare(const char* baselineRecord, const char* record) {
+  baselineSchema.decodeRecord(baselineRecord, baselineValues.data());
+  schema.decodeRecord(record, values.data());
+
+  const double* a = baselineValues.data();
+  const double* b = values.data();
+  if (!isIdentityMapping) {
+    for (size_t i = 0; i < fields.size(); i++) {
+      comparedBaselineValues[i] = baselineValues[baselineFields[i]];
+      comparedValues[i] = values[fields[i]];
+    }
+    a = comparedBaselineValues.data();
+    b = comparedValues.data();
+  }
+  double time = timeField >= 0 ? baselineValues[timeField] : static_cast<double>(comparedRecords);
+  comparedRecords++;
+
+  // branch free pass over all fields so that the compiler can vectorize it, values which are both nan are equal
+  const size_t count = fields.size();
+  uint64_t exceededFields = 0;
+  for (size_t i = 0; i < count; i++) {
+    double error = std::abs(a[i] - b[i]);
+    double tolerance = absoluteTolerances[i] + relativeTolerances[i] * std::max(std::abs(a[i]), std::abs(b[i]));
+    bool isEqual = a[i] == b[i] || (a[i] != a[i] && b[i] != b[i]);
+    bool isExceeded = !isEqual && !(error <= tolerance);
+    squaredErrorSums[i] += error < std::numeric_limits<double>::infinity() ? error * error : 0.0;
+    exceedanceCounts[i] += isExceeded;
+    exceededFields += isExceeded;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    double error = std::abs(a[i] - b[i]);
+    if (error > maximumErrors[i]) {
+      maximumErrors[i] = error;
+      maximumErrorTimes[i] = time;
+    }
+  }
+
+  if (exceededFields == 0) {
+    return;
+  }
+
+  // the exceedance counters changed, record the time of the first exceedance of each field
+  for (size_t i = 0; i < count; i++) {
+    double error = std::abs(a[i] - b[i]);
+    double tolerance = absoluteTolerances[i] + relativeTolerances[i] * std::max(std::abs(a[i]), std::abs(b[i]));
+    bool isEqual = a[i] == b[i] || (a[i] != a[i] && b[i] != b[i]);
+    if (isEqual || error <= tolerance) {
+      continue;
+    }
+    if (exceedanceCounts[i] == 1) {
+      firstExceedanceTimes[i] = time;
+    }
+    if (!hasDivergence) {
+      hasDivergence = true;
+      divergenceTime = time;
+      divergenceField = static_cast<int>(i);
+      divergenceBaselineValue = a[i];
+      divergenceValue = b[i];
+    }
+  }
+}
+
+void FlightDataRecorderComparison::addUnmatchedRecord(bool isBaseline) {
+  if (isBaseline) {
+    unmatchedBaselineRecords++;
+  } else {
+    unmatchedRecords++;
+  }
+}
+
+bool FlightDataRecorderComparison::hasDifferences() const {
+  return hasDivergence || unmatchedBaselineRecords > 0 || unmatchedRecords > 0;
+}
+
+// nan and infinity are not valid json numbers
+static void appendJsonNumber(fmt::memory_buffer& buffer, double value) {
+  if (std::isfinite(value)) {
+    fmt::format_to(fmt::appender(buffer), "{}", value);
+  } else {
+    appendJsonString(buffer, fmt::format("{}", value));
+  }
+}
+
+void FlightDataRecorderComparison::writeJson(fmt::memory_buffer& buffer, std::string_view baselinePath, std::string_view path) const {
+  buffer.append(std::string_view("{\n  \"baseline\": "));
+  appendJsonString(buffer, baselinePath);
+  buffer.append(std::string_view(",\n  \"file\": "));
+  appendJsonString(buffer, path);
+  fmt::format_to(fmt::appender(buffer),
+                 ",\n  \"compared_records\": {},\n  \"unmatched_baseline_records\": {},\n  \"unmatched_records\": {},\n  \"compared_fields\": {},\n",
+                 comparedRecords, unmatchedBaselineRecords, unmatchedRecords, fields.size());
+
+  buffer.append(std::string_view("  \"first_divergence\": "));
+  if (hasDivergence) {
+    fmt::format_to(fmt::appender(buffer), "{{\"time\": {}, \"field\": \"{}\", \"baseline\": ", divergenceTime,
+                   baselineSchema.fields[baselineFields[divergenceField]].name);
+    appendJsonNumber(buffer, divergenceBaselineValue);
+    buffer.append(std::string_view(", \"value\": "));
+    appendJsonNumber(buffer, divergenceValue);
+    buffer.append(std::string_view("},\n"));
+  } else {
+    buffer.append(std::string_view("null,\n"));
+  }
+
+  // only fields with differences are listed
+  buffer.append(std::string_view("  \"fields\": {"));
+  bool isFirst = true;
+  for (size_t i = 0; i < fields.size(); i++) {
+    if (maximumErrors[i] == 0.0 && exceedanceCounts[i] == 0) {
+      continue;
+    }
+    double rmsError = comparedRecords > 0 ? std::sqrt(squaredErrorSums[i] / static_cast<double>(comparedRecords)) : 0.0;
+    fmt::format_to(fmt::appender(buffer), "{}\n    \"{}\": {{\"max_error\": ", isFirst ? "" : ",", baselineSchema.fields[baselineFields[i]].name);
+    appendJsonNumber(buffer, maximumErrors[i]);
+    fmt::format_to(fmt::appender(buffer), ", \"max_error_time\": {}, \"rms_error\": {}, \"exceedances\": {}", maximumErrorTimes[i], rmsError,
+                   exceedanceCounts[i]);
+    if (exceedanceCounts[i] > 0) {
+      fmt::format_to(fmt::appender(buffer), ", \"first_exceedance_time\": {}", firstExceedanceTimes[i]);
+    }
+    buffer.push_back('}');
+    isFirst = false;
+  }
+  buffer.append(std::string_view("\n  },\n"));
+
+  auto appendNames = [&buffer](std::string_view key, const std::vector<std::string>& names) {
+    fmt::format_to(fmt::appender(buffer), "  \"{}\": [", key);
+    for (size_t i = 0; i < names.size(); i++) {
+      buffer.append(std::string_view(i == 0 ? "" : ", "));
+      appendJsonString(buffer, names[i]);
+    }
+    buffer.push_back(']');
+  };
+  appendNames("only_in_baseline", onlyInBaseline);
+  buffer.append(std::string_view(",\n"));
+  appendNames("only_in_file", onlyInRecording);
+  buffer.append(std::string_view("\n}\n"));
+}
+
+void FlightDataRecorderComparison::printSummary() const {
+  size_t differingFields = std::count_if(exceedanceCounts.begin(), exceedanceCounts.end(), [](uint64_t count) { return count > 0; });
+  fmt::print("Compared {} records and {} fields, {} baseline and {} other records without counterpart, {} fields exceed the tolerance\n",
+             comparedRecords, fields.size(), unmatchedBaselineRecords, unmatchedRecords, differingFields);
+  if (hasDivergence) {
+    fmt::print("First divergence at {} s in '{}': baseline {}, value {}\n", divergenceTime,
+               baselineSchema.fields[baselineFields[divergenceField]].name, divergenceBaselineValue, divergenceValue);
+  }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FlightDataRecorderSchema.h"
+
+// compares the records of a recording with the records of a baseline recording at the same simulation time, fields are matched by name
+// so that recordings of different interface versions can be compared as well
+class FlightDataRecorderComparison {
+ public:
+  // a difference is accepted when it is not larger than absolute + relative * max(|baseline|, |value|)
+  struct Tolerance {
+    double absolute = 0.0;
+    double relative = 0.0;
+  };
+
+  FlightDataRecorderComparison(const FlightDataRecorderSchema& baselineSchema,
+                               const FlightDataRecorderSchema& schema,
+                               const Tolerance& defaultTolerance);
+
+  // restricts the comparison to the fields matching the patterns, see selectFlightDataRecorderFields(), resets the tolerances
+  bool selectFields(const std::string& patterns, std::string& unmatchedPattern);
+
+  // sets the tolerance of all fields matching the pattern, returns false when no field matches
+  bool setTolerance(std::string_view pattern, const Tolerance& tolerance);
+
+  // compares two records which belong to the same simulation time
+  void compare(const char* baselineRecord, const char* record);
+
+  // counts a record of one of the recordings without counterpart in the other recording
+  void addUnmatchedRecord(bool isBaseline);
+
+  bool hasDifferences() const;
+
+  // writes the first divergence and the error statistics of all fields with differences as json object
+  void writeJson(fmt::memory_buffer& buffer, std::string_view baselinePath, std::string_view path) const;
+
+  void printSummary() const;
+
+ private:
+  const FlightDataRecorderSchema& baselineSchema;
+  const FlightDataRecorderSchema& schema;
+  const int timeField;
+  const Tolerance defaultTolerance;
+
+  // indices of the compared fields in both schemas, when the schemas are equal the values are compared in place
+  bool isIdentityMapping = false;
+  std::vector<int> baselineFields;
+  std::vector<int> fields;
+  std::vector<std::string> onlyInBaseline;
+  std::vector<std::string> onlyInRecording;
+
+  // decoded records and the compared values in the order of the compared fields
+  std::vector<double> baselineValues;
+  std::vector<double> values;
+  std::vector<double> comparedBaselineValues;
+  std::vector<double> comparedValues;
+
+  // tolerances and statistics per compared field
+  std::vector<double> absoluteTolerances;
+  std::vector<double> relativeTolerances;
+  std::vector<double> maximumErrors;
+  std::vector<double> maximumErrorTimes;
+  std::vector<double> squaredErrorSums;
+  std::vector<uint64_t> exceedanceCounts;
+  std::vector<double> firstExceedanceTimes;
+
+  uint64_t comparedRecords = 0;
+  uint64_t unmatchedBaselineRecords = 0;
+  uint64_t unmatchedRecords = 0;
+
+  bool hasDivergence = false;
+  double divergenceTime = 0.0;
+  int divergenceField = -1;
+  double divergenceBaselineValue = 0.0;
+  double divergenceValue = 0.0;
+
+  void mapFields(const std::vector<int>& candidateBaselineFields);
+};
@@ -1,24 +1,33 @@
 #pragma once
 
 #include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
-#include "AdditionalData.h"
-#include "AutopilotLaws_types.h"
-#include "AutopilotStateMachine_types.h"
-#include "Autothrust_types.h"
-#include "EngineData.h"
+#include "FlightDataRecorderSchema.h"
 
 class FlightDataRecorderConverter {
  public:
-  FlightDataRecorderConverter() = delete;
-  ~FlightDataRecorderConverter() = delete;
-
-  static void writeHeader(std::ofstream& out, const std::string& delimiter);
-  static void writeStruct(std::ofstream& out,
-                          const std::string& delimiter,
-                          const ap_sm_output& ap_sm,
-                          const ap_raw_output& ap_law,
-                          const athr_out& athr,
-                          const EngineData& engine,
-                          const AdditionalData& data);
+  FlightDataRecorderConverter(const FlightDataRecorderSchema& schema, std::string_view delimiter);
+
+  // restricts the output to the fields matching a comma separated list of patterns with * and ?, fields are written in the order of the
+  // patterns, returns false and the pattern when a pattern does not match any field
+  bool selectFields(const std::string& patterns, std::string& unmatchedPattern);
+
+  void writeHeader(fmt::memory_buffer& buffer) const;
+  void writeRecord(fmt::memory_buffer& buffer, const char* record) const;
+
+  static void flush(std::ofstream& out, fmt::memory_buffer& buffer);
+
+ private:
+  struct SelectedField {
+    const FlightDataRecorderField* field;
+    FlightDataRecorderFieldFormatter formatter;
+  };
+
+  const FlightDataRecorderSchema& schema;
+  const std::string delimiter;
+  bool isSelectionActive = false;
+  std::vector<SelectedField> selectedFields;
 };
@@ -0,0 +1,210 @@
+#include "FlightDataRecorderInputStream.h"
+
+#include <cstring>
+#include <thread>
+
+// blocks claiming to be larger are considered corrupt
+static constexpr uint32_t MAXIMUM_BLOCK_SIZE = 64 * 1024 * 1024;
+
+// size of the chunks read from gzip files
+static constexpr size_t GZIP_CHUNK_SIZE = 64 * 1024;
+
+FlightDataRecorderInputStream::FlightDataRecorderInputStream(const std::string& filePath)
+    : FlightDataRecorderInputStream(filePath, std::chrono::milliseconds::zero(), std::chrono::milliseconds::zero(), nullptr) {}
+
+FlightDataRecorderInputStream::FlightDataRecorderInputStream(const std::string& filePath,
+                                                             std::chrono::milliseconds pollInterval,
+                                                             std::chrono::milliseconds idleTimeout,
+                                                             std::function<void()> onWait)
+    : std::istream(nullptr), buffer(filePath, pollInterval, idleTimeout, std::move(onWait)) {
+  rdbuf(&buffer);
+  if (!buffer.isOpen()) {
+    setstate(std::ios::failbit);
+  }
+}
+
+FlightDataRecorderInputStream::Buffer::Buffer(const std::string& filePath,
+                                              std::chrono::milliseconds pollInterval,
+                                              std::chrono::milliseconds idleTimeout,
+                                              std::function<void()> onWait)
+    : filePath(filePath),
+      pollInterval(pollInterval),
+      idleTimeout(idleTimeout),
+      onWait(std::move(onWait)),
+      file(fopen(filePath.c_str(), "rb")),
+      data(GZIP_CHUNK_SIZE) {}
+
+FlightDataRecorderInputStream::Buffer::~Buffer() {
+  if (file != nullptr) {
+    fclose(file);
+  }
+  if (gzipFile != nullptr) {
+    gzclose(gzipFile);
+  }
+  if (zstdContext != nullptr) {
+    ZSTD_freeDCtx(zstdContext);
+  }
+  if (isInflateStreamInitialized) {
+    inflateEnd(&inflateStream);
+  }
+}
+
+std::streambuf::int_type FlightDataRecorderInputStream::Buffer::underflow() {
+  auto idleTime = std::chrono::milliseconds::zero();
+  while (true) {
+    int count = read();
+    if (count > 0) {
+      setg(data.data(), data.data(), data.data() + count);
+      return traits_type::to_int_type(data[0]);
+    }
+    if (count < 0 || idleTime >= idleTimeout) {
+      return traits_type::eof();
+    }
+
+    if (onWait) {
+      onWait();
+    }
+    std::this_thread::sleep_for(pollInterval);
+    idleTime += pollInterval;
+  }
+}
+
+// returns the number of bytes available in data, 0 when no data is available yet and -1 at the end of the data or on errors
+int FlightDataRecorderInputStream::Buffer::read() {
+  if (format == Format::Unknown) {
+    if (file == nullptr || !readPart(&fileHeader, sizeof(fileHeader.magic), fileHeaderProgress)) {
+      return file == nullptr ? -1 : 0;
+    }
+
+    if (std::memcmp(fileHeader.magic, FlightDataRecorderFileHeader::MAGIC, sizeof(fileHeader.magic)) != 0) {
+      // zlib passes files which are not compressed through
+      fclose(file);
+      file = nullptr;
+      gzipFile = gzopen(filePath.c_str(), "rb");
+      if (gzipFile == nullptr) {
+        return -1;
+      }
+      format = Format::Gzip;
+    } else {
+      if (!readPart(&fileHeader, sizeof(fileHeader), fileHeaderProgress)) {
+        return 0;
+      }
+      if (fileHeader.transform != FlightDataRecorderTransform::None) {
+        if (static_cast<uint8_t>(fileHeader.transform) > static_cast<uint8_t>(FlightDataRecorderTransform::XorShuffle)) {
+          return -1;
+        }
+        if (!readPart(&recordLayout, sizeof(recordLayout), recordLayoutProgress)) {
+          return 0;
+        }
+        if (recordLayout.size == 0) {
+          return -1;
+        }
+      }
+      switch (fileHeader.codec) {
+        case FlightDataRecorderCodec::Store:
+          break;
+        case FlightDataRecorderCodec::Fast:
+          zstdContext = ZSTD_createDCtx();
+          if (zstdContext == nullptr) {
+            return -1;
+          }
+          break;
+        case FlightDataRecorderCodec::Deflate:
+          if (inflateInit(&inflateStream) != Z_OK) {
+            return -1;
+          }
+          isInflateStreamInitialized = true;
+          break;
+        default:
+          return -1;
+      }
+      format = Format::Blocks;
+    }
+  }
+
+  return format == Format::Gzip ? readGzip() : readBlock();
+}
+
+int FlightDataRecorderInputStream::Buffer::readGzip() {
+  data.resize(GZIP_CHUNK_SIZE);
+  int count = gzread(gzipFile, data.data(), static_cast<unsigned>(data.size()));
+  if (count > 0) {
+    return count;
+  }
+
+  // reaching the end of a deflate stream which is still being written is reported as buffer error and is not fatal
+  int error = Z_OK;
+  gzerror(gzipFile, &error);
+  if (count < 0 && error != Z_BUF_ERROR) {
+    return -1;
+  }
+
+  // clears the end of file so that the next read looks at the file again
+  gzclearerr(gzipFile);
+  return 0;
+}
+
+int FlightDataRecorderInputStream::Buffer::readBlock() {
+  if (!readPart(&blockHeader, sizeof(blockHeader), blockHeaderProgress)) {
+    return 0;
+  }
+  if (blockHeader.size == 0 || blockHeader.size > MAXIMUM_BLOCK_SIZE || blockHeader.storedSize > blockHeader.size) {
+    return -1;
+  }
+
+  storedBlock.resize(blockHeader.storedSize);
+  if (!readPart(storedBlock.data(), storedBlock.size(), storedBlockProgress)) {
+    return 0;
+  }
+  blockHeaderProgress = 0;
+  storedBlockProgress = 0;
+
+  if (!decodeBlock()) {
+    return -1;
+  }
+
+  if (fileHeader.transform != FlightDataRecorderTransform::None) {
+    size_t firstRecord = getFlightDataRecorderFirstRecord(position, recordLayout);
+    if (firstRecord < data.size()) {
+      size_t count = (data.size() - firstRecord) / recordLayout.size;
+      decodeFlightDataRecorderRecords(data.data() + firstRecord, count, recordLayout.size, fileHeader.transform, transformBuffer);
+    }
+  }
+  position += data.size();
+  return static_cast<int>(data.size());
+}
+
+// reads the missing part of a structure, returns false when the recorder has not written all of it yet
+bool FlightDataRecorderInputStream::Buffer::readPart(void* destination, size_t size, size_t& progress) {
+  progress += fread(static_cast<char*>(destination) + progress, 1, size - progress, file);
+  if (progress < size) {
+    clearerr(file);
+    return false;
+  }
+  return true;
+}
+
+bool FlightDataRecorderInputStream::Buffer::decodeBlock() {
+  // blocks which did not get smaller by compression are stored
+  if (blockHeader.storedSize == blockHeader.size) {
+    data.swap(storedBlock);
+    return true;
+  }
+
+  data.resize(blockHeader.size);
+  switch (fileHeader.codec) {
+    case FlightDataRecorderCodec::Fast: {
+      size_t result = ZSTD_decompressDCtx(zstdContext, data.data(), data.size(), storedBlock.data(), storedBlock.size());
+      return !ZSTD_isError(result) && result == data.size();
+    }
+    case FlightDataRecorderCodec::Deflate:
+      inflateReset(&inflateStream);
+      inflateStream.next_in = reinterpret_cast<Bytef*>(storedBlock.data());
+      inflateStream.avail_in = static_cast<uInt>(storedBlock.size());
+      inflateStream.next_out = reinterpret_cast<Bytef*>(data.data());
+      inflateStream.avail_out = static_cast<uInt>(data.size());
+      return inflate(&inflateStream, Z_FINISH) == Z_STREAM_END && inflateStream.total_out == data.size();
+    default:
+      return false;
+  }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderFile.h"
+
+// input stream over the uncompressed content of a recording, the format is detected from the first bytes: files with a
+// FlightDataRecorderFileHeader consist of blocks compressed with the codec of the header, older recordings are gzip files
+//
+// a recording which is still being written can be followed: at the end of the available data the stream waits for the recorder to
+// write the next block until no data arrived for the idle timeout, without idle timeout the stream ends at the end of the file
+class FlightDataRecorderInputStream : public std::istream {
+ public:
+  explicit FlightDataRecorderInputStream(const std::string& filePath);
+
+  // onWait is called before waiting for more data, e.g. to flush the output written so far
+  FlightDataRecorderInputStream(const std::string& filePath,
+                                std::chrono::milliseconds pollInterval,
+                                std::chrono::milliseconds idleTimeout,
+                                std::function<void()> onWait);
+
+  // aircraft of the file header, unknown before the first read and for recordings without the aircraft in the header
+  FlightDataRecorderAircraft getAircraft() const { return buffer.getAircraft(); }
+
+ private:
+  class Buffer : public std::streambuf {
+   public:
+    Buffer(const std::string& filePath,
+           std::chrono::milliseconds pollInterval,
+           std::chrono::milliseconds idleTimeout,
+           std::function<void()> onWait);
+    ~Buffer() override;
+
+    bool isOpen() const { return file != nullptr; }
+    FlightDataRecorderAircraft getAircraft() const { return fileHeader.aircraft; }
+
+   protected:
+    int_type underflow() override;
+
+   private:
+    enum class Format { Unknown, Gzip, Blocks };
+
+    const std::string filePath;
+    const std::chrono::milliseconds pollInterval;
+    const std::chrono::milliseconds idleTimeout;
+    const std::function<void()> onWait;
+
+    Format format = Format::Unknown;
+    FILE* file = nullptr;
+    gzFile gzipFile = nullptr;
+    FlightDataRecorderFileHeader fileHeader = {};
+    size_t fileHeaderProgress = 0;
+    FlightDataRecorderRecordLayout recordLayout = {};
+    size_t recordLayoutProgress = 0;
+
+    // state of the block being read, the parts of a block which is still being written are kept until it is complete
+    FlightDataRecorderBlockHeader blockHeader = {};
+    size_t blockHeaderProgress = 0;
+    std::vector<char> storedBlock;
+    size_t storedBlockProgress = 0;
+    ZSTD_DCtx* zstdContext = nullptr;
+    z_stream inflateStream = {};
+    bool isInflateStreamInitialized = false;
+
+    // position of the decoded block in the uncompressed stream, needed to find the records to transform back
+    uint64_t position = 0;
+    std::vector<char> transformBuffer;
+
+    std::vector<char> data;
+
+    int read();
+    int readGzip();
+    int readBlock();
+    bool readPart(void* destination, size_t size, size_t& progress);
+    bool decodeBlock();
+  };
+
+  Buffer buffer;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string_view>
+
+#include "fmt/include/fmt/format.h"
+
+// appends the text as quoted json string
+inline void appendJsonString(fmt::memory_buffer& buffer, std::string_view text) {
+  buffer.push_back('"');
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      buffer.push_back('\\');
+      buffer.push_back(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      fmt::format_to(fmt::appender(buffer), "\\u{:04x}", static_cast<unsigned int>(c));
+    } else {
+      buffer.push_back(c);
+    }
+  }
+  buffer.push_back('"');
+}
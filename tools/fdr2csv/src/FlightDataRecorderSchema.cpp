@@ -0,0 +1,120 @@
+#include "FlightDataRecorderSchema.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+
+// defined by the schema translation units in schemas/
+extern const FlightDataRecorderSchema A32NX_V25_SCHEMA;
+extern const FlightDataRecorderSchema A32NX_V26_SCHEMA;
+extern const FlightDataRecorderSchema A380X_V24_SCHEMA;
+extern const FlightDataRecorderSchema A380X_V27_SCHEMA;
+
+// IMPORTANT: a schema needs to be added with every interface change of an aircraft
+static const std::array<const FlightDataRecorderSchema*, 4> SCHEMAS = {
+    &A32NX_V25_SCHEMA,
+    &A32NX_V26_SCHEMA,
+    &A380X_V24_SCHEMA,
+    &A380X_V27_SCHEMA,
+};
+
+std::span<const FlightDataRecorderSchema* const> getFlightDataRecorderSchemas() {
+  return SCHEMAS;
+}
+
+const FlightDataRecorderSchema* findFlightDataRecorderSchema(uint64_t version, const std::string& aircraft) {
+  std::string aircraftUpper = aircraft;
+  std::transform(aircraftUpper.begin(), aircraftUpper.end(), aircraftUpper.begin(), [](unsigned char c) { return std::toupper(c); });
+
+  const FlightDataRecorderSchema* result = nullptr;
+  for (const auto* schema : SCHEMAS) {
+    if (schema->version != version || (!aircraftUpper.empty() && aircraftUpper != schema->aircraft)) {
+      continue;
+    }
+    // older files do not contain the aircraft, a version used by several aircraft needs to be resolved by the user
+    if (result != nullptr) {
+      return nullptr;
+    }
+    result = schema;
+  }
+  return result;
+}
+
+const char* getFlightDataRecorderAircraftName(FlightDataRecorderAircraft aircraft) {
+  switch (aircraft) {
+    case FlightDataRecorderAircraft::A32NX:
+      return "A32NX";
+    case FlightDataRecorderAircraft::A380X:
+      return "A380X";
+    default:
+      return "";
+  }
+}
+
+int findFlightDataRecorderField(const FlightDataRecorderSchema& schema, std::string_view name) {
+  for (size_t i = 0; i < schema.fields.size(); i++) {
+    if (name == schema.fields[i].name) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+bool matchesFlightDataRecorderFieldPattern(std::string_view pattern, std::string_view name) {
+  size_t p = 0;
+  size_t n = 0;
+  size_t starPattern = std::string_view::npos;
+  size_t starName = 0;
+  while (n < name.size()) {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+      p++;
+      n++;
+    } else if (p < pattern.size() && pattern[p] == '*') {
+      starPattern = p++;
+      starName = n;
+    } else if (starPattern != std::string_view::npos) {
+      // let the last star consume one more character
+      p = starPattern + 1;
+      n = ++starName;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*') {
+    p++;
+  }
+  return p == pattern.size();
+}
+
+bool selectFlightDataRecorderFields(const FlightDataRecorderSchema& schema,
+                                    const std::string& patterns,
+                                    std::vector<int>& fields,
+                                    std::string& unmatchedPattern) {
+  fields.clear();
+  std::vector<bool> isSelected(schema.fields.size(), false);
+  size_t start = 0;
+  while (start <= patterns.size()) {
+    size_t end = std::min(patterns.find(',', start), patterns.size());
+    std::string_view pattern = std::string_view(patterns).substr(start, end - start);
+    start = end + 1;
+    if (pattern.empty()) {
+      continue;
+    }
+
+    bool hasMatch = false;
+    for (size_t i = 0; i < schema.fields.size(); i++) {
+      if (matchesFlightDataRecorderFieldPattern(pattern, schema.fields[i].name)) {
+        hasMatch = true;
+        if (!isSelected[i]) {
+          isSelected[i] = true;
+          fields.push_back(static_cast<int>(i));
+        }
+      }
+    }
+    if (!hasMatch) {
+      unmatchedPattern = pattern;
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "FlightDataRecorderFile.h"
+#include "fmt/include/fmt/format.h"
+
+// storage type of a single field within a record
+enum class FlightDataRecorderFieldType {
+  Bool,
+  Int8,
+  UInt8,
+  Int16,
+  UInt16,
+  Int32,
+  UInt32,
+  Int64,
+  UInt64,
+  Float32,
+  Float64,
+};
+
+// how a field is printed, unsigned truncates the value to an unsigned integer
+enum class FlightDataRecorderFieldFormat {
+  Value,
+  Unsigned,
+};
+
+struct FlightDataRecorderField {
+  const char* name;
+  size_t offset;
+  FlightDataRecorderFieldType type;
+  FlightDataRecorderFieldFormat format;
+};
+
+// layout of the records of one aircraft and interface version, records are the parts written by the recorder without padding
+struct FlightDataRecorderSchema {
+  const char* aircraft;
+  uint64_t version;
+  size_t recordSize;
+  std::span<const FlightDataRecorderField> fields;
+  // formats one record as a delimited line, generated at compile time from the field table
+  void (*formatRecord)(fmt::memory_buffer& buffer, const char* record, std::string_view delimiter);
+  // converts all fields of one record to doubles in the order of the field table
+  void (*decodeRecord)(const char* record, double* values);
+};
+
+// returns all known schemas
+std::span<const FlightDataRecorderSchema* const> getFlightDataRecorderSchemas();
+
+// returns the schema for the version, the aircraft is only needed when several aircraft share the version
+const FlightDataRecorderSchema* findFlightDataRecorderSchema(uint64_t version, const std::string& aircraft);
+
+// returns the aircraft name used by the schemas, empty when the aircraft is unknown
+const char* getFlightDataRecorderAircraftName(FlightDataRecorderAircraft aircraft);
+
+// returns the index of the field in the schema or -1 when the schema does not contain it
+int findFlightDataRecorderField(const FlightDataRecorderSchema& schema, std::string_view name);
+
+// matches a field name against a pattern in which * and ? match any characters
+bool matchesFlightDataRecorderFieldPattern(std::string_view pattern, std::string_view name);
+
+// returns the indices of the fields matching a comma separated list of patterns in the order of the patterns, returns false and the
+// pattern when a pattern does not match any field
+bool selectFlightDataRecorderFields(const FlightDataRecorderSchema& schema,
+                                    const std::string& patterns,
+                                    std::vector<int>& fields,
+                                    std::string& unmatchedPattern);
+
+template <typename T>
+constexpr FlightDataRecorderFieldType flightDataRecorderFieldType() {
+  if constexpr (std::is_enum_v<T>) {
+    return flightDataRecorderFieldType<std::underlying_type_t<T>>();
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return FlightDataRecorderFieldType::Bool;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return FlightDataRecorderFieldType::Float32;
+  } else if constexpr (std::is_same_v<T, double>) {
+    return FlightDataRecorderFieldType::Float64;
+  } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "unsupported integer size");
+    if constexpr (sizeof(T) == 1) {
+      return FlightDataRecorderFieldType::Int8;
+    } else if constexpr (sizeof(T) == 2) {
+      return FlightDataRecorderFieldType::Int16;
+    } else if constexpr (sizeof(T) == 4) {
+      return FlightDataRecorderFieldType::Int32;
+    } else {
+      return FlightDataRecorderFieldType::Int64;
+    }
+  } else {
+    static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>, "unsupported field type");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "unsupported integer size");
+    if constexpr (sizeof(T) == 1) {
+      return FlightDataRecorderFieldType::UInt8;
+    } else if constexpr (sizeof(T) == 2) {
+      return FlightDataRecorderFieldType::UInt16;
+    } else if constexpr (sizeof(T) == 4) {
+      return FlightDataRecorderFieldType::UInt32;
+    } else {
+      return FlightDataRecorderFieldType::UInt64;
+    }
+  }
+}
+
+template <FlightDataRecorderFieldType Type>
+struct FlightDataRecorderFieldStorage;
+
+#define FDR_FIELD_STORAGE(fieldType, storageType)                                 \
+  template <>                                                                     \
+  struct FlightDataRecorderFieldStorage<FlightDataRecorderFieldType::fieldType> { \
+    using type = storageType;                                                     \
+  }
+
+FDR_FIELD_STORAGE(Bool, bool);
+FDR_FIELD_STORAGE(Int8, int8_t);
+FDR_FIELD_STORAGE(UInt8, uint8_t);
+FDR_FIELD_STORAGE(Int16, int16_t);
+FDR_FIELD_STORAGE(UInt16, uint16_t);
+FDR_FIELD_STORAGE(Int32, int32_t);
+FDR_FIELD_STORAGE(UInt32, uint32_t);
+FDR_FIELD_STORAGE(Int64, int64_t);
+FDR_FIELD_STORAGE(UInt64, uint64_t);
+FDR_FIELD_STORAGE(Float32, float);
+FDR_FIELD_STORAGE(Float64, double);
+
+#undef FDR_FIELD_STORAGE
+
+// size of a field in the record
+constexpr size_t flightDataRecorderFieldSize(FlightDataRecorderFieldType type) {
+  switch (type) {
+    case FlightDataRecorderFieldType::Bool:
+    case FlightDataRecorderFieldType::Int8:
+    case FlightDataRecorderFieldType::UInt8:
+      return 1;
+    case FlightDataRecorderFieldType::Int16:
+    case FlightDataRecorderFieldType::UInt16:
+      return 2;
+    case FlightDataRecorderFieldType::Int32:
+    case FlightDataRecorderFieldType::UInt32:
+    case FlightDataRecorderFieldType::Float32:
+      return 4;
+    default:
+      return 8;
+  }
+}
+
+// reads a field from the record, records are packed so the field may not be aligned
+template <FlightDataRecorderFieldType Type>
+inline typename FlightDataRecorderFieldStorage<Type>::type readFlightDataRecorderField(const char* record, size_t offset) {
+  typename FlightDataRecorderFieldStorage<Type>::type value;
+  std::memcpy(&value, record + offset, sizeof(value));
+  return value;
+}
+
+// formats a single field of a record followed by the delimiter
+template <FlightDataRecorderFieldType Type, FlightDataRecorderFieldFormat Format>
+inline void formatFlightDataRecorderField(fmt::memory_buffer& buffer, const char* record, size_t offset, std::string_view delimiter) {
+  auto value = readFlightDataRecorderField<Type>(record, offset);
+  if constexpr (Format == FlightDataRecorderFieldFormat::Unsigned) {
+    fmt::format_to(fmt::appender(buffer), FMT_STRING("{}"), static_cast<unsigned int>(value));
+  } else {
+    fmt::format_to(fmt::appender(buffer), FMT_STRING("{}"), value);
+  }
+  buffer.append(delimiter);
+}
+
+// calls the visitor with the field type as compile time constant
+template <typename Visitor>
+inline auto visitFlightDataRecorderFieldType(FlightDataRecorderFieldType type, Visitor&& visitor) {
+  using Type = FlightDataRecorderFieldType;
+  switch (type) {
+    case Type::Bool:
+      return visitor(std::integral_constant<Type, Type::Bool>{});
+    case Type::Int8:
+      return visitor(std::integral_constant<Type, Type::Int8>{});
+    case Type::UInt8:
+      return visitor(std::integral_constant<Type, Type::UInt8>{});
+    case Type::Int16:
+      return visitor(std::integral_constant<Type, Type::Int16>{});
+    case Type::UInt16:
+      return visitor(std::integral_constant<Type, Type::UInt16>{});
+    case Type::Int32:
+      return visitor(std::integral_constant<Type, Type::Int32>{});
+    case Type::UInt32:
+      return visitor(std::integral_constant<Type, Type::UInt32>{});
+    case Type::Int64:
+      return visitor(std::integral_constant<Type, Type::Int64>{});
+    case Type::UInt64:
+      return visitor(std::integral_constant<Type, Type::UInt64>{});
+    case Type::Float32:
+      return visitor(std::integral_constant<Type, Type::Float32>{});
+    default:
+      return visitor(std::integral_constant<Type, Type::Float64>{});
+  }
+}
+
+// reads a single field of a record as double
+inline double readFlightDataRecorderFieldValue(const char* record, const FlightDataRecorderField& field) {
+  return visitFlightDataRecorderFieldType(field.type, [&](auto type) {
+    return static_cast<double>(readFlightDataRecorderField<decltype(type)::value>(record, field.offset));
+  });
+}
+
+using FlightDataRecorderFieldFormatter = void (*)(fmt::memory_buffer& buffer, const char* record, size_t offset, std::string_view delimiter);
+
+// returns the routine formatting the field, used when only some fields of a record are printed
+inline FlightDataRecorderFieldFormatter getFlightDataRecorderFieldFormatter(const FlightDataRecorderField& field) {
+  return visitFlightDataRecorderFieldType(field.type, [&](auto type) -> FlightDataRecorderFieldFormatter {
+    if (field.format == FlightDataRecorderFieldFormat::Unsigned) {
+      return &formatFlightDataRecorderField<decltype(type)::value, FlightDataRecorderFieldFormat::Unsigned>;
+    }
+    return &formatFlightDataRecorderField<decltype(type)::value, FlightDataRecorderFieldFormat::Value>;
+  });
+}
+
+// formats a record with a routine unrolled over the field table, so no per field dispatch remains at runtime
+template <const auto& Fields>
+void formatFlightDataRecorderRecord(fmt::memory_buffer& buffer, const char* record, std::string_view delimiter) {
+  [&]<size_t... Index>(std::index_sequence<Index...>) {
+    (formatFlightDataRecorderField<Fields[Index].type, Fields[Index].format>(buffer, record, Fields[Index].offset, delimiter), ...);
+  }(std::make_index_sequence<std::size(Fields)>{});
+  buffer.push_back('\n');
+}
+
+// decodes a record with a routine unrolled over the field table
+template <const auto& Fields>
+void decodeFlightDataRecorderRecord(const char* record, double* values) {
+  [&]<size_t... Index>(std::index_sequence<Index...>) {
+    ((values[Index] = static_cast<double>(readFlightDataRecorderField<Fields[Index].type>(record, Fields[Index].offset))), ...);
+  }(std::make_index_sequence<std::size(Fields)>{});
+}
+
+// checks that every field lies within the record
+constexpr bool flightDataRecorderFieldsFit(std::span<const FlightDataRecorderField> fields, size_t recordSize) {
+  for (const auto& field : fields) {
+    if (field.offset + flightDataRecorderFieldSize(field.type) > recordSize) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// returns the first fields of a table, used for older versions whose records are a prefix of the current records
+template <size_t Count, size_t Size>
+constexpr std::array<FlightDataRecorderField, Count> firstFlightDataRecorderFields(const FlightDataRecorderField (&fields)[Size]) {
+  static_assert(Count <= Size, "more fields than in the table");
+  std::array<FlightDataRecorderField, Count> result = {};
+  for (size_t i = 0; i < Count; i++) {
+    result[i] = fields[i];
+  }
+  return result;
+}
+
+// describes a member of a part of the record, the name is the path of the member prefixed by the name of the part
+#define FDR_FIELD(part, type, partOffset, member, format)                                                                          \
+  FlightDataRecorderField {                                                                                                        \
+    part "." #member, (partOffset) + offsetof(type, member), flightDataRecorderFieldType<decltype(std::declval<type>().member)>(), \
+        FlightDataRecorderFieldFormat::format                                                                                      \
+  }
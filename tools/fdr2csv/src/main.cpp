@@ -1,37 +1,429 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
-#include "AdditionalData.h"
-#include "AutopilotLaws_types.h"
-#include "AutopilotStateMachine_types.h"
-#include "Autothrust_types.h"
-#include "EngineData.h"
+#include "FlightDataRecorderAnalysis.h"
+#include "FlightDataRecorderComparison.h"
 #include "FlightDataRecorderConverter.h"
+#include "FlightDataRecorderInputStream.h"
+#include "FlightDataRecorderSchema.h"
 #include "commandline/CommandLine.hpp"
 #include "fmt/include/fmt/core.h"
-#include "zfstream.h"
 
-// IMPORTANT: this constant needs to increased with every interface change
-const uint64_t INTERFACE_VERSION = 25;
+// the output is written in chunks of this size
+const size_t OUTPUT_BUFFER_SIZE = 1024 * 1024;
+
+// a followed recording is checked for new data in this interval, the recorder flushes its file once per second by default
+const std::chrono::milliseconds FOLLOW_POLL_INTERVAL(100);
+
+// records of two recordings belong to the same step when their simulation times differ by less than this
+const double TIME_ALIGNMENT_TOLERANCE = 1e-6;
+
+struct Options {
+  std::string delimiter;
+  std::string aircraft;
+  bool noCompression;
+  bool statistics;
+  FlightDataRecorderAnalysis::Limits limits;
+  std::string fields;
+  double fromTime;
+  double toTime;
+  std::string baselineFilePath;
+  FlightDataRecorderComparison::Tolerance tolerance;
+  std::string tolerancesFilePath;
+  bool follow;
+  double followTimeout;
+};
+
+// messages of files processed in parallel must not interleave
+static std::mutex printMutex;
+
+template <typename... Args>
+static void printMessage(fmt::format_string<Args...> format, Args&&... args) {
+  std::lock_guard<std::mutex> lock(printMutex);
+  fmt::print(format, std::forward<Args>(args)...);
+}
+
+// opens a recording and selects the schema of its interface version, errors are printed
+static std::unique_ptr<std::istream> openRecording(const Options& options,
+                                                   const std::string& filePath,
+                                                   const FlightDataRecorderSchema*& schema,
+                                                   std::function<void()> onWait = nullptr) {
+  // create input stream, the codec is detected from the file
+  std::unique_ptr<std::istream> in;
+  FlightDataRecorderInputStream* recording = nullptr;
+  if (options.follow) {
+    auto idleTimeout = std::chrono::milliseconds(static_cast<int64_t>(options.followTimeout * 1000.0));
+    in = std::make_unique<FlightDataRecorderInputStream>(filePath, FOLLOW_POLL_INTERVAL, idleTimeout, std::move(onWait));
+    recording = static_cast<FlightDataRecorderInputStream*>(in.get());
+  } else if (!options.noCompression) {
+    in = std::make_unique<FlightDataRecorderInputStream>(filePath);
+    recording = static_cast<FlightDataRecorderInputStream*>(in.get());
+  } else {
+    in = std::make_unique<std::ifstream>(filePath.c_str(), std::ios::in | std::ios::binary);
+  }
+
+  // check if stream is ok
+  if (!in->good()) {
+    printMessage("Failed to open input file '{}'!\n", filePath);
+    return nullptr;
+  }
+
+  // read file version
+  uint64_t fileFormatVersion = {};
+  in->read(reinterpret_cast<char*>(&fileFormatVersion), sizeof(fileFormatVersion));
+
+  // select the schema of the file, the aircraft of the file header is used unless the aircraft is given
+  std::string aircraft = options.aircraft;
+  if (aircraft.empty() && recording != nullptr) {
+    aircraft = getFlightDataRecorderAircraftName(recording->getAircraft());
+  }
+  schema = findFlightDataRecorderSchema(fileFormatVersion, aircraft);
+  if (schema == nullptr) {
+    std::lock_guard<std::mutex> lock(printMutex);
+    fmt::print("ERROR: no unique schema for interface version {} and aircraft '{}' in '{}', supported are:\n", fileFormatVersion,
+               aircraft, filePath);
+    for (const auto* supported : getFlightDataRecorderSchemas()) {
+      fmt::print("  {} version {}\n", supported->aircraft, supported->version);
+    }
+    return nullptr;
+  }
+  return in;
+}
+
+// converts a single file into csv or a json summary, progress is only printed when a single file is processed
+static int processFile(const Options& options, const std::string& inFilePath, const std::string& outFilePath, bool isBatch) {
+  // when following a recording the output written so far is flushed whenever the recorder has not written new data yet
+  std::function<void()> flushOutput;
+  const FlightDataRecorderSchema* schema = nullptr;
+  auto in = openRecording(options, inFilePath, schema, [&flushOutput]() {
+    if (flushOutput) {
+      flushOutput();
+    }
+  });
+  if (!in) {
+    return 1;
+  }
+
+  // print information on convert
+  if (!isBatch) {
+    fmt::print("{} from '{}' to '{}' with aircraft '{}', interface version '{}' and delimiter '{}'\n",
+               options.statistics ? "Analysing" : "Converting", inFilePath, outFilePath, schema->aircraft, schema->version,
+               options.delimiter);
+  }
+
+  // select the fields to convert
+  FlightDataRecorderConverter converter(*schema, options.delimiter);
+  std::string unmatchedPattern;
+  if (!options.fields.empty() && !converter.selectFields(options.fields, unmatchedPattern)) {
+    printMessage("ERROR: no field matches '{}'!\n", unmatchedPattern);
+    return 1;
+  }
+
+  // the time window is checked on the raw record before anything is formatted
+  bool isWindowActive = options.fromTime > -std::numeric_limits<double>::infinity() ||
+                        options.toTime < std::numeric_limits<double>::infinity();
+  int timeField = findFlightDataRecorderField(*schema, "ap_sm.time.simulation_time");
+  if (isWindowActive && timeField < 0) {
+    printMessage("ERROR: schema does not contain the simulation time!\n");
+    return 1;
+  }
+
+  // output stream
+  std::ofstream out;
+  // open the output file
+  out.open(outFilePath, std::ios::out | std::ios::trunc);
+  // check if file is open
+  if (!out.is_open()) {
+    printMessage("Failed to create output file '{}'!\n", outFilePath);
+    return 1;
+  }
+
+  // write header
+  fmt::memory_buffer buffer;
+  std::unique_ptr<FlightDataRecorderAnalysis> analysis;
+  if (options.statistics) {
+    analysis = std::make_unique<FlightDataRecorderAnalysis>(*schema, options.limits);
+  } else {
+    converter.writeHeader(buffer);
+    flushOutput = [&out, &buffer]() {
+      FlightDataRecorderConverter::flush(out, buffer);
+      out.flush();
+    };
+  }
+
+  // calculate number of entries
+  auto counter = 0;
+
+  // buffer for reading a record
+  std::vector<char> record(schema->recordSize);
+
+  // read one record from the file, a partial record at the end of the file is ignored
+  while (in->read(record.data(), static_cast<std::streamsize>(record.size()))) {
+    if (isWindowActive) {
+      double time = readFlightDataRecorderFieldValue(record.data(), schema->fields[timeField]);
+      if (time < options.fromTime) {
+        continue;
+      }
+      // the simulation time is monotonic within a recording, the remaining records are not read
+      if (time > options.toTime) {
+        break;
+      }
+    }
+
+    if (analysis) {
+      analysis->process(record.data());
+    } else {
+      // write record to csv file
+      converter.writeRecord(buffer, record.data());
+      if (buffer.size() >= OUTPUT_BUFFER_SIZE) {
+        FlightDataRecorderConverter::flush(out, buffer);
+      }
+    }
+    // print progress
+    if (++counter % 1000 == 0 && !isBatch) {
+      fmt::print("Processed {} entries...\r", counter);
+    }
+  }
+  if (analysis) {
+    analysis->writeJson(buffer, inFilePath);
+  }
+  FlightDataRecorderConverter::flush(out, buffer);
+
+  // print final value
+  if (isBatch) {
+    printMessage("Processed {} entries of '{}'\n", counter, inFilePath);
+  } else {
+    fmt::print("Processed {} entries...\n", counter);
+  }
+
+  // success
+  return 0;
+}
+
+// reads the per field tolerances, each line holds a field pattern, the absolute and optionally the relative tolerance
+static bool readTolerances(const std::string& filePath, FlightDataRecorderComparison& comparison) {
+  std::ifstream file(filePath);
+  if (!file.is_open()) {
+    fmt::print("Failed to open tolerance file '{}'!\n", filePath);
+    return false;
+  }
+
+  std::string line;
+  for (int lineNumber = 1; std::getline(file, line); lineNumber++) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream stream(line);
+    std::string pattern;
+    if (!(stream >> pattern)) {
+      continue;
+    }
+
+    FlightDataRecorderComparison::Tolerance tolerance;
+    if (!(stream >> tolerance.absolute)) {
+      fmt::print("ERROR: missing absolute tolerance in line {} of '{}'!\n", lineNumber, filePath);
+      return false;
+    }
+    stream >> tolerance.relative;
+    if (!comparison.setTolerance(pattern, tolerance)) {
+      fmt::print("ERROR: no compared field matches '{}' in line {} of '{}'!\n", pattern, lineNumber, filePath);
+      return false;
+    }
+  }
+  return true;
+}
+
+// compares a recording with a baseline recording step by step and writes the differences as json, returns 2 when they differ
+static int compareFiles(const Options& options, const std::string& inFilePath, const std::string& outFilePath) {
+  const FlightDataRecorderSchema* baselineSchema = nullptr;
+  const FlightDataRecorderSchema* schema = nullptr;
+  auto baselineIn = openRecording(options, options.baselineFilePath, baselineSchema);
+  if (!baselineIn) {
+    return 1;
+  }
+  auto in = openRecording(options, inFilePath, schema);
+  if (!in) {
+    return 1;
+  }
+
+  // the records are aligned by simulation time
+  int baselineTimeField = findFlightDataRecorderField(*baselineSchema, "ap_sm.time.simulation_time");
+  int timeField = findFlightDataRecorderField(*schema, "ap_sm.time.simulation_time");
+  if (baselineTimeField < 0 || timeField < 0) {
+    fmt::print("ERROR: schema does not contain the simulation time!\n");
+    return 1;
+  }
+
+  fmt::print("Comparing '{}' ({} version {}) with baseline '{}' ({} version {}) to '{}'\n", inFilePath, schema->aircraft, schema->version,
+             options.baselineFilePath, baselineSchema->aircraft, baselineSchema->version, outFilePath);
+
+  FlightDataRecorderComparison comparison(*baselineSchema, *schema, options.tolerance);
+  std::string unmatchedPattern;
+  if (!options.fields.empty() && !comparison.selectFields(options.fields, unmatchedPattern)) {
+    fmt::print("ERROR: no field matches '{}'!\n", unmatchedPattern);
+    return 1;
+  }
+  if (!options.tolerancesFilePath.empty() && !readTolerances(options.tolerancesFilePath, comparison)) {
+    return 1;
+  }
+
+  std::ofstream out(outFilePath, std::ios::out | std::ios::trunc);
+  if (!out.is_open()) {
+    fmt::print("Failed to create output file '{}'!\n", outFilePath);
+    return 1;
+  }
+
+  // reads the next record within the time window, returns false at the end of the window or of the recording
+  auto readRecord = [&options](std::istream& stream, const FlightDataRecorderSchema& recordSchema, int recordTimeField,
+                               std::vector<char>& record, double& time) {
+    while (stream.read(record.data(), static_cast<std::streamsize>(record.size()))) {
+      time = readFlightDataRecorderFieldValue(record.data(), recordSchema.fields[recordTimeField]);
+      if (time > options.toTime) {
+        return false;
+      }
+      if (time >= options.fromTime) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  std::vector<char> baselineRecord(baselineSchema->recordSize);
+  std::vector<char> record(schema->recordSize);
+  double baselineTime = 0.0;
+  double time = 0.0;
+  bool hasBaselineRecord = readRecord(*baselineIn, *baselineSchema, baselineTimeField, baselineRecord, baselineTime);
+  bool hasRecord = readRecord(*in, *schema, timeField, record, time);
+
+  // both recordings are monotonic in time, the one which is behind advances until the times match again
+  auto counter = 0;
+  while (hasBaselineRecord && hasRecord) {
+    if (std::abs(baselineTime - time) <= TIME_ALIGNMENT_TOLERANCE) {
+      comparison.compare(baselineRecord.data(), record.data());
+      hasBaselineRecord = readRecord(*baselineIn, *baselineSchema, baselineTimeField, baselineRecord, baselineTime);
+      hasRecord = readRecord(*in, *schema, timeField, record, time);
+    } else if (baselineTime < time) {
+      comparison.addUnmatchedRecord(true);
+      hasBaselineRecord = readRecord(*baselineIn, *baselineSchema, baselineTimeField, baselineRecord, baselineTime);
+    } else {
+      comparison.addUnmatchedRecord(false);
+      hasRecord = readRecord(*in, *schema, timeField, record, time);
+    }
+    if (++counter % 1000 == 0) {
+      fmt::print("Processed {} entries...\r", counter);
+    }
+  }
+  fmt::print("Processed {} entries...\n", counter);
+  for (; hasBaselineRecord; hasBaselineRecord = readRecord(*baselineIn, *baselineSchema, baselineTimeField, baselineRecord, baselineTime)) {
+    comparison.addUnmatchedRecord(true);
+  }
+  for (; hasRecord; hasRecord = readRecord(*in, *schema, timeField, record, time)) {
+    comparison.addUnmatchedRecord(false);
+  }
+
+  fmt::memory_buffer buffer;
+  comparison.writeJson(buffer, options.baselineFilePath, inFilePath);
+  FlightDataRecorderConverter::flush(out, buffer);
+  comparison.printSummary();
+
+  return comparison.hasDifferences() ? 2 : 0;
+}
+
+// processes all fdr files of a directory in parallel, the outputs are named after the inputs
+static int processDirectory(const Options& options, const std::string& inDirectory, const std::string& outDirectory, int jobs) {
+  std::vector<std::filesystem::path> files;
+  for (const auto& entry : std::filesystem::directory_iterator(inDirectory)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".fdr") {
+      files.push_back(entry.path());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  std::error_code error;
+  std::filesystem::create_directories(outDirectory, error);
+  if (error) {
+    fmt::print("Failed to create output directory!\n");
+    return 1;
+  }
+
+  if (jobs <= 0) {
+    jobs = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  }
+  fmt::print("{} {} files from '{}' to '{}' with {} jobs\n", options.statistics ? "Analysing" : "Converting", files.size(), inDirectory,
+             outDirectory, jobs);
+
+  std::atomic<size_t> next = 0;
+  std::atomic<int> failures = 0;
+  auto worker = [&]() {
+    for (size_t i = next++; i < files.size(); i = next++) {
+      auto outFile = std::filesystem::path(outDirectory) / files[i].stem();
+      outFile += options.statistics ? ".json" : ".csv";
+      if (processFile(options, files[i].string(), outFile.string(), true) != 0) {
+        failures++;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < std::min<int>(jobs, static_cast<int>(files.size())); i++) {
+    threads.emplace_back(worker);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (failures > 0) {
+    fmt::print("Failed to process {} of {} files\n", failures.load(), files.size());
+    return 1;
+  }
+  return 0;
+}
 
 int main(int argc, char* argv[]) {
   // variables for command line parameters
   std::string inFilePath;
   std::string outFilePath;
-  std::string delimiter = ",";
-  bool noCompression = false;
+  Options options = {",", "", false, false, {}, "", -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(),
+                     "", {}, "", false, 10.0};
+  int32_t jobs = 0;
   bool printStructSize = false;
   bool printGetFileInterfaceVersion = false;
+  bool printSchemas = false;
   bool oPrintHelp = false;
 
   // configuration of command line parameters
-  CommandLine args("Converts a32nx fdr files to csv");
-  args.addArgument({"-i", "--in"}, &inFilePath, "Input File");
-  args.addArgument({"-o", "--out"}, &outFilePath, "Output File");
-  args.addArgument({"-d", "--delimiter"}, &delimiter, "Delimiter");
-  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input file is not compressed");
+  CommandLine args("Converts A32NX and A380X fdr files to csv or analyses them");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Input File, or directory to process all fdr files in it");
+  args.addArgument({"-o", "--out"}, &outFilePath, "Output File, or directory when the input is a directory");
+  args.addArgument({"-d", "--delimiter"}, &options.delimiter, "Delimiter");
+  args.addArgument({"-n", "--no-compression"}, &options.noCompression, "Input file is not compressed");
   args.addArgument({"-p", "--print-struct-size"}, &printStructSize, "Print struct size");
   args.addArgument({"-g", "--get-input-file-version"}, &printGetFileInterfaceVersion, "Print interface version of input file");
+  args.addArgument({"-a", "--aircraft"}, &options.aircraft, "Aircraft of the input file, only needed for older files when the version is ambiguous");
+  args.addArgument({"-l", "--list-schemas"}, &printSchemas, "Print the supported aircraft and interface versions");
+  args.addArgument({"-s", "--statistics"}, &options.statistics, "Write field statistics and events as json instead of csv");
+  args.addArgument({"--nz-max"}, &options.limits.nzMax, "Upper load factor limit for exceedance events");
+  args.addArgument({"--nz-min"}, &options.limits.nzMin, "Lower load factor limit for exceedance events");
+  args.addArgument({"--bank-max"}, &options.limits.bankMax, "Bank angle limit in degrees for exceedance events");
+  args.addArgument({"-f", "--fields"}, &options.fields, "Comma separated fields to convert, * and ? match any characters");
+  args.addArgument({"--from"}, &options.fromTime, "Simulation time of the first record to process");
+  args.addArgument({"--to"}, &options.toTime, "Simulation time of the last record to process");
+  args.addArgument({"-c", "--compare"}, &options.baselineFilePath,
+                   "Baseline file to compare the input with, writes the differences as json and exits with 2 when they differ");
+  args.addArgument({"--abs-tolerance"}, &options.tolerance.absolute, "Absolute tolerance of the comparison");
+  args.addArgument({"--rel-tolerance"}, &options.tolerance.relative, "Relative tolerance of the comparison");
+  args.addArgument({"--tolerances"}, &options.tolerancesFilePath, "File with lines of field pattern, absolute and relative tolerance");
+  args.addArgument({"--follow"}, &options.follow, "Follow a recording which is still being written and process new records as they arrive");
+  args.addArgument({"--follow-timeout"}, &options.followTimeout, "Seconds without new records after which following ends");
+  args.addArgument({"-j", "--jobs"}, &jobs, "Number of files processed in parallel, all cores by default");
   args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
 
   // parse command line
@@ -49,6 +441,15 @@ int main(int argc, char* argv[]) {
     return 0;
   }
 
+  // print supported schemas
+  if (printSchemas) {
+    for (const auto* schema : getFlightDataRecorderSchemas()) {
+      fmt::print("{} version {}: {} fields, {} bytes per record\n", schema->aircraft, schema->version, schema->fields.size(),
+                 schema->recordSize);
+    }
+    return 0;
+  }
+
   // check parameters
   if (inFilePath.empty()) {
     fmt::print("Input file parameter missing!\n");
@@ -63,79 +464,35 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  // create input stream
-  std::unique_ptr<std::istream> in;
-  if (!noCompression) {
-    in = std::make_unique<gzifstream>(inFilePath.c_str());
-  } else {
-    in = std::make_unique<std::ifstream>(inFilePath.c_str(), std::ios::in | std::ios::binary);
-  }
-
-  // check if stream is ok
-  if (!in->good()) {
-    fmt::print("Failed to open input file!\n");
-    return 1;
-  }
-
-  // read file version
-  uint64_t fileFormatVersion = {};
-  in->read(reinterpret_cast<char*>(&fileFormatVersion), sizeof(INTERFACE_VERSION));
-
   // print file version if requested and return
   if (printGetFileInterfaceVersion) {
+    std::unique_ptr<std::istream> in;
+    if (!options.noCompression) {
+      in = std::make_unique<FlightDataRecorderInputStream>(inFilePath);
+    } else {
+      in = std::make_unique<std::ifstream>(inFilePath.c_str(), std::ios::in | std::ios::binary);
+    }
+    uint64_t fileFormatVersion = {};
+    in->read(reinterpret_cast<char*>(&fileFormatVersion), sizeof(fileFormatVersion));
     std::cout << fileFormatVersion << std::endl;
     return 0;
-  } else if (INTERFACE_VERSION != fileFormatVersion) {
-    fmt::print("ERROR: mismatch between converter and file version (expected {}, got {})\n", INTERFACE_VERSION, fileFormatVersion);
-    return 1;
   }
 
-  // print information on convert
-  fmt::print("Converting from '{}' to '{}' with interface version '{}' and delimiter '{}'\n", inFilePath, outFilePath, fileFormatVersion,
-             delimiter);
-
-  // output stream
-  std::ofstream out;
-  // open the output file
-  out.open(outFilePath, std::ios::out | std::ios::trunc);
-  // check if file is open
-  if (!out.is_open()) {
-    fmt::print("Failed to create output file!\n");
+  if (options.follow && (!options.baselineFilePath.empty() || std::filesystem::is_directory(inFilePath))) {
+    fmt::print("Only a single file can be followed!\n");
     return 1;
   }
 
-  // write header
-  FlightDataRecorderConverter::writeHeader(out, delimiter);
-
-  // calculate number of entries
-  auto counter = 0;
-
-  // struct for reading
-  ap_sm_output data_ap_sm = {};
-  ap_raw_output data_ap_laws = {};
-  athr_out data_athr = {};
-  EngineData data_engine = {};
-  AdditionalData data_additional = {};
-
-  // read one struct from the file
-  while (!in->eof()) {
-    // read data into structs
-    in->read(reinterpret_cast<char*>(&data_ap_sm), sizeof(ap_sm_output));
-    in->read(reinterpret_cast<char*>(&data_ap_laws), sizeof(ap_raw_output));
-    in->read(reinterpret_cast<char*>(&data_athr), sizeof(athr_out));
-    in->read(reinterpret_cast<char*>(&data_engine), sizeof(EngineData));
-    in->read(reinterpret_cast<char*>(&data_additional), sizeof(AdditionalData));
-    // write struct to csv file
-    FlightDataRecorderConverter::writeStruct(out, delimiter, data_ap_sm, data_ap_laws, data_athr, data_engine, data_additional);
-    // print progress
-    if (++counter % 1000 == 0) {
-      fmt::print("Processed {} entries...\r", counter);
+  if (!options.baselineFilePath.empty()) {
+    if (!std::filesystem::is_regular_file(options.baselineFilePath) || std::filesystem::is_directory(inFilePath)) {
+      fmt::print("Comparison needs a baseline file and an input file!\n");
+      return 1;
     }
+    return compareFiles(options, inFilePath, outFilePath);
   }
 
-  // print final value
-  fmt::print("Processed {} entries...\n", counter);
-
-  // success
-  return 0;
+  if (std::filesystem::is_directory(inFilePath)) {
+    return processDirectory(options, inFilePath, outFilePath, jobs);
+  }
+  return processFile(options, inFilePath, outFilePath, false);
 }
@@ -0,0 +1,520 @@
+#include "FlightDataRecorderSchema.h"
+
+#include "AdditionalData.h"
+#include "AutopilotLaws_types.h"
+#include "AutopilotStateMachine_types.h"
+#include "Autothrust_types.h"
+#include "EngineData.h"
+#include "FlightDataRecorderSampler.h"
+
+// A32NX records as written by the FlightDataRecorder with interface version 26, version 25 records end before the sampling
+namespace {
+
+constexpr size_t AP_SM_OFFSET = 0;
+constexpr size_t AP_LAW_OFFSET = AP_SM_OFFSET + sizeof(ap_sm_output);
+constexpr size_t ATHR_OFFSET = AP_LAW_OFFSET + sizeof(ap_raw_output);
+constexpr size_t ENGINE_OFFSET = ATHR_OFFSET + sizeof(athr_out);
+constexpr size_t DATA_OFFSET = ENGINE_OFFSET + sizeof(EngineData);
+constexpr size_t SAMPLING_OFFSET = DATA_OFFSET + sizeof(AdditionalData);
+constexpr size_t RECORD_SIZE = SAMPLING_OFFSET + sizeof(FlightDataRecorderSampling);
+
+#define AP_SM(member, format) FDR_FIELD("ap_sm", ap_sm_output, AP_SM_OFFSET, member, format)
+#define AP_LAW(member, format) FDR_FIELD("ap_law", ap_raw_output, AP_LAW_OFFSET, member, format)
+#define ATHR(member, format) FDR_FIELD("athr", athr_out, ATHR_OFFSET, member, format)
+#define ENGINE(member, format) FDR_FIELD("engine", EngineData, ENGINE_OFFSET, member, format)
+#define DATA(member, format) FDR_FIELD("data", AdditionalData, DATA_OFFSET, member, format)
+#define SAMPLING(member, format) FDR_FIELD("sampling", FlightDataRecorderSampling, SAMPLING_OFFSET, member, format)
+
+constexpr FlightDataRecorderField FIELDS[] = {
+    AP_SM(time.dt, Value),
+    AP_SM(time.simulation_time, Value),
+    AP_SM(data.aircraft_position.lat, Value),
+    AP_SM(data.aircraft_position.lon, Value),
+    AP_SM(data.aircraft_position.alt, Value),
+    AP_SM(data.Theta_deg, Value),
+    AP_SM(data.Phi_deg, Value),
+    AP_SM(data.qk_deg_s, Value),
+    AP_SM(data.rk_deg_s, Value),
+    AP_SM(data.pk_deg_s, Value),
+    AP_SM(data.V_ias_kn, Value),
+    AP_SM(data.V_tas_kn, Value),
+    AP_SM(data.V_mach, Value),
+    AP_SM(data.V_gnd_kn, Value),
+    AP_SM(data.alpha_deg, Value),
+    AP_SM(data.beta_deg, Value),
+    AP_SM(data.H_ft, Value),
+    AP_SM(data.H_ind_ft, Value),
+    AP_SM(data.H_radio_ft, Value),
+    AP_SM(data.H_dot_ft_min, Value),
+    AP_SM(data.Psi_magnetic_deg, Value),
+    AP_SM(data.Psi_magnetic_track_deg, Value),
+    AP_SM(data.Psi_true_deg, Value),
+    AP_SM(data.bx_m_s2, Value),
+    AP_SM(data.by_m_s2, Value),
+    AP_SM(data.bz_m_s2, Value),
+    AP_SM(data.nav_valid, Unsigned),
+    AP_SM(data.nav_loc_deg, Value),
+    AP_SM(data.nav_dme_valid, Unsigned),
+    AP_SM(data.nav_dme_nmi, Value),
+    AP_SM(data.nav_loc_valid, Unsigned),
+    AP_SM(data.nav_loc_magvar_deg, Value),
+    AP_SM(data.nav_loc_error_deg, Value),
+    AP_SM(data.nav_loc_position.lat, Value),
+    AP_SM(data.nav_loc_position.lon, Value),
+    AP_SM(data.nav_loc_position.alt, Value),
+    AP_SM(data.nav_e_loc_valid, Unsigned),
+    AP_SM(data.nav_e_loc_error_deg, Value),
+    AP_SM(data.nav_gs_valid, Unsigned),
+    AP_SM(data.nav_gs_error_deg, Value),
+    AP_SM(data.nav_gs_position.lat, Value),
+    AP_SM(data.nav_gs_position.lon, Value),
+    AP_SM(data.nav_gs_position.alt, Value),
+    AP_SM(data.nav_e_gs_valid, Unsigned),
+    AP_SM(data.nav_e_gs_error_deg, Value),
+    AP_SM(data.flight_guidance_xtk_nmi, Value),
+    AP_SM(data.flight_guidance_tae_deg, Value),
+    AP_SM(data.flight_guidance_phi_deg, Value),
+    AP_SM(data.flight_guidance_phi_limit_deg, Value),
+    AP_SM(data.flight_phase, Value),
+    AP_SM(data.V2_kn, Value),
+    AP_SM(data.VAPP_kn, Value),
+    AP_SM(data.VLS_kn, Value),
+    AP_SM(data.is_flight_plan_available, Unsigned),
+    AP_SM(data.altitude_constraint_ft, Value),
+    AP_SM(data.thrust_reduction_altitude, Value),
+    AP_SM(data.thrust_reduction_altitude_go_around, Value),
+    AP_SM(data.acceleration_altitude, Value),
+    AP_SM(data.acceleration_altitude_engine_out, Value),
+    AP_SM(data.acceleration_altitude_go_around, Value),
+    AP_SM(data.cruise_altitude, Value),
+    AP_SM(data.on_ground, Value),
+    AP_SM(data.zeta_deg, Value),
+    AP_SM(data.throttle_lever_1_pos, Value),
+    AP_SM(data.throttle_lever_2_pos, Value),
+    AP_SM(data.flaps_handle_index, Value),
+    AP_SM(data.total_weight_kg, Value),
+    AP_SM(data_computed.time_since_touchdown, Value),
+    AP_SM(data_computed.time_since_lift_off, Value),
+    AP_SM(data_computed.time_since_SRS, Value),
+    AP_SM(data_computed.H_fcu_in_selection, Unsigned),
+    AP_SM(data_computed.H_constraint_valid, Unsigned),
+    AP_SM(data_computed.Psi_fcu_in_selection, Unsigned),
+    AP_SM(data_computed.gs_convergent_towards_beam, Unsigned),
+    AP_SM(data_computed.V_fcu_in_selection, Unsigned),
+    AP_SM(input.FD_active, Unsigned),
+    AP_SM(input.AP_1_push, Unsigned),
+    AP_SM(input.AP_2_push, Unsigned),
+    AP_SM(input.AP_DISCONNECT_push, Unsigned),
+    AP_SM(input.HDG_push, Unsigned),
+    AP_SM(input.HDG_pull, Unsigned),
+    AP_SM(input.ALT_push, Unsigned),
+    AP_SM(input.ALT_pull, Unsigned),
+    AP_SM(input.VS_push, Unsigned),
+    AP_SM(input.VS_pull, Unsigned),
+    AP_SM(input.LOC_push, Unsigned),
+    AP_SM(input.APPR_push, Unsigned),
+    AP_SM(input.EXPED_push, Unsigned),
+    AP_SM(input.V_fcu_kn, Value),
+    AP_SM(input.Psi_fcu_deg, Value),
+    AP_SM(input.H_fcu_ft, Value),
+    AP_SM(input.H_constraint_ft, Value),
+    AP_SM(input.H_dot_fcu_fpm, Value),
+    AP_SM(input.FPA_fcu_deg, Value),
+    AP_SM(input.TRK_FPA_mode, Unsigned),
+    AP_SM(input.DIR_TO_trigger, Unsigned),
+    AP_SM(input.is_FLX_active, Unsigned),
+    AP_SM(input.Slew_trigger, Unsigned),
+    AP_SM(input.MACH_mode, Unsigned),
+    AP_SM(input.ATHR_engaged, Unsigned),
+    AP_SM(input.is_SPEED_managed, Unsigned),
+    AP_SM(input.FDR_event, Unsigned),
+    AP_SM(input.FM_requested_vertical_mode, Unsigned),
+    AP_SM(input.FM_H_c_ft, Value),
+    AP_SM(input.FM_H_dot_c_fpm, Value),
+    AP_SM(input.FM_rnav_appr_selected, Value),
+    AP_SM(input.FM_final_des_can_engage, Value),
+    AP_SM(input.TCAS_mode_available, Value),
+    AP_SM(input.TCAS_advisory_state, Value),
+    AP_SM(input.TCAS_advisory_target_min_fpm, Value),
+    AP_SM(input.TCAS_advisory_target_max_fpm, Value),
+    AP_SM(lateral.armed.NAV, Unsigned),
+    AP_SM(lateral.armed.LOC, Unsigned),
+    AP_SM(lateral.condition.NAV, Unsigned),
+    AP_SM(lateral.condition.LOC_CPT, Unsigned),
+    AP_SM(lateral.condition.LOC_TRACK, Unsigned),
+    AP_SM(lateral.condition.LAND, Unsigned),
+    AP_SM(lateral.condition.FLARE, Unsigned),
+    AP_SM(lateral.condition.ROLL_OUT, Unsigned),
+    AP_SM(lateral.condition.GA_TRACK, Unsigned),
+    AP_SM(lateral.output.mode, Value),
+    AP_SM(lateral.output.mode_reversion, Unsigned),
+    AP_SM(lateral.output.mode_reversion_TRK_FPA, Unsigned),
+    AP_SM(lateral.output.law, Value),
+    AP_SM(lateral.output.Psi_c_deg, Value),
+    AP_SM(lateral_previous.armed.NAV, Unsigned),
+    AP_SM(lateral_previous.armed.LOC, Unsigned),
+    AP_SM(lateral_previous.condition.NAV, Unsigned),
+    AP_SM(lateral_previous.condition.LOC_CPT, Unsigned),
+    AP_SM(lateral_previous.condition.LOC_TRACK, Unsigned),
+    AP_SM(lateral_previous.condition.LAND, Unsigned),
+    AP_SM(lateral_previous.condition.FLARE, Unsigned),
+    AP_SM(lateral_previous.condition.ROLL_OUT, Unsigned),
+    AP_SM(lateral_previous.condition.GA_TRACK, Unsigned),
+    AP_SM(lateral_previous.output.mode, Value),
+    AP_SM(lateral_previous.output.mode_reversion, Unsigned),
+    AP_SM(lateral_previous.output.mode_reversion_TRK_FPA, Unsigned),
+    AP_SM(lateral_previous.output.law, Value),
+    AP_SM(lateral_previous.output.Psi_c_deg, Value),
+    AP_SM(vertical.armed.ALT, Unsigned),
+    AP_SM(vertical.armed.ALT_CST, Unsigned),
+    AP_SM(vertical.armed.CLB, Unsigned),
+    AP_SM(vertical.armed.DES, Unsigned),
+    AP_SM(vertical.armed.FINAL_DES, Unsigned),
+    AP_SM(vertical.armed.GS, Unsigned),
+    AP_SM(vertical.armed.TCAS, Unsigned),
+    AP_SM(vertical.condition.ALT, Unsigned),
+    AP_SM(vertical.condition.ALT_CPT, Unsigned),
+    AP_SM(vertical.condition.ALT_CST, Unsigned),
+    AP_SM(vertical.condition.ALT_CST_CPT, Unsigned),
+    AP_SM(vertical.condition.CLB, Unsigned),
+    AP_SM(vertical.condition.DES, Unsigned),
+    AP_SM(vertical.condition.FINAL_DES, Unsigned),
+    AP_SM(vertical.condition.GS_CPT, Unsigned),
+    AP_SM(vertical.condition.GS_TRACK, Unsigned),
+    AP_SM(vertical.condition.LAND, Unsigned),
+    AP_SM(vertical.condition.FLARE, Unsigned),
+    AP_SM(vertical.condition.ROLL_OUT, Unsigned),
+    AP_SM(vertical.condition.SRS, Unsigned),
+    AP_SM(vertical.condition.SRS_GA, Unsigned),
+    AP_SM(vertical.condition.THR_RED, Unsigned),
+    AP_SM(vertical.condition.H_fcu_active, Unsigned),
+    AP_SM(vertical.condition.TCAS, Unsigned),
+    AP_SM(vertical.output.mode, Value),
+    AP_SM(vertical.output.mode_autothrust, Value),
+    AP_SM(vertical.output.mode_reversion, Unsigned),
+    AP_SM(vertical.output.law, Value),
+    AP_SM(vertical.output.H_c_ft, Value),
+    AP_SM(vertical.output.H_dot_c_fpm, Value),
+    AP_SM(vertical.output.FPA_c_deg, Value),
+    AP_SM(vertical.output.V_c_kn, Value),
+    AP_SM(vertical.output.mode_reversion_target_fpm, Value),
+    AP_SM(vertical.output.mode_reversion_TRK_FPA, Value),
+    AP_SM(vertical.output.ALT_soft_mode_active, Unsigned),
+    AP_SM(vertical.output.EXPED_mode_active, Unsigned),
+    AP_SM(vertical.output.FD_disconnect, Unsigned),
+    AP_SM(vertical.output.TCAS_sub_mode, Unsigned),
+    AP_SM(vertical.output.TCAS_sub_mode_compatible, Unsigned),
+    AP_SM(vertical.output.TCAS_message_disarm, Unsigned),
+    AP_SM(vertical.output.TCAS_message_RA_inhibit, Unsigned),
+    AP_SM(vertical.output.TCAS_message_TRK_FPA_deselection, Unsigned),
+    AP_SM(vertical_previous.armed.ALT, Unsigned),
+    AP_SM(vertical_previous.armed.ALT_CST, Unsigned),
+    AP_SM(vertical_previous.armed.CLB, Unsigned),
+    AP_SM(vertical_previous.armed.DES, Unsigned),
+    AP_SM(vertical_previous.armed.FINAL_DES, Unsigned),
+    AP_SM(vertical_previous.armed.GS, Unsigned),
+    AP_SM(vertical_previous.armed.TCAS, Unsigned),
+    AP_SM(vertical_previous.condition.ALT, Unsigned),
+    AP_SM(vertical_previous.condition.ALT_CPT, Unsigned),
+    AP_SM(vertical_previous.condition.ALT_CST, Unsigned),
+    AP_SM(vertical_previous.condition.ALT_CST_CPT, Unsigned),
+    AP_SM(vertical_previous.condition.CLB, Unsigned),
+    AP_SM(vertical_previous.condition.DES, Unsigned),
+    AP_SM(vertical_previous.condition.FINAL_DES, Unsigned),
+    AP_SM(vertical_previous.condition.GS_CPT, Unsigned),
+    AP_SM(vertical_previous.condition.GS_TRACK, Unsigned),
+    AP_SM(vertical_previous.condition.LAND, Unsigned),
+    AP_SM(vertical_previous.condition.FLARE, Unsigned),
+    AP_SM(vertical_previous.condition.ROLL_OUT, Unsigned),
+    AP_SM(vertical_previous.condition.SRS, Unsigned),
+    AP_SM(vertical_previous.condition.SRS_GA, Unsigned),
+    AP_SM(vertical_previous.condition.THR_RED, Unsigned),
+    AP_SM(vertical_previous.condition.H_fcu_active, Unsigned),
+    AP_SM(vertical_previous.condition.TCAS, Unsigned),
+    AP_SM(vertical_previous.output.mode, Value),
+    AP_SM(vertical_previous.output.mode_autothrust, Value),
+    AP_SM(vertical_previous.output.mode_reversion, Unsigned),
+    AP_SM(vertical_previous.output.law, Value),
+    AP_SM(vertical_previous.output.H_c_ft, Value),
+    AP_SM(vertical_previous.output.H_dot_c_fpm, Value),
+    AP_SM(vertical_previous.output.FPA_c_deg, Value),
+    AP_SM(vertical_previous.output.V_c_kn, Value),
+    AP_SM(vertical_previous.output.mode_reversion_target_fpm, Value),
+    AP_SM(vertical_previous.output.mode_reversion_TRK_FPA, Value),
+    AP_SM(vertical_previous.output.ALT_soft_mode_active, Unsigned),
+    AP_SM(vertical_previous.output.EXPED_mode_active, Unsigned),
+    AP_SM(vertical_previous.output.FD_disconnect, Unsigned),
+    AP_SM(vertical_previous.output.TCAS_sub_mode, Unsigned),
+    AP_SM(vertical_previous.output.TCAS_sub_mode_compatible, Unsigned),
+    AP_SM(vertical_previous.output.TCAS_message_disarm, Unsigned),
+    AP_SM(vertical_previous.output.TCAS_message_RA_inhibit, Unsigned),
+    AP_SM(vertical_previous.output.TCAS_message_TRK_FPA_deselection, Unsigned),
+    AP_SM(output.enabled_AP1, Value),
+    AP_SM(output.enabled_AP2, Value),
+    AP_SM(output.lateral_law, Value),
+    AP_SM(output.lateral_mode, Value),
+    AP_SM(output.lateral_mode_armed, Value),
+    AP_SM(output.vertical_law, Value),
+    AP_SM(output.vertical_mode, Value),
+    AP_SM(output.vertical_mode_armed, Value),
+    AP_SM(output.mode_reversion_lateral, Value),
+    AP_SM(output.mode_reversion_vertical, Value),
+    AP_SM(output.mode_reversion_vertical_target_fpm, Value),
+    AP_SM(output.mode_reversion_TRK_FPA, Unsigned),
+    AP_SM(output.mode_reversion_triple_click, Unsigned),
+    AP_SM(output.mode_reversion_fma, Unsigned),
+    AP_SM(output.speed_protection_mode, Unsigned),
+    AP_SM(output.autothrust_mode, Value),
+    AP_SM(output.Psi_c_deg, Value),
+    AP_SM(output.H_c_ft, Value),
+    AP_SM(output.H_dot_c_fpm, Value),
+    AP_SM(output.FPA_c_deg, Value),
+    AP_SM(output.V_c_kn, Value),
+    AP_SM(output.ALT_soft_mode_active, Unsigned),
+    AP_SM(output.EXPED_mode_active, Unsigned),
+    AP_SM(output.FD_disconnect, Unsigned),
+    AP_SM(output.TCAS_message_disarm, Unsigned),
+    AP_SM(output.TCAS_message_RA_inhibit, Unsigned),
+    AP_SM(output.TCAS_message_TRK_FPA_deselection, Unsigned),
+    AP_LAW(ap_on, Value),
+    AP_LAW(Phi_loc_c, Value),
+    AP_LAW(Nosewheel_c, Value),
+    AP_LAW(flight_director.Theta_c_deg, Value),
+    AP_LAW(flight_director.Phi_c_deg, Value),
+    AP_LAW(flight_director.Beta_c_deg, Value),
+    AP_LAW(autopilot.Theta_c_deg, Value),
+    AP_LAW(autopilot.Phi_c_deg, Value),
+    AP_LAW(autopilot.Beta_c_deg, Value),
+    AP_LAW(flare_law.condition_Flare, Unsigned),
+    AP_LAW(flare_law.H_dot_radio_fpm, Value),
+    AP_LAW(flare_law.H_dot_c_fpm, Value),
+    AP_LAW(flare_law.delta_Theta_H_dot_deg, Value),
+    AP_LAW(flare_law.delta_Theta_bx_deg, Value),
+    AP_LAW(flare_law.delta_Theta_bz_deg, Value),
+    AP_LAW(flare_law.delta_Theta_beta_c_deg, Value),
+    ATHR(data.nz_g, Value),
+    ATHR(data.Theta_deg, Value),
+    ATHR(data.Phi_deg, Value),
+    ATHR(data.V_ias_kn, Value),
+    ATHR(data.V_tas_kn, Value),
+    ATHR(data.V_mach, Value),
+    ATHR(data.V_gnd_kn, Value),
+    ATHR(data.alpha_deg, Value),
+    ATHR(data.H_ft, Value),
+    ATHR(data.H_ind_ft, Value),
+    ATHR(data.H_radio_ft, Value),
+    ATHR(data.H_dot_fpm, Value),
+    ATHR(data.ax_m_s2, Value),
+    ATHR(data.ay_m_s2, Value),
+    ATHR(data.az_m_s2, Value),
+    ATHR(data.bx_m_s2, Value),
+    ATHR(data.by_m_s2, Value),
+    ATHR(data.bz_m_s2, Value),
+    ATHR(data.Psi_magnetic_deg, Value),
+    ATHR(data.Psi_magnetic_track_deg, Value),
+    ATHR(data.on_ground, Unsigned),
+    ATHR(data.flap_handle_index, Value),
+    ATHR(data.is_engine_operative_1, Unsigned),
+    ATHR(data.is_engine_operative_2, Unsigned),
+    ATHR(data.commanded_engine_N1_1_percent, Value),
+    ATHR(data.commanded_engine_N1_2_percent, Value),
+    ATHR(data.engine_N1_1_percent, Value),
+    ATHR(data.engine_N1_2_percent, Value),
+    ATHR(data.TAT_degC, Value),
+    ATHR(data.OAT_degC, Value),
+    ATHR(data.ISA_degC, Value),
+    ATHR(data.ambient_density_kg_per_m3, Value),
+    ATHR(data_computed.TLA_in_active_range, Unsigned),
+    ATHR(data_computed.is_FLX_active, Unsigned),
+    ATHR(data_computed.ATHR_push, Unsigned),
+    ATHR(data_computed.ATHR_disabled, Unsigned),
+    ATHR(data_computed.time_since_touchdown, Value),
+    ATHR(data_computed.alpha_floor_inhibited, Unsigned),
+    ATHR(input.ATHR_push, Unsigned),
+    ATHR(input.ATHR_disconnect, Unsigned),
+    ATHR(input.is_TCAS_active, Unsigned),
+    ATHR(input.target_TCAS_RA_rate_fpm, Value),
+    ATHR(input.TLA_1_deg, Value),
+    ATHR(input.TLA_2_deg, Value),
+    ATHR(input.V_c_kn, Value),
+    ATHR(input.V_LS_kn, Value),
+    ATHR(input.V_MAX_kn, Value),
+    ATHR(input.thrust_limit_REV_percent, Value),
+    ATHR(input.thrust_limit_IDLE_percent, Value),
+    ATHR(input.thrust_limit_CLB_percent, Value),
+    ATHR(input.thrust_limit_MCT_percent, Value),
+    ATHR(input.thrust_limit_FLEX_percent, Value),
+    ATHR(input.thrust_limit_TOGA_percent, Value),
+    ATHR(input.flex_temperature_degC, Value),
+    ATHR(input.mode_requested, Value),
+    ATHR(input.is_mach_mode_active, Unsigned),
+    ATHR(input.alpha_floor_condition, Unsigned),
+    ATHR(input.is_approach_mode_active, Unsigned),
+    ATHR(input.is_SRS_TO_mode_active, Unsigned),
+    ATHR(input.is_SRS_GA_mode_active, Unsigned),
+    ATHR(input.thrust_reduction_altitude, Value),
+    ATHR(input.thrust_reduction_altitude_go_around, Value),
+    ATHR(input.is_anti_ice_wing_active, Unsigned),
+    ATHR(input.is_anti_ice_engine_1_active, Unsigned),
+    ATHR(input.is_anti_ice_engine_2_active, Unsigned),
+    ATHR(input.is_air_conditioning_1_active, Unsigned),
+    ATHR(input.is_air_conditioning_2_active, Unsigned),
+    ATHR(input.FD_active, Unsigned),
+    ATHR(input.ATHR_reset_disable, Unsigned),
+    ATHR(output.sim_throttle_lever_1_pos, Value),
+    ATHR(output.sim_throttle_lever_2_pos, Value),
+    ATHR(output.sim_thrust_mode_1, Value),
+    ATHR(output.sim_thrust_mode_2, Value),
+    ATHR(output.N1_TLA_1_percent, Value),
+    ATHR(output.N1_TLA_2_percent, Value),
+    ATHR(output.is_in_reverse_1, Unsigned),
+    ATHR(output.is_in_reverse_2, Unsigned),
+    ATHR(output.thrust_limit_type, Value),
+    ATHR(output.thrust_limit_percent, Value),
+    ATHR(output.N1_c_1_percent, Value),
+    ATHR(output.N1_c_2_percent, Value),
+    ATHR(output.status, Value),
+    ATHR(output.mode, Value),
+    ATHR(output.mode_message, Value),
+    ATHR(output.thrust_lever_warning_flex, Unsigned),
+    ATHR(output.thrust_lever_warning_toga, Unsigned),
+    ENGINE(simOnGround, Value),
+    ENGINE(generalEngineElapsedTime_1, Value),
+    ENGINE(generalEngineElapsedTime_2, Value),
+    ENGINE(standardAtmTemperature, Value),
+    ENGINE(turbineEngineCorrectedFuelFlow_1, Value),
+    ENGINE(turbineEngineCorrectedFuelFlow_2, Value),
+    ENGINE(fuelTankCapacityAuxLeft, Value),
+    ENGINE(fuelTankCapacityAuxRight, Value),
+    ENGINE(fuelTankCapacityMainLeft, Value),
+    ENGINE(fuelTankCapacityMainRight, Value),
+    ENGINE(fuelTankCapacityCenter, Value),
+    ENGINE(fuelTankQuantityAuxLeft, Value),
+    ENGINE(fuelTankQuantityAuxRight, Value),
+    ENGINE(fuelTankQuantityMainLeft, Value),
+    ENGINE(fuelTankQuantityMainRight, Value),
+    ENGINE(fuelTankQuantityCenter, Value),
+    ENGINE(fuelTankQuantityTotal, Value),
+    ENGINE(fuelWeightPerGallon, Value),
+    ENGINE(engineEngine1N2, Value),
+    ENGINE(engineEngine2N2, Value),
+    ENGINE(engineEngine1N1, Value),
+    ENGINE(engineEngine2N1, Value),
+    ENGINE(engineEngineIdleN1, Value),
+    ENGINE(engineEngineIdleN2, Value),
+    ENGINE(engineEngineIdleFF, Value),
+    ENGINE(engineEngineIdleEGT, Value),
+    ENGINE(engineEngine1EGT, Value),
+    ENGINE(engineEngine2EGT, Value),
+    ENGINE(engineEngine1Oil, Value),
+    ENGINE(engineEngine2Oil, Value),
+    ENGINE(engineEngine1OilTotal, Value),
+    ENGINE(engineEngine2OilTotal, Value),
+    ENGINE(engineEngine1VibN1, Value),
+    ENGINE(engineEngine2VibN1, Value),
+    ENGINE(engineEngine1VibN2, Value),
+    ENGINE(engineEngine2VibN2, Value),
+    ENGINE(engineEngineOilTemperature_1, Value),
+    ENGINE(engineEngineOilTemperature_2, Value),
+    ENGINE(engineEngineOilPressure_1, Value),
+    ENGINE(engineEngineOilPressure_2, Value),
+    ENGINE(engineEngine1FF, Value),
+    ENGINE(engineEngine2FF, Value),
+    ENGINE(engineEngine1PreFF, Value),
+    ENGINE(engineEngine2PreFF, Value),
+    ENGINE(engineEngineImbalance, Value),
+    ENGINE(engineFuelUsedLeft, Value),
+    ENGINE(engineFuelUsedRight, Value),
+    ENGINE(engineFuelLeftPre, Value),
+    ENGINE(engineFuelRightPre, Value),
+    ENGINE(engineFuelAuxLeftPre, Value),
+    ENGINE(engineFuelAuxRightPre, Value),
+    ENGINE(engineFuelCenterPre, Value),
+    ENGINE(engineEngineCycleTime, Value),
+    ENGINE(engineEngine1State, Value),
+    ENGINE(engineEngine2State, Value),
+    ENGINE(engineEngine1Timer, Value),
+    ENGINE(engineEngine2Timer, Value),
+    DATA(master_warning_active, Value),
+    DATA(master_caution_active, Value),
+    DATA(park_brake_lever_pos, Value),
+    DATA(brake_pedal_left_pos, Value),
+    DATA(brake_pedal_right_pos, Value),
+    DATA(brake_left_sim_pos, Value),
+    DATA(brake_right_sim_pos, Value),
+    DATA(autobrake_armed_mode, Value),
+    DATA(autobrake_decel_light, Value),
+    DATA(spoilers_handle_pos, Value),
+    DATA(spoilers_armed, Value),
+    DATA(spoilers_handle_sim_pos, Value),
+    DATA(ground_spoilers_active, Value),
+    DATA(flaps_handle_percent, Value),
+    DATA(flaps_handle_index, Value),
+    DATA(flaps_handle_configuration_index, Value),
+    DATA(flaps_handle_sim_index, Value),
+    DATA(gear_handle_pos, Value),
+    DATA(hydraulic_green_pressure, Value),
+    DATA(hydraulic_blue_pressure, Value),
+    DATA(hydraulic_yellow_pressure, Value),
+    DATA(throttle_lever_1_pos, Value),
+    DATA(throttle_lever_2_pos, Value),
+    DATA(corrected_engine_N1_1_percent, Value),
+    DATA(corrected_engine_N1_2_percent, Value),
+    DATA(assistanceTakeoffEnabled, Unsigned),
+    DATA(assistanceLandingEnabled, Unsigned),
+    DATA(aiAutoTrimActive, Unsigned),
+    DATA(aiControlsActive, Unsigned),
+    DATA(realisticTillerEnabled, Value),
+    DATA(tillerHandlePosition, Value),
+    DATA(noseWheelPosition, Value),
+    DATA(syncFoEfisEnabled, Value),
+    DATA(ls1Active, Value),
+    DATA(ls2Active, Value),
+    DATA(IsisLsActive, Value),
+    DATA(wingAntiIce, Value),
+    // controller input data
+    DATA(inputElevator, Value),
+    DATA(inputAileron, Value),
+    DATA(inputRudder, Value),
+    // additional sim data
+    DATA(simulation_rate, Value),
+    DATA(wasPaused, Value),
+    DATA(slew_on, Value),
+    // ambient data
+    DATA(ice_structure_percent, Value),
+    DATA(ambient_pressure_mbar, Value),
+    DATA(ambient_wind_velocity_kn, Value),
+    DATA(ambient_wind_direction_deg, Value),
+    DATA(total_air_temperature_celsius, Value),
+    // failure
+    DATA(failuresActive, Value),
+    // a.floor
+    DATA(alpha_floor_condition, Value),
+    // high aoa protection
+    DATA(high_aoa_protection, Value),
+    // sampling
+    SAMPLING(rate_hz, Value),
+    SAMPLING(triggers, Unsigned),
+};
+
+#undef AP_SM
+#undef AP_LAW
+#undef ATHR
+#undef ENGINE
+#undef DATA
+#undef SAMPLING
+
+static_assert(flightDataRecorderFieldsFit(FIELDS, RECORD_SIZE), "field outside of the record");
+
+constexpr auto V25_FIELDS = firstFlightDataRecorderFields<std::size(FIELDS) - 2>(FIELDS);
+static_assert(flightDataRecorderFieldsFit(V25_FIELDS, SAMPLING_OFFSET), "field outside of the record");
+
+}  // namespace
+
+extern const FlightDataRecorderSchema A32NX_V26_SCHEMA = {
+    "A32NX", 26, RECORD_SIZE, FIELDS, &formatFlightDataRecorderRecord<FIELDS>, &decodeFlightDataRecorderRecord<FIELDS>,
+};
+
+extern const FlightDataRecorderSchema A32NX_V25_SCHEMA = {
+    "A32NX", 25, SAMPLING_OFFSET, V25_FIELDS, &formatFlightDataRecorderRecord<V25_FIELDS>, &decodeFlightDataRecorderRecord<V25_FIELDS>,
+};
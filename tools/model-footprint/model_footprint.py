@@ -0,0 +1,282 @@
+"""
+Reports the memory footprint of the generated Simulink models.
+
+The layout of every model class and of the structs it is composed of is computed from the generated headers with the
+alignment rules of the target, so no build of the models is required. Besides the size of each instance the report
+shows the padding, the number of booleans and enumerations and an estimate of the size with a compact layout where
+booleans are packed into bits, enumerations are narrowed to the smallest integer holding their values and the fields
+are ordered by alignment with the nested structs flattened.
+
+The models shared by both aircraft are generated into fbw-common/src/wasm/fbw_common/src/model, this directory is read
+together with the given directories unless --no-common is set.
+
+usage: python model_footprint.py <model directory> ... [--no-common] [--target wasm32|x86_64] [--structs]
+                                 [--instances Model=N ...]
+
+e.g. python model_footprint.py fbw-a32nx/src/wasm/fbw_a320/src/model
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+TARGETS = {
+    # size and alignment of the types in rtwtypes.h and the C++ types used by the generated code
+    'wasm32': {'pointer': 4, 'long': 4},
+    'x86_64': {'pointer': 8, 'long': 8},
+}
+
+CACHE_LINE = 64
+
+COMMON_MODEL_DIRECTORY = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'fbw-common', 'src', 'wasm',
+                                      'fbw_common', 'src', 'model')
+
+
+def primitive_types(target):
+    long_size = TARGETS[target]['long']
+    pointer_size = TARGETS[target]['pointer']
+    types = {
+        'int8_T': 1, 'uint8_T': 1, 'boolean_T': 1, 'char_T': 1, 'uchar_T': 1, 'byte_T': 1, 'bool': 1,
+        'int16_T': 2, 'uint16_T': 2,
+        'int32_T': 4, 'uint32_T': 4, 'int_T': 4, 'uint_T': 4, 'real32_T': 4, 'int': 4, 'float': 4,
+        'real_T': 8, 'real64_T': 8, 'time_T': 8, 'double': 8,
+        'ulong_T': long_size, 'pointer_T': pointer_size,
+    }
+    return {name: (size, size) for name, size in types.items()}
+
+
+class Field:
+    def __init__(self, type_name, name, count):
+        self.type_name = type_name
+        self.name = name
+        self.count = count
+
+
+class Layout:
+    def __init__(self, size, alignment, padding, booleans, enums, compact_bytes, compact_alignment):
+        self.size = size
+        self.alignment = alignment
+        self.padding = padding
+        self.booleans = booleans
+        self.enums = enums
+        # bytes of all fields which are not booleans in the compact layout, the booleans take a bit each
+        self.compact_bytes = compact_bytes
+        self.compact_alignment = compact_alignment
+
+    @property
+    def compact_size(self):
+        size = self.compact_bytes + math.ceil(self.booleans / 8)
+        return max(1, math.ceil(size / self.compact_alignment) * self.compact_alignment)
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def header_paths(directories):
+    paths = []
+    for directory in directories:
+        paths += [os.path.join(directory, name) for name in sorted(os.listdir(directory)) if name.endswith('.h')]
+    return paths
+
+
+def parse_headers(directories):
+    structs = {}
+    enums = {}
+    classes = {}
+
+    field_pattern = re.compile(r'^\s*(?:const\s+)?([A-Za-z_][\w:]*)\s+([A-Za-z_]\w*)((?:\[\d+\])*)\s*;\s*$')
+
+    for path in header_paths(directories):
+        with open(path) as file:
+            text = strip_comments(file.read())
+
+        for match in re.finditer(r'enum\s+class\s+(\w+)\s*:\s*\w+\s*\{(.*?)\}', text, flags=re.S):
+            enums[match.group(1)] = len([value for value in match.group(2).split(',') if value.strip()])
+        for match in re.finditer(r'typedef\s+enum\s*\{(.*?)\}\s*(\w+)\s*;', text, flags=re.S):
+            enums[match.group(2)] = len([value for value in match.group(1).split(',') if value.strip()])
+
+        # structs and classes are parsed line by line to keep track of the nesting, bodies of inline functions are skipped
+        stack = []
+        body_depth = 0
+        for line in text.splitlines():
+            if body_depth > 0:
+                body_depth += line.count('{') - line.count('}')
+                continue
+            if stack and stack[-1][3] and ('(' in line or line.strip() == '{') and '{' in line:
+                body_depth = line.count('{') - line.count('}')
+                continue
+
+            class_match = re.match(r'^\s*class\s+(\w+)(?:\s+final)?\s*$', line)
+            struct_match = re.match(r'^\s*struct\s+(\w+)\s*\{?\s*$', line)
+            if class_match:
+                stack.append(('class', class_match.group(1), [], line.count('{') > 0))
+                continue
+            if struct_match:
+                stack.append(('struct', struct_match.group(1), [], '{' in line))
+                continue
+            if not stack:
+                continue
+
+            kind, name, fields, opened = stack[-1]
+            if not opened:
+                if '{' in line:
+                    stack[-1] = (kind, name, fields, True)
+                continue
+
+            if re.match(r'^\s*\}\s*;', line):
+                stack.pop()
+                if kind == 'struct':
+                    structs[name] = fields
+                else:
+                    classes[name] = fields
+                continue
+
+            if re.match(r'^\s*static\b', line) or '(' in line or ')' in line:
+                continue
+            field_match = field_pattern.match(line)
+            if field_match:
+                count = 1
+                for dimension in re.findall(r'\[(\d+)\]', field_match.group(3)):
+                    count *= int(dimension)
+                type_name = field_match.group(1).split('::')[-1]
+                fields.append(Field(type_name, field_match.group(2), count))
+
+    return structs, enums, classes
+
+
+class LayoutCalculator:
+    def __init__(self, structs, enums, classes, target):
+        self.structs = structs
+        self.enums = enums
+        self.classes = classes
+        self.primitives = primitive_types(target)
+        self.cache = {}
+
+    def compact_enum_size(self, name):
+        values = self.enums[name]
+        return 1 if values <= 256 else 2 if values <= 65536 else 4
+
+    def layout(self, type_name):
+        if type_name in self.cache:
+            return self.cache[type_name]
+
+        if type_name in self.primitives:
+            size, alignment = self.primitives[type_name]
+            if type_name in ('boolean_T', 'bool'):
+                result = Layout(size, alignment, 0, 1, 0, 0, 1)
+            else:
+                result = Layout(size, alignment, 0, 0, 0, size, alignment)
+        elif type_name in self.enums:
+            compact_size = self.compact_enum_size(type_name)
+            result = Layout(4, 4, 0, 0, 1, compact_size, compact_size)
+        elif type_name in self.structs or type_name in self.classes:
+            fields = self.structs.get(type_name, self.classes.get(type_name))
+            result = self.aggregate(fields)
+        else:
+            raise KeyError(f'unknown type {type_name}')
+
+        self.cache[type_name] = result
+        return result
+
+    def aggregate(self, fields):
+        offset = 0
+        alignment = 1
+        padding = 0
+        booleans = 0
+        enums = 0
+        compact_bytes = 0
+        compact_alignment = 1
+
+        for field in fields:
+            layout = self.layout(field.type_name)
+            aligned = math.ceil(offset / layout.alignment) * layout.alignment
+            padding += aligned - offset + layout.padding * field.count
+            offset = aligned + layout.size * field.count
+            alignment = max(alignment, layout.alignment)
+            booleans += layout.booleans * field.count
+            enums += layout.enums * field.count
+            compact_bytes += layout.compact_bytes * field.count
+            compact_alignment = max(compact_alignment, layout.compact_alignment)
+
+        size = math.ceil(offset / alignment) * alignment if offset > 0 else 1
+        padding += size - offset
+
+        # the compact layout flattens the nested structs and orders the fields by alignment, which leaves no padding
+        return Layout(size, alignment, padding, booleans, enums, compact_bytes, compact_alignment)
+
+
+def format_row(name, layout, count=1):
+    return (f'{name:<56} {layout.size * count:>9} {math.ceil(layout.size / CACHE_LINE) * count:>6} '
+            f'{layout.padding * count:>8} {layout.booleans * count:>6} {layout.enums * count:>6} '
+            f'{layout.compact_size * count:>9}')
+
+
+def print_header(title):
+    print(title)
+    print(f'{"":<56} {"bytes":>9} {"lines":>6} {"padding":>8} {"bools":>6} {"enums":>6} {"compact":>9}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Reports the memory footprint of the generated Simulink models.')
+    parser.add_argument('directories', nargs='+', metavar='directory',
+                        help='directories containing the generated model sources')
+    parser.add_argument('--no-common', action='store_true', help='do not read the models shared by both aircraft')
+    parser.add_argument('--target', choices=sorted(TARGETS.keys()), default='wasm32', help='target of the layout')
+    parser.add_argument('--structs', action='store_true', help='list all structs instead of only the model members')
+    parser.add_argument('--instances', nargs='*', default=[], metavar='MODEL=N',
+                        help='number of instances of a model used to compute the total, e.g. A380PrimComputer=3')
+    arguments = parser.parse_args()
+
+    directories = []
+    for directory in arguments.directories + ([] if arguments.no_common else [COMMON_MODEL_DIRECTORY]):
+        if not any(os.path.samefile(directory, known) for known in directories):
+            directories.append(os.path.relpath(directory))
+
+    structs, enums, classes = parse_headers(directories)
+    calculator = LayoutCalculator(structs, enums, classes, arguments.target)
+
+    instances = {}
+    for instance in arguments.instances:
+        name, _, count = instance.partition('=')
+        instances[name] = int(count)
+
+    # models are the classes holding the external inputs of a model, the others are helpers of the generated code
+    models = sorted(name for name, fields in classes.items()
+                    if any(field.type_name.startswith('ExternalInputs_') for field in fields))
+
+    print(f'models of {", ".join(directories)}')
+    print(f'target {arguments.target}, {CACHE_LINE} byte cache lines, compact = packed booleans, narrowed enums, '
+          f'fields ordered by alignment')
+    print()
+
+    total = 0
+    compact_total = 0
+    for model in models:
+        layout = calculator.layout(model)
+        count = instances.get(model, 1)
+        total += layout.size * count
+        compact_total += layout.compact_size * count
+
+        print_header(f'{model} ({count} instance{"s" if count != 1 else ""})')
+        print(format_row('instance', layout))
+        for field in classes[model]:
+            field_layout = calculator.layout(field.type_name)
+            print(format_row(f'  {field.name} ({field.type_name})', field_layout, field.count))
+        print()
+
+    if arguments.structs:
+        print_header('structs')
+        for name in sorted(structs.keys()):
+            print(format_row(name, calculator.layout(name)))
+        print()
+
+    print(f'total {total} bytes, compact {compact_total} bytes')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
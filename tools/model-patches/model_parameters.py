@@ -0,0 +1,126 @@
+"""
+Makes the parameters of the generated models constant unless FBW_TUNABLE_MODEL_PARAMETERS is defined.
+
+Every generated model keeps its gains, breakpoints and limits in a static Parameters_<Model>_T member, which the code
+generator declares mutable. This patch has to be applied after every code generation of a model: it prefixes the
+declaration in the header of the model and the definition in its source (<Model>_data.cpp or <Model>.cpp, whichever
+defines them) with RT_PARAMETERS_CONST. Given rtwtypes.h, it adds the definition of RT_PARAMETERS_CONST, const by
+default and empty with FBW_TUNABLE_MODEL_PARAMETERS. The headers get a note that they are patched.
+
+The patch is idempotent, already patched files are left unchanged. With --check nothing is written and the exit code is
+1 when a file is not patched.
+
+usage: python model_parameters.py <generated model header or rtwtypes.h> ... [--check]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+HEADER_NOTE = ('// the parameters are made constant by tools/model-patches/model_parameters.py after the code '
+               'generation, apply it again after regenerating')
+
+DECLARATION = re.compile(r'^  static (Parameters_\w+_T \w+;)$', re.MULTILINE)
+# the code generator may break the line after the class of the definition
+DEFINITION = re.compile(r'^(\w+::Parameters_\w+_T \w+::)', re.MULTILINE)
+PATCHED_DEFINITION = re.compile(r'^RT_PARAMETERS_CONST \w+::Parameters_', re.MULTILINE)
+
+RTWTYPES = 'rtwtypes.h'
+DEFINE = '''// Model parameters are constant so that they can be folded into the model code. Define
+// FBW_TUNABLE_MODEL_PARAMETERS to keep them mutable, e.g. to tune them at runtime during development.
+#ifdef FBW_TUNABLE_MODEL_PARAMETERS
+#define RT_PARAMETERS_CONST
+#else
+#define RT_PARAMETERS_CONST            const
+#endif
+
+'''
+
+
+def add_note(text):
+    if HEADER_NOTE in text:
+        return text
+    return HEADER_NOTE + '\n' + text
+
+
+def patch_rtwtypes(text, path):
+    text = add_note(text)
+    if '#define RT_PARAMETERS_CONST' in text:
+        return text
+    # the definition goes before the #endif of the include guard
+    end = text.rfind('#endif')
+    if end < 0:
+        raise ValueError(f'{path}: end of the include guard not found')
+    return text[:end] + DEFINE + text[end:]
+
+
+def patch_header(text, path):
+    if DECLARATION.search(text) is None and 'static RT_PARAMETERS_CONST Parameters_' not in text:
+        raise ValueError(f'{path}: no parameters declared')
+    return add_note(DECLARATION.sub(r'  static RT_PARAMETERS_CONST \1', text))
+
+
+def patch_source(text, path):
+    if DEFINITION.search(text) is None and PATCHED_DEFINITION.search(text) is None:
+        raise ValueError(f'{path}: no parameters defined')
+    return DEFINITION.sub(r'RT_PARAMETERS_CONST \1', text)
+
+
+def defines_parameters(path):
+    if not os.path.exists(path):
+        return False
+    with open(path, newline='') as file:
+        text = file.read()
+    return DEFINITION.search(text) is not None or PATCHED_DEFINITION.search(text) is not None
+
+
+def source_of(header_path):
+    # the computers, the autopilot and the autothrust define their parameters in a separate source, the laws have a
+    # <Model>_data.cpp as well but define their parameters in <Model>.cpp
+    base = os.path.splitext(header_path)[0]
+    data_path = base + '_data.cpp'
+    return data_path if defines_parameters(data_path) else base + '.cpp'
+
+
+def patch_file(path, patch, check):
+    with open(path, newline='') as file:
+        text = file.read()
+    patched = patch(text, path)
+    if patched == text:
+        return False
+    if not check:
+        with open(path, 'w', newline='') as file:
+            file.write(patched)
+    return True
+
+
+def process(path, check):
+    if os.path.basename(path) == RTWTYPES:
+        patches = [(path, patch_rtwtypes)]
+    else:
+        patches = [(path, patch_header), (source_of(path), patch_source)]
+    return [file_path for file_path, patch in patches if patch_file(file_path, patch, check)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Makes the parameters of generated models constant')
+    parser.add_argument('headers', nargs='+', help='generated model headers, e.g. ElacComputer.h, and rtwtypes.h')
+    parser.add_argument('--check', action='store_true', help='only report files which are not patched')
+    args = parser.parse_args()
+
+    unpatched = []
+    for path in args.headers:
+        try:
+            changed = process(path, args.check)
+        except (OSError, ValueError) as error:
+            print(f'error: {error}', file=sys.stderr)
+            return 2
+        for file_path in changed:
+            print(f'{"not patched" if args.check else "patched"}: {file_path}')
+        unpatched += changed
+    return 1 if args.check and unpatched else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
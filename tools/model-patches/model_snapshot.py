@@ -0,0 +1,114 @@
+"""
+Adds the snapshot of their state to the classes of the generated models.
+
+A snapshot of a model is a trivially copyable Snapshot_<Model>_T struct with the external inputs, the external outputs,
+the block IO and the DWork of the model, followed by the snapshots of the referenced models (the LawMDLOBJ members of
+the computers). saveSnapshot() and restoreSnapshot() copy the state into and out of it. The computer wrappers, e.g.
+Elac, build their snapshots on these, see ModelSnapshot.h. This patch has to be applied after every code generation
+of a model with a snapshot: the struct is inserted before the deleted copy constructor and the methods before the
+constructor of the model class. The header gets a note that it is patched.
+
+The members are read from the header of the model, so regenerated models with other state are covered as well. A
+referenced model needs to be patched too, its snapshot is part of the snapshot of the referencing model.
+
+The patch is idempotent, already patched headers are left unchanged. With --check nothing is written and the exit code
+is 1 when a header is not patched.
+
+usage: python model_snapshot.py <generated model header> ... [--check]
+"""
+
+import argparse
+import re
+import sys
+
+HEADER_NOTE = ('// the snapshot is added by tools/model-patches/model_snapshot.py after the code generation, '
+               'apply it again after regenerating')
+
+CLASS = re.compile(r'^class (\w+)', re.MULTILINE)
+# the state of the model is declared with two spaces of indentation in the private section of the class
+STATE = re.compile(r'^  (ExternalInputs|ExternalOutputs|BlockIO|D_Work)_(\w+)_T (\w+);$', re.MULTILINE)
+REFERENCED_MODEL = re.compile(r'^  (\w+) (\w*MDLOBJ\d+);$', re.MULTILINE)
+SNAPSHOT_FIELDS = {'ExternalInputs': 'U', 'ExternalOutputs': 'Y', 'BlockIO': 'B', 'D_Work': 'DWork'}
+
+
+def create_snapshot(text, path):
+    class_match = CLASS.search(text)
+    if class_match is None:
+        raise ValueError(f'{path}: no class found')
+    class_name = class_match.group(1)
+
+    states = STATE.findall(text)
+    if not states:
+        raise ValueError(f'{path}: no state of the model found')
+    model = states[0][1]
+    referenced_models = REFERENCED_MODEL.findall(text)
+
+    struct = [f'  struct Snapshot_{model}_T {{']
+    struct += [f'    {kind}_{model}_T {SNAPSHOT_FIELDS[kind]};' for kind, _, _ in states]
+    struct += [f'    {type_name}::Snapshot_{type_name}_T {name};' for type_name, name in referenced_models]
+    struct += ['  };', '', '']
+
+    save = [f'  void saveSnapshot(Snapshot_{model}_T *pSnapshot) const', '  {']
+    save += [f'    pSnapshot->{SNAPSHOT_FIELDS[kind]} = {member};' for kind, _, member in states]
+    save += [f'    {name}.saveSnapshot(&pSnapshot->{name});' for _, name in referenced_models]
+    save += ['  }', '']
+
+    restore = [f'  void restoreSnapshot(const Snapshot_{model}_T *pSnapshot)', '  {']
+    restore += [f'    {member} = pSnapshot->{SNAPSHOT_FIELDS[kind]};' for kind, _, member in states]
+    restore += [f'    {name}.restoreSnapshot(&pSnapshot->{name});' for _, name in referenced_models]
+    restore += ['  }', '', '']
+
+    return class_name, '\n'.join(struct), '\n'.join(save + restore)
+
+
+def patch_header(text, path):
+    if HEADER_NOTE not in text:
+        text = HEADER_NOTE + '\n' + text
+    if 'struct Snapshot_' in text:
+        return text
+
+    class_name, struct, methods = create_snapshot(text, path)
+    copy_constructor = re.search(r'^  ' + class_name + r'\(' + class_name + r' const&\)', text, re.MULTILINE)
+    if copy_constructor is None:
+        raise ValueError(f'{path}: deleted copy constructor of {class_name} not found')
+    text = text[:copy_constructor.start()] + struct + text[copy_constructor.start():]
+
+    constructor = re.search(r'^  ' + class_name + r'\(\);$', text, re.MULTILINE)
+    if constructor is None:
+        raise ValueError(f'{path}: constructor of {class_name} not found')
+    return text[:constructor.start()] + methods + text[constructor.start():]
+
+
+def process(path, check):
+    with open(path, newline='') as file:
+        text = file.read()
+    patched = patch_header(text, path)
+    if patched == text:
+        return False
+    if not check:
+        with open(path, 'w', newline='') as file:
+            file.write(patched)
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Adds the snapshot of their state to the classes of generated models')
+    parser.add_argument('headers', nargs='+', help='generated model headers, e.g. ElacComputer.h')
+    parser.add_argument('--check', action='store_true', help='only report headers which are not patched')
+    args = parser.parse_args()
+
+    unpatched = []
+    for path in args.headers:
+        try:
+            changed = process(path, args.check)
+        except (OSError, ValueError) as error:
+            print(f'error: {error}', file=sys.stderr)
+            return 2
+        if changed:
+            print(f'{"not patched" if args.check else "patched"}: {path}')
+            unpatched.append(path)
+    return 1 if args.check and unpatched else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
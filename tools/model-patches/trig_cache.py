@@ -0,0 +1,138 @@
+"""
+Routes the trigonometric functions of the generated autopilot models through a TrigCache.
+
+The step of AutopilotLaws and AutopilotStateMachine evaluates sine, cosine, tangent, arc tangent and arc sine of the
+same few angles many times. This patch has to be applied after every code generation of these models: it includes
+TrigCache.h, declares a TrigCache for the duration of the step and replaces the calls to std::sin, std::cos,
+std::tan, std::atan and std::asin within step() by the cache. Functions other than step() and std::atan2 are left
+unchanged. The header of the model gets a note that the source is patched.
+
+Sine and cosine whose argument is computed from the positions of the aircraft and the navaids in the call itself are
+routed to the guidance functions of the cache, which are evaluated with the approximations of FastTrig.h when the
+module is built with --fast-trig. These are the terms of the great circle distances to the localizer and the glide
+slope transmitters (haversine of the latitude and longitude differences and cosine of the latitudes). All other terms,
+among them the attitude transformations of pitch and bank, the track and heading terms of the lateral laws and the
+bearings to the navaids, keep the library functions.
+
+The patch is idempotent, already patched sources are left unchanged. With --check nothing is written and the exit code
+is 1 when a source is not patched.
+
+usage: python trig_cache.py <generated source> ... [--check]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+INCLUDE = '#include "TrigCache.h"'
+DECLARATION = '  TrigCache trigCache;'
+HEADER_NOTE = ('// step() is patched by tools/model-patches/trig_cache.py after the code generation, '
+               'apply it again after regenerating')
+
+FUNCTIONS = ('sin', 'cos', 'tan', 'atan', 'asin')
+# the generated code may break the line between the function and its arguments
+CALL = re.compile(r'std::(' + '|'.join(FUNCTIONS) + r')(?=\s*\()')
+CACHED_CALL = re.compile(r'trigCache\.(sin|cos)(?=\s*\()')
+GUIDANCE_FUNCTIONS = {'sin': 'guidanceSin', 'cos': 'guidanceCos'}
+# the positions of the aircraft and of the navaids are the inputs ending in _position
+GUIDANCE_ARGUMENT = re.compile(r'_position\.(lat|lon)\b')
+STEP = re.compile(r'^void \w+ModelClass::step\(\)\n\{\n', re.MULTILINE)
+# the cache is declared after the last declaration the code generator puts before the blank line of the step
+LAST_DECLARATION = '  boolean_T guard1{ false };\n'
+
+
+def argument_of(text, start):
+    # text of the parenthesized argument starting at the first opening parenthesis after start
+    position = text.index('(', start)
+    depth = 0
+    for end in range(position, len(text)):
+        if text[end] == '(':
+            depth += 1
+        elif text[end] == ')':
+            depth -= 1
+            if depth == 0:
+                return text[position + 1:end]
+    raise ValueError('unbalanced parentheses')
+
+
+def route_guidance_terms(body):
+    parts = []
+    last = 0
+    for call in CACHED_CALL.finditer(body):
+        if GUIDANCE_ARGUMENT.search(argument_of(body, call.end())):
+            parts.append(body[last:call.start()] + 'trigCache.' + GUIDANCE_FUNCTIONS[call.group(1)])
+            last = call.end()
+    return ''.join(parts) + body[last:]
+
+
+def patch_source(text, path):
+    # include the cache after the includes of the model
+    if INCLUDE not in text:
+        includes = list(re.finditer(r'^#include .*\n', text, re.MULTILINE))
+        if not includes:
+            raise ValueError(f'{path}: no includes found')
+        end = includes[-1].end()
+        text = text[:end] + INCLUDE + '\n' + text[end:]
+
+    step = STEP.search(text)
+    if step is None:
+        raise ValueError(f'{path}: no step() found')
+    # the body of the step ends with the first closing brace in the first column
+    body_end = text.find('\n}\n', step.end())
+    if body_end < 0:
+        raise ValueError(f'{path}: end of step() not found')
+    body = text[step.end():body_end + 1]
+
+    if DECLARATION not in body:
+        position = body.find(LAST_DECLARATION)
+        position = 0 if position < 0 else position + len(LAST_DECLARATION)
+        body = body[:position] + DECLARATION + '\n' + body[position:]
+    body = route_guidance_terms(CALL.sub(r'trigCache.\1', body))
+
+    return text[:step.end()] + body + text[body_end + 1:]
+
+
+def patch_header(text):
+    if HEADER_NOTE in text:
+        return text
+    return HEADER_NOTE + '\n' + text
+
+
+def process(path, check):
+    header_path = os.path.splitext(path)[0] + '.h'
+    changed = []
+    for file_path, patch in ((path, lambda text: patch_source(text, path)), (header_path, patch_header)):
+        with open(file_path, newline='') as file:
+            text = file.read()
+        patched = patch(text)
+        if patched == text:
+            continue
+        changed.append(file_path)
+        if not check:
+            with open(file_path, 'w', newline='') as file:
+                file.write(patched)
+    return changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Routes the trigonometric functions of generated models through a TrigCache')
+    parser.add_argument('sources', nargs='+', help='generated model sources, e.g. AutopilotLaws.cpp')
+    parser.add_argument('--check', action='store_true', help='only report sources which are not patched')
+    args = parser.parse_args()
+
+    unpatched = []
+    for path in args.sources:
+        try:
+            changed = process(path, args.check)
+        except (OSError, ValueError) as error:
+            print(f'error: {error}', file=sys.stderr)
+            return 2
+        for file_path in changed:
+            print(f'{"not patched" if args.check else "patched"}: {file_path}')
+        unpatched += changed
+    return 1 if args.check and unpatched else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())